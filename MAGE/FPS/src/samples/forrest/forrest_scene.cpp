@@ -58,25 +58,27 @@ namespace mage {
 		// ModelDescriptors
 		//---------------------------------------------------------------------
 		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
+		MeshDescriptor< VertexPositionNormalTexture > tree_desc(true, true, true, 
+			VertexCompression::None, 3);
 		
 		auto model_desc_plane =
 			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/plane/plane.mdl",       mesh_desc);
 		auto model_desc_tree1 =
-			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree1a_lod0.mdl",  mesh_desc);
+			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree1a_lod0.mdl",  tree_desc);
 		auto model_desc_tree2 =
-			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree1b_lod0.mdl",  mesh_desc);
+			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree1b_lod0.mdl",  tree_desc);
 		auto model_desc_tree3 =
-			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree2a_lod0.mdl",  mesh_desc);
+			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree2a_lod0.mdl",  tree_desc);
 		auto model_desc_tree4 =
-			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree2b_lod0.mdl",  mesh_desc);
+			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree2b_lod0.mdl",  tree_desc);
 		auto model_desc_tree5 =
-			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree3a_lod0.mdl",  mesh_desc);
+			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree3a_lod0.mdl",  tree_desc);
 		auto model_desc_tree6 =
-			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree3b_lod0.mdl",  mesh_desc);
+			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree3b_lod0.mdl",  tree_desc);
 		auto model_desc_tree7 =
-			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree4a_lod0.mdl",  mesh_desc);
+			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree4a_lod0.mdl",  tree_desc);
 		auto model_desc_tree8 =
-			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree4b_lod0.mdl",  mesh_desc);
+			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree4b_lod0.mdl",  tree_desc);
 		auto model_desc_windmill =
 			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/windmill/windmill.mdl", mesh_desc);
 
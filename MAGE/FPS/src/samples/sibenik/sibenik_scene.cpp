@@ -58,11 +58,13 @@ namespace mage {
 		// ModelDescriptors
 		//---------------------------------------------------------------------
 		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
+		MeshDescriptor< VertexPositionNormalTexture > tree_desc(true, true, true, 
+			VertexCompression::None, 3);
 
 		auto model_desc_sibenik = 
 			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/sibenik/sibenik.mdl", mesh_desc);
 		auto model_desc_tree = 
-			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree1a_lod0.mdl", mesh_desc);
+			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree1a_lod0.mdl", tree_desc);
 		
 		//---------------------------------------------------------------------
 		// Models
@@ -67,10 +67,14 @@ namespace mage {
 		// ModelDescriptors
 		//---------------------------------------------------------------------
 		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
-		auto model_desc_sponza = 
-			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/sponza/sponza.mdl",    mesh_desc);
+		MeshDescriptor< VertexPositionNormalTexture > tree_desc(true, true, true, 
+			VertexCompression::None, 3);
+		// Load Sponza in the background while loading the tree.
+		auto model_desc_sponza_future = 
+			ResourceManager::Get()->GetOrCreateModelDescriptorAsync(L"assets/models/sponza/sponza.mdl", mesh_desc);
 		auto model_desc_tree = 
-			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree1a_lod0.mdl", mesh_desc);
+			ResourceManager::Get()->GetOrCreateModelDescriptor(L"assets/models/tree/tree1a_lod0.mdl", tree_desc);
+		auto model_desc_sponza = model_desc_sponza_future.get();
 		
 		//---------------------------------------------------------------------
 		// Models
@@ -2,6 +2,7 @@
 // Engine Includes
 //-----------------------------------------------------------------------------
 #include "global.hlsli"
+#include "transform\vertex_decoding.hlsli"
 
 //-----------------------------------------------------------------------------
 // Constant Buffers
@@ -21,6 +22,6 @@ CBUFFER(Model, SLOT_CBUFFER_MODEL) {
 //-----------------------------------------------------------------------------
 float4 VS(VSInputPositionNormalTexture input) : SV_Position {
     // g_object_to_view * g_view_to_projection: eliminates Z-fighting
-	return mul(mul(float4(input.p, 1.0f), 
+	return mul(mul(float4(DecodePosition(input.p), 1.0f), 
 	           g_object_to_view2), g_view2_to_projection2);
 }
@@ -0,0 +1,36 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "global.hlsli"
+#include "transform\vertex_decoding.hlsli"
+
+//-----------------------------------------------------------------------------
+// Constant Buffers
+//-----------------------------------------------------------------------------
+CBUFFER(SecondaryCamera, SLOT_CBUFFER_SECONDARY_CAMERA) {
+	// The view-to-projection transformation matrix.
+	float4x4 g_view2_to_projection2 : packoffset(c0);
+}
+
+CBUFFER(Model, SLOT_CBUFFER_MODEL) {
+	// The index of the first instance in the model instance buffer.
+	uint g_instance_start           : packoffset(c0);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "transform\instancing.hlsli"
+
+//-----------------------------------------------------------------------------
+// Vertex Shader
+//-----------------------------------------------------------------------------
+float4 VS(VSInputPositionNormalTexture input, 
+          uint instance_id : SV_InstanceID) : SV_Position {
+
+	const ModelInstance instance = GetModelInstance(instance_id);
+	
+	// object_to_view * g_view_to_projection: eliminates Z-fighting
+	return mul(mul(float4(DecodePosition(input.p), 1.0f), 
+	           instance.object_to_view), g_view2_to_projection2);
+}
\ No newline at end of file
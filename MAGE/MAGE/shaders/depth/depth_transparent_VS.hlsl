@@ -2,6 +2,7 @@
 // Engine Includes
 //-----------------------------------------------------------------------------
 #include "global.hlsli"
+#include "transform\vertex_decoding.hlsli"
 
 //-----------------------------------------------------------------------------
 // Constant Buffers
@@ -24,7 +25,7 @@ CBUFFER(Model, SLOT_CBUFFER_MODEL) {
 PSInputTexture VS(VSInputPositionNormalTexture input) {
 	PSInputTexture output;
 	// g_object_to_view * g_view_to_projection: eliminates Z-fighting
-	output.p   = mul(mul(float4(input.p, 1.0f), 
+	output.p   = mul(mul(float4(DecodePosition(input.p), 1.0f), 
 		             g_object_to_view2), g_view2_to_projection2);
 	output.tex = mul(float3(input.tex, 1.0f), (float3x3)g_texture_transform).xy;
 	return output;
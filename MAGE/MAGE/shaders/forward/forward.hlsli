@@ -26,6 +26,7 @@
 // DISSABLE_SHADOW_MAP_DIRECTIONAL_LIGHTS | not defined
 // DISSABLE_SHADOW_MAP_OMNI_LIGHTS        | not defined
 // DISSABLE_SHADOW_MAP_SPOT_LIGHTS        | not defined
+// DISSABLE_LIGHT_CLUSTERING              | not defined
 // DISSABLE_FOG                           | not defined
 // MSAA_AS_SSAA                           | not defined
 
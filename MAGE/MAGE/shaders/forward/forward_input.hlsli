@@ -33,6 +33,10 @@ CBUFFER(Model, SLOT_CBUFFER_MODEL) {
 	float  g_roughness                 : packoffset(c13.x);
 	// The metalness of the material.
 	float  g_metalness                 : packoffset(c13.y);
+
+	// INSTANCING
+	// The index of the first instance in the model instance buffer.
+	uint   g_instance_start            : packoffset(c13.z);
 }
 
 //-----------------------------------------------------------------------------
@@ -16,6 +16,8 @@
 #define TRANSPARENCY_SKIP_THRESHOLD   0.00392157f // ~  1/255
 #define TRANSPARENCY_THRESHOLD        0.95686275f // ~244/255
 
+#define NB_SHADOW_CASCADES            4
+
 #ifdef DISSABLE_INVERTED_Z_BUFFER
 	#define Z_NEAR 0.0f
 	#define Z_FAR  1.0f
@@ -77,12 +79,14 @@
 #define SLOT_CBUFFER_LIGHTING                   2
 #define SLOT_CBUFFER_MODEL                      3
 #define SLOT_CBUFFER_SECONDARY_CAMERA           4
+#define SLOT_CBUFFER_MESH                       5
 
 //-----------------------------------------------------------------------------
 // Engine Includes: Light and Shadow Map SRVs
 //-----------------------------------------------------------------------------
 
 #define SLOT_SRV_LIGHT_INDEX_LIST               0
+#define SLOT_SRV_LIGHT_CLUSTERS                 15
 
 #define SLOT_SRV_DIRECTIONAL_LIGHTS             1
 #define SLOT_SRV_OMNI_LIGHTS                    2
@@ -134,6 +138,12 @@
 #define SLOT_SRV_SPRITE                         SLOT_SRV_BASE_COLOR
 #define SLOT_SRV_TEXTURE                        SLOT_SRV_BASE_COLOR
 
+//-----------------------------------------------------------------------------
+// Engine Includes: Instancing SRVs
+//-----------------------------------------------------------------------------
+
+#define SLOT_SRV_MODEL_INSTANCES                14
+
 //-----------------------------------------------------------------------------
 // Engine Includes: General UAVs
 //-----------------------------------------------------------------------------
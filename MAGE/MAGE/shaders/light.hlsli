@@ -13,6 +13,7 @@
 //-----------------------------------------------------------------------------
 // Engine Includes
 //-----------------------------------------------------------------------------
+#include "hlsl.hpp"
 #include "math.hlsli"
 
 //-----------------------------------------------------------------------------
@@ -71,8 +72,11 @@ struct SpotLight {
 struct DirectionalLightWithShadowMapping {
 	// The directional light of this directional light with shadow mapping.
 	DirectionalLight light;
-	// The camera-view-to-light-projection transformation matrix.
-	float4x4 cview_to_lprojection;
+	// The camera-view-to-light-projection transformation matrices of the 
+	// shadow cascades.
+	float4x4 cview_to_lprojection[NB_SHADOW_CASCADES];
+	// The camera-view-space depths of the far planes of the shadow cascades.
+	float4 cascade_ends;
 };
 
 /**
@@ -101,6 +105,19 @@ struct SpotLightWithShadowMapping {
 	float4x4 cview_to_lprojection;
 };
 
+/**
+ A struct of light clusters.
+ */
+struct LightCluster {
+	// The offset of the first light index of this light cluster in the light 
+	// index list.
+	uint offset;
+	// The number of lights of each light list of this light cluster (8 bits 
+	// per light list: omni lights, spotlights, omni lights with shadow 
+	// mapping and spotlights with shadow mapping).
+	uint counts;
+};
+
 /**
  Calculates the distance intensity attenuation smoothing factor of a light.
 
@@ -317,7 +334,9 @@ float ShadowFactor(SamplerComparisonState pcf_sampler,
 /**
  Calculates the radiance contribution of the given directional light.
 
- @pre			@a shadow_maps must contain a shadow map at index @a index.
+ @pre			@a shadow_maps must contain NB_SHADOW_CASCADES shadow maps 
+				(one per shadow cascade) starting at index 
+				@a index * NB_SHADOW_CASCADES.
  @param[in]		light
 				The directional light.
  @param[in]		pcf_sampler
@@ -326,6 +345,8 @@ float ShadowFactor(SamplerComparisonState pcf_sampler,
 				The array of shadow maps.
  @param[in]		index
 				The light index into the array of shadow maps.
+ @param[in]		p
+				The hit position in view space coordinates.
  @param[out]	l
 				The light (hit-to-light) direction.
  @param[out]	L
@@ -340,8 +361,22 @@ void Contribution(DirectionalLightWithShadowMapping light,
 	Contribution(light.light, l0, L0);
 
 	l = l0;
-	const float4 p_proj = mul(float4(p, 1.0f), light.cview_to_lprojection);
-	L = L0 * ShadowFactor(pcf_sampler, shadow_maps, index, p_proj);
+
+	// Select the shadow cascade containing the hit position.
+	const float4 beyond  = (light.cascade_ends < p.z) ? 1.0f : 0.0f;
+	const uint   cascade = (uint)dot(beyond, 1.0f);
+	
+	[branch]
+	if (NB_SHADOW_CASCADES <= cascade) {
+		// No shadows beyond the last shadow cascade.
+		L = L0;
+		return;
+	}
+
+	const float4 p_proj = mul(float4(p, 1.0f), 
+		                      light.cview_to_lprojection[cascade]);
+	L = L0 * ShadowFactor(pcf_sampler, shadow_maps, 
+		                  index * NB_SHADOW_CASCADES + cascade, p_proj);
 }
 
 /**
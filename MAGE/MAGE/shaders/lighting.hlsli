@@ -25,6 +25,7 @@
 // DISSABLE_SHADOW_MAP_DIRECTIONAL_LIGHTS | not defined
 // DISSABLE_SHADOW_MAP_OMNI_LIGHTS        | not defined
 // DISSABLE_SHADOW_MAP_SPOT_LIGHTS        | not defined
+// DISSABLE_LIGHT_CLUSTERING              | not defined
 // DISSABLE_FOG                           | not defined
 
 //-----------------------------------------------------------------------------
@@ -59,6 +60,15 @@ CBUFFER(LightBuffer, SLOT_CBUFFER_LIGHTING) {
 	uint g_nb_sm_omni_lights        : packoffset(c3.y);
 	// The number of spotlights with shadow mapping in the scene.
 	uint g_nb_sm_spot_lights        : packoffset(c3.z);
+
+	// The number of light clusters of the light grid along each axis.
+	uint3 g_light_grid_size         : packoffset(c4);
+	// The scale of the logarithm of the camera view space depth for 
+	// selecting the depth slice of the light grid.
+	float g_light_grid_depth_scale  : packoffset(c4.w);
+	// The bias of the scaled logarithm of the camera view space depth for 
+	// selecting the depth slice of the light grid.
+	float g_light_grid_depth_bias   : packoffset(c5.x);
 }
 
 //-----------------------------------------------------------------------------
@@ -115,12 +125,115 @@ TEXTURE_2D_ARRAY(
 
 #endif // DISSABLE_SHADOW_MAPPING
 
+#ifndef DISSABLE_LIGHT_CLUSTERING
+STRUCTURED_BUFFER(
+	g_light_clusters, LightCluster, 
+	SLOT_SRV_LIGHT_CLUSTERS);
+STRUCTURED_BUFFER(
+	g_light_indices, uint, 
+	SLOT_SRV_LIGHT_INDEX_LIST);
+#endif // DISSABLE_LIGHT_CLUSTERING
+
 #endif // BRDFxCOS
 
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
 
+#ifdef BRDFxCOS
+
+// The light list of the omni lights of a light cluster.
+static const uint g_omni_light_list    = 0u;
+// The light list of the spotlights of a light cluster.
+static const uint g_spot_light_list    = 1u;
+// The light list of the omni lights with shadow mapping of a light cluster.
+static const uint g_sm_omni_light_list = 2u;
+// The light list of the spotlights with shadow mapping of a light cluster.
+static const uint g_sm_spot_light_list = 3u;
+
+/**
+ A struct of light lists.
+ */
+struct LightList {
+	// The offset of the first light index of this light list.
+	uint start;
+	// The number of lights of this light list.
+	uint count;
+};
+
+/**
+ Returns the light cluster containing the given position.
+
+ @param[in]		p
+				The position in camera view space.
+ @return		The light cluster containing the given position.
+ */
+LightCluster GetLightCluster(float3 p) {
+#ifdef DISSABLE_LIGHT_CLUSTERING
+	const LightCluster cluster = { 0u, 0u };
+	return cluster;
+#else  // DISSABLE_LIGHT_CLUSTERING
+	const float4 p_proj = mul(float4(p, 1.0f), g_view_to_projection);
+	// [-1,1]x[-1,1] -> [0,1]x[1,0]
+	const float2 uv     = float2(0.5f, -0.5f) * (p_proj.xy / p_proj.w) + 0.5f;
+	const uint2  tile   = min(uint2(max(uv * g_light_grid_size.xy, 0.0f)), 
+		                      g_light_grid_size.xy - 1u);
+	const float  z      = floor(log(max(p.z, 0.01f)) * g_light_grid_depth_scale 
+		                        + g_light_grid_depth_bias);
+	const uint   slice  = min(uint(max(z, 0.0f)), g_light_grid_size.z - 1u);
+
+	return g_light_clusters[(slice * g_light_grid_size.y + tile.y) 
+		                    * g_light_grid_size.x + tile.x];
+#endif // DISSABLE_LIGHT_CLUSTERING
+}
+
+/**
+ Returns the given light list of the given light cluster.
+
+ @param[in]		cluster
+				The light cluster.
+ @param[in]		list
+				The light list.
+ @param[in]		nb_lights
+				The total number of lights of the light list.
+ @return		The given light list of the given light cluster.
+ */
+LightList GetLightList(LightCluster cluster, uint list, uint nb_lights) {
+	LightList light_list;
+
+#ifdef DISSABLE_LIGHT_CLUSTERING
+	light_list.start = 0u;
+	light_list.count = nb_lights;
+#else  // DISSABLE_LIGHT_CLUSTERING
+	const uint4 counts   = (cluster.counts >> uint4(0u, 8u, 16u, 24u)) & 0xFFu;
+	const uint4 previous = counts * uint4(uint4(0u, 1u, 2u, 3u) < list);
+	light_list.start = cluster.offset 
+		             + previous.x + previous.y + previous.z + previous.w;
+	light_list.count = counts[list];
+#endif // DISSABLE_LIGHT_CLUSTERING
+
+	return light_list;
+}
+
+/**
+ Returns the index of the given light of the given light list.
+
+ @param[in]		light_list
+				The light list.
+ @param[in]		i
+				The index of the light in the light list.
+ @return		The index of the given light of the given light list.
+ */
+uint GetLightIndex(LightList light_list, uint i) {
+#ifdef DISSABLE_LIGHT_CLUSTERING
+	return light_list.start + i;
+#else  // DISSABLE_LIGHT_CLUSTERING
+	return g_light_indices[light_list.start + i];
+#endif // DISSABLE_LIGHT_CLUSTERING
+}
+
+#endif // BRDFxCOS
+
 // Calculates the BRDF shading.
 float3 BRDFShading(float3 p, float3 n, 
 	float3 base_color, float roughness, float metalness) {
@@ -139,6 +252,9 @@ float3 BRDFShading(float3 p, float3 n,
 
 	const float3 v = -p / r_eye;
 
+	// Obtain the light cluster containing the position.
+	const LightCluster cluster = GetLightCluster(p);
+
 #ifndef DISSABLE_DIRECTIONAL_LIGHTS
 	// Directional lights contribution
 	for (uint i0 = 0u; i0 < g_nb_directional_lights; ++i0) {
@@ -153,8 +269,10 @@ float3 BRDFShading(float3 p, float3 n,
 
 #ifndef DISSABLE_OMNI_LIGHTS
 	// Omni lights contribution
-	for (uint i1 = 0u; i1 < g_nb_omni_lights; ++i1) {
-		const OmniLight light = g_omni_lights[i1];
+	const LightList omni_lights 
+		= GetLightList(cluster, g_omni_light_list, g_nb_omni_lights);
+	for (uint i1 = 0u; i1 < omni_lights.count; ++i1) {
+		const OmniLight light = g_omni_lights[GetLightIndex(omni_lights, i1)];
 		
 		float3 l, I_light;
 		Contribution(light, p, l, I_light);
@@ -165,8 +283,10 @@ float3 BRDFShading(float3 p, float3 n,
 
 #ifndef DISSABLE_SPOT_LIGHTS
 	// Spotlights contribution
-	for (uint i2 = 0u; i2 < g_nb_spot_lights; ++i2) {
-		const SpotLight light = g_spot_lights[i2];
+	const LightList spot_lights 
+		= GetLightList(cluster, g_spot_light_list, g_nb_spot_lights);
+	for (uint i2 = 0u; i2 < spot_lights.count; ++i2) {
+		const SpotLight light = g_spot_lights[GetLightIndex(spot_lights, i2)];
 		
 		float3 l, I_light;
 		Contribution(light, p, l, I_light);
@@ -191,11 +311,14 @@ float3 BRDFShading(float3 p, float3 n,
 
 #ifndef DISSABLE_SHADOW_MAP_OMNI_LIGHTS
 	// Omni lights with shadow mapping contribution
-	for (uint i4 = 0u; i4 < g_nb_sm_omni_lights; ++i4) {
-		const OmniLightWithShadowMapping light = g_sm_omni_lights[i4];
+	const LightList sm_omni_lights 
+		= GetLightList(cluster, g_sm_omni_light_list, g_nb_sm_omni_lights);
+	for (uint i4 = 0u; i4 < sm_omni_lights.count; ++i4) {
+		const uint index = GetLightIndex(sm_omni_lights, i4);
+		const OmniLightWithShadowMapping light = g_sm_omni_lights[index];
 		
 		float3 l, I_light;
-		Contribution(light, g_pcf_sampler, g_omni_sms, i4, p, l, I_light);
+		Contribution(light, g_pcf_sampler, g_omni_sms, index, p, l, I_light);
 		
 		L += I_light * BRDFxCOS(n, l, v, base_color, roughness, metalness);
 	}
@@ -203,11 +326,14 @@ float3 BRDFShading(float3 p, float3 n,
 
 #ifndef DISSABLE_SHADOW_MAP_SPOT_LIGHTS
 	// Spotlights with shadow mapping contribution
-	for (uint i5 = 0u; i5 < g_nb_sm_spot_lights; ++i5) {
-		const SpotLightWithShadowMapping light = g_sm_spot_lights[i5];
+	const LightList sm_spot_lights 
+		= GetLightList(cluster, g_sm_spot_light_list, g_nb_sm_spot_lights);
+	for (uint i5 = 0u; i5 < sm_spot_lights.count; ++i5) {
+		const uint index = GetLightIndex(sm_spot_lights, i5);
+		const SpotLightWithShadowMapping light = g_sm_spot_lights[index];
 		
 		float3 l, I_light;
-		Contribution(light, g_pcf_sampler, g_spot_sms, i5, p, l, I_light);
+		Contribution(light, g_pcf_sampler, g_spot_sms, index, p, l, I_light);
 
 		L += I_light * BRDFxCOS(n, l, v, base_color, roughness, metalness);
 	}
@@ -541,6 +541,22 @@ float3 PackNormal(float3 n) {
 	return SNORMtoUNORM(n);
 }
 
+/**
+ Decodes the given octahedral encoded unit vector.
+
+ @pre			The given octahedral coordinates are in the [-1,1] range.
+ @param[in]		v
+				The octahedral coordinates in the [-1,1] range to decode.
+ @return		The decoded unit vector.
+ */
+float3 DecodeOctahedralUnitVector(float2 v) {
+	float3 n = float3(v, 1.0f - abs(v.x) - abs(v.y));
+	if (n.z < 0.0f) {
+		n.xy = (1.0f - abs(v.yx)) * (0.0f <= v ? 1.0f : -1.0f);
+	}
+	return normalize(n);
+}
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions: Transform Utilities
 //-----------------------------------------------------------------------------
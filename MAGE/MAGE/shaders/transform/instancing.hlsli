@@ -0,0 +1,41 @@
+//-----------------------------------------------------------------------------
+// Requires global variable: g_instance_start
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Definitions and Declarations
+//-----------------------------------------------------------------------------
+
+/**
+ A struct of model instances.
+ */
+struct ModelInstance {
+	// The object-to-view transformation matrix.
+	float4x4 object_to_view;
+	// The object-to-view inverse transpose transformation matrix
+	// = The normal-to-view transformation matrix.
+	float4x4 normal_to_view;
+	// The texture transformation matrix.
+	float4x4 texture_transform;
+};
+
+//-----------------------------------------------------------------------------
+// SRVs
+//-----------------------------------------------------------------------------
+STRUCTURED_BUFFER(g_model_instances, ModelInstance, SLOT_SRV_MODEL_INSTANCES);
+
+//-----------------------------------------------------------------------------
+// Definitions and Declarations
+//-----------------------------------------------------------------------------
+
+/**
+ Returns the model instance with the given instance identifier.
+
+ @param[in]		instance_id
+				The instance identifier (relative to the first instance of 
+				the draw call).
+ @return		The model instance with the given instance identifier.
+ */
+ModelInstance GetModelInstance(uint instance_id) {
+	return g_model_instances[g_instance_start + instance_id];
+}
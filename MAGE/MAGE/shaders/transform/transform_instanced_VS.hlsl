@@ -0,0 +1,26 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "forward\forward_input.hlsli"
+#include "transform\instancing.hlsli"
+#include "transform\vertex_decoding.hlsli"
+
+//-----------------------------------------------------------------------------
+// Vertex Shader
+//-----------------------------------------------------------------------------
+PSInputPositionNormalTexture VS(VSInputPositionNormalTexture input, 
+                                uint instance_id : SV_InstanceID) {
+
+	const ModelInstance instance = GetModelInstance(instance_id);
+	const float3 p = DecodePosition(input.p);
+	const float3 n = DecodeNormal(input.n);
+
+	PSInputPositionNormalTexture output;
+	output.p      = mul(float4(p, 1.0f), instance.object_to_view);
+	output.p_view = output.p.xyz;
+	output.p      = mul(output.p, g_view_to_projection);
+	output.n_view = normalize(mul(n, (float3x3)instance.normal_to_view));
+	output.tex    = mul(float3(input.tex, 1.0f), (float3x3)instance.texture_transform).xy;
+	output.tex2   = input.tex;
+	return output;
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#ifndef MAGE_HEADER_VERTEX_DECODING
+#define MAGE_HEADER_VERTEX_DECODING
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "global.hlsli"
+
+//-----------------------------------------------------------------------------
+// Constant Buffers
+//-----------------------------------------------------------------------------
+CBUFFER(Mesh, SLOT_CBUFFER_MESH) {
+	// The scale of the positions of the mesh.
+	float3 g_position_scale     : packoffset(c0);
+	// Flag indicating whether the normals of the mesh are octahedral encoded.
+	uint   g_octahedral_normals : packoffset(c0.w);
+	// The offset of the positions of the mesh.
+	float3 g_position_offset    : packoffset(c1);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+
+/**
+ Decodes the given object-space position of the mesh.
+
+ @param[in]		p
+				The stored object-space position.
+ @return		The decoded object-space position.
+ */
+float3 DecodePosition(float3 p) {
+	return p * g_position_scale + g_position_offset;
+}
+
+/**
+ Decodes the given object-space normal of the mesh.
+
+ @param[in]		n
+				The stored object-space normal.
+ @return		The decoded object-space normal.
+ */
+float3 DecodeNormal(float3 n) {
+	return g_octahedral_normals ? DecodeOctahedralUnitVector(n.xy) : n;
+}
+
+#endif // MAGE_HEADER_VERTEX_DECODING
\ No newline at end of file
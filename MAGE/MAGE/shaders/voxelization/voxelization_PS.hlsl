@@ -2,6 +2,7 @@
 // Engine Includes
 //-----------------------------------------------------------------------------
 #define DISSABLE_DIFFUSE_BRDF
+#define DISSABLE_LIGHT_CLUSTERING
 #include "forward\forward_input.hlsli"
 #include "voxel.hlsli"
 #include "lighting.hlsli"
@@ -20,6 +20,16 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	// Engine
 	//-------------------------------------------------------------------------
+
+	/**
+	 The display width in pixels of headless engines.
+	 */
+	constexpr U32 g_headless_display_width = 1920u;
+
+	/**
+	 The display height in pixels of headless engines.
+	 */
+	constexpr U32 g_headless_display_height = 1080u;
 	
 	Engine *Engine::s_engine = nullptr;
 
@@ -58,17 +68,34 @@ namespace mage {
 		InitializeConsole();
 		PrintConsoleHeader();
 
-		// Enumerate the devices.
-		UniquePtr< DisplayConfigurator > display_configurator(
-			MakeUnique< DisplayConfigurator >());
-		const HRESULT result_configure = display_configurator->Configure();
-		if (FAILED(result_configure)) {
-			Error("Display configuration failed: %ld", result_configure);
-			return;
+		UniquePtr< DisplayConfigurator > display_configurator;
+		UniquePtr< DisplayConfiguration > headless_configuration;
+		const DisplayConfiguration *display_configuration = nullptr;
+
+		if (setup.IsHeadless()) {
+			// Use a display configuration without adapter and output.
+			DXGI_MODE_DESC1 display_mode = {};
+			display_mode.Width  = g_headless_display_width;
+			display_mode.Height = g_headless_display_height;
+			display_mode.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+
+			headless_configuration = MakeUnique< DisplayConfiguration >(
+				nullptr, nullptr, display_mode);
+			display_configuration  = headless_configuration.get();
 		}
+		else {
+			// Enumerate the devices.
+			display_configurator = MakeUnique< DisplayConfigurator >();
+			const HRESULT result_configure 
+				= display_configurator->Configure();
+			if (FAILED(result_configure)) {
+				Error("Display configuration failed: %ld", result_configure);
+				return;
+			}
 
-		const DisplayConfiguration *display_configuration 
-			= display_configurator->GetDisplayConfiguration();
+			display_configuration 
+				= display_configurator->GetDisplayConfiguration();
+		}
 		
 		// Initialize the resource system.
 		m_resource_manager    = MakeUnique< ResourceManager >();
@@ -137,6 +164,11 @@ namespace mage {
 			Error("Game loop can not start because the engine is not loaded.");
 			return 0;
 		}
+		// Check if this engine has a display.
+		if (m_rendering_manager->IsHeadless()) {
+			Error("Game loop can not start because the engine is headless.");
+			return 0;
+		}
 		
 		// Pass the given scene to the scene manager.
 		m_scene_manager->SetScene(std::move(scene));
@@ -224,4 +256,51 @@ namespace mage {
 
 		return static_cast< int >(msg.wParam);
 	}
-}
+
+	void Engine::RunHeadless(UniquePtr< Scene > &&scene, 
+		size_t nb_frames, F64 delta_time) {
+
+		// Check if this engine is loaded.
+		if (!IsLoaded()) {
+			Error("Game loop can not start because the engine is not loaded.");
+			return;
+		}
+
+		// Pass the given scene to the scene manager.
+		m_scene_manager->SetScene(std::move(scene));
+		
+		F64 fixed_time_budget = 0.0f;
+
+		for (size_t i = 0; i < nb_frames; ++i) {
+			// Check if the scene manager is finished.
+			if (m_scene_manager->IsFinished()) {
+				return;
+			}
+
+			m_rendering_manager->BeginFrame();
+
+			// Perform the fixed delta time updates of the current scene.
+			if (m_fixed_delta_time) {
+				fixed_time_budget += delta_time;
+				while (fixed_time_budget >= m_fixed_delta_time) {
+					m_scene_manager->FixedUpdate();
+					fixed_time_budget -= m_fixed_delta_time;
+				}
+			}
+			else {
+				m_scene_manager->FixedUpdate();
+			}
+			// Perform the non-fixed delta time updates of the current scene.
+			m_scene_manager->Update(delta_time);
+			if (m_scene_manager->IsFinished()) {
+				return;
+			}
+
+			// Render the current scene.
+			m_engine_stats->PrepareRendering();
+			m_scene_manager->Render();
+
+			m_rendering_manager->EndFrame();
+		}
+	}
+}
\ No newline at end of file
@@ -126,6 +126,24 @@ namespace mage {
 		[[nodiscard]] int Run(UniquePtr< Scene > &&scene, 
 			int nCmdShow = SW_NORMAL);
 
+		/**
+		 Runs this engine for a fixed number of frames without a message loop
+		 and with a fixed elapsed time per frame.
+
+		 Combined with a headless engine setup and a pipeline recorder (see
+		 @c Pipeline::SetRecorder), this allows driving the renderer over a
+		 scene without a display.
+
+		 @param[in]		scene
+						A reference to the start scene.
+		 @param[in]		nb_frames
+						The maximal number of frames to run.
+		 @param[in]		delta_time
+						The elapsed time per frame.
+		 */
+		void RunHeadless(UniquePtr< Scene > &&scene, 
+			size_t nb_frames, F64 delta_time);
+
 		//---------------------------------------------------------------------
 		// Member Methods: Resource System
 		//---------------------------------------------------------------------
@@ -13,8 +13,11 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
-	EngineSetup::EngineSetup(HINSTANCE hinstance, wstring name)
-		: m_hinstance(hinstance), m_name(std::move(name)) {
+	EngineSetup::EngineSetup(HINSTANCE hinstance, wstring name, 
+		bool headless)
+		: m_hinstance(hinstance), 
+		m_name(std::move(name)), 
+		m_headless(headless) {
 
 		Assert(m_hinstance);
 	}
@@ -42,9 +42,14 @@ namespace mage {
 						The application instance handle of the application.
 		 @param[in]		name
 						The name of the application.
+		 @param[in]		headless
+						@c true if the engine must render without a display
+						(i.e. on a device without rendering capabilities and
+						without a swap chain). @c false otherwise.
 		 */
 		explicit EngineSetup(HINSTANCE hinstance, 
-			wstring name = MAGE_DEFAULT_APPLICATION_NAME);
+			wstring name = MAGE_DEFAULT_APPLICATION_NAME,
+			bool headless = false);
 
 		/**
 		 Constructs an engine setup from the given engine setup.
@@ -112,6 +117,16 @@ namespace mage {
 		HINSTANCE GetApplicationHinstance() const noexcept {
 			return m_hinstance;
 		}
+
+		/**
+		 Checks whether the application renders without a display.
+
+		 @return		@c true if the application renders without a display.
+						@c false otherwise.
+		 */
+		bool IsHeadless() const noexcept {
+			return m_headless;
+		}
 	
 	private:
 
@@ -128,5 +143,10 @@ namespace mage {
 		 Name of the application.
 		 */
 		const wstring m_name;
+
+		/**
+		 Flag indicating whether the application renders without a display.
+		 */
+		const bool m_headless;
 	};
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #pragma region
 
 #include "utils\type\types.hpp"
+#include "utils\parallel\atomic.hpp"
 
 #pragma endregion
 
@@ -16,6 +17,9 @@ namespace mage {
 
 	/**
 	 A class of engine statistics.
+
+	 The counters of engine statistics are updated atomically, since command 
+	 lists may be recorded on multiple threads.
 	 */
 	class EngineStatistics final {
 
@@ -43,7 +47,13 @@ namespace mage {
 		 Constructs a engine statistics.
 		 */
 		EngineStatistics()
-			: m_nb_draw_calls(0) {}
+			: m_nb_draw_calls(0), 
+			m_nb_shader_binds(0), 
+			m_nb_srv_binds(0), 
+			m_nb_mesh_binds(0), 
+			m_nb_state_binds(0), 
+			m_nb_issued_state_binds(0), 
+			m_nb_dropped_cluster_lights(0) {}
 
 		/**
 		 Constructs a engine statistics from the given engine statistics.
@@ -100,7 +110,13 @@ namespace mage {
 		 Prepares this engine statistics for rendering.
 		 */
 		void PrepareRendering() noexcept {
-			m_nb_draw_calls = 0;
+			m_nb_draw_calls   = 0;
+			m_nb_shader_binds = 0;
+			m_nb_srv_binds    = 0;
+			m_nb_mesh_binds   = 0;
+			m_nb_state_binds  = 0;
+			m_nb_issued_state_binds = 0;
+			m_nb_dropped_cluster_lights = 0;
 		}
 
 		/**
@@ -109,7 +125,7 @@ namespace mage {
 		 @return		The number of draw calls of this engine statistics.
 		 */
 		U32 GetNumberOfDrawCalls() noexcept {
-			return m_nb_draw_calls;
+			return static_cast< U32 >(m_nb_draw_calls);
 		}
 
 		/**
@@ -119,7 +135,149 @@ namespace mage {
 						The number of units to add.
 		 */
 		void IncrementNumberOfDrawCalls(U32 units = 1) noexcept {
-			m_nb_draw_calls += units;
+			AtomicAdd(&m_nb_draw_calls, static_cast< S32 >(units));
+		}
+
+		/**
+		 Returns the number of shader binds of this engine statistics.
+
+		 @return		The number of shader binds of this engine statistics.
+		 */
+		U32 GetNumberOfShaderBinds() noexcept {
+			return static_cast< U32 >(m_nb_shader_binds);
+		}
+
+		/**
+		 Increments the number of shader binds of this engine statistics.
+
+		 @param[in]		units
+						The number of units to add.
+		 */
+		void IncrementNumberOfShaderBinds(U32 units = 1) noexcept {
+			AtomicAdd(&m_nb_shader_binds, static_cast< S32 >(units));
+		}
+
+		/**
+		 Returns the number of shader resource view binds of this engine 
+		 statistics.
+
+		 @return		The number of shader resource view binds of this 
+						engine statistics.
+		 */
+		U32 GetNumberOfSRVBinds() noexcept {
+			return static_cast< U32 >(m_nb_srv_binds);
+		}
+
+		/**
+		 Increments the number of shader resource view binds of this engine 
+		 statistics.
+
+		 @param[in]		units
+						The number of units to add.
+		 */
+		void IncrementNumberOfSRVBinds(U32 units = 1) noexcept {
+			AtomicAdd(&m_nb_srv_binds, static_cast< S32 >(units));
+		}
+
+		/**
+		 Returns the number of mesh (i.e. vertex and index buffer) binds of 
+		 this engine statistics.
+
+		 @return		The number of mesh binds of this engine statistics.
+		 */
+		U32 GetNumberOfMeshBinds() noexcept {
+			return static_cast< U32 >(m_nb_mesh_binds);
+		}
+
+		/**
+		 Increments the number of mesh (i.e. vertex and index buffer) binds 
+		 of this engine statistics.
+
+		 @param[in]		units
+						The number of units to add.
+		 */
+		void IncrementNumberOfMeshBinds(U32 units = 1) noexcept {
+			AtomicAdd(&m_nb_mesh_binds, static_cast< S32 >(units));
+		}
+
+		/**
+		 Returns the number of requested pipeline state binds of this engine 
+		 statistics.
+
+		 @return		The number of requested pipeline state binds of this 
+						engine statistics.
+		 */
+		U32 GetNumberOfStateBinds() noexcept {
+			return static_cast< U32 >(m_nb_state_binds);
+		}
+
+		/**
+		 Increments the number of requested pipeline state binds of this 
+		 engine statistics.
+
+		 @param[in]		units
+						The number of units to add.
+		 */
+		void IncrementNumberOfStateBinds(U32 units = 1) noexcept {
+			AtomicAdd(&m_nb_state_binds, static_cast< S32 >(units));
+		}
+
+		/**
+		 Returns the number of pipeline state binds issued to the device 
+		 contexts of this engine statistics.
+
+		 @return		The number of issued pipeline state binds of this 
+						engine statistics.
+		 */
+		U32 GetNumberOfIssuedStateBinds() noexcept {
+			return static_cast< U32 >(m_nb_issued_state_binds);
+		}
+
+		/**
+		 Increments the number of pipeline state binds issued to the device 
+		 contexts of this engine statistics.
+
+		 @param[in]		units
+						The number of units to add.
+		 */
+		void IncrementNumberOfIssuedStateBinds(U32 units = 1) noexcept {
+			AtomicAdd(&m_nb_issued_state_binds, static_cast< S32 >(units));
+		}
+
+		/**
+		 Returns the number of filtered (i.e. redundant or batched) pipeline 
+		 state binds of this engine statistics.
+
+		 @return		The number of filtered pipeline state binds of this 
+						engine statistics.
+		 */
+		U32 GetNumberOfFilteredStateBinds() noexcept {
+			const U32 nb_state_binds        = GetNumberOfStateBinds();
+			const U32 nb_issued_state_binds = GetNumberOfIssuedStateBinds();
+			return (nb_state_binds > nb_issued_state_binds) 
+				? nb_state_binds - nb_issued_state_binds : 0u;
+		}
+
+		/**
+		 Returns the number of lights which are dropped from full light 
+		 cluster lists of this engine statistics.
+
+		 @return		The number of dropped light cluster lights of this 
+						engine statistics.
+		 */
+		U32 GetNumberOfDroppedClusterLights() noexcept {
+			return static_cast< U32 >(m_nb_dropped_cluster_lights);
+		}
+
+		/**
+		 Increments the number of lights which are dropped from full light 
+		 cluster lists of this engine statistics.
+
+		 @param[in]		units
+						The number of units to add.
+		 */
+		void IncrementNumberOfDroppedClusterLights(U32 units = 1) noexcept {
+			AtomicAdd(&m_nb_dropped_cluster_lights, static_cast< S32 >(units));
 		}
 
 	private:
@@ -131,6 +289,40 @@ namespace mage {
 		/**
 		 The number of draw calls of this engine statistics.
 		 */
-		U32 m_nb_draw_calls;
+		AtomicS32 m_nb_draw_calls;
+
+		/**
+		 The number of shader binds of this engine statistics.
+		 */
+		AtomicS32 m_nb_shader_binds;
+
+		/**
+		 The number of shader resource view binds of this engine statistics.
+		 */
+		AtomicS32 m_nb_srv_binds;
+
+		/**
+		 The number of mesh (i.e. vertex and index buffer) binds of this 
+		 engine statistics.
+		 */
+		AtomicS32 m_nb_mesh_binds;
+
+		/**
+		 The number of requested pipeline state binds of this engine 
+		 statistics.
+		 */
+		AtomicS32 m_nb_state_binds;
+
+		/**
+		 The number of pipeline state binds issued to the device contexts of 
+		 this engine statistics.
+		 */
+		AtomicS32 m_nb_issued_state_binds;
+
+		/**
+		 The number of lights which are dropped from full light cluster lists 
+		 of this engine statistics.
+		 */
+		AtomicS32 m_nb_dropped_cluster_lights;
 	};
 }
\ No newline at end of file
@@ -128,6 +128,14 @@ namespace mage {
 		 */
 		void ReadMDLSubModel();
 
+		/**
+		 Reads a LOD definition of the last Submodel.
+
+		 @throws		FormattedException
+						Failed to read a LOD definition.
+		 */
+		void ReadMDLLOD();
+
 		/**
 		 Reads a Material Library definition and imports the materials 
 		 corresponding to the model.
@@ -35,6 +35,8 @@ namespace mage {
 			"%ls: vertex buffer must be empty.", GetFilename().c_str());
 		ThrowIfFailed(m_model_output.m_index_buffer.empty(),
 			"%ls: index buffer must be empty.", GetFilename().c_str());
+		ThrowIfFailed(!m_model_output.m_mesh_view.IsMapped(),
+			"%ls: mesh view must be empty.", GetFilename().c_str());
 
 		ImportMesh();
 	}
@@ -43,8 +45,7 @@ namespace mage {
 	void MDLReader< VertexT >::ImportMesh() {
 		const wstring msh_fname 
 			= mage::GetFilenameWithoutFileExtension(GetFilename()) + L".msh";
-		ImportMSHMeshFromFile(msh_fname, 
-			m_model_output.m_vertex_buffer, m_model_output.m_index_buffer);
+		ImportMSHMeshFromFile(msh_fname, m_model_output.m_mesh_view);
 	}
 
 	template < typename VertexT >
@@ -60,6 +61,9 @@ namespace mage {
 		if (str_equals(token, MAGE_MDL_TOKEN_SUBMODEL)) {
 			ReadMDLSubModel();
 		}
+		else if (str_equals(token, MAGE_MDL_TOKEN_LOD)) {
+			ReadMDLLOD();
+		}
 		else if (str_equals(token, MAGE_MDL_TOKEN_MATERIAL_LIBRARY)) {
 			ReadMDLMaterialLibrary();
 		}
@@ -83,10 +87,29 @@ namespace mage {
 		model_part.m_material    = ReadString();
 		model_part.m_start_index = ReadU32();
 		model_part.m_nb_indices  = ReadU32();
+		if (HasU32()) {
+			model_part.m_base_vertex = ReadU32();
+		}
 		
 		m_model_output.AddModelPart(std::move(model_part));
 	}
 
+	template < typename VertexT >
+	void MDLReader< VertexT >::ReadMDLLOD() {
+		ThrowIfFailed(!m_model_output.m_model_parts.empty(),
+			"%ls: line %u: LOD definition without Submodel.",
+			GetFilename().c_str(), GetCurrentLineNumber());
+
+		ModelLOD lod;
+		lod.m_start_index   = ReadU32();
+		lod.m_nb_indices    = ReadU32();
+		lod.m_first_cluster = 0u;
+		lod.m_nb_clusters   = 0u;
+		lod.m_error         = ReadF32();
+
+		m_model_output.m_model_parts.back().m_lods.push_back(lod);
+	}
+
 	template < typename VertexT >
 	void MDLReader< VertexT >::ReadMDLMaterialLibrary() {
 		const wstring mtl_path  = mage::GetPathName(GetFilename());
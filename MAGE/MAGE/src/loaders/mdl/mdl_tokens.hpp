@@ -7,6 +7,7 @@
 
 #define MAGE_MDL_COMMENT_CHAR           '#'
 #define MAGE_MDL_TOKEN_SUBMODEL         "s"
+#define MAGE_MDL_TOKEN_LOD              "l"
 #define MAGE_MDL_TOKEN_MATERIAL_LIBRARY "mtllib"
 
 #pragma endregion
\ No newline at end of file
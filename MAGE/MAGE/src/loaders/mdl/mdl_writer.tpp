@@ -43,8 +43,22 @@ namespace mage {
 		const wstring &fname = GetFilename();
 		const wstring msh_fname 
 			= mage::GetFilenameWithoutFileExtension(fname) + L".msh";
-		ExportMSHMeshToFile(msh_fname, 
-			m_model_output.m_vertex_buffer, m_model_output.m_index_buffer);
+		
+		const MeshView< VertexT > &mesh_view = m_model_output.m_mesh_view;
+		if (!mesh_view.IsMapped()) {
+			if (m_model_output.HasU16Indices()) {
+				ExportMSHMeshToFile(msh_fname, m_model_output.m_vertex_buffer, 
+					m_model_output.GetU16IndexBuffer());
+			}
+			else {
+				ExportMSHMeshToFile(msh_fname, m_model_output.m_vertex_buffer, 
+					m_model_output.m_index_buffer);
+			}
+		}
+		else if (mesh_view.m_file->GetFilename() != msh_fname) {
+			ExportMSHMeshToFile(msh_fname, mesh_view);
+		}
+		// Otherwise, the mapped MSH file is already up to date.
 	}
 
 	template < typename VertexT >
@@ -78,7 +92,7 @@ namespace mage {
 		for (const auto &model_part : m_model_output.m_model_parts) {
 
 			sprintf_s(output, _countof(output),
-				"%s %s %s %f %f %f %f %f %f %f %f %f %s %u %u",
+				"%s %s %s %f %f %f %f %f %f %f %f %f %s %u %u %u",
 				MAGE_MDL_TOKEN_SUBMODEL, 
 				model_part.m_child.c_str(), 
 				model_part.m_parent.c_str(),
@@ -93,9 +107,21 @@ namespace mage {
 				model_part.m_scale.m_z,
 				model_part.m_material.c_str(),
 				model_part.m_start_index, 
-				model_part.m_nb_indices);
+				model_part.m_nb_indices,
+				model_part.m_base_vertex);
 			
 			WriteStringLine(output);
+
+			for (const auto &lod : model_part.m_lods) {
+				sprintf_s(output, _countof(output),
+					"%s %u %u %g",
+					MAGE_MDL_TOKEN_LOD,
+					lod.m_start_index,
+					lod.m_nb_indices,
+					lod.m_error);
+
+				WriteStringLine(output);
+			}
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,357 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\mdlb\mdlb_tokens.hpp"
+#include "utils\type\vector_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 An enumeration of the different MDLB file sections.
+	 */
+	enum struct MDLBSectionType : U32 {
+		Vertices = 0,
+		Indices,
+		ModelParts,
+		Materials,
+		Clusters,
+		LODs,
+		Strings,
+		Count
+	};
+
+	/**
+	 A struct of MDLB table of contents entries.
+	 */
+	struct MDLBSection final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The offset in bytes of this section from the start of the file.
+		 */
+		U64 m_offset;
+
+		/**
+		 The size in bytes of this section.
+		 */
+		U64 m_size;
+	};
+
+	static_assert(16 == sizeof(MDLBSection), "MDLB section size mismatch");
+
+	/**
+	 A struct of MDLB file headers.
+
+	 An MDLB file packs the mesh, the model parts, the materials, the mesh 
+	 clusters, the LODs and all their strings of a model in a single file. All fields are stored in
+	 little-endian byte order and every section starts at an offset that is a
+	 multiple of @c MAGE_MDLB_SECTION_ALIGNMENT bytes, which allows all
+	 sections to be used directly from a memory-mapped file.
+	 */
+	struct MDLBHeader final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The magic of this MDLB header (not null-terminated).
+		 */
+		char m_magic[8];
+
+		/**
+		 The version of this MDLB header.
+		 */
+		U32 m_version;
+
+		/**
+		 The size in bytes of a vertex.
+		 */
+		U32 m_vertex_size;
+
+		/**
+		 The size in bytes of an index (2 or 4).
+		 */
+		U32 m_index_size;
+
+		/**
+		 The number of vertices.
+		 */
+		U32 m_nb_vertices;
+
+		/**
+		 The number of indices.
+		 */
+		U32 m_nb_indices;
+
+		/**
+		 The number of model parts.
+		 */
+		U32 m_nb_model_parts;
+
+		/**
+		 The number of materials.
+		 */
+		U32 m_nb_materials;
+
+		/**
+		 The number of mesh clusters.
+		 */
+		U32 m_nb_clusters;
+
+		/**
+		 The number of LODs.
+		 */
+		U32 m_nb_lods;
+
+		/**
+		 Padding (must be zero).
+		 */
+		U32 m_padding;
+
+		/**
+		 The table of contents of this MDLB header indexed by
+		 @c MDLBSectionType.
+		 */
+		MDLBSection m_sections[static_cast< size_t >(MDLBSectionType::Count)];
+	};
+
+	static_assert(160 == sizeof(MDLBHeader), "MDLB header size mismatch");
+	static_assert(0 == sizeof(MDLBHeader) % MAGE_MDLB_SECTION_ALIGNMENT,
+		          "MDLB header must be a multiple of the section alignment");
+
+	/**
+	 A struct of MDLB model part records.
+
+	 Names are stored as byte offsets into the string section.
+	 */
+	struct MDLBModelPart final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The offset of the name of this model part.
+		 */
+		U32 m_child;
+
+		/**
+		 The offset of the name of the parent model part of this model part.
+		 */
+		U32 m_parent;
+
+		/**
+		 The index of the material of this model part in the material
+		 section, or @c MAGE_MDLB_INVALID_INDEX for the default material.
+		 */
+		U32 m_material;
+
+		/**
+		 The start index of this model part in the mesh.
+		 */
+		U32 m_start_index;
+
+		/**
+		 The number of indices of this model part in the mesh.
+		 */
+		U32 m_nb_indices;
+
+		/**
+		 The base vertex of this model part in the mesh.
+		 */
+		U32 m_base_vertex;
+
+		/**
+		 The local translation component of this model part.
+		 */
+		F32x3 m_translation;
+
+		/**
+		 The local rotation component of this model part.
+		 */
+		F32x3 m_rotation;
+
+		/**
+		 The local scale component of this model part.
+		 */
+		F32x3 m_scale;
+
+		/**
+		 The minimum point of the AABB of this model part.
+		 */
+		F32x3 m_aabb_min;
+
+		/**
+		 The maximum point of the AABB of this model part.
+		 */
+		F32x3 m_aabb_max;
+
+		/**
+		 The centroid of the BS of this model part.
+		 */
+		F32x3 m_bs_centroid;
+
+		/**
+		 The radius of the BS of this model part.
+		 */
+		F32 m_bs_radius;
+
+		/**
+		 The index of the first mesh cluster of this model part in the 
+		 cluster section.
+		 */
+		U32 m_first_cluster;
+
+		/**
+		 The number of mesh clusters of this model part.
+		 */
+		U32 m_nb_clusters;
+
+		/**
+		 The index of the first LOD of this model part in the LOD section.
+		 */
+		U32 m_first_lod;
+
+		/**
+		 The number of (coarser) LODs of this model part.
+		 */
+		U32 m_nb_lods;
+
+		/**
+		 The padding of this model part.
+		 */
+		U32 m_padding[3];
+	};
+
+	static_assert(128 == sizeof(MDLBModelPart),
+		          "MDLB model part size mismatch");
+
+	/**
+	 A struct of MDLB material records.
+
+	 Names and texture filenames are stored as byte offsets into the string
+	 section. Textures which are absent are stored as
+	 @c MAGE_MDLB_INVALID_INDEX.
+	 */
+	struct MDLBMaterial final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The offset of the name of this material.
+		 */
+		U32 m_name;
+
+		/**
+		 The offset of the filename of the base color texture of this
+		 material.
+		 */
+		U32 m_base_color_texture;
+
+		/**
+		 The offset of the filename of the material texture of this material.
+		 */
+		U32 m_material_texture;
+
+		/**
+		 The offset of the filename of the normal texture of this material.
+		 */
+		U32 m_normal_texture;
+
+		/**
+		 The sRGBA base color of this material.
+		 */
+		F32x4 m_base_color;
+
+		/**
+		 The roughness of this material.
+		 */
+		F32 m_roughness;
+
+		/**
+		 The metalness of this material.
+		 */
+		F32 m_metalness;
+
+		/**
+		 The flags of this material.
+		 */
+		U32 m_flags;
+
+		/**
+		 Padding (must be zero).
+		 */
+		U32 m_padding;
+	};
+
+	static_assert(48 == sizeof(MDLBMaterial), "MDLB material size mismatch");
+
+	/**
+	 Rounds the given offset up to the MDLB section alignment.
+
+	 @param[in]		offset
+					The offset in bytes.
+	 @return		The smallest multiple of @c MAGE_MDLB_SECTION_ALIGNMENT
+					which is greater than or equal to @a offset.
+	 */
+	constexpr U64 AlignMDLBSectionOffset(U64 offset) noexcept {
+		return (offset + (MAGE_MDLB_SECTION_ALIGNMENT - 1u))
+			& ~static_cast< U64 >(MAGE_MDLB_SECTION_ALIGNMENT - 1u);
+	}
+
+	/**
+	 Returns the string at the given offset in the given MDLB string section.
+
+	 @param[in]		strings
+					A pointer to the string section.
+	 @param[in]		size
+					The size in bytes of the string section.
+	 @param[in]		offset
+					The offset in bytes of the string.
+	 @return		A pointer to the null-terminated string, or @c nullptr 
+					if @a offset does not refer to a null-terminated string 
+					inside the string section.
+	 */
+	inline const char *GetMDLBString(const char *strings, 
+		size_t size, U32 offset) noexcept {
+
+		if (size <= offset) {
+			return nullptr;
+		}
+
+		const char * const str = strings + offset;
+		return std::memchr(str, '\0', size - offset) ? str : nullptr;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "model\model_output.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 Imports the model from the given MDLB file.
+
+	 The MDLB file is memory-mapped and the mesh view of the given model 
+	 output refers to the vertices and indices inside the mapped file.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @param[in]		fname
+					A reference to the MDLB filename.
+	 @param[out]	model_output
+					A reference to the model output.
+	 @throws		FormattedException
+					Failed to import the model from file.
+	 */
+	template < typename VertexT >
+	void ImportMDLBModelFromFile(const wstring &fname,
+		ModelOutput< VertexT > &model_output);
+
+	/**
+	 Exports the given model to the given MDLB file.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @param[in]		fname
+					A reference to the MDLB filename.
+	 @param[in]		model_output
+					A reference to the model output.
+	 @throws		FormattedException
+					Failed to export the model to file.
+	 */
+	template < typename VertexT >
+	void ExportMDLBModelToFile(const wstring &fname,
+		const ModelOutput< VertexT > &model_output);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\mdlb\mdlb_loader.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\mdlb\mdlb_reader.hpp"
+#include "loaders\mdlb\mdlb_writer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template < typename VertexT >
+	void ImportMDLBModelFromFile(const wstring &fname,
+		ModelOutput< VertexT > &model_output) {
+		
+		MDLBReader< VertexT > reader(model_output);
+		reader.ReadFromFile(fname);
+	}
+
+	template < typename VertexT >
+	void ExportMDLBModelToFile(const wstring &fname,
+		const ModelOutput< VertexT > &model_output) {
+		
+		MDLBWriter< VertexT > writer(model_output);
+		writer.WriteToFile(fname);
+	}
+}
\ No newline at end of file
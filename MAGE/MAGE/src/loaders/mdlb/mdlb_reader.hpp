@@ -0,0 +1,218 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\mdlb\mdlb_header.hpp"
+#include "model\model_output.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of MDLB file readers for reading models.
+
+	 MDLB files are memory-mapped and prefetched with a single sequential
+	 read. The vertices and indices are used in place (i.e. without copying
+	 them to intermediate buffers), while the model parts and materials are
+	 decoded from their records.
+
+	 @tparam		VertexT
+					The vertex type.
+	 */
+	template< typename VertexT >
+	class MDLBReader final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a MDLB reader.
+
+		 @param[in]		model_output
+						A reference to a model output for storing the read
+						data from file.
+		 */
+		explicit MDLBReader(ModelOutput< VertexT > &model_output);
+
+		/**
+		 Constructs a MDLB reader from the given MDLB reader.
+
+		 @param[in]		reader
+						A reference to the MDLB reader to copy.
+		 */
+		MDLBReader(const MDLBReader &reader) = delete;
+
+		/**
+		 Constructs a MDLB reader by moving the given MDLB reader.
+
+		 @param[in]		reader
+						A reference to the MDLB reader to move.
+		 */
+		MDLBReader(MDLBReader &&reader);
+
+		/**
+		 Destructs this MDLB reader.
+		 */
+		~MDLBReader();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given MDLB reader to this MDLB reader.
+
+		 @param[in]		reader
+						A reference to a MDLB reader to copy.
+		 @return		A reference to the copy of the given MDLB reader (i.e.
+						this MDLB reader).
+		 */
+		MDLBReader &operator=(const MDLBReader &reader) = delete;
+
+		/**
+		 Moves the given MDLB reader to this MDLB reader.
+
+		 @param[in]		reader
+						A reference to a MDLB reader to move.
+		 @return		A reference to the moved MDLB reader (i.e. this MDLB
+						reader).
+		 */
+		MDLBReader &operator=(MDLBReader &&reader) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Reads from the given file.
+
+		 @param[in]		fname
+						The filename.
+		 @throws		FormattedException
+						Failed to read from the given file.
+		 */
+		void ReadFromFile(wstring fname);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Reads and validates the header of the given MDLB file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file.
+		 @return		A reference to the header of the given file.
+		 @throws		FormattedException
+						Failed to read from the given file.
+		 */
+		const MDLBHeader &ReadHeader(const MappedFile &file);
+
+		/**
+		 Reads the mesh of the given MDLB file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file.
+		 @param[in]		header
+						A reference to the header of the given file.
+		 */
+		void ReadMesh(const MappedFile &file, const MDLBHeader &header);
+
+		/**
+		 Reads the materials of the given MDLB file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file.
+		 @param[in]		header
+						A reference to the header of the given file.
+		 @throws		FormattedException
+						Failed to read from the given file.
+		 */
+		void ReadMaterials(const MappedFile &file, const MDLBHeader &header);
+
+		/**
+		 Reads the model parts of the given MDLB file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file.
+		 @param[in]		header
+						A reference to the header of the given file.
+		 @throws		FormattedException
+						Failed to read from the given file.
+		 */
+		void ReadModelParts(const MappedFile &file, const MDLBHeader &header);
+
+		/**
+		 Reads the mesh clusters of the given MDLB file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file.
+		 @param[in]		header
+						A reference to the header of the given file.
+		 @throws		FormattedException
+						Failed to read from the given file.
+		 */
+		void ReadClusters(const MappedFile &file, const MDLBHeader &header);
+
+		/**
+		 Reads the string at the given offset of the given MDLB file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file.
+		 @param[in]		header
+						A reference to the header of the given file.
+		 @param[in]		offset
+						The offset in bytes of the string in the string
+						section.
+		 @return		The string at the given offset.
+		 @throws		FormattedException
+						Failed to read from the given file.
+		 */
+		static const string ReadString(const MappedFile &file,
+			const MDLBHeader &header, U32 offset);
+
+		/**
+		 Returns the given section of the given MDLB file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file.
+		 @param[in]		header
+						A reference to the header of the given file.
+		 @param[in]		type
+						The section type.
+		 @return		A pointer to the first byte of the given section.
+		 */
+		static const U8 *GetSection(const MappedFile &file,
+			const MDLBHeader &header, MDLBSectionType type) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the model output of this MDLB reader.
+		 */
+		ModelOutput< VertexT > &m_model_output;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\mdlb\mdlb_reader.tpp"
+
+#pragma endregion
\ No newline at end of file
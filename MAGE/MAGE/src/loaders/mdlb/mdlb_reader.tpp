@@ -0,0 +1,304 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "texture\texture_factory.hpp"
+#include "utils\string\string_utils.hpp"
+#include "utils\exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename VertexT >
+	MDLBReader< VertexT >::MDLBReader(ModelOutput< VertexT > &model_output)
+		: m_model_output(model_output) {}
+
+	template< typename VertexT >
+	MDLBReader< VertexT >::MDLBReader(MDLBReader &&reader) = default;
+
+	template< typename VertexT >
+	MDLBReader< VertexT >::~MDLBReader() = default;
+
+	template< typename VertexT >
+	void MDLBReader< VertexT >::ReadFromFile(wstring fname) {
+		UniquePtr< MappedFile > file = MakeUnique< MappedFile >(std::move(fname));
+
+		ThrowIfFailed(m_model_output.m_vertex_buffer.empty(),
+			"%ls: vertex buffer must be empty.", file->GetFilename().c_str());
+		ThrowIfFailed(m_model_output.m_index_buffer.empty(),
+			"%ls: index buffer must be empty.", file->GetFilename().c_str());
+		ThrowIfFailed(!m_model_output.m_mesh_view.IsMapped(),
+			"%ls: mesh view must be empty.", file->GetFilename().c_str());
+		ThrowIfFailed(m_model_output.m_cluster_buffer.empty(),
+			"%ls: cluster buffer must be empty.", file->GetFilename().c_str());
+
+		// Read the whole model with one sequential read instead of faulting
+		// in the sections page by page.
+		file->Prefetch();
+
+		const MDLBHeader &header = ReadHeader(*file);
+		ReadMesh(*file, header);
+		ReadMaterials(*file, header);
+		ReadModelParts(*file, header);
+		ReadClusters(*file, header);
+
+		// The vertices and indices point into the mapped file.
+		m_model_output.m_mesh_view.m_file = std::move(file);
+	}
+
+	template< typename VertexT >
+	const MDLBHeader &MDLBReader< VertexT >::ReadHeader(const MappedFile &file) {
+		const wchar_t * const fname = file.GetFilename().c_str();
+		const U8  * const data = file.GetData();
+		const size_t      size = file.GetSize();
+
+		ThrowIfFailed((sizeof(MDLBHeader) <= size
+			        && 0 == std::memcmp(data, MAGE_MDLB_MAGIC, 
+			                           sizeof(MDLBHeader::m_magic))),
+			"%ls: invalid model header.", fname);
+
+		// Mapped views are page aligned.
+		const MDLBHeader &header = *reinterpret_cast< const MDLBHeader * >(data);
+
+		ThrowIfFailed((MAGE_MDLB_VERSION == header.m_version),
+			"%ls: unsupported model version: %u.", fname, header.m_version);
+		ThrowIfFailed((sizeof(VertexT) == header.m_vertex_size),
+			"%ls: vertex size mismatch: %u instead of %zu.",
+			fname, header.m_vertex_size, sizeof(VertexT));
+		ThrowIfFailed((sizeof(U16) == header.m_index_size
+			        || sizeof(U32) == header.m_index_size),
+			"%ls: unsupported index size: %u.", fname, header.m_index_size);
+
+		const U64 expected_sizes[] = {
+			static_cast< U64 >(header.m_nb_vertices)    * header.m_vertex_size,
+			static_cast< U64 >(header.m_nb_indices)     * header.m_index_size,
+			static_cast< U64 >(header.m_nb_model_parts) * sizeof(MDLBModelPart),
+			static_cast< U64 >(header.m_nb_materials)   * sizeof(MDLBMaterial),
+			static_cast< U64 >(header.m_nb_clusters)    * sizeof(MeshCluster),
+			static_cast< U64 >(header.m_nb_lods)        * sizeof(ModelLOD)
+		};
+
+		for (size_t i = 0; i < _countof(header.m_sections); ++i) {
+			const MDLBSection &section = header.m_sections[i];
+
+			ThrowIfFailed((0 == section.m_offset % MAGE_MDLB_SECTION_ALIGNMENT),
+				"%ls: misaligned model section: %zu.", fname, i);
+			ThrowIfFailed((sizeof(MDLBHeader) <= section.m_offset
+				        && section.m_offset <= size
+				        && section.m_size <= size - section.m_offset),
+				"%ls: model section out of bounds: %zu.", fname, i);
+			ThrowIfFailed((_countof(expected_sizes) <= i
+				        || expected_sizes[i] == section.m_size),
+				"%ls: model section size mismatch: %zu.", fname, i);
+		}
+
+		return header;
+	}
+
+	template< typename VertexT >
+	void MDLBReader< VertexT >::ReadMesh(const MappedFile &file,
+		const MDLBHeader &header) {
+
+		MeshView< VertexT > &mesh = m_model_output.m_mesh_view;
+
+		mesh.m_vertices    = reinterpret_cast< const VertexT * >(
+			GetSection(file, header, MDLBSectionType::Vertices));
+		mesh.m_nb_vertices = header.m_nb_vertices;
+		mesh.m_indices     = GetSection(file, header, MDLBSectionType::Indices);
+		mesh.m_nb_indices  = header.m_nb_indices;
+		mesh.m_index_size  = header.m_index_size;
+	}
+
+	template< typename VertexT >
+	void MDLBReader< VertexT >::ReadMaterials(const MappedFile &file,
+		const MDLBHeader &header) {
+
+		const MDLBMaterial * const records
+			= reinterpret_cast< const MDLBMaterial * >(
+				GetSection(file, header, MDLBSectionType::Materials));
+
+		const auto read_texture = [&file, &header](U32 offset) 
+			-> SharedPtr< const Texture > {
+			
+			if (MAGE_MDLB_INVALID_INDEX == offset) {
+				return nullptr;
+			}
+			
+			return CreateTextureFromFile(
+				str_convert(ReadString(file, header, offset)));
+		};
+
+		m_model_output.m_material_buffer.reserve(
+			m_model_output.m_material_buffer.size() + header.m_nb_materials);
+
+		for (U32 i = 0u; i < header.m_nb_materials; ++i) {
+			const MDLBMaterial &record = records[i];
+
+			Material material(ReadString(file, header, record.m_name));
+			material.GetBaseColor() = SRGBA(record.m_base_color.m_x,
+				                            record.m_base_color.m_y,
+				                            record.m_base_color.m_z,
+				                            record.m_base_color.m_w);
+			material.SetRoughness(record.m_roughness);
+			material.SetMetalness(record.m_metalness);
+			material.SetLightInteraction(
+				0u != (record.m_flags & MAGE_MDLB_MATERIAL_LIGHT_INTERACTION));
+			material.SetTransparent(
+				0u != (record.m_flags & MAGE_MDLB_MATERIAL_TRANSPARENT));
+			material.SetBaseColorTexture(read_texture(record.m_base_color_texture));
+			material.SetMaterialTexture(read_texture(record.m_material_texture));
+			material.SetNormalTexture(read_texture(record.m_normal_texture));
+
+			m_model_output.m_material_buffer.push_back(std::move(material));
+		}
+	}
+
+	template< typename VertexT >
+	void MDLBReader< VertexT >::ReadModelParts(const MappedFile &file,
+		const MDLBHeader &header) {
+
+		const wchar_t * const fname = file.GetFilename().c_str();
+
+		const MDLBModelPart * const records
+			= reinterpret_cast< const MDLBModelPart * >(
+				GetSection(file, header, MDLBSectionType::ModelParts));
+		const MDLBMaterial * const materials
+			= reinterpret_cast< const MDLBMaterial * >(
+				GetSection(file, header, MDLBSectionType::Materials));
+		const ModelLOD * const lods
+			= reinterpret_cast< const ModelLOD * >(
+				GetSection(file, header, MDLBSectionType::LODs));
+
+		m_model_output.m_model_parts.reserve(
+			m_model_output.m_model_parts.size() + header.m_nb_model_parts);
+
+		for (U32 i = 0u; i < header.m_nb_model_parts; ++i) {
+			const MDLBModelPart &record = records[i];
+
+			ThrowIfFailed((MAGE_MDLB_INVALID_INDEX == record.m_material
+				        || record.m_material < header.m_nb_materials),
+				"%ls: model part %u: invalid material index: %u.",
+				fname, i, record.m_material);
+			ThrowIfFailed((record.m_start_index <= header.m_nb_indices
+				        && record.m_nb_indices
+				           <= header.m_nb_indices - record.m_start_index),
+				"%ls: model part %u: index range out of bounds.", fname, i);
+			ThrowIfFailed((record.m_base_vertex <= header.m_nb_vertices),
+				"%ls: model part %u: base vertex out of bounds.", fname, i);
+			ThrowIfFailed((record.m_first_cluster <= header.m_nb_clusters
+				        && record.m_nb_clusters
+				           <= header.m_nb_clusters - record.m_first_cluster),
+				"%ls: model part %u: cluster range out of bounds.", fname, i);
+			ThrowIfFailed((record.m_first_lod <= header.m_nb_lods
+				        && record.m_nb_lods
+				           <= header.m_nb_lods - record.m_first_lod),
+				"%ls: model part %u: LOD range out of bounds.", fname, i);
+
+			for (U32 j = record.m_first_lod; 
+				 j < record.m_first_lod + record.m_nb_lods; ++j) {
+				
+				const ModelLOD &lod = lods[j];
+				ThrowIfFailed((lod.m_start_index <= header.m_nb_indices
+					        && lod.m_nb_indices
+					           <= header.m_nb_indices - lod.m_start_index),
+					"%ls: LOD %u: index range out of bounds.", fname, j);
+				ThrowIfFailed((lod.m_first_cluster <= header.m_nb_clusters
+					        && lod.m_nb_clusters
+					           <= header.m_nb_clusters - lod.m_first_cluster),
+					"%ls: LOD %u: cluster range out of bounds.", fname, j);
+			}
+
+			ModelPart model_part;
+			model_part.m_child       = ReadString(file, header, record.m_child);
+			model_part.m_parent      = ReadString(file, header, record.m_parent);
+			model_part.m_translation = record.m_translation;
+			model_part.m_rotation    = record.m_rotation;
+			model_part.m_scale       = record.m_scale;
+			if (MAGE_MDLB_INVALID_INDEX != record.m_material) {
+				model_part.m_material = ReadString(file, header,
+					materials[record.m_material].m_name);
+			}
+			model_part.m_start_index = record.m_start_index;
+			model_part.m_nb_indices  = record.m_nb_indices;
+			model_part.m_base_vertex   = record.m_base_vertex;
+			model_part.m_first_cluster = record.m_first_cluster;
+			model_part.m_nb_clusters   = record.m_nb_clusters;
+			model_part.m_lods.assign(lods + record.m_first_lod, 
+				lods + record.m_first_lod + record.m_nb_lods);
+			model_part.m_aabb        = AABB(Point3(record.m_aabb_min),
+				                            Point3(record.m_aabb_max));
+			model_part.m_bs          = BS(Point3(record.m_bs_centroid),
+				                          record.m_bs_radius);
+
+			// The bounding volumes are stored in the file.
+			m_model_output.AddModelPart(std::move(model_part), false);
+		}
+	}
+
+	template< typename VertexT >
+	void MDLBReader< VertexT >::ReadClusters(const MappedFile &file,
+		const MDLBHeader &header) {
+
+		const wchar_t * const fname = file.GetFilename().c_str();
+
+		const MeshCluster * const clusters
+			= reinterpret_cast< const MeshCluster * >(
+				GetSection(file, header, MDLBSectionType::Clusters));
+
+		for (U32 i = 0u; i < header.m_nb_clusters; ++i) {
+			const MeshCluster &cluster = clusters[i];
+
+			ThrowIfFailed((cluster.m_start_index <= header.m_nb_indices
+				        && cluster.m_nb_indices 
+				           <= header.m_nb_indices - cluster.m_start_index),
+				"%ls: mesh cluster %u: index range out of bounds.", fname, i);
+		}
+
+		// The mesh clusters are copied since they outlive the mapped file.
+		m_model_output.m_cluster_buffer.assign(
+			clusters, clusters + header.m_nb_clusters);
+	}
+
+	template< typename VertexT >
+	const string MDLBReader< VertexT >::ReadString(const MappedFile &file,
+		const MDLBHeader &header, U32 offset) {
+
+		const MDLBSection &section = header.m_sections[
+			static_cast< size_t >(MDLBSectionType::Strings)];
+
+		const char * const str = GetMDLBString(
+			reinterpret_cast< const char * >(
+				GetSection(file, header, MDLBSectionType::Strings)),
+			static_cast< size_t >(section.m_size), offset);
+		ThrowIfFailed((nullptr != str),
+			"%ls: invalid string offset: %u.",
+			file.GetFilename().c_str(), offset);
+
+		return string(str);
+	}
+
+	template< typename VertexT >
+	inline const U8 *MDLBReader< VertexT >::GetSection(const MappedFile &file,
+		const MDLBHeader &header, MDLBSectionType type) noexcept {
+
+		const MDLBSection &section
+			= header.m_sections[static_cast< size_t >(type)];
+		return file.GetData() + section.m_offset;
+	}
+}
\ No newline at end of file
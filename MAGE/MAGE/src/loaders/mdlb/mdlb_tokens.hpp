@@ -0,0 +1,15 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+#define MAGE_MDLB_MAGIC                      "MAGEMDLB"
+#define MAGE_MDLB_VERSION                    4u
+#define MAGE_MDLB_SECTION_ALIGNMENT          16u
+#define MAGE_MDLB_INVALID_INDEX              0xFFFFFFFFu
+#define MAGE_MDLB_MATERIAL_LIGHT_INTERACTION 1u
+#define MAGE_MDLB_MATERIAL_TRANSPARENT       2u
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,181 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\mdlb\mdlb_header.hpp"
+#include "model\model_output.hpp"
+#include "utils\io\binary_writer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of MDLB file writers for writing models.
+
+	 @tparam		VertexT
+					The vertex type.
+	 */
+	template< typename VertexT >
+	class MDLBWriter final : public BigEndianBinaryWriter {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a MDLB writer.
+
+		 @param[in]		model_output
+						A reference to the model output.
+		 */
+		explicit MDLBWriter(const ModelOutput< VertexT > &model_output);
+
+		/**
+		 Constructs a MDLB writer from the given MDLB writer.
+
+		 @param[in]		writer
+						A reference to the MDLB writer to copy.
+		 */
+		MDLBWriter(const MDLBWriter &writer) = delete;
+
+		/**
+		 Constructs a MDLB writer by moving the given MDLB writer.
+
+		 @param[in]		writer
+						A reference to the MDLB writer to move.
+		 */
+		MDLBWriter(MDLBWriter &&writer);
+
+		/**
+		 Destructs this MDLB writer.
+		 */
+		virtual ~MDLBWriter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given MDLB writer to this MDLB writer.
+
+		 @param[in]		writer
+						A reference to a MDLB writer to copy.
+		 @return		A reference to the copy of the given MDLB writer (i.e.
+						this MDLB writer).
+		 */
+		MDLBWriter &operator=(const MDLBWriter &writer) = delete;
+
+		/**
+		 Moves the given MDLB writer to this MDLB writer.
+
+		 @param[in]		writer
+						A reference to a MDLB writer to move.
+		 @return		A reference to the moved MDLB writer (i.e. this MDLB
+						writer).
+		 */
+		MDLBWriter &operator=(MDLBWriter &&writer) = delete;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts writing.
+
+		 @throws		FormattedException
+						Failed to write.
+		 */
+		virtual void Write() override;
+
+		/**
+		 Encodes the materials of the model output of this MDLB writer.
+		 */
+		void EncodeMaterials();
+
+		/**
+		 Encodes the model parts of the model output of this MDLB writer.
+
+		 @throws		FormattedException
+						A model part refers to an unknown material.
+		 */
+		void EncodeModelParts();
+
+		/**
+		 Adds the given string to the string section of this MDLB writer.
+
+		 @param[in]		str
+						A reference to the string.
+		 @return		The offset in bytes of the given string in the string
+						section.
+		 */
+		U32 AddString(const string &str);
+
+		/**
+		 Writes zero-valued padding bytes up to the given offset.
+
+		 @param[in]		offset
+						The current offset in bytes.
+		 @param[in]		aligned_offset
+						The aligned offset in bytes.
+		 @throws		FormattedException
+						Failed to write.
+		 */
+		void WritePadding(U64 offset, U64 aligned_offset);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the model output of this MDLB writer.
+		 */
+		const ModelOutput< VertexT > &m_model_output;
+
+		/**
+		 A vector containing the encoded model parts of this MDLB writer.
+		 */
+		vector< MDLBModelPart > m_model_parts;
+
+		/**
+		 A vector containing the LODs of the encoded model parts of this MDLB 
+		 writer.
+		 */
+		vector< ModelLOD > m_lods;
+
+		/**
+		 A vector containing the encoded materials of this MDLB writer.
+		 */
+		vector< MDLBMaterial > m_materials;
+
+		/**
+		 A vector containing the null-terminated strings of this MDLB writer.
+		 */
+		vector< char > m_strings;
+
+		/**
+		 A mapping between the strings and their offsets in the string
+		 section of this MDLB writer.
+		 */
+		map< string, U32 > m_string_offsets;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\mdlb\mdlb_writer.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,258 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "utils\string\string_utils.hpp"
+#include "utils\logging\error.hpp"
+#include "utils\exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename VertexT >
+	MDLBWriter< VertexT >::MDLBWriter(const ModelOutput< VertexT > &model_output)
+		: BigEndianBinaryWriter(),
+		m_model_output(model_output),
+		m_model_parts(),
+		m_lods(),
+		m_materials(),
+		m_strings(),
+		m_string_offsets() {}
+
+	template< typename VertexT >
+	MDLBWriter< VertexT >::MDLBWriter(MDLBWriter &&writer) = default;
+
+	template< typename VertexT >
+	MDLBWriter< VertexT >::~MDLBWriter() = default;
+
+	template< typename VertexT >
+	void MDLBWriter< VertexT >::Write() {
+		const wstring &fname = GetFilename();
+
+		const MeshView< VertexT > &mesh_view = m_model_output.m_mesh_view;
+		ThrowIfFailed((!mesh_view.IsMapped()
+			        || mesh_view.m_file->GetFilename() != fname),
+			"%ls: cannot overwrite the mapped model file.", fname.c_str());
+
+		const void *vertices;
+		size_t nb_vertices;
+		const void *indices;
+		size_t nb_indices;
+		size_t index_size;
+		if (mesh_view.IsMapped()) {
+			vertices    = mesh_view.m_vertices;
+			nb_vertices = mesh_view.m_nb_vertices;
+			indices     = mesh_view.m_indices;
+			nb_indices  = mesh_view.m_nb_indices;
+			index_size  = mesh_view.m_index_size;
+		}
+		else {
+			vertices    = m_model_output.m_vertex_buffer.data();
+			nb_vertices = m_model_output.m_vertex_buffer.size();
+			indices     = m_model_output.m_index_buffer.data();
+			nb_indices  = m_model_output.m_index_buffer.size();
+			index_size  = sizeof(U32);
+		}
+
+		vector< U16 > u16_indices;
+		if (!mesh_view.IsMapped() && m_model_output.HasU16Indices()) {
+			u16_indices = m_model_output.GetU16IndexBuffer();
+			indices     = u16_indices.data();
+			index_size  = sizeof(U16);
+		}
+
+		EncodeMaterials();
+		EncodeModelParts();
+
+		MDLBHeader header = {};
+		std::memcpy(header.m_magic, MAGE_MDLB_MAGIC, sizeof(header.m_magic));
+		header.m_version        = MAGE_MDLB_VERSION;
+		header.m_vertex_size    = static_cast< U32 >(sizeof(VertexT));
+		header.m_index_size     = static_cast< U32 >(index_size);
+		header.m_nb_vertices    = static_cast< U32 >(nb_vertices);
+		header.m_nb_indices     = static_cast< U32 >(nb_indices);
+		header.m_nb_model_parts = static_cast< U32 >(m_model_parts.size());
+		header.m_nb_materials   = static_cast< U32 >(m_materials.size());
+		header.m_nb_clusters    
+			= static_cast< U32 >(m_model_output.m_cluster_buffer.size());
+		header.m_nb_lods        = static_cast< U32 >(m_lods.size());
+
+		const U64 section_sizes[] = {
+			static_cast< U64 >(nb_vertices) * sizeof(VertexT),
+			static_cast< U64 >(nb_indices)  * index_size,
+			static_cast< U64 >(m_model_parts.size()) * sizeof(MDLBModelPart),
+			static_cast< U64 >(m_materials.size())   * sizeof(MDLBMaterial),
+			static_cast< U64 >(header.m_nb_clusters) * sizeof(MeshCluster),
+			static_cast< U64 >(m_lods.size())        * sizeof(ModelLOD),
+			static_cast< U64 >(m_strings.size())
+		};
+		static_assert(_countof(section_sizes)
+			== static_cast< size_t >(MDLBSectionType::Count),
+			"MDLB section count mismatch");
+
+		// The sections are stored contiguously in the order of the table of
+		// contents, so that the whole model is read with one sequential read.
+		U64 offset = sizeof(MDLBHeader);
+		for (size_t i = 0; i < _countof(section_sizes); ++i) {
+			header.m_sections[i].m_offset = offset;
+			header.m_sections[i].m_size   = section_sizes[i];
+			offset = AlignMDLBSectionOffset(offset + section_sizes[i]);
+		}
+
+		const void * const sections[] = {
+			vertices,
+			indices,
+			m_model_parts.data(),
+			m_materials.data(),
+			m_model_output.m_cluster_buffer.data(),
+			m_lods.data(),
+			m_strings.data()
+		};
+
+		WriteValue(header);
+		for (size_t i = 0; i < _countof(section_sizes); ++i) {
+			const MDLBSection &section = header.m_sections[i];
+
+			if (0 != section.m_size) {
+				WriteValueArray(static_cast< const U8 * >(sections[i]),
+					            static_cast< size_t >(section.m_size));
+			}
+			WritePadding(section.m_offset + section.m_size,
+				AlignMDLBSectionOffset(section.m_offset + section.m_size));
+		}
+	}
+
+	template< typename VertexT >
+	void MDLBWriter< VertexT >::EncodeMaterials() {
+		const auto encode_texture
+			= [this](const SharedPtr< const Texture > &texture) {
+
+			return texture ? AddString(str_convert(texture->GetFilename()))
+				           : MAGE_MDLB_INVALID_INDEX;
+		};
+
+		m_materials.clear();
+		m_materials.reserve(m_model_output.m_material_buffer.size());
+
+		for (const auto &material : m_model_output.m_material_buffer) {
+			const SRGBA &base_color = material.GetBaseColor();
+
+			MDLBMaterial record;
+			record.m_name               = AddString(material.GetName());
+			record.m_base_color_texture
+				= encode_texture(material.GetBaseColorTexture());
+			record.m_material_texture
+				= encode_texture(material.GetMaterialTexture());
+			record.m_normal_texture
+				= encode_texture(material.GetNormalTexture());
+			record.m_base_color         = F32x4(base_color.m_x, base_color.m_y,
+				                                base_color.m_z, base_color.m_w);
+			record.m_roughness          = material.GetRoughness();
+			record.m_metalness          = material.GetMetalness();
+			record.m_flags
+				= (material.InteractsWithLight()
+					? MAGE_MDLB_MATERIAL_LIGHT_INTERACTION : 0u)
+				| (!material.IsOpaque()
+					? MAGE_MDLB_MATERIAL_TRANSPARENT : 0u);
+			record.m_padding            = 0u;
+
+			m_materials.push_back(record);
+		}
+	}
+
+	template< typename VertexT >
+	void MDLBWriter< VertexT >::EncodeModelParts() {
+		const vector< Material > &materials = m_model_output.m_material_buffer;
+
+		m_model_parts.clear();
+		m_model_parts.reserve(m_model_output.m_model_parts.size());
+		m_lods.clear();
+
+		for (const auto &model_part : m_model_output.m_model_parts) {
+			U32 material_index = MAGE_MDLB_INVALID_INDEX;
+			if (!model_part.HasDefaultMaterial()) {
+				for (size_t i = 0; i < materials.size(); ++i) {
+					if (materials[i].GetName() == model_part.m_material) {
+						material_index = static_cast< U32 >(i);
+						break;
+					}
+				}
+
+				ThrowIfFailed((MAGE_MDLB_INVALID_INDEX != material_index),
+					"%ls: model part %s: unknown material: %s.",
+					GetFilename().c_str(), model_part.m_child.c_str(),
+					model_part.m_material.c_str());
+			}
+
+			MDLBModelPart record;
+			record.m_child       = AddString(model_part.m_child);
+			record.m_parent      = AddString(model_part.m_parent);
+			record.m_material    = material_index;
+			record.m_start_index = model_part.m_start_index;
+			record.m_nb_indices  = model_part.m_nb_indices;
+			record.m_base_vertex = model_part.m_base_vertex;
+			record.m_translation = model_part.m_translation;
+			record.m_rotation    = model_part.m_rotation;
+			record.m_scale       = model_part.m_scale;
+			record.m_aabb_min    = model_part.m_aabb.m_p_min;
+			record.m_aabb_max    = model_part.m_aabb.m_p_max;
+			record.m_bs_centroid = model_part.m_bs.m_p;
+			record.m_bs_radius     = model_part.m_bs.m_r;
+			record.m_first_cluster = model_part.m_first_cluster;
+			record.m_nb_clusters   = model_part.m_nb_clusters;
+			record.m_first_lod     = static_cast< U32 >(m_lods.size());
+			record.m_nb_lods       = static_cast< U32 >(model_part.m_lods.size());
+			record.m_padding[0]    = 0u;
+			record.m_padding[1]    = 0u;
+			record.m_padding[2]    = 0u;
+
+			m_lods.insert(m_lods.end(), 
+				model_part.m_lods.cbegin(), model_part.m_lods.cend());
+
+			m_model_parts.push_back(record);
+		}
+	}
+
+	template< typename VertexT >
+	U32 MDLBWriter< VertexT >::AddString(const string &str) {
+		const auto it = m_string_offsets.find(str);
+		if (m_string_offsets.end() != it) {
+			return it->second;
+		}
+
+		const U32 offset = static_cast< U32 >(m_strings.size());
+		m_strings.insert(m_strings.end(), str.c_str(), str.c_str() + str.size() + 1);
+		m_string_offsets.emplace(str, offset);
+
+		return offset;
+	}
+
+	template< typename VertexT >
+	void MDLBWriter< VertexT >::WritePadding(U64 offset, U64 aligned_offset) {
+		Assert(offset <= aligned_offset);
+		Assert(aligned_offset - offset < MAGE_MDLB_SECTION_ALIGNMENT);
+
+		static const U8 padding[MAGE_MDLB_SECTION_ALIGNMENT] = {};
+
+		const size_t nb_bytes = static_cast< size_t >(aligned_offset - offset);
+		if (0 != nb_bytes) {
+			WriteValueArray(padding, nb_bytes);
+		}
+	}
+}
\ No newline at end of file
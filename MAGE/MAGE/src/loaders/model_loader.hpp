@@ -49,6 +49,28 @@ namespace mage {
 	template < typename VertexT >
 	void ExportModelToFile(const wstring &fname, 
 		const ModelOutput< VertexT > &model_output);
+
+	/**
+	 Converts the model of the given file to a packed MDLB file.
+
+	 The MDLB file has the same filename as the given file, but with the 
+	 MDLB file extension. All materials, model parts and bounding volumes are 
+	 packed together with the mesh in the MDLB file, so that loading the 
+	 model afterwards requires a single file read.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @param[in]		fname
+					A reference to the filename of the model to convert.
+	 @param[in]		mesh_desc
+					A reference to the mesh descriptor.
+	 @return		The filename of the MDLB file.
+	 @throws		FormattedException
+					Failed to convert the model.
+	 */
+	template < typename VertexT >
+	const wstring ConvertModelToMDLBFile(const wstring &fname, 
+		const MeshDescriptor< VertexT > &mesh_desc = MeshDescriptor< VertexT >());
 }
 
 //-----------------------------------------------------------------------------
@@ -6,11 +6,22 @@
 #pragma region
 
 #include "loaders\mdl\mdl_loader.hpp"
+#include "loaders\mdlb\mdlb_loader.hpp"
 #include "loaders\obj\obj_loader.hpp"
+#include "utils\logging\error.hpp"
 #include "utils\exception\exception.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -26,6 +37,9 @@ namespace mage {
 		if (extension == L"mdl" || extension == L"MDL") {
 			ImportMDLModelFromFile(fname, model_output);
 		} 
+		else if (extension == L"mdlb" || extension == L"MDLB") {
+			ImportMDLBModelFromFile(fname, model_output);
+		}
 		else if (extension == L"obj" || extension == L"OBJ") {
 			ImportOBJMeshFromFile(fname, model_output, mesh_desc);
 		}
@@ -33,6 +47,54 @@ namespace mage {
 			throw FormattedException(
 				"Unknown model file extension: %ls", fname.c_str());
 		}
+
+		// Mapped meshes are stored optimized.
+		if (mesh_desc.OptimizeMesh() 
+			&& !model_output.m_mesh_view.IsMapped()
+			&& !model_output.m_index_buffer.empty()) {
+
+			VertexCacheStatistics before;
+			VertexCacheStatistics after;
+			model_output.Optimize(before, after);
+
+			Info("%ls: ACMR: %.3f -> %.3f, ATVR: %.3f -> %.3f.", 
+				fname.c_str(), before.GetACMR(), after.GetACMR(), 
+				before.GetATVR(), after.GetATVR());
+		}
+
+		// Mapped meshes are stored with their index size.
+		if (!model_output.m_mesh_view.IsMapped()
+			&& !model_output.m_index_buffer.empty()) {
+
+			model_output.RebaseIndices();
+		}
+
+		// Mapped meshes are stored with their LODs, if any. Otherwise, the 
+		// mapped mesh is copied for generating its LODs.
+		if (0 != mesh_desc.GetNumberOfLODs()
+			&& model_output.m_mesh_view.IsMapped()
+			&& std::all_of(model_output.m_model_parts.cbegin(), 
+				           model_output.m_model_parts.cend(), 
+				           [](const ModelPart &model_part) {
+				               return model_part.m_lods.empty();
+			               })) {
+
+			model_output.Unmap();
+		}
+
+		if (0 != mesh_desc.GetNumberOfLODs()
+			&& !model_output.m_mesh_view.IsMapped()
+			&& !model_output.m_index_buffer.empty()) {
+
+			const size_t nb_indices = model_output.m_index_buffer.size();
+			model_output.GenerateLODs(mesh_desc.GetNumberOfLODs());
+
+			Info("%ls: LODs: %zu -> %zu indices.", fname.c_str(), 
+				nb_indices, model_output.m_index_buffer.size());
+		}
+
+		// Mapped meshes are stored with their mesh clusters.
+		model_output.BuildClusters();
 	}
 
 	template < typename VertexT >
@@ -44,9 +106,26 @@ namespace mage {
 		if (extension == L"mdl" || extension == L"MDL") {
 			ExportMDLModelToFile(fname, model_output);
 		}
+		else if (extension == L"mdlb" || extension == L"MDLB") {
+			ExportMDLBModelToFile(fname, model_output);
+		}
 		else {
 			throw FormattedException(
 				"Unknown model file extension: %ls", fname.c_str());
 		}
 	}
+
+	template < typename VertexT >
+	const wstring ConvertModelToMDLBFile(const wstring &fname, 
+		const MeshDescriptor< VertexT > &mesh_desc) {
+
+		const wstring mdlb_fname 
+			= mage::GetFilenameWithoutFileExtension(fname) + L".mdlb";
+		
+		ModelOutput< VertexT > model_output;
+		ImportModelFromFile(fname, model_output, mesh_desc);
+		ExportModelToFile(mdlb_fname, model_output);
+
+		return mdlb_fname;
+	}
 }
\ No newline at end of file
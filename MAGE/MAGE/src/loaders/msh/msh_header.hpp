@@ -0,0 +1,96 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\msh\msh_tokens.hpp"
+#include "utils\type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A struct of MSH (version 2) file headers.
+
+	 All fields are stored in little-endian byte order. The vertex and index
+	 sections start at an offset that is a multiple of
+	 @c MAGE_MSH_SECTION_ALIGNMENT bytes, which allows both sections to be
+	 used directly from a memory-mapped file.
+	 */
+	struct MSHHeader final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The magic of this MSH header (not null-terminated).
+		 */
+		char m_magic[8];
+
+		/**
+		 The version of this MSH header.
+		 */
+		U32 m_version;
+
+		/**
+		 The size in bytes of a vertex.
+		 */
+		U32 m_vertex_size;
+
+		/**
+		 The size in bytes of an index (2 or 4).
+		 */
+		U32 m_index_size;
+
+		/**
+		 The number of vertices.
+		 */
+		U32 m_nb_vertices;
+
+		/**
+		 The number of indices.
+		 */
+		U32 m_nb_indices;
+
+		/**
+		 Padding (must be zero).
+		 */
+		U32 m_padding;
+
+		/**
+		 The offset in bytes of the vertex section from the start of the file.
+		 */
+		U64 m_vertex_offset;
+
+		/**
+		 The offset in bytes of the index section from the start of the file.
+		 */
+		U64 m_index_offset;
+	};
+
+	static_assert(48 == sizeof(MSHHeader), "MSH header size mismatch");
+	static_assert(0 == sizeof(MSHHeader) % MAGE_MSH_SECTION_ALIGNMENT,
+		          "MSH header must be a multiple of the section alignment");
+
+	/**
+	 Rounds the given offset up to the MSH section alignment.
+
+	 @param[in]		offset
+					The offset in bytes.
+	 @return		The smallest multiple of @c MAGE_MSH_SECTION_ALIGNMENT
+					which is greater than or equal to @a offset.
+	 */
+	constexpr U64 AlignMSHSectionOffset(U64 offset) noexcept {
+		return (offset + (MAGE_MSH_SECTION_ALIGNMENT - 1u))
+			& ~static_cast< U64 >(MAGE_MSH_SECTION_ALIGNMENT - 1u);
+	}
+}
\ No newline at end of file
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "utils\type\types.hpp"
+#include "mesh\mesh_view.hpp"
 #include "utils\collection\collection.hpp" 
 
 #pragma endregion
@@ -15,6 +15,24 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	/**
+	 Imports the mesh from the given MSH file.
+
+	 The MSH file is memory-mapped and the given mesh view refers to the 
+	 vertices and indices inside the mapped file.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @param[in]		fname
+					A reference to the MSH filename.
+	 @param[out]	mesh
+					A reference to the mesh view.
+	 @throws		FormattedException
+					Failed to import the mesh from file.
+	 */
+	template < typename VertexT >
+	void ImportMSHMeshFromFile(const wstring &fname, MeshView< VertexT > &mesh);
+
 	/**
 	 Imports the mesh from the given MSH file.
 
@@ -36,6 +54,35 @@ namespace mage {
 	void ImportMSHMeshFromFile(const wstring &fname, 
 		vector< VertexT > &vertices, vector< IndexT > &indices);
 
+	/**
+	 Exports the given mesh to the given MSH file.
+
+	 @pre			If @a nb_vertices is not equal to zero, @a vertices is not 
+					equal to @c nullptr.
+	 @pre			If @a nb_indices is not equal to zero, @a indices is not 
+					equal to @c nullptr.
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		fname
+					A reference to the MSH filename.
+	 @param[in]		vertices
+					A pointer to the vertices of the mesh.
+	 @param[in]		nb_vertices
+					The number of vertices of the mesh.
+	 @param[in]		indices
+					A pointer to the indices of the mesh.
+	 @param[in]		nb_indices
+					The number of indices of the mesh.
+	 @throws		FormattedException
+					Failed to export the mesh to file.
+	 */
+	template < typename VertexT, typename IndexT >
+	void ExportMSHMeshToFile(const wstring &fname,
+		const VertexT *vertices, size_t nb_vertices, 
+		const IndexT *indices, size_t nb_indices);
+
 	/**
 	 Exports the given mesh to the given MSH file.
 
@@ -56,6 +103,22 @@ namespace mage {
 	template < typename VertexT, typename IndexT >
 	void ExportMSHMeshToFile(const wstring &fname,
 		const vector< VertexT > &vertices, const vector< IndexT > &indices);
+
+	/**
+	 Exports the given mesh to the given MSH file.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @param[in]		fname
+					A reference to the MSH filename.
+	 @param[in]		mesh
+					A reference to the mesh view.
+	 @throws		FormattedException
+					Failed to export the mesh to file.
+	 */
+	template < typename VertexT >
+	void ExportMSHMeshToFile(const wstring &fname, 
+		const MeshView< VertexT > &mesh);
 }
 
 //-----------------------------------------------------------------------------
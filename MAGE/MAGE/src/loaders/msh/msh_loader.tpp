@@ -16,18 +16,55 @@
 namespace mage {
 
 	template < typename VertexT >
+	void ImportMSHMeshFromFile(const wstring &fname, MeshView< VertexT > &mesh) {
+		MSHReader< VertexT > reader(mesh);
+		reader.ReadFromFile(fname);
+	}
+
+	template < typename VertexT, typename IndexT >
 	void ImportMSHMeshFromFile(const wstring &fname,
-		vector< VertexT > &vertices, vector < U32 > &indices) {
+		vector< VertexT > &vertices, vector< IndexT > &indices) {
 		
-		MSHReader< VertexT, U32 > reader(vertices, indices);
-		reader.ReadFromFile(fname);
+		MeshView< VertexT > mesh;
+		ImportMSHMeshFromFile(fname, mesh);
+
+		vertices.assign(mesh.m_vertices, mesh.m_vertices + mesh.m_nb_vertices);
+		
+		indices.resize(mesh.m_nb_indices);
+		for (size_t i = 0; i < mesh.m_nb_indices; ++i) {
+			indices[i] = static_cast< IndexT >(mesh.GetIndex(i));
+		}
 	}
 
-	template < typename VertexT >
+	template < typename VertexT, typename IndexT >
 	void ExportMSHMeshToFile(const wstring &fname,
-		const vector< VertexT > &vertices, const vector< U32 > &indices) {
+		const VertexT *vertices, size_t nb_vertices, 
+		const IndexT *indices, size_t nb_indices) {
 		
-		MSHWriter< VertexT, U32 > writer(vertices, indices);
+		MSHWriter< VertexT, IndexT > writer(
+			vertices, nb_vertices, indices, nb_indices);
 		writer.WriteToFile(fname);
 	}
+
+	template < typename VertexT, typename IndexT >
+	void ExportMSHMeshToFile(const wstring &fname,
+		const vector< VertexT > &vertices, const vector< IndexT > &indices) {
+		
+		ExportMSHMeshToFile(fname, vertices.data(), vertices.size(), 
+			indices.data(), indices.size());
+	}
+
+	template < typename VertexT >
+	void ExportMSHMeshToFile(const wstring &fname, 
+		const MeshView< VertexT > &mesh) {
+		
+		if (sizeof(U16) == mesh.m_index_size) {
+			ExportMSHMeshToFile(fname, mesh.m_vertices, mesh.m_nb_vertices, 
+				static_cast< const U16 * >(mesh.m_indices), mesh.m_nb_indices);
+		}
+		else {
+			ExportMSHMeshToFile(fname, mesh.m_vertices, mesh.m_nb_vertices, 
+				static_cast< const U32 * >(mesh.m_indices), mesh.m_nb_indices);
+		}
+	}
 }
\ No newline at end of file
@@ -5,8 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "utils\io\binary_reader.hpp"
-#include "utils\collection\collection.hpp"
+#include "mesh\mesh_view.hpp"
 
 #pragma endregion
 
@@ -18,13 +17,14 @@ namespace mage {
 	/**
 	 A class of MSH file readers for reading meshes.
 
+	 MSH files are memory-mapped and the vertices and indices are used in
+	 place (i.e. without copying them to intermediate buffers).
+
 	 @tparam		VertexT
 					The vertex type.
-	 @tparam		IndexT
-					The index type.
 	 */
-	template< typename VertexT, typename IndexT >
-	class MSHReader final : public BigEndianBinaryReader {
+	template< typename VertexT >
+	class MSHReader final {
 
 	public:
 
@@ -35,15 +35,11 @@ namespace mage {
 		/**
 		 Constructs a MSH reader.
 
-		 @param[in]		vertices
-						A reference to a vector for storing the read vertices
-						from file.
-		 @param[in]		indices
-						A reference to a vector for storing the read indices
+		 @param[in]		mesh
+						A reference to a mesh view for storing the read mesh
 						from file.
 		 */
-		explicit MSHReader(
-			vector< VertexT > &vertices, vector< IndexT > &indices);
+		explicit MSHReader(MeshView< VertexT > &mesh);
 
 		/**
 		 Constructs a MSH reader from the given MSH reader.
@@ -64,7 +60,7 @@ namespace mage {
 		/**
 		 Destructs this MSH reader.
 		 */
-		virtual ~MSHReader();
+		~MSHReader();
 
 		//---------------------------------------------------------------------
 		// Assignment Operators
@@ -90,6 +86,20 @@ namespace mage {
 		 */
 		MSHReader &operator=(MSHReader &&reader) = delete;
 
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Reads from the given file.
+
+		 @param[in]		fname
+						The filename.
+		 @throws		FormattedException
+						Failed to read from the given file.
+		 */
+		void ReadFromFile(wstring fname);
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -97,36 +107,47 @@ namespace mage {
 		//---------------------------------------------------------------------
 
 		/**
-		 Starts reading.
+		 Reads the given MSH (version 2) file.
 
+		 @param[in]		file
+						A reference to the memory-mapped file.
 		 @throws		FormattedException
-						Failed to read to the given file.
+						Failed to read from the given file.
 		 */
-		virtual void Read() override;
+		void Read(const MappedFile &file);
 
 		/**
-		 Checks whether the header of the file is valid.
+		 Reads the given legacy MSH (version 1) file.
 
-		 @return		@c true if the header of the file is valid. @c false 
-						otherwise.
+		 @param[in]		file
+						A reference to the memory-mapped file.
+		 @throws		FormattedException
+						Failed to read from the given file.
 		 */
-		bool IsHeaderValid();
+		void ReadLegacy(const MappedFile &file);
+
+		/**
+		 Checks whether the given file starts with the given magic.
+
+		 @pre			@a magic is not equal to @c nullptr.
+		 @param[in]		file
+						A reference to the memory-mapped file.
+		 @param[in]		magic
+						A pointer to the null-terminated magic.
+		 @return		@c true if the given file starts with the given 
+						magic. @c false otherwise.
+		 */
+		static bool HasMagic(const MappedFile &file, 
+			const char *magic) noexcept;
 
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
 
 		/**
-		 A reference to a vector containing the read vertices of this MSH 
-		 reader.
-		 */
-		vector< VertexT > &m_vertices;
-
-		/**
-		 A reference to a vector containing the read indices of this MSH 
-		 reader.
+		 A reference to the mesh view of this MSH reader.
 		 */
-		vector< IndexT > &m_indices;
+		MeshView< VertexT > &m_mesh;
 	};
 }
 
@@ -5,60 +5,141 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\msh\msh_tokens.hpp"
+#include "loaders\msh\msh_header.hpp"
 #include "utils\exception\exception.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage {
 
-	template< typename VertexT, typename IndexT >
-	MSHReader< VertexT, IndexT >::MSHReader(
-		vector< VertexT > &vertices, vector< IndexT > &indices)
-		: BigEndianBinaryReader(), 
-		m_vertices(vertices), 
-		m_indices(indices) {}
+	template< typename VertexT >
+	MSHReader< VertexT >::MSHReader(MeshView< VertexT > &mesh)
+		: m_mesh(mesh) {}
 
-	template< typename VertexT, typename IndexT >
-	MSHReader< VertexT, IndexT >::MSHReader(MSHReader &&reader) = default;
+	template< typename VertexT >
+	MSHReader< VertexT >::MSHReader(MSHReader &&reader) = default;
 
-	template< typename VertexT, typename IndexT >
-	MSHReader< VertexT, IndexT >::~MSHReader() = default;
+	template< typename VertexT >
+	MSHReader< VertexT >::~MSHReader() = default;
 
-	template< typename VertexT, typename IndexT >
-	void MSHReader< VertexT, IndexT >::Read() {
+	template< typename VertexT >
+	void MSHReader< VertexT >::ReadFromFile(wstring fname) {
+		UniquePtr< MappedFile > file = MakeUnique< MappedFile >(std::move(fname));
 
-		// Read the header.
-		{
-			const bool result = IsHeaderValid();
-			ThrowIfFailed(result, 
-				"%ls: invalid mesh header.", GetFilename().c_str());
+		if (HasMagic(*file, MAGE_MSH_MAGIC)) {
+			Read(*file);
+		}
+		else if (HasMagic(*file, MAGE_MSH_LEGACY_MAGIC)) {
+			ReadLegacy(*file);
+		}
+		else {
+			throw FormattedException(
+				"%ls: invalid mesh header.", file->GetFilename().c_str());
 		}
 
-		const U32 nb_vertices = ReadValue< U32 >();
-		const U32 nb_indices  = ReadValue< U32 >();
-		
-		const VertexT *vertices = ReadValueArray< VertexT >(nb_vertices);
-		m_vertices.assign(vertices, vertices + nb_vertices);
+		// The vertices and indices point into the mapped file.
+		m_mesh.m_file = std::move(file);
+	}
+
+	template< typename VertexT >
+	void MSHReader< VertexT >::Read(const MappedFile &file) {
+		const wchar_t * const fname = file.GetFilename().c_str();
+		const U8  * const data = file.GetData();
+		const size_t      size = file.GetSize();
+
+		ThrowIfFailed((sizeof(MSHHeader) <= size),
+			"%ls: invalid mesh header.", fname);
 
-		const IndexT *indices   = ReadValueArray< IndexT >(nb_indices);
-		m_indices.assign(indices, indices + nb_indices);
+		// Mapped views are page aligned.
+		const MSHHeader &header = *reinterpret_cast< const MSHHeader * >(data);
+
+		ThrowIfFailed((MAGE_MSH_VERSION == header.m_version),
+			"%ls: unsupported mesh version: %u.", fname, header.m_version);
+		ThrowIfFailed((sizeof(VertexT) == header.m_vertex_size),
+			"%ls: vertex size mismatch: %u instead of %zu.",
+			fname, header.m_vertex_size, sizeof(VertexT));
+		ThrowIfFailed((sizeof(U16) == header.m_index_size
+			        || sizeof(U32) == header.m_index_size),
+			"%ls: unsupported index size: %u.", fname, header.m_index_size);
+		ThrowIfFailed((0 == header.m_vertex_offset % MAGE_MSH_SECTION_ALIGNMENT
+			        && 0 == header.m_index_offset  % MAGE_MSH_SECTION_ALIGNMENT),
+			"%ls: misaligned mesh sections.", fname);
+
+		const U64 vertices_size = static_cast< U64 >(header.m_nb_vertices)
+			                    * header.m_vertex_size;
+		const U64 indices_size  = static_cast< U64 >(header.m_nb_indices)
+			                    * header.m_index_size;
+		// Avoid overflows by never adding offsets and sizes.
+		ThrowIfFailed((sizeof(MSHHeader) <= header.m_vertex_offset
+			        && header.m_vertex_offset <= size
+			        && vertices_size <= size - header.m_vertex_offset),
+			"%ls: vertex section out of bounds.", fname);
+		ThrowIfFailed((sizeof(MSHHeader) <= header.m_index_offset
+			        && header.m_index_offset <= size
+			        && indices_size <= size - header.m_index_offset),
+			"%ls: index section out of bounds.", fname);
+
+		m_mesh.m_vertices    = reinterpret_cast< const VertexT * >(
+			                       data + header.m_vertex_offset);
+		m_mesh.m_nb_vertices = header.m_nb_vertices;
+		m_mesh.m_indices     = data + header.m_index_offset;
+		m_mesh.m_nb_indices  = header.m_nb_indices;
+		m_mesh.m_index_size  = header.m_index_size;
 	}
 
-	template< typename VertexT, typename IndexT >
-	bool MSHReader< VertexT, IndexT >::IsHeaderValid() {
-		const char *magic = MAGE_MSH_MAGIC;
-		
-		while (*magic != L'\0') {
-			if (ReadValue< U8 >() != *magic) {
-				return false;
-			}
-			++magic;
-		}
-		
-		return true;
+	template< typename VertexT >
+	void MSHReader< VertexT >::ReadLegacy(const MappedFile &file) {
+		const wchar_t * const fname = file.GetFilename().c_str();
+		const U8  * const data = file.GetData();
+		const size_t      size = file.GetSize();
+
+		// magic (8 bytes) | nb_vertices (U32) | nb_indices (U32)
+		constexpr size_t header_size = 8 + 2 * sizeof(U32);
+		ThrowIfFailed((header_size <= size),
+			"%ls: invalid mesh header.", fname);
+
+		U32 nb_vertices;
+		U32 nb_indices;
+		std::memcpy(&nb_vertices, data + 8, sizeof(U32));
+		std::memcpy(&nb_indices,  data + 8 + sizeof(U32), sizeof(U32));
+
+		const U64 vertices_size = static_cast< U64 >(nb_vertices)
+			                    * sizeof(VertexT);
+		const U64 indices_size  = static_cast< U64 >(nb_indices)
+			                    * sizeof(U32);
+		// Avoid overflows by never adding sizes.
+		ThrowIfFailed((vertices_size <= size - header_size
+			        && indices_size  <= size - header_size - vertices_size),
+			"%ls: mesh data out of bounds.", fname);
+
+		m_mesh.m_vertices    = reinterpret_cast< const VertexT * >(
+			                       data + header_size);
+		m_mesh.m_nb_vertices = nb_vertices;
+		m_mesh.m_indices     = data + header_size + vertices_size;
+		m_mesh.m_nb_indices  = nb_indices;
+		m_mesh.m_index_size  = sizeof(U32);
+	}
+
+	template< typename VertexT >
+	bool MSHReader< VertexT >::HasMagic(const MappedFile &file,
+		const char *magic) noexcept {
+
+		Assert(magic);
+
+		const size_t length = std::strlen(magic);
+		return (length <= file.GetSize())
+			&& (0 == std::memcmp(file.GetData(), magic, length));
 	}
 }
\ No newline at end of file
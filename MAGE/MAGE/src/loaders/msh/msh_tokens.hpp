@@ -5,6 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#define MAGE_MSH_MAGIC "MAGEmesh"
+#define MAGE_MSH_MAGIC             "MAGEMESH"
+#define MAGE_MSH_LEGACY_MAGIC      "MAGEmesh"
+#define MAGE_MSH_VERSION           2u
+#define MAGE_MSH_SECTION_ALIGNMENT 16u
 
 #pragma endregion
\ No newline at end of file
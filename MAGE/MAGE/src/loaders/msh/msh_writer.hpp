@@ -22,7 +22,6 @@ namespace mage {
 					The vertex type.
 	 @tparam		IndexT
 					The index type.
-
 	 */
 	template< typename VertexT, typename IndexT >
 	class MSHWriter final : public BigEndianBinaryWriter {
@@ -33,6 +32,25 @@ namespace mage {
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
 
+		/**
+		 Constructs a MSH writer.
+
+		 @pre			If @a nb_vertices is not equal to zero, @a vertices 
+						is not equal to @c nullptr.
+		 @pre			If @a nb_indices is not equal to zero, @a indices is 
+						not equal to @c nullptr.
+		 @param[in]		vertices
+						A pointer to an array of vertices.
+		 @param[in]		nb_vertices
+						The number of vertices.
+		 @param[in]		indices
+						A pointer to an array of indices.
+		 @param[in]		nb_indices
+						The number of indices.
+		 */
+		explicit MSHWriter(const VertexT *vertices, size_t nb_vertices,
+			const IndexT *indices, size_t nb_indices);
+
 		/**
 		 Constructs a MSH writer.
 
@@ -103,21 +121,41 @@ namespace mage {
 		 */
 		virtual void Write() override;
 
+		/**
+		 Writes zero-valued padding bytes up to the given offset.
+
+		 @param[in]		offset
+						The current offset in bytes.
+		 @param[in]		aligned_offset
+						The aligned offset in bytes.
+		 @throws		FormattedException
+						Failed to write.
+		 */
+		void WritePadding(U64 offset, U64 aligned_offset);
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
 
 		/**
-		 A reference to a vector containing the vertices to write by this VS 
-		 writer.
+		 A pointer to the vertices to write by this MSH writer.
+		 */
+		const VertexT *m_vertices;
+
+		/**
+		 The number of vertices to write by this MSH writer.
 		 */
-		const vector< VertexT > &m_vertices;
+		size_t m_nb_vertices;
 		
 		/**
-		 A reference to a vector containing the indices to write by this VS 
-		 writer.
+		 A pointer to the indices to write by this MSH writer.
+		 */
+		const IndexT *m_indices;
+
+		/**
+		 The number of indices to write by this MSH writer.
 		 */
-		const vector< IndexT > &m_indices;
+		size_t m_nb_indices;
 	};
 }
 
@@ -5,7 +5,17 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\msh\msh_tokens.hpp"
+#include "loaders\msh\msh_header.hpp"
+#include "utils\logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
 
 #pragma endregion
 
@@ -16,11 +26,24 @@ namespace mage {
 
 	template< typename VertexT, typename IndexT >
 	MSHWriter< VertexT, IndexT >::MSHWriter(
-		const vector< VertexT > &vertices, 
+		const VertexT *vertices, size_t nb_vertices,
+		const IndexT *indices, size_t nb_indices)
+		: BigEndianBinaryWriter(),
+		m_vertices(vertices),
+		m_nb_vertices(nb_vertices),
+		m_indices(indices),
+		m_nb_indices(nb_indices) {
+
+		Assert(vertices || 0 == nb_vertices);
+		Assert(indices  || 0 == nb_indices);
+	}
+
+	template< typename VertexT, typename IndexT >
+	MSHWriter< VertexT, IndexT >::MSHWriter(
+		const vector< VertexT > &vertices,
 		const vector< IndexT > &indices)
-		: BigEndianBinaryWriter(), 
-		m_vertices(vertices), 
-		m_indices(indices) {}
+		: MSHWriter(vertices.data(), vertices.size(),
+			indices.data(), indices.size()) {}
 
 	template< typename VertexT, typename IndexT >
 	MSHWriter< VertexT, IndexT >::MSHWriter(MSHWriter &&writer) = default;
@@ -30,15 +53,52 @@ namespace mage {
 
 	template< typename VertexT, typename IndexT >
 	void MSHWriter< VertexT, IndexT >::Write() {
+		static_assert(sizeof(U16) == sizeof(IndexT)
+			       || sizeof(U32) == sizeof(IndexT),
+			          "Unsupported index size");
+
+		const U64 vertices_size = static_cast< U64 >(m_nb_vertices)
+			                    * sizeof(VertexT);
+		const U64 indices_size  = static_cast< U64 >(m_nb_indices)
+			                    * sizeof(IndexT);
+
+		MSHHeader header = {};
+		std::memcpy(header.m_magic, MAGE_MSH_MAGIC, sizeof(header.m_magic));
+		header.m_version       = MAGE_MSH_VERSION;
+		header.m_vertex_size   = static_cast< U32 >(sizeof(VertexT));
+		header.m_index_size    = static_cast< U32 >(sizeof(IndexT));
+		header.m_nb_vertices   = static_cast< U32 >(m_nb_vertices);
+		header.m_nb_indices    = static_cast< U32 >(m_nb_indices);
+		header.m_vertex_offset = sizeof(MSHHeader);
+		header.m_index_offset  = AlignMSHSectionOffset(
+			                         header.m_vertex_offset + vertices_size);
+		WriteValue(header);
+
+		if (0 != m_nb_vertices) {
+			WriteValueArray(m_vertices, m_nb_vertices);
+		}
+		WritePadding(header.m_vertex_offset + vertices_size,
+			         header.m_index_offset);
+
+		if (0 != m_nb_indices) {
+			WriteValueArray(m_indices, m_nb_indices);
+		}
+		WritePadding(header.m_index_offset + indices_size,
+			         AlignMSHSectionOffset(header.m_index_offset + indices_size));
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MSHWriter< VertexT, IndexT >::WritePadding(
+		U64 offset, U64 aligned_offset) {
+
+		Assert(offset <= aligned_offset);
+		Assert(aligned_offset - offset < MAGE_MSH_SECTION_ALIGNMENT);
 
-		WriteString(MAGE_MSH_MAGIC);
+		static const U8 padding[MAGE_MSH_SECTION_ALIGNMENT] = {};
 
-		const U32 nb_vertices = static_cast< U32 >(m_vertices.size());
-		WriteValue(nb_vertices);
-		const U32 nb_indices  = static_cast< U32 >(m_indices.size());
-		WriteValue(nb_indices);
-		
-		WriteValueArray(m_vertices.data(), m_vertices.size());
-		WriteValueArray(m_indices.data(), m_indices.size());
+		const size_t nb_bytes = static_cast< size_t >(aligned_offset - offset);
+		if (0 != nb_bytes) {
+			WriteValueArray(padding, nb_bytes);
+		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,323 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\obj\obj_chunk_reader.hpp"
+#include "loaders\obj\obj_tokens.hpp"
+#include "math\geometry\geometry.hpp"
+#include "utils\string\token.hpp"
+#include "utils\exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	OBJChunkReader::OBJChunkReader(const wstring &fname,
+		bool invert_handness, OBJChunk &chunk) noexcept
+		: m_fname(fname),
+		m_invert_handness(invert_handness),
+		m_chunk(chunk),
+		m_line_number(0),
+		m_pos(nullptr),
+		m_line_end(nullptr) {}
+
+	OBJChunkReader::OBJChunkReader(OBJChunkReader &&reader) noexcept = default;
+
+	OBJChunkReader::~OBJChunkReader() = default;
+
+	void OBJChunkReader::Read(U32 first_line_number) {
+		const char *it  = m_chunk.m_begin;
+		const char *end = m_chunk.m_end;
+
+		m_line_number = first_line_number;
+		// Continue reading from the chunk until the end is reached.
+		while (it != end) {
+			const void *eol = std::memchr(it, '\n', static_cast< size_t >(end - it));
+			m_pos      = it;
+			m_line_end = eol ? static_cast< const char * >(eol) : end;
+
+			ReadLine();
+
+			it = (m_line_end == end) ? end : m_line_end + 1;
+			++m_line_number;
+		}
+
+		m_chunk.m_nb_lines = m_line_number - first_line_number;
+
+		m_pos      = nullptr;
+		m_line_end = nullptr;
+	}
+
+	void OBJChunkReader::ReadLine() {
+		if (!HasToken() || MAGE_OBJ_COMMENT_CHAR == *m_pos) {
+			return;
+		}
+
+		const string_view token = ReadToken();
+
+		if (MAGE_OBJ_TOKEN_VERTEX == token) {
+			ReadOBJVertex();
+		}
+		else if (MAGE_OBJ_TOKEN_TEXTURE == token) {
+			ReadOBJVertexTexture();
+		}
+		else if (MAGE_OBJ_TOKEN_NORMAL == token) {
+			ReadOBJVertexNormal();
+		}
+		else if (MAGE_OBJ_TOKEN_FACE == token) {
+			ReadOBJFace();
+		}
+		else if (MAGE_OBJ_TOKEN_MATERIAL_LIBRARY == token) {
+			ReadOBJMaterialLibrary();
+		}
+		else if (MAGE_OBJ_TOKEN_MATERIAL_USE == token) {
+			ReadOBJMaterialUse();
+		}
+		else if (MAGE_OBJ_TOKEN_GROUP == token) {
+			ReadOBJGroup();
+		}
+		else if (MAGE_OBJ_TOKEN_OBJECT == token) {
+			ReadOBJObject();
+		}
+		else if (MAGE_OBJ_TOKEN_SMOOTHING_GROUP == token) {
+			ReadOBJSmoothingGroup();
+		}
+		else {
+			AddWarning("unsupported keyword token: ", token);
+			return;
+		}
+
+		ReadLineRemaining();
+	}
+
+	void OBJChunkReader::ReadLineRemaining() {
+		while (HasToken()) {
+			AddWarning("unused token: ", ReadToken());
+		}
+	}
+
+	void OBJChunkReader::AddWarning(const char *message, string_view token) {
+		string text(message);
+		text.append(token.data(), token.size());
+		text += '.';
+
+		m_chunk.m_warnings.push_back(OBJWarning{ m_line_number, std::move(text) });
+	}
+
+	bool OBJChunkReader::HasF32() noexcept {
+		SkipWhitespace();
+
+		const char *it = m_pos;
+		F32 value;
+		return (TokenResult::Valid == ScanF32(it, m_line_end, value))
+			&& (it == m_line_end || IsWhitespace(*it));
+	}
+
+	const string_view OBJChunkReader::ReadToken() {
+		ThrowIfFailed(HasToken(),
+			"%ls: line %u: no char string value found.",
+			GetFilename().c_str(), GetCurrentLineNumber());
+
+		const char * const begin = m_pos;
+		while (m_pos != m_line_end && !IsWhitespace(*m_pos)) {
+			++m_pos;
+		}
+
+		return string_view(begin, static_cast< size_t >(m_pos - begin));
+	}
+
+	F32 OBJChunkReader::ReadF32() {
+		SkipWhitespace();
+
+		F32 result;
+		switch (ScanF32(m_pos, m_line_end, result)) {
+
+		case TokenResult::Valid: {
+			if (m_pos == m_line_end || IsWhitespace(*m_pos)) {
+				return result;
+			}
+
+			throw FormattedException(
+				"%ls: line %u: invalid F32 value found.",
+				GetFilename().c_str(), GetCurrentLineNumber());
+		}
+
+		case TokenResult::None: {
+			throw FormattedException(
+				"%ls: line %u: no F32 value found.",
+				GetFilename().c_str(), GetCurrentLineNumber());
+		}
+
+		default: {
+			throw FormattedException(
+				"%ls: line %u: invalid F32 value found.",
+				GetFilename().c_str(), GetCurrentLineNumber());
+		}
+		}
+	}
+
+	const F32x2 OBJChunkReader::ReadF32x2() {
+		const F32 x = ReadF32();
+		const F32 y = ReadF32();
+		return F32x2(x, y);
+	}
+
+	const F32x3 OBJChunkReader::ReadF32x3() {
+		const F32 x = ReadF32();
+		const F32 y = ReadF32();
+		const F32 z = ReadF32();
+		return F32x3(x, y, z);
+	}
+
+	void OBJChunkReader::ReadOBJMaterialLibrary() {
+		OBJStatement statement;
+		statement.m_type = OBJStatementType::MaterialLibrary;
+		statement.m_face = m_chunk.m_face_sizes.size();
+		statement.m_name = ReadString();
+
+		m_chunk.m_statements.push_back(std::move(statement));
+	}
+
+	void OBJChunkReader::ReadOBJMaterialUse() {
+		OBJStatement statement;
+		statement.m_type = OBJStatementType::MaterialUse;
+		statement.m_face = m_chunk.m_face_sizes.size();
+		statement.m_name = ReadString();
+
+		m_chunk.m_statements.push_back(std::move(statement));
+	}
+
+	void OBJChunkReader::ReadOBJGroup() {
+		OBJStatement statement;
+		statement.m_type = OBJStatementType::Group;
+		statement.m_face = m_chunk.m_face_sizes.size();
+
+		ModelPart &model_part = statement.m_model_part;
+		model_part.m_child = ReadString();
+		if (HasToken()) {
+			if (!HasF32()) {
+				model_part.m_parent  = ReadString();
+			}
+			model_part.m_translation = InvertHandness(Point3(ReadF32x3()));
+			model_part.m_rotation    = ReadF32x3();
+			model_part.m_scale       = ReadF32x3();
+		}
+
+		m_chunk.m_statements.push_back(std::move(statement));
+	}
+
+	void OBJChunkReader::ReadOBJObject() {
+		ReadString();
+	}
+
+	void OBJChunkReader::ReadOBJSmoothingGroup() {
+		// Silently ignore smoothing group declarations
+		ReadString();
+	}
+
+	void OBJChunkReader::ReadOBJVertex() {
+		const Point3 vertex(ReadF32x3());
+
+		m_chunk.m_vertex_coordinates.push_back(
+			m_invert_handness ? InvertHandness(vertex) : vertex);
+	}
+
+	void OBJChunkReader::ReadOBJVertexTexture() {
+		const UV texture(ReadF32x2());
+
+		if (HasF32()) {
+			// Silently ignore 3D vertex texture coordinates.
+			ReadF32();
+		}
+
+		m_chunk.m_vertex_texture_coordinates.push_back(
+			m_invert_handness ? InvertHandness(texture) : texture);
+	}
+
+	void OBJChunkReader::ReadOBJVertexNormal() {
+		const Normal3 normal(ReadF32x3());
+
+		m_chunk.m_vertex_normal_coordinates.push_back(
+			m_invert_handness ? InvertHandness(normal) : normal);
+	}
+
+	void OBJChunkReader::ReadOBJFace() {
+		m_chunk.m_face_nb_coordinates.emplace_back(
+			static_cast< U32 >(m_chunk.m_vertex_coordinates.size()),
+			static_cast< U32 >(m_chunk.m_vertex_texture_coordinates.size()),
+			static_cast< U32 >(m_chunk.m_vertex_normal_coordinates.size()));
+
+		U32 nb_vertices = 0u;
+		while (nb_vertices < 3u || HasToken()) {
+			m_chunk.m_face_vertices.push_back(ReadOBJFaceVertex());
+			++nb_vertices;
+		}
+
+		m_chunk.m_face_sizes.push_back(nb_vertices);
+	}
+
+	const OBJFaceVertex OBJChunkReader::ReadOBJFaceVertex() {
+		ThrowIfFailed(HasToken(),
+			"%ls: line %u: no face indices found.",
+			GetFilename().c_str(), GetCurrentLineNumber());
+
+		OBJFaceVertex vertex{ S32x3(), 0u, GetCurrentLineNumber() };
+		bool relative = false;
+
+		// v1, v1/vt1, v1//vn1 or v1/vt1/vn1
+		vertex.m_indices.m_x = ReadOBJIndex(
+			m_chunk.m_vertex_coordinates.size(), "vertex", relative);
+		vertex.m_relative |= relative ? 1u : 0u;
+
+		if (m_pos != m_line_end && '/' == *m_pos) {
+			++m_pos;
+
+			if (m_pos != m_line_end && '/' != *m_pos && !IsWhitespace(*m_pos)) {
+				vertex.m_indices.m_y = ReadOBJIndex(
+					m_chunk.m_vertex_texture_coordinates.size(), "texture", relative);
+				vertex.m_relative |= relative ? 2u : 0u;
+			}
+
+			if (m_pos != m_line_end && '/' == *m_pos) {
+				++m_pos;
+				vertex.m_indices.m_z = ReadOBJIndex(
+					m_chunk.m_vertex_normal_coordinates.size(), "normal", relative);
+				vertex.m_relative |= relative ? 4u : 0u;
+			}
+		}
+
+		ThrowIfFailed((m_pos == m_line_end || IsWhitespace(*m_pos)),
+			"%ls: line %u: invalid face indices found.",
+			GetFilename().c_str(), GetCurrentLineNumber());
+
+		return vertex;
+	}
+
+	S32 OBJChunkReader::ReadOBJIndex(size_t nb_elements,
+		const char *component, bool &relative) {
+
+		S32 index;
+		const TokenResult result = ScanS32(m_pos, m_line_end, index);
+		ThrowIfFailed((TokenResult::Valid == result && 0 != index),
+			"%ls: line %u: invalid %s index value found.",
+			GetFilename().c_str(), GetCurrentLineNumber(), component);
+
+		relative = (0 > index);
+
+		// Negative indices are relative to the last read element.
+		return relative ? static_cast< S32 >(nb_elements) + index + 1 : index;
+	}
+}
\ No newline at end of file
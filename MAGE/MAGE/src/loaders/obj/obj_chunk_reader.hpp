@@ -0,0 +1,565 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "model\model_output.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A struct of OBJ face vertices.
+	 */
+	struct OBJFaceVertex final {
+
+	public:
+
+		/**
+		 The vertex position/texture/normal coordinates' indices of this face
+		 vertex. A zero indicates the absence of a component.
+
+		 Absolute indices are one-based. Relative indices are resolved
+		 against the coordinates of the chunk only, and must still be offset
+		 by the number of coordinates of all preceding chunks.
+		 */
+		S32x3 m_indices;
+
+		/**
+		 A bit mask indicating which components of this face vertex are
+		 relative (bit 0: position, bit 1: texture, bit 2: normal).
+		 */
+		U32 m_relative;
+
+		/**
+		 The line number (relative to the chunk) of this face vertex.
+		 */
+		U32 m_line_number;
+	};
+
+	/**
+	 An enumeration of the different OBJ statements which affect the model
+	 parts and materials.
+
+	 This contains:
+	 @c Group,
+	 @c MaterialLibrary and
+	 @c MaterialUse.
+	 */
+	enum struct OBJStatementType {
+		Group,
+		MaterialLibrary,
+		MaterialUse
+	};
+
+	/**
+	 A struct of OBJ statements which affect the model parts and materials.
+	 */
+	struct OBJStatement final {
+
+	public:
+
+		/**
+		 The type of this OBJ statement.
+		 */
+		OBJStatementType m_type;
+
+		/**
+		 The number of faces of the chunk preceding this OBJ statement.
+		 */
+		size_t m_face;
+
+		/**
+		 The model part of this OBJ statement (@c Group only).
+		 */
+		ModelPart m_model_part;
+
+		/**
+		 The name of this OBJ statement (@c MaterialLibrary and
+		 @c MaterialUse only).
+		 */
+		string m_name;
+	};
+
+	/**
+	 A struct of deferred OBJ warnings.
+	 */
+	struct OBJWarning final {
+
+	public:
+
+		/**
+		 The line number (relative to the chunk) of this OBJ warning.
+		 */
+		U32 m_line_number;
+
+		/**
+		 The message of this OBJ warning.
+		 */
+		string m_message;
+	};
+
+	/**
+	 A struct of OBJ chunks containing the data of a range of complete lines
+	 of an OBJ file.
+	 */
+	struct OBJChunk final {
+
+	public:
+
+		/**
+		 A pointer to the begin (inclusive) of this OBJ chunk.
+		 */
+		const char *m_begin;
+
+		/**
+		 A pointer to the end (exclusive) of this OBJ chunk.
+		 */
+		const char *m_end;
+
+		/**
+		 The number of lines of this OBJ chunk.
+		 */
+		U32 m_nb_lines;
+
+		/**
+		 A flag indicating whether reading this OBJ chunk failed.
+		 */
+		bool m_failed;
+
+		/**
+		 A vector containing the read vertex position coordinates of this
+		 OBJ chunk.
+		 */
+		vector< Point3 > m_vertex_coordinates;
+
+		/**
+		 A vector containing the read vertex texture coordinates of this OBJ
+		 chunk.
+		 */
+		vector< UV > m_vertex_texture_coordinates;
+
+		/**
+		 A vector containing the read vertex normal coordinates of this OBJ
+		 chunk.
+		 */
+		vector< Normal3 > m_vertex_normal_coordinates;
+
+		/**
+		 A vector containing the face vertices of all faces of this OBJ
+		 chunk.
+		 */
+		vector< OBJFaceVertex > m_face_vertices;
+
+		/**
+		 A vector containing the number of face vertices of each face of this
+		 OBJ chunk.
+		 */
+		vector< U32 > m_face_sizes;
+
+		/**
+		 A vector containing the number of vertex position/texture/normal 
+		 coordinates of this OBJ chunk preceding each face of this OBJ chunk.
+		 Faces may only refer to preceding coordinates.
+		 */
+		vector< U32x3 > m_face_nb_coordinates;
+
+		/**
+		 A vector containing the statements of this OBJ chunk.
+		 */
+		vector< OBJStatement > m_statements;
+
+		/**
+		 A vector containing the deferred warnings of this OBJ chunk.
+		 */
+		vector< OBJWarning > m_warnings;
+	};
+
+	/**
+	 A class of OBJ chunk readers for reading a range of complete lines of an
+	 OBJ file.
+
+	 OBJ chunk readers only tokenize and convert. Resolving indices,
+	 constructing vertices and model parts is left to the OBJ reader, which
+	 merges the chunks in order. Multiple OBJ chunk readers can therefore
+	 read the chunks of the same file concurrently.
+	 */
+	class OBJChunkReader final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an OBJ chunk reader.
+
+		 @param[in]		fname
+						A reference to the filename of the OBJ file.
+		 @param[in]		invert_handness
+						A flag indicating whether the handness of the
+						coordinates must be inverted.
+		 @param[in]		chunk
+						A reference to the OBJ chunk to read.
+		 */
+		explicit OBJChunkReader(const wstring &fname,
+			bool invert_handness, OBJChunk &chunk) noexcept;
+
+		/**
+		 Constructs an OBJ chunk reader from the given OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to the OBJ chunk reader to copy.
+		 */
+		OBJChunkReader(const OBJChunkReader &reader) = delete;
+
+		/**
+		 Constructs an OBJ chunk reader by moving the given OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to the OBJ chunk reader to move.
+		 */
+		OBJChunkReader(OBJChunkReader &&reader) noexcept;
+
+		/**
+		 Destructs this OBJ chunk reader.
+		 */
+		~OBJChunkReader();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given OBJ chunk reader to this OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to a OBJ chunk reader to copy.
+		 @return		A reference to the copy of the given OBJ chunk reader
+						(i.e. this OBJ chunk reader).
+		 */
+		OBJChunkReader &operator=(const OBJChunkReader &reader) = delete;
+
+		/**
+		 Moves the given OBJ chunk reader to this OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to a OBJ chunk reader to move.
+		 @return		A reference to the moved OBJ chunk reader (i.e. this
+						OBJ chunk reader).
+		 */
+		OBJChunkReader &operator=(OBJChunkReader &&reader) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Reads the OBJ chunk of this OBJ chunk reader.
+
+		 @param[in]		first_line_number
+						The line number of the first line of the OBJ chunk
+						(used for error reporting only).
+		 @throws		FormattedException
+						Failed to read the OBJ chunk.
+		 */
+		void Read(U32 first_line_number = 1u);
+
+		/**
+		 Returns the filename of this OBJ chunk reader.
+
+		 @return		A reference to the filename of this OBJ chunk reader.
+		 */
+		const wstring &GetFilename() const noexcept {
+			return m_fname;
+		}
+
+		/**
+		 Returns the current line number of this OBJ chunk reader.
+
+		 @return		The current line number of this OBJ chunk reader.
+		 */
+		U32 GetCurrentLineNumber() const noexcept {
+			return m_line_number;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Reads the current line.
+
+		 @throws		FormattedException
+						Failed to read the current line.
+		 */
+		void ReadLine();
+
+		/**
+		 Reads the remaining tokens of the current line of this OBJ chunk
+		 reader.
+		 */
+		void ReadLineRemaining();
+
+		/**
+		 Defers a warning for the current line of this OBJ chunk reader.
+
+		 @param[in]		message
+						The message.
+		 @param[in]		token
+						The offending token.
+		 */
+		void AddWarning(const char *message, string_view token);
+
+		/**
+		 Checks whether the given character is a whitespace character.
+
+		 @param[in]		c
+						The character.
+		 @return		@c true if the given character is a whitespace
+						character. @c false otherwise.
+		 */
+		static bool IsWhitespace(char c) noexcept {
+			return ' ' == c || '\t' == c || '\r' == c;
+		}
+
+		/**
+		 Skips the whitespace of the current line of this OBJ chunk reader.
+		 */
+		void SkipWhitespace() noexcept {
+			while (m_pos != m_line_end && IsWhitespace(*m_pos)) {
+				++m_pos;
+			}
+		}
+
+		/**
+		 Checks whether the current line of this OBJ chunk reader contains
+		 another token.
+
+		 @return		@c true if the current line of this OBJ chunk reader
+						contains another token. @c false otherwise.
+		 */
+		bool HasToken() noexcept {
+			SkipWhitespace();
+			return m_pos != m_line_end;
+		}
+
+		/**
+		 Checks whether the next token of this OBJ chunk reader is a @c F32.
+
+		 @return		@c true if the next token of this OBJ chunk reader is
+						a @c F32. @c false otherwise.
+		 */
+		bool HasF32() noexcept;
+
+		/**
+		 Reads the next token of this OBJ chunk reader.
+
+		 @return		A view of the next token of this OBJ chunk reader.
+		 @throws		FormattedException
+						Failed to read a token.
+		 */
+		const string_view ReadToken();
+
+		/**
+		 Reads the next token of this OBJ chunk reader as a string.
+
+		 @return		The string represented by the next token of this OBJ
+						chunk reader.
+		 @throws		FormattedException
+						Failed to read a string.
+		 */
+		const string ReadString() {
+			return string(ReadToken());
+		}
+
+		/**
+		 Reads and converts the next token of this OBJ chunk reader to a
+		 @c F32.
+
+		 @return		The @c F32 represented by the next token of this OBJ
+						chunk reader.
+		 @throws		FormattedException
+						Failed to read a @c F32.
+		 */
+		F32 ReadF32();
+
+		/**
+		 Reads and converts the next tokens of this OBJ chunk reader to a
+		 @c F32x2.
+
+		 @return		The @c F32x2 represented by the next tokens of this
+						OBJ chunk reader.
+		 @throws		FormattedException
+						Failed to read a @c F32x2.
+		 */
+		const F32x2 ReadF32x2();
+
+		/**
+		 Reads and converts the next tokens of this OBJ chunk reader to a
+		 @c F32x3.
+
+		 @return		The @c F32x3 represented by the next tokens of this
+						OBJ chunk reader.
+		 @throws		FormattedException
+						Failed to read a @c F32x3.
+		 */
+		const F32x3 ReadF32x3();
+
+		/**
+		 Reads a Material Library Include definition.
+
+		 @throws		FormattedException
+						Failed to read a Material Library Include definition.
+		 */
+		void ReadOBJMaterialLibrary();
+
+		/**
+		 Reads a Material Usage definition.
+
+		 @throws		FormattedException
+						Failed to read a Material Usage definition.
+		 */
+		void ReadOBJMaterialUse();
+
+		/**
+		 Reads a Group definition.
+
+		 @throws		FormattedException
+						Failed to read a Group definition.
+		 */
+		void ReadOBJGroup();
+
+		/**
+		 Reads an Object definition.
+
+		 @throws		FormattedException
+						Failed to read a Object definition.
+		 */
+		void ReadOBJObject();
+
+		/**
+		 Reads a Smoothing Group definition.
+
+		 @note			A smoothing group is, if present,
+						silently ignored.
+		 @throws		FormattedException
+						Failed to read a Smoothing Group definition.
+		 */
+		void ReadOBJSmoothingGroup();
+
+		/**
+		 Reads a Vertex Position Coordinates definition.
+
+		 @throws		FormattedException
+						Failed to read a Vertex Position Coordinates
+						definition.
+		 */
+		void ReadOBJVertex();
+
+		/**
+		 Reads a Vertex Texture Coordinates definition.
+
+		 @note			Only UV texture coordinates are supported,
+						The W component of UVW texture coordinates
+						is, if present, silently ignored.
+		 @throws		FormattedException
+						Failed to read a Vertex Texture Coordinates definition.
+		 */
+		void ReadOBJVertexTexture();
+
+		/**
+		 Reads a Vertex Normal Coordinates definition.
+
+		 @pre			All the vertex normals in the OBJ file are normalized.
+		 @throws		FormattedException
+						Failed to read a Vertex Normal Coordinates definition.
+		 */
+		void ReadOBJVertexNormal();
+
+		/**
+		 Reads a Face definition.
+
+		 @throws		FormattedException
+						Failed to read a Face definition.
+		 */
+		void ReadOBJFace();
+
+		/**
+		 Reads a set of face indices.
+
+		 @return		The face vertex represented by the next token of this
+						OBJ chunk reader.
+		 @throws		FormattedException
+						Failed to read the face indices.
+		 */
+		const OBJFaceVertex ReadOBJFaceVertex();
+
+		/**
+		 Reads a (possibly relative) OBJ index.
+
+		 @param[in]		nb_elements
+						The number of elements of the chunk read so far which
+						the index refers to.
+		 @param[in]		component
+						A pointer to the null-terminated name of the indexed
+						component.
+		 @param[out]	relative
+						A reference to a flag indicating whether the read
+						index is relative.
+		 @return		The read index. Relative indices are resolved against
+						the elements of the chunk only.
+		 @throws		FormattedException
+						Failed to read an index.
+		 */
+		S32 ReadOBJIndex(size_t nb_elements, const char *component,
+			bool &relative);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the filename of the OBJ file of this OBJ chunk
+		 reader.
+		 */
+		const wstring &m_fname;
+
+		/**
+		 A flag indicating whether the handness of the coordinates must be
+		 inverted by this OBJ chunk reader.
+		 */
+		bool m_invert_handness;
+
+		/**
+		 A reference to the OBJ chunk of this OBJ chunk reader.
+		 */
+		OBJChunk &m_chunk;
+
+		/**
+		 The current line number of this OBJ chunk reader.
+		 */
+		U32 m_line_number;
+
+		/**
+		 A pointer to the current position in the current line of this OBJ
+		 chunk reader.
+		 */
+		const char *m_pos;
+
+		/**
+		 A pointer to the end (exclusive) of the current line of this OBJ
+		 chunk reader.
+		 */
+		const char *m_line_end;
+	};
+}
\ No newline at end of file
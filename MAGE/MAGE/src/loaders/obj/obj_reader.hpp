@@ -5,8 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "utils\io\line_reader.hpp"
-#include "model\model_output.hpp"
+#include "loaders\obj\obj_chunk_reader.hpp"
 #include "mesh\mesh_descriptor.hpp"
 
 #pragma endregion
@@ -19,11 +18,17 @@ namespace mage {
 	/**
 	 A class of OBJ file readers for reading meshes.
 
+	 OBJ files are memory-mapped and split on line boundaries into chunks. 
+	 The chunks are tokenized in parallel without copying lines (i.e. lines 
+	 can have an arbitrary length) and merged afterwards in file order. The 
+	 merge resolves the indices, deduplicates the vertices and constructs the 
+	 model parts, which makes the output independent of the number of chunks.
+
 	 @tparam		VertexT
 					The vertex type.
 	 */
 	template < typename VertexT >
-	class OBJReader final : public LineReader {
+	class OBJReader final {
 
 	public:
 
@@ -62,7 +67,7 @@ namespace mage {
 		/**
 		 Destructs this OBJ reader.
 		 */
-		virtual ~OBJReader();
+		~OBJReader();
 
 		//---------------------------------------------------------------------
 		// Assignment Operators
@@ -88,199 +93,190 @@ namespace mage {
 		 */
 		OBJReader &operator=(OBJReader &&reader) = delete;
 
-	private:
-
 		//---------------------------------------------------------------------
 		// Member Methods
 		//---------------------------------------------------------------------
 
 		/**
-		 Pre-process before reading the current file of this OBJ reader.
+		 Reads from the given file.
 
+		 @param[in]		fname
+						The filename.
 		 @throws		FormattedException
-						Failed to finish the pre-processing successfully.
+						Failed to read from the given file.
 		 */
-		virtual void Preprocess() override;
+		void ReadFromFile(wstring fname);
 
 		/**
-		 Reads the given line.
+		 Returns the current filename of this OBJ reader.
 
-		 @pre			@a line is not equal to @c nullptr.
-		 @param[in,out] line
-						A pointer to the null-terminated byte string to read.
-		 @throws		FormattedException
-						Failed to read the given line.
+		 @return		A reference to the current filename of this OBJ 
+						reader.
 		 */
-		virtual void ReadLine(char *line) override;
+		const wstring &GetFilename() const noexcept {
+			return m_fname;
+		}
 
-		/**
-		 Post-processes after reading the current file of this OBJ reader.
+	private:
 
-		 @throws		FormattedException
-						Failed to finish post-processing successfully.
-		 */
-		virtual void Postprocess() override;
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
 
 		/**
-		 Reads a Material Library Include definition.
+		 Pre-process before reading the current file of this OBJ reader.
 
 		 @throws		FormattedException
-						Failed to read a Material Library Include definition.
+						Failed to finish the pre-processing successfully.
 		 */
-		void ReadOBJMaterialLibrary();
+		void Preprocess();
 
 		/**
-		 Reads a Material Usage definition and imports the materials 
-		 corresponding to the mesh.
+		 Post-processes after reading the current file of this OBJ reader.
 
 		 @throws		FormattedException
-						Failed to read a Material Usage definition.
-		 @throws		FormattedException
-						Failed to import the materials.
+						Failed to finish post-processing successfully.
 		 */
-		void ReadOBJMaterialUse();
+		void Postprocess();
 
 		/**
-		 Reads a Group definition.
+		 Splits the given range on line boundaries into chunks.
 
-		 @throws		FormattedException
-						Failed to read a Group definition.
+		 @param[in]		begin
+						A pointer to the begin (inclusive) of the range.
+		 @param[in]		end
+						A pointer to the end (exclusive) of the range.
+		 @return		A vector containing the (unread) chunks.
 		 */
-		void ReadOBJGroup();
+		static vector< OBJChunk > SplitChunks(
+			const char *begin, const char *end);
 
 		/**
-		 Reads an Object definition.
+		 Reads the given chunks (in parallel if there are multiple chunks).
 
+		 @param[in,out]	chunks
+						A reference to a vector containing the chunks.
 		 @throws		FormattedException
-						Failed to read a Object definition.
+						Failed to read the chunks.
 		 */
-		void ReadOBJObject();
+		void ReadChunks(vector< OBJChunk > &chunks);
 
 		/**
-		 Reads a Smoothing Group definition.
+		 Merges the given chunks in order.
 
-		 @note			A smoothing group is, if present, 
-						silently ignored.
+		 @param[in,out]	chunks
+						A reference to a vector containing the read chunks.
 		 @throws		FormattedException
-						Failed to read a Smoothing Group definition.
+						Failed to merge the chunks.
 		 */
-		void ReadOBJSmoothingGroup();
+		void MergeChunks(vector< OBJChunk > &chunks);
 
 		/**
-		 Reads a Vertex Position Coordinates definition.
+		 Applies the given statement.
 
+		 @param[in,out]	statement
+						A reference to the statement.
 		 @throws		FormattedException
-						Failed to read a Vertex Position Coordinates 
-						definition.
+						Failed to apply the given statement.
 		 */
-		void ReadOBJVertex();
+		void ApplyStatement(OBJStatement &statement);
 
 		/**
-		 Reads a Vertex Texture Coordinates definition.
+		 Adds the triangles of the given face vertices.
 
-		 @note			Only UV texture coordinates are supported,
-						The W component of UVW texture coordinates
-						is, if present, silently ignored.
-		 @throws		FormattedException
-						Failed to read a Vertex Texture Coordinates definition.
+		 @pre			@a face_vertices contains at least three indices.
+		 @param[in]		face_vertices
+						A reference to a vector containing the indices of the 
+						face vertices in the vertex buffer.
 		 */
-		void ReadOBJVertexTexture();
+		void AddFace(const vector< U32 > &face_vertices);
 
 		/**
-		 Reads a Vertex Normal Coordinates definition.
-
-		 @pre			All the vertex normals in the OBJ file are normalized.
+		 Resolves the given face vertex of a chunk.
+
+		 @param[in]		vertex
+						A reference to the face vertex.
+		 @param[in]		offsets
+						A reference to the number of vertex position/texture/
+						normal coordinates of all preceding chunks.
+		 @param[in]		limits
+						A reference to the number of vertex position/texture/
+						normal coordinates of the file preceding the face of 
+						the given face vertex.
+		 @param[in]		first_line_number
+						The line number of the first line of the chunk.
+		 @return		The resolved (one-based) vertex indices. A zero 
+						indicates the absence of a component.
 		 @throws		FormattedException
-						Failed to read a Vertex Normal Coordinates definition.
+						The given face vertex is invalid or refers to 
+						coordinates which do not precede its face.
 		 */
-		void ReadOBJVertexNormal();
-
+		const U32x3 ResolveVertexIndices(const OBJFaceVertex &vertex, 
+			const U32x3 &offsets, const U32x3 &limits, 
+			U32 first_line_number) const;
+		
 		/**
-		 Reads a Face definition.
+		 Constructs the vertex matching the given vertex indices.
 
-		 @throws		FormattedException
-						Failed to read a Face definition.
+		 @param[in]		vertex_indices
+						A reference to the vertex indices.
+		 @pre			The given vertex indices are in range.
+		 @return		The vertex matching the given vertex indices 
+						@a vertex_indices.
 		 */
-		void ReadOBJFace();
+		const VertexT ConstructVertex(const U32x3 &vertex_indices);
 
 		/**
-		 Reads a set of vertex position coordinates.
+		 Returns the index of the vertex (in the vertex buffer of the model 
+		 output) matching the given vertex indices. The vertex is constructed 
+		 if it does not exist yet.
 
-		 @return		The @c Point3 represented by the next token of this OBJ 
-						reader (modified according to the mesh descriptor of 
-						this OBj reader).
+		 @param[in]		vertex_indices
+						A reference to the vertex indices.
+		 @return		The index of the vertex matching the given vertex 
+						indices @a vertex_indices.
 		 @throws		FormattedException
-						Failed to read a @c Point3.
+						The given vertex indices are out of range.
 		 */
-		const Point3 ReadOBJVertexCoordinates();
+		U32 GetVertexIndex(const U32x3 &vertex_indices);
 
 		/**
-		 Reads a set of vertex normal coordinates.
+		 Grows the capacity of the vertex index mapping of this OBJ reader.
 
-		 @pre			All the vertex normals in the OBJ file are normalized.
-		 @return		The @c Normal3 represented by the next token of this 
-						OBJ reader (modified according to the mesh descriptor 
-						of this OBj reader).
-		 @throws		FormattedException
-						Failed to read a @c Normal3.
+		 @param[in]		nb_vertices
+						The number of vertices the vertex index mapping must 
+						be able to contain.
 		 */
-		const Normal3 ReadOBJVertexNormalCoordinates();
+		void GrowMapping(size_t nb_vertices);
 
 		/**
-		 Reads a set of vertex texture coordinates.
-
-		 @return		The @c UV represented by the next token of this OBJ 
-						reader (modified according to the mesh descriptor of 
-						this OBj reader).
-		 @throws		FormattedException
-						Failed to read a @c UV.
+		 A struct of entries of the open-addressing vertex index mapping.
 		 */
-		const UV ReadOBJVertexTextureCoordinates();
+		struct OBJMappingEntry final {
 
-		/**
-		 Reads a set of face indices.
+		public:
+
+			/**
+			 The vertex position/texture/normal coordinates' indices of this 
+			 entry.
+			 */
+			U32x3 m_key;
+
+			/**
+			 The index of the vertex in the vertex buffer of this entry, or 
+			 @c g_obj_empty_mapping_entry if this entry is empty.
+			 */
+			U32 m_index;
+		};
 
-		 @return		The face indices represented by the next token of this 
-						OBJ reader.	A zero indicates the absence of a 
-						component.
-		 @throws		FormattedException
-						Failed to read a Bool variable.
-		 */
-		const U32x3 ReadOBJVertexIndices();
-		
 		/**
-		 Constructs or retrieves (if already existing) the vertex matching the 
-		 given vertex indices.
+		 Returns the hash of the given vertex indices.
 
 		 @param[in]		vertex_indices
 						A reference to the vertex indices.
-		 @return		The vertex matching the given vertex indices 
-						@a vertex_indices.
+		 @return		The hash of the given vertex indices.
 		 */
-		const VertexT ConstructVertex(const U32x3 &vertex_indices);
-
-		/**
-		 A struct of @c U32x3 comparators for OBJ vertex indices.
-		 */
-		struct OBJComparatorU32x3 final {
-
-		public:
-
-			/**
-			 Compares the two given @c U32x3 vectors against each other.
-
-			 @param[in]		a
-							A reference to the first vector.
-			 @param[in]		b
-							A reference to the second vector.
-			 @return		@c true if the @a a is smaller than @a b. @c false 
-							otherwise.
-			 */
-			bool operator()(const U32x3& a, const U32x3& b) const {
-				return (a.m_x == b.m_x) ? ((a.m_y == b.m_y) ? 
-					(a.m_z < b.m_z) : (a.m_y < b.m_y)) : (a.m_x < b.m_x);
-			}
-		};
+		static size_t Hash(const U32x3 &vertex_indices) noexcept;
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -307,9 +303,21 @@ namespace mage {
 		/**
 		 A mapping between vertex position/texture/normal coordinates' indices
 		 and the index of a vertex in the vertex buffer (@c m_model_output) of 
-		 this OBJ reader.
+		 this OBJ reader. The mapping uses open addressing with linear probing 
+		 and has a power-of-two capacity.
+		 */
+		vector< OBJMappingEntry > m_mapping;
+
+		/**
+		 A vector containing the vertex indices of the current face of this 
+		 OBJ reader (reused across faces).
+		 */
+		vector< U32 > m_face_indices;
+
+		/**
+		 The current filename of this OBJ reader.
 		 */
-		map< U32x3, U32, OBJComparatorU32x3 > m_mapping;
+		wstring m_fname;
 		
 		/**
 		 A reference to a model output containing the read data of this OBJ 
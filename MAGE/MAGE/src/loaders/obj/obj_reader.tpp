@@ -5,29 +5,58 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\obj\obj_tokens.hpp"
 #include "loaders\material_loader.hpp"
 #include "mesh\vertex.hpp"
+#include "utils\io\mapped_file.hpp"
 #include "utils\string\string_utils.hpp"
 #include "utils\exception\exception.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+#include <execution>
+#include <limits>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	/**
+	 The index of empty entries of the vertex index mapping of OBJ readers.
+	 */
+	constexpr U32 g_obj_empty_mapping_entry = std::numeric_limits< U32 >::max();
+
+	/**
+	 The initial capacity of the vertex index mapping of OBJ readers.
+	 */
+	constexpr size_t g_obj_initial_mapping_capacity = 1024;
+
+	/**
+	 The (approximate) size in bytes of the chunks of OBJ readers. Files
+	 smaller than twice this size are read in a single chunk.
+	 */
+	constexpr size_t g_obj_chunk_size = 4u << 20u;
+
 	template < typename VertexT >
 	OBJReader< VertexT >::OBJReader(
 		ModelOutput< VertexT > &model_output,
 		const MeshDescriptor< VertexT > &mesh_desc)
-		: LineReader(),
-		m_vertex_coordinates(), 
+		: m_vertex_coordinates(),
 		m_vertex_texture_coordinates(),
-		m_vertex_normal_coordinates(), 
+		m_vertex_normal_coordinates(),
 		m_mapping(),
-		m_model_output(model_output), 
+		m_face_indices(),
+		m_fname(),
+		m_model_output(model_output),
 		m_mesh_desc(mesh_desc) {}
 
 	template < typename VertexT >
@@ -36,6 +65,23 @@ namespace mage {
 	template < typename VertexT >
 	OBJReader< VertexT >::~OBJReader() = default;
 
+	template < typename VertexT >
+	void OBJReader< VertexT >::ReadFromFile(wstring fname) {
+		m_fname = std::move(fname);
+
+		const MappedFile file(m_fname);
+		const char *begin = reinterpret_cast< const char * >(file.GetData());
+		const char *end   = begin + file.GetSize();
+
+		Preprocess();
+
+		vector< OBJChunk > chunks = SplitChunks(begin, end);
+		ReadChunks(chunks);
+		MergeChunks(chunks);
+
+		Postprocess();
+	}
+
 	template < typename VertexT >
 	void OBJReader< VertexT >::Preprocess() {
 		ThrowIfFailed(m_model_output.m_vertex_buffer.empty(),
@@ -54,269 +100,352 @@ namespace mage {
 	}
 
 	template < typename VertexT >
-	void OBJReader< VertexT >::ReadLine(char *line) {
-		m_context = nullptr;
-		const char *token 
-			= strtok_s(line, GetDelimiters().c_str(), &m_context);
+	vector< OBJChunk > OBJReader< VertexT >::SplitChunks(
+		const char *begin, const char *end) {
 
-		if (!token || MAGE_OBJ_COMMENT_CHAR == token[0]) {
-			return;
-		}
+		const size_t size      = static_cast< size_t >(end - begin);
+		const size_t nb_chunks = std::max(size_t(1), size / g_obj_chunk_size);
 
-		if (str_equals(token, MAGE_OBJ_TOKEN_VERTEX)) {
-			ReadOBJVertex();
-		}
-		else if (str_equals(token, MAGE_OBJ_TOKEN_TEXTURE)) {
-			ReadOBJVertexTexture();
-		}
-		else if (str_equals(token, MAGE_OBJ_TOKEN_NORMAL)) {
-			ReadOBJVertexNormal();
-		}
-		else if (str_equals(token, MAGE_OBJ_TOKEN_FACE)) {
-			ReadOBJFace();
-		}
-		else if (str_equals(token, MAGE_OBJ_TOKEN_MATERIAL_LIBRARY)) {
-			ReadOBJMaterialLibrary();
-		}
-		else if (str_equals(token, MAGE_OBJ_TOKEN_MATERIAL_USE)) {
-			ReadOBJMaterialUse();
-		}
-		else if (str_equals(token, MAGE_OBJ_TOKEN_GROUP)) {
-			ReadOBJGroup();
-		}
-		else if (str_equals(token, MAGE_OBJ_TOKEN_OBJECT)) {
-			ReadOBJObject();
-		}
-		else if (str_equals(token, MAGE_OBJ_TOKEN_SMOOTHING_GROUP)) {
-			ReadOBJSmoothingGroup();
-		}
-		else {
-			Warning(
-				"%ls: line %u: unsupported keyword token: %s.", 
-				GetFilename().c_str(), GetCurrentLineNumber(), token);
-			return;
-		}
+		vector< OBJChunk > chunks;
+		chunks.reserve(nb_chunks);
 
-		ReadLineRemaining();
-	}
+		const char *chunk_begin = begin;
+		for (size_t i = 1; i <= nb_chunks; ++i) {
+			const char *chunk_end = end;
 
-	template < typename VertexT >
-	void OBJReader< VertexT >::ReadOBJMaterialLibrary() {
-		const wstring mtl_path  = mage::GetPathName(GetFilename());
-		const wstring mtl_name  = str_convert(ReadString());
-		const wstring mtl_fname = mage::GetFilename(mtl_path, mtl_name);
-
-		ImportMaterialFromFile(mtl_fname, m_model_output.m_material_buffer);
-	}
+			if (i != nb_chunks) {
+				// Move the split point past the end of its line.
+				const char *split = std::max(chunk_begin, begin + i * (size / nb_chunks));
+				const void *eol   = std::memchr(split, '\n',
+					                            static_cast< size_t >(end - split));
+				chunk_end = eol ? static_cast< const char * >(eol) + 1 : end;
+			}
 
-	template < typename VertexT >
-	void OBJReader< VertexT >::ReadOBJMaterialUse() {
-		m_model_output.SetMaterial(ReadString());
-	}
+			if (chunk_begin == chunk_end && !chunks.empty()) {
+				continue;
+			}
 
-	template < typename VertexT >
-	void OBJReader< VertexT >::ReadOBJGroup() {
-		// End current group.
-		m_model_output.EndModelPart();
+			OBJChunk chunk = {};
+			chunk.m_begin = chunk_begin;
+			chunk.m_end   = chunk_end;
+			chunks.push_back(std::move(chunk));
 
-		ModelPart model_part;
-		model_part.m_child = ReadString();
-		if (HasChars()) {
-			if (!HasF32()) {
-				model_part.m_parent  = ReadString();
-			}
-			model_part.m_translation = InvertHandness(Point3(ReadF32x3()));
-			model_part.m_rotation    = ReadF32x3();
-			model_part.m_scale       = ReadF32x3();
+			chunk_begin = chunk_end;
 		}
-		
-		// Begin current group.
-		m_model_output.StartModelPart(std::move(model_part));
-	}
 
-	template < typename VertexT >
-	void OBJReader< VertexT >::ReadOBJObject() {
-		ReadString();
+		return chunks;
 	}
 
 	template < typename VertexT >
-	void OBJReader< VertexT >::ReadOBJSmoothingGroup() {
-		// Silently ignore smoothing group declarations
-		ReadString();
-	}
+	void OBJReader< VertexT >::ReadChunks(vector< OBJChunk > &chunks) {
+		const bool invert_handness = m_mesh_desc.InvertHandness();
 
-	template < typename VertexT >
-	void OBJReader< VertexT >::ReadOBJVertex() {
-		const Point3 vertex = m_mesh_desc.InvertHandness() ?
-			InvertHandness(ReadOBJVertexCoordinates()) :
-			ReadOBJVertexCoordinates();
+		if (1 == chunks.size()) {
+			OBJChunkReader reader(m_fname, invert_handness, chunks.front());
+			reader.Read();
+			return;
+		}
 
-		m_vertex_coordinates.push_back(std::move(vertex));
-	}
+		// The chunks only share the (read-only) mapped file.
+		std::for_each(std::execution::par, chunks.begin(), chunks.end(),
+			[this, invert_handness](OBJChunk &chunk) noexcept {
+				try {
+					OBJChunkReader reader(m_fname, invert_handness, chunk);
+					reader.Read();
+				}
+				catch (...) {
+					chunk.m_failed = true;
+				}
+			});
 
-	template < typename VertexT >
-	void OBJReader< VertexT >::ReadOBJVertexTexture() {
-		const UV texture = m_mesh_desc.InvertHandness() ?
-			InvertHandness(ReadOBJVertexTextureCoordinates()) :
-			ReadOBJVertexTextureCoordinates();
+		// Re-read the first failed chunk with its actual first line number to
+		// report the error.
+		U32 first_line_number = 1u;
+		for (const auto &chunk : chunks) {
+			if (chunk.m_failed) {
+				OBJChunk failed_chunk = {};
+				failed_chunk.m_begin = chunk.m_begin;
+				failed_chunk.m_end   = chunk.m_end;
 
-		m_vertex_texture_coordinates.push_back(std::move(texture));
-	}
+				OBJChunkReader reader(m_fname, invert_handness, failed_chunk);
+				reader.Read(first_line_number);
 
-	template < typename VertexT >
-	void OBJReader< VertexT >::ReadOBJVertexNormal() {
-		const Normal3 normal = m_mesh_desc.InvertHandness() ?
-			InvertHandness(ReadOBJVertexNormalCoordinates()) :
-			ReadOBJVertexNormalCoordinates();
-		const XMVECTOR v = XMLoadFloat3(&normal);
-		const XMVECTOR normal_v = XMVector3Normalize(v);
-		XMLoadFloat3(&normal);
-
-		m_vertex_normal_coordinates.push_back(std::move(normal));
+				throw FormattedException(
+					"%ls: could not read file.", GetFilename().c_str());
+			}
+
+			first_line_number += chunk.m_nb_lines;
+		}
 	}
 
 	template < typename VertexT >
-	void OBJReader< VertexT >::ReadOBJFace() {
-		
-		vector< U32 > indices;
-		while (indices.size() < 3 || HasString()) {
-			const U32x3 vertex_indices = ReadOBJVertexIndices();
+	void OBJReader< VertexT >::MergeChunks(vector< OBJChunk > &chunks) {
+		size_t nb_positions = 0;
+		size_t nb_textures  = 0;
+		size_t nb_normals   = 0;
+		size_t nb_indices   = 0;
+		for (const auto &chunk : chunks) {
+			nb_positions += chunk.m_vertex_coordinates.size();
+			nb_textures  += chunk.m_vertex_texture_coordinates.size();
+			nb_normals   += chunk.m_vertex_normal_coordinates.size();
+			for (const U32 face_size : chunk.m_face_sizes) {
+				nb_indices += 3u * (face_size - 2u);
+			}
+		}
 
-			if (const auto it = m_mapping.find(vertex_indices); 
-				it != m_mapping.cend()) {
+		// Concatenate the coordinates. Indices are checked against the
+		// coordinates preceding their face.
+		m_vertex_coordinates.reserve(m_vertex_coordinates.size() + nb_positions);
+		m_vertex_texture_coordinates.reserve(
+			m_vertex_texture_coordinates.size() + nb_textures);
+		m_vertex_normal_coordinates.reserve(
+			m_vertex_normal_coordinates.size() + nb_normals);
+		for (const auto &chunk : chunks) {
+			m_vertex_coordinates.insert(m_vertex_coordinates.end(),
+				chunk.m_vertex_coordinates.cbegin(),
+				chunk.m_vertex_coordinates.cend());
+			m_vertex_texture_coordinates.insert(m_vertex_texture_coordinates.end(),
+				chunk.m_vertex_texture_coordinates.cbegin(),
+				chunk.m_vertex_texture_coordinates.cend());
+			m_vertex_normal_coordinates.insert(m_vertex_normal_coordinates.end(),
+				chunk.m_vertex_normal_coordinates.cbegin(),
+				chunk.m_vertex_normal_coordinates.cend());
+		}
 
-				indices.push_back(it->second);
+		// Most vertices typically have a unique position.
+		m_model_output.m_vertex_buffer.reserve(
+			m_model_output.m_vertex_buffer.size() + nb_positions);
+		m_model_output.m_index_buffer.reserve(
+			m_model_output.m_index_buffer.size() + nb_indices);
+		GrowMapping(m_model_output.m_vertex_buffer.size() + nb_positions);
+
+		U32x3 offsets(0u);
+		U32 first_line_number = 1u;
+		for (auto &chunk : chunks) {
+			for (const auto &warning : chunk.m_warnings) {
+				Warning("%ls: line %u: %s", GetFilename().c_str(),
+					first_line_number + warning.m_line_number - 1u,
+					warning.m_message.c_str());
 			}
-			else {
-				const U32 index 
-					= static_cast< U32 >(m_model_output.m_vertex_buffer.size());
-				indices.push_back(index);
-				m_model_output.m_vertex_buffer.push_back(ConstructVertex(vertex_indices));
-				m_mapping[vertex_indices] = index;
-			}
-		}
 
-		if (m_mesh_desc.ClockwiseOrder()) {
-			for (size_t i = 1; i < indices.size() - 1; ++i) {
-				m_model_output.m_index_buffer.push_back(indices[0]);
-				m_model_output.m_index_buffer.push_back(indices[i + 1]);
-				m_model_output.m_index_buffer.push_back(indices[i]);
+			size_t statement   = 0;
+			size_t face_vertex = 0;
+			for (size_t face = 0; face < chunk.m_face_sizes.size(); ++face) {
+				for (; statement < chunk.m_statements.size()
+					   && chunk.m_statements[statement].m_face == face;
+					 ++statement) {
+
+					ApplyStatement(chunk.m_statements[statement]);
+				}
+
+				const U32x3 &nb_coordinates = chunk.m_face_nb_coordinates[face];
+				const U32x3 limits(offsets.m_x + nb_coordinates.m_x,
+					               offsets.m_y + nb_coordinates.m_y,
+					               offsets.m_z + nb_coordinates.m_z);
+
+				m_face_indices.clear();
+				for (U32 i = 0u; i < chunk.m_face_sizes[face]; ++i) {
+					const U32x3 vertex_indices = ResolveVertexIndices(
+						chunk.m_face_vertices[face_vertex++], offsets, limits,
+						first_line_number);
+					m_face_indices.push_back(GetVertexIndex(vertex_indices));
+				}
+
+				AddFace(m_face_indices);
 			}
-		}
-		else {
-			for (size_t i = 1; i < indices.size() - 1; ++i) {
-				m_model_output.m_index_buffer.push_back(indices[0]);
-				m_model_output.m_index_buffer.push_back(indices[i]);
-				m_model_output.m_index_buffer.push_back(indices[i + 1]);
+
+			for (; statement < chunk.m_statements.size(); ++statement) {
+				ApplyStatement(chunk.m_statements[statement]);
 			}
+
+			offsets.m_x += static_cast< U32 >(chunk.m_vertex_coordinates.size());
+			offsets.m_y += static_cast< U32 >(chunk.m_vertex_texture_coordinates.size());
+			offsets.m_z += static_cast< U32 >(chunk.m_vertex_normal_coordinates.size());
+			first_line_number += chunk.m_nb_lines;
 		}
 	}
 
 	template < typename VertexT >
-	inline const Point3 OBJReader< VertexT >::ReadOBJVertexCoordinates() {
-		return Point3(ReadF32x3());
-	}
+	void OBJReader< VertexT >::ApplyStatement(OBJStatement &statement) {
+		switch (statement.m_type) {
+
+		case OBJStatementType::Group: {
+			// End current group.
+			m_model_output.EndModelPart();
+			// Begin current group.
+			m_model_output.StartModelPart(std::move(statement.m_model_part));
+			break;
+		}
 
-	template < typename VertexT >
-	inline const Normal3 OBJReader< VertexT >::ReadOBJVertexNormalCoordinates() {
-		return Normal3(ReadF32x3());
-	}
+		case OBJStatementType::MaterialLibrary: {
+			const wstring mtl_path  = mage::GetPathName(GetFilename());
+			const wstring mtl_name  = str_convert(statement.m_name);
+			const wstring mtl_fname = mage::GetFilename(mtl_path, mtl_name);
 
-	template < typename VertexT >
-	inline const UV OBJReader< VertexT >::ReadOBJVertexTextureCoordinates() {
-		const UV result(ReadF32x2());
-		
-		if (HasF32()) {
-			// Silently ignore 3D vertex texture coordinates.
-			ReadF32();
+			ImportMaterialFromFile(mtl_fname, m_model_output.m_material_buffer);
+			break;
 		}
 
-		return result;
+		case OBJStatementType::MaterialUse: {
+			m_model_output.SetMaterial(std::move(statement.m_name));
+			break;
+		}
+		}
 	}
 
 	template < typename VertexT >
-	const U32x3 OBJReader< VertexT >::ReadOBJVertexIndices() {
-		const char *token = ReadChars();
+	void OBJReader< VertexT >::AddFace(const vector< U32 > &face_vertices) {
+		Assert(3 <= face_vertices.size());
 
-		U32 vertex_index = 0;
-		U32 texture_index = 0;
-		U32 normal_index = 0;
+		vector< U32 > &index_buffer = m_model_output.m_index_buffer;
+		const size_t nb_triangles   = face_vertices.size() - 2;
 
-		if (str_contains(token, "//")) {
-			// v1//vn1
-			const char *index_end = strchr(token, '/');
-			if (StringToU32(token, index_end, vertex_index) == TokenResult::Invalid) {
-				throw FormattedException(
-					"%ls: line %u: invalid vertex index value found in %s.", 
-					GetFilename().c_str(), GetCurrentLineNumber(), token);
-			}
-			if (StringToU32(index_end + 2, normal_index) == TokenResult::Invalid) {
-				throw FormattedException(
-					"%ls: line %u: invalid normal index value found in %s.", 
-					GetFilename().c_str(), GetCurrentLineNumber(), token);
+		if (m_mesh_desc.ClockwiseOrder()) {
+			for (size_t i = 1; i <= nb_triangles; ++i) {
+				index_buffer.push_back(face_vertices[0]);
+				index_buffer.push_back(face_vertices[i + 1]);
+				index_buffer.push_back(face_vertices[i]);
 			}
 		}
-		else if (str_contains(token, '/')) {
-			// v1/vt1 or v1/vt1/vn1
-			const char *index_end = strchr(token, '/');
-			if (StringToU32(token, index_end, vertex_index) == TokenResult::Invalid) {
-				throw FormattedException(
-					"%ls: line %u: invalid vertex index value found in %s.", 
-					GetFilename().c_str(), GetCurrentLineNumber(), token);
-			}
-			
-			if (str_contains(index_end + 1, '/')) {
-				const char *texture_end = strchr(index_end + 1, '/');
-				if (StringToU32(index_end + 1, texture_end, texture_index) == TokenResult::Invalid) {
-					throw FormattedException(
-						"%ls: line %u: invalid texture index value found in %s.", 
-						GetFilename().c_str(), GetCurrentLineNumber(), token);
-				}
-				if (StringToU32(texture_end + 1, normal_index) == TokenResult::Invalid) {
-					throw FormattedException(
-						"%ls: line %u: invalid normal index value found in %s.", 
-						GetFilename().c_str(), GetCurrentLineNumber(), token);
-				}
-			}
-			else if (StringToU32(index_end + 1, texture_index) == TokenResult::Invalid) {
-				throw FormattedException(
-					"%ls: line %u: invalid texture index value found in %s.", 
-					GetFilename().c_str(), GetCurrentLineNumber(), token);
+		else {
+			for (size_t i = 1; i <= nb_triangles; ++i) {
+				index_buffer.push_back(face_vertices[0]);
+				index_buffer.push_back(face_vertices[i]);
+				index_buffer.push_back(face_vertices[i + 1]);
 			}
 		}
-		else if (StringToU32(token, vertex_index) == TokenResult::Invalid) {
-			throw FormattedException(
-				"%ls: line %u: invalid vertex index value found in %s.", 
-				GetFilename().c_str(), GetCurrentLineNumber(), token);
-		}
+	}
 
-		return U32x3(vertex_index, texture_index, normal_index);
+	template < typename VertexT >
+	const U32x3 OBJReader< VertexT >::ResolveVertexIndices(
+		const OBJFaceVertex &vertex, const U32x3 &offsets, 
+		const U32x3 &limits, U32 first_line_number) const {
+
+		const U32 line_number = first_line_number + vertex.m_line_number - 1u;
+
+		const auto resolve = [this, line_number](S32 index, U32 offset, 
+			U32 limit, bool relative, const char *component) {
+
+			const S64 resolved_index = relative
+				? static_cast< S64 >(offset) + index : index;
+			ThrowIfFailed((0 <= resolved_index && (!relative || 0 < resolved_index)),
+				"%ls: line %u: invalid %s index value found.",
+				GetFilename().c_str(), line_number, component);
+			// Faces may only refer to preceding coordinates.
+			ThrowIfFailed((resolved_index <= static_cast< S64 >(limit)),
+				"%ls: line %u: %s index out of range: %lld.",
+				GetFilename().c_str(), line_number, component, resolved_index);
+			return static_cast< U32 >(resolved_index);
+		};
+
+		return U32x3(
+			resolve(vertex.m_indices.m_x, offsets.m_x, limits.m_x, 
+				    0u != (vertex.m_relative & 1u), "vertex"),
+			resolve(vertex.m_indices.m_y, offsets.m_y, limits.m_y, 
+				    0u != (vertex.m_relative & 2u), "texture"),
+			resolve(vertex.m_indices.m_z, offsets.m_z, limits.m_z, 
+				    0u != (vertex.m_relative & 4u), "normal"));
 	}
 
 	template < typename VertexT >
 	const VertexT OBJReader< VertexT >::ConstructVertex(
 		const U32x3 &vertex_indices) {
-		
+
 		VertexT vertex;
 
 		if constexpr(VertexT::HasPosition()) {
 			if (vertex_indices.m_x) {
+				Assert(vertex_indices.m_x <= m_vertex_coordinates.size());
 				vertex.p = m_vertex_coordinates[vertex_indices.m_x - 1];
 			}
 		}
 
 		if constexpr(VertexT::HasTexture()) {
 			if (vertex_indices.m_y) {
+				Assert(vertex_indices.m_y <= m_vertex_texture_coordinates.size());
 				vertex.tex = m_vertex_texture_coordinates[vertex_indices.m_y - 1];
 			}
 		}
 
 		if constexpr(VertexT::HasNormal()) {
 			if (vertex_indices.m_z) {
+				Assert(vertex_indices.m_z <= m_vertex_normal_coordinates.size());
 				vertex.n = m_vertex_normal_coordinates[vertex_indices.m_z - 1];
 			}
 		}
 
 		return vertex;
 	}
+
+	template < typename VertexT >
+	U32 OBJReader< VertexT >::GetVertexIndex(const U32x3 &vertex_indices) {
+		vector< VertexT > &vertex_buffer = m_model_output.m_vertex_buffer;
+
+		// Keep the load factor at or below one half.
+		if (2 * (vertex_buffer.size() + 1) > m_mapping.size()) {
+			GrowMapping(vertex_buffer.size() + 1);
+		}
+
+		const size_t mask = m_mapping.size() - 1;
+		for (size_t i = Hash(vertex_indices) & mask; true; i = (i + 1) & mask) {
+			OBJMappingEntry &entry = m_mapping[i];
+
+			if (g_obj_empty_mapping_entry == entry.m_index) {
+				const U32 index = static_cast< U32 >(vertex_buffer.size());
+				vertex_buffer.push_back(ConstructVertex(vertex_indices));
+				entry.m_key   = vertex_indices;
+				entry.m_index = index;
+				return index;
+			}
+
+			if (entry.m_key.m_x == vertex_indices.m_x
+				&& entry.m_key.m_y == vertex_indices.m_y
+				&& entry.m_key.m_z == vertex_indices.m_z) {
+
+				return entry.m_index;
+			}
+		}
+	}
+
+	template < typename VertexT >
+	void OBJReader< VertexT >::GrowMapping(size_t nb_vertices) {
+		size_t capacity
+			= std::max(g_obj_initial_mapping_capacity, m_mapping.size());
+		while (capacity < 2 * nb_vertices) {
+			capacity *= 2;
+		}
+
+		if (capacity == m_mapping.size()) {
+			return;
+		}
+
+		const size_t mask = capacity - 1;
+		vector< OBJMappingEntry > mapping(capacity,
+			OBJMappingEntry{ U32x3(), g_obj_empty_mapping_entry });
+
+		for (const auto &entry : m_mapping) {
+			if (g_obj_empty_mapping_entry == entry.m_index) {
+				continue;
+			}
+
+			size_t i = Hash(entry.m_key) & mask;
+			while (g_obj_empty_mapping_entry != mapping[i].m_index) {
+				i = (i + 1) & mask;
+			}
+			mapping[i] = entry;
+		}
+
+		m_mapping = std::move(mapping);
+	}
+
+	template < typename VertexT >
+	inline size_t OBJReader< VertexT >::Hash(
+		const U32x3 &vertex_indices) noexcept {
+
+		const U64 hash
+			= static_cast< U64 >(vertex_indices.m_x) * 0x9E3779B97F4A7C15ull
+			^ static_cast< U64 >(vertex_indices.m_y) * 0xC2B2AE3D27D4EB4Full
+			^ static_cast< U64 >(vertex_indices.m_z) * 0x165667B19E3779F9ull;
+		return static_cast< size_t >(hash ^ (hash >> 32));
+	}
 }
\ No newline at end of file
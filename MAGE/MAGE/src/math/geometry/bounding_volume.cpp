@@ -85,6 +85,27 @@ namespace mage {
 		return AABB(pmin, pmax);
 	}
 
+	const AABB XM_CALLCONV TransformAABB(const AABB &aabb, 
+		FXMMATRIX transform) noexcept {
+
+		const XMVECTOR p_min = XMLoadFloat3(&aabb.m_p_min);
+		const XMVECTOR p_max = XMLoadFloat3(&aabb.m_p_max);
+		
+		// Transform the center and the half extents of the AABB.
+		const XMVECTOR c = XMVector3TransformCoord(
+			                   0.5f * (p_min + p_max), transform);
+		const XMVECTOR e = 0.5f * (p_max - p_min);
+		const XMVECTOR transformed_e 
+			= XMVectorAbs(transform.r[0]) * XMVectorSplatX(e)
+			+ XMVectorAbs(transform.r[1]) * XMVectorSplatY(e)
+			+ XMVectorAbs(transform.r[2]) * XMVectorSplatZ(e);
+
+		Point3 pmin, pmax;
+		XMStoreFloat3(&pmin, c - transformed_e);
+		XMStoreFloat3(&pmax, c + transformed_e);
+		return AABB(pmin, pmax);
+	}
+
 	//-------------------------------------------------------------------------
 	// Axis-Aligned Bounding Box
 	//-------------------------------------------------------------------------
@@ -772,6 +772,21 @@ namespace mage {
 	 */
 	const AABB OverlapStrict(const AABB &aabb1, const AABB &aabb2) noexcept;
 	
+	/**
+	 Returns the AABB enclosing the given AABB transformed by the given 
+	 transformation matrix.
+
+	 @param[in]		aabb
+					A reference to the AABB.
+	 @param[in]		transform
+					The (affine) transformation matrix (e.g. the 
+					object-to-world transformation matrix).
+	 @return		The AABB enclosing @a aabb transformed by 
+					@a transform.
+	 */
+	const AABB XM_CALLCONV TransformAABB(const AABB &aabb, 
+		FXMMATRIX transform) noexcept;
+	
 	/**
 	 Returns the minimum AABB (i.e. variant for union operations).
 
@@ -4,6 +4,16 @@
 #pragma region
 
 #include "math\geometry\view_frustum.hpp"
+#include "utils\logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
 
 #pragma endregion
 
@@ -12,6 +22,128 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	//-------------------------------------------------------------------------
+	// AABBBatch
+	//-------------------------------------------------------------------------
+
+	AABBBatch::AABBBatch() 
+		: m_packets(), m_size(0) {}
+
+	AABBBatch::AABBBatch(const AABBBatch &batch) = default;
+
+	AABBBatch::AABBBatch(AABBBatch &&batch) noexcept = default;
+
+	AABBBatch::~AABBBatch() = default;
+
+	AABBBatch &AABBBatch::operator=(const AABBBatch &batch) = default;
+
+	AABBBatch &AABBBatch::operator=(AABBBatch &&batch) noexcept = default;
+
+	void AABBBatch::clear() noexcept {
+		m_packets.clear();
+		m_size = 0;
+	}
+
+	void AABBBatch::reserve(size_t nb_aabbs) {
+		m_packets.reserve((nb_aabbs + 3) / 4);
+	}
+
+	void AABBBatch::Rebind(MemoryArena *memory_arena) {
+		RebindArenaVector(m_packets, memory_arena);
+		m_size = 0;
+	}
+
+	void AABBBatch::push_back(const AABB &aabb) {
+		const size_t lane = m_size & 3;
+		if (0 == lane) {
+			// The unused lanes of a packet contain degenerate AABBs.
+			m_packets.push_back({});
+		}
+
+		Packet &packet = m_packets.back();
+		packet.m_min_x[lane] = aabb.m_p_min.m_x;
+		packet.m_min_y[lane] = aabb.m_p_min.m_y;
+		packet.m_min_z[lane] = aabb.m_p_min.m_z;
+		packet.m_max_x[lane] = aabb.m_p_max.m_x;
+		packet.m_max_y[lane] = aabb.m_p_max.m_y;
+		packet.m_max_z[lane] = aabb.m_p_max.m_z;
+
+		++m_size;
+	}
+
+	void XM_CALLCONV AABBBatch::push_back(const AABB &aabb, 
+		FXMMATRIX transform) {
+		
+		push_back(TransformAABB(aabb, transform));
+	}
+
+	//-------------------------------------------------------------------------
+	// BSBatch
+	//-------------------------------------------------------------------------
+
+	BSBatch::BSBatch()
+		: m_packets(), m_size(0) {}
+
+	BSBatch::BSBatch(const BSBatch &batch) = default;
+
+	BSBatch::BSBatch(BSBatch &&batch) noexcept = default;
+
+	BSBatch::~BSBatch() = default;
+
+	BSBatch &BSBatch::operator=(const BSBatch &batch) = default;
+
+	BSBatch &BSBatch::operator=(BSBatch &&batch) noexcept = default;
+
+	void BSBatch::clear() noexcept {
+		m_packets.clear();
+		m_size = 0;
+	}
+
+	void BSBatch::reserve(size_t nb_bss) {
+		m_packets.reserve((nb_bss + 3) / 4);
+	}
+
+	void BSBatch::Rebind(MemoryArena *memory_arena) {
+		RebindArenaVector(m_packets, memory_arena);
+		m_size = 0;
+	}
+
+	void BSBatch::push_back(const BS &bs) {
+		const size_t lane = m_size & 3;
+		if (0 == lane) {
+			// The unused lanes of a packet contain degenerate BSs.
+			m_packets.push_back({});
+		}
+
+		Packet &packet = m_packets.back();
+		packet.m_x[lane] = bs.m_p.m_x;
+		packet.m_y[lane] = bs.m_p.m_y;
+		packet.m_z[lane] = bs.m_p.m_z;
+		packet.m_r[lane] = bs.m_r;
+
+		++m_size;
+	}
+
+	void XM_CALLCONV BSBatch::push_back(const BS &bs, FXMMATRIX transform) {
+		const XMVECTOR c = XMVector3TransformCoord(
+			                   XMLoadFloat3(&bs.m_p), transform);
+		
+		// Scale the radius with the largest scale factor of the transform.
+		const XMVECTOR s = XMVectorMax(XMVector3LengthSq(transform.r[0]),
+			               XMVectorMax(XMVector3LengthSq(transform.r[1]),
+							           XMVector3LengthSq(transform.r[2])));
+		const F32 r = bs.m_r * XMVectorGetX(XMVectorSqrt(s));
+
+		Point3 transformed_p;
+		XMStoreFloat3(&transformed_p, c);
+
+		push_back(BS(transformed_p, r));
+	}
+
+	//-------------------------------------------------------------------------
+	// ViewFrustum
+	//-------------------------------------------------------------------------
+
 	ViewFrustum::ViewFrustum(CXMMATRIX transform) {
 		const XMMATRIX C = XMMatrixTranspose(transform);
 
@@ -259,6 +391,312 @@ namespace mage {
 		return true;
 	}
 
+	//-------------------------------------------------------------------------
+	// ViewFrustum: Overlapping = Partial | Full Coverage (Batches)
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of view frustum planes replicated over four lanes.
+	 */
+	struct alignas(16) PlanePacket final {
+
+	public:
+
+		/**
+		 The replicated x-coordinate of the normal of this plane packet.
+		 */
+		XMVECTOR m_nx;
+
+		/**
+		 The replicated y-coordinate of the normal of this plane packet.
+		 */
+		XMVECTOR m_ny;
+
+		/**
+		 The replicated z-coordinate of the normal of this plane packet.
+		 */
+		XMVECTOR m_nz;
+
+		/**
+		 The replicated offset of this plane packet.
+		 */
+		XMVECTOR m_d;
+
+		/**
+		 The control vector for selecting the maximum x-coordinates along the 
+		 normal of this plane packet.
+		 */
+		XMVECTOR m_x_control;
+
+		/**
+		 The control vector for selecting the maximum y-coordinates along the 
+		 normal of this plane packet.
+		 */
+		XMVECTOR m_y_control;
+
+		/**
+		 The control vector for selecting the maximum z-coordinates along the 
+		 normal of this plane packet.
+		 */
+		XMVECTOR m_z_control;
+	};
+
+	/**
+	 Replicates the given view frustum planes over four lanes.
+
+	 @param[in]		planes
+					A reference to the view frustum planes.
+	 @param[out]	plane_packets
+					A reference to the plane packets.
+	 */
+	inline void ReplicatePlanes(const XMVECTOR (&planes)[6], 
+		PlanePacket (&plane_packets)[6]) noexcept {
+
+		for (size_t i = 0; i < 6; ++i) {
+			PlanePacket &packet = plane_packets[i];
+			packet.m_nx = XMVectorSplatX(planes[i]);
+			packet.m_ny = XMVectorSplatY(planes[i]);
+			packet.m_nz = XMVectorSplatZ(planes[i]);
+			packet.m_d  = XMVectorSplatW(planes[i]);
+			packet.m_x_control = XMVectorGreaterOrEqual(packet.m_nx, XMVectorZero());
+			packet.m_y_control = XMVectorGreaterOrEqual(packet.m_ny, XMVectorZero());
+			packet.m_z_control = XMVectorGreaterOrEqual(packet.m_nz, XMVectorZero());
+		}
+	}
+
+	/**
+	 Converts the given control vector to a four bit mask.
+
+	 @param[in]		control
+					The control vector.
+	 @return		The four bit mask containing the most significant bit of 
+					each component of @a control.
+	 */
+	inline U32 XM_CALLCONV GetMask(FXMVECTOR control) noexcept {
+#if defined(_XM_SSE_INTRINSICS_) && !defined(_XM_NO_INTRINSICS_)
+		return static_cast< U32 >(_mm_movemask_ps(control));
+#else  // defined(_XM_SSE_INTRINSICS_) && !defined(_XM_NO_INTRINSICS_)
+		return  (XMVectorGetIntX(control) >> 31)
+			 | ((XMVectorGetIntY(control) >> 31) << 1)
+			 | ((XMVectorGetIntZ(control) >> 31) << 2)
+			 | ((XMVectorGetIntW(control) >> 31) << 3);
+#endif // defined(_XM_SSE_INTRINSICS_) && !defined(_XM_NO_INTRINSICS_)
+	}
+
+	/**
+	 Returns the four bit mask of the valid lanes of the given packet.
+
+	 @param[in]		packet_index
+					The index of the packet.
+	 @param[in]		size
+					The number of elements of all packets.
+	 @return		The four bit mask of the valid lanes of the packet.
+	 */
+	inline U32 GetLaneMask(size_t packet_index, size_t size) noexcept {
+		const size_t nb_lanes = size - 4 * packet_index;
+		return (4 <= nb_lanes) ? 0xFu : ((1u << nb_lanes) - 1u);
+	}
+
+	/**
+	 Returns the number of set bits of the given four bit mask.
+
+	 @param[in]		mask
+					The four bit mask.
+	 @return		The number of set bits of @a mask.
+	 */
+	inline size_t CountMask(U32 mask) noexcept {
+		static constexpr U8 s_counts[16] = { 
+			0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 
+		};
+
+		return s_counts[mask & 0xFu];
+	}
+
+	/**
+	 Checks which of the four given AABBs overlap the given plane packets.
+
+	 @param[in]		plane_packets
+					A reference to the plane packets.
+	 @param[in]		min_x
+					A pointer to the (aligned) minimum x-coordinates.
+	 @param[in]		min_y
+					A pointer to the (aligned) minimum y-coordinates.
+	 @param[in]		min_z
+					A pointer to the (aligned) minimum z-coordinates.
+	 @param[in]		max_x
+					A pointer to the (aligned) maximum x-coordinates.
+	 @param[in]		max_y
+					A pointer to the (aligned) maximum y-coordinates.
+	 @param[in]		max_z
+					A pointer to the (aligned) maximum z-coordinates.
+	 @return		The four bit mask of the overlapping AABBs.
+	 */
+	inline U32 OverlapsAABBs(const PlanePacket (&plane_packets)[6],
+		const F32 *min_x, const F32 *min_y, const F32 *min_z,
+		const F32 *max_x, const F32 *max_y, const F32 *max_z) noexcept {
+
+		const XMVECTOR v_min_x = XMLoadFloat4A(reinterpret_cast< const XMFLOAT4A * >(min_x));
+		const XMVECTOR v_min_y = XMLoadFloat4A(reinterpret_cast< const XMFLOAT4A * >(min_y));
+		const XMVECTOR v_min_z = XMLoadFloat4A(reinterpret_cast< const XMFLOAT4A * >(min_z));
+		const XMVECTOR v_max_x = XMLoadFloat4A(reinterpret_cast< const XMFLOAT4A * >(max_x));
+		const XMVECTOR v_max_y = XMLoadFloat4A(reinterpret_cast< const XMFLOAT4A * >(max_y));
+		const XMVECTOR v_max_z = XMLoadFloat4A(reinterpret_cast< const XMFLOAT4A * >(max_z));
+
+		XMVECTOR result = XMVectorTrueInt();
+		for (size_t i = 0; i < 6; ++i) {
+			const PlanePacket &plane = plane_packets[i];
+			
+			// Test the maximum points along the plane normal.
+			const XMVECTOR x = XMVectorSelect(v_min_x, v_max_x, plane.m_x_control);
+			const XMVECTOR y = XMVectorSelect(v_min_y, v_max_y, plane.m_y_control);
+			const XMVECTOR z = XMVectorSelect(v_min_z, v_max_z, plane.m_z_control);
+			const XMVECTOR distance = XMVectorMultiplyAdd(plane.m_nx, x,
+				                      XMVectorMultiplyAdd(plane.m_ny, y,
+									  XMVectorMultiplyAdd(plane.m_nz, z, plane.m_d)));
+			
+			result = XMVectorAndInt(result, 
+				XMVectorGreaterOrEqual(distance, XMVectorZero()));
+		}
+
+		return GetMask(result);
+	}
+
+	/**
+	 Checks which of the four given BSs overlap the given plane packets.
+
+	 @param[in]		plane_packets
+					A reference to the plane packets.
+	 @param[in]		x
+					A pointer to the (aligned) x-coordinates of the centers.
+	 @param[in]		y
+					A pointer to the (aligned) y-coordinates of the centers.
+	 @param[in]		z
+					A pointer to the (aligned) z-coordinates of the centers.
+	 @param[in]		r
+					A pointer to the (aligned) radii.
+	 @return		The four bit mask of the overlapping BSs.
+	 */
+	inline U32 OverlapsBSs(const PlanePacket (&plane_packets)[6],
+		const F32 *x, const F32 *y, const F32 *z, const F32 *r) noexcept {
+
+		const XMVECTOR v_x     = XMLoadFloat4A(reinterpret_cast< const XMFLOAT4A * >(x));
+		const XMVECTOR v_y     = XMLoadFloat4A(reinterpret_cast< const XMFLOAT4A * >(y));
+		const XMVECTOR v_z     = XMLoadFloat4A(reinterpret_cast< const XMFLOAT4A * >(z));
+		const XMVECTOR v_neg_r = -XMLoadFloat4A(reinterpret_cast< const XMFLOAT4A * >(r));
+
+		XMVECTOR result = XMVectorTrueInt();
+		for (size_t i = 0; i < 6; ++i) {
+			const PlanePacket &plane = plane_packets[i];
+			
+			const XMVECTOR distance = XMVectorMultiplyAdd(plane.m_nx, v_x,
+				                      XMVectorMultiplyAdd(plane.m_ny, v_y,
+									  XMVectorMultiplyAdd(plane.m_nz, v_z, plane.m_d)));
+			
+			result = XMVectorAndInt(result, 
+				XMVectorGreaterOrEqual(distance, v_neg_r));
+		}
+
+		return GetMask(result);
+	}
+
+	size_t ViewFrustum::Overlaps(const AABBBatch &aabbs, 
+		U32 *mask) const noexcept {
+		
+		Assert(mask);
+
+		PlanePacket plane_packets[6];
+		ReplicatePlanes(m_planes, plane_packets);
+
+		std::fill(mask, mask + (aabbs.size() + 31) / 32, 0u);
+
+		size_t count = 0;
+		for (size_t i = 0; i < aabbs.m_packets.size(); ++i) {
+			const AABBBatch::Packet &packet = aabbs.m_packets[i];
+			const U32 packet_mask = GetLaneMask(i, aabbs.size()) 
+				& OverlapsAABBs(plane_packets, 
+				                packet.m_min_x, packet.m_min_y, packet.m_min_z,
+				                packet.m_max_x, packet.m_max_y, packet.m_max_z);
+			
+			mask[i / 8] |= packet_mask << (4 * (i % 8));
+			count += CountMask(packet_mask);
+		}
+
+		return count;
+	}
+
+	size_t ViewFrustum::Overlaps(const AABBBatch &aabbs, 
+		ArenaVector< size_t > &indices) const {
+		
+		PlanePacket plane_packets[6];
+		ReplicatePlanes(m_planes, plane_packets);
+
+		indices.clear();
+
+		for (size_t i = 0; i < aabbs.m_packets.size(); ++i) {
+			const AABBBatch::Packet &packet = aabbs.m_packets[i];
+			const U32 packet_mask = GetLaneMask(i, aabbs.size()) 
+				& OverlapsAABBs(plane_packets, 
+				                packet.m_min_x, packet.m_min_y, packet.m_min_z,
+				                packet.m_max_x, packet.m_max_y, packet.m_max_z);
+			
+			for (size_t lane = 0; lane < 4; ++lane) {
+				if (packet_mask & (1u << lane)) {
+					indices.push_back(4 * i + lane);
+				}
+			}
+		}
+
+		return indices.size();
+	}
+
+	size_t ViewFrustum::Overlaps(const BSBatch &bss, 
+		U32 *mask) const noexcept {
+		
+		Assert(mask);
+
+		PlanePacket plane_packets[6];
+		ReplicatePlanes(m_planes, plane_packets);
+
+		std::fill(mask, mask + (bss.size() + 31) / 32, 0u);
+
+		size_t count = 0;
+		for (size_t i = 0; i < bss.m_packets.size(); ++i) {
+			const BSBatch::Packet &packet = bss.m_packets[i];
+			const U32 packet_mask = GetLaneMask(i, bss.size()) 
+				& OverlapsBSs(plane_packets, 
+				              packet.m_x, packet.m_y, packet.m_z, packet.m_r);
+			
+			mask[i / 8] |= packet_mask << (4 * (i % 8));
+			count += CountMask(packet_mask);
+		}
+
+		return count;
+	}
+
+	size_t ViewFrustum::Overlaps(const BSBatch &bss, 
+		ArenaVector< size_t > &indices) const {
+		
+		PlanePacket plane_packets[6];
+		ReplicatePlanes(m_planes, plane_packets);
+
+		indices.clear();
+
+		for (size_t i = 0; i < bss.m_packets.size(); ++i) {
+			const BSBatch::Packet &packet = bss.m_packets[i];
+			const U32 packet_mask = GetLaneMask(i, bss.size()) 
+				& OverlapsBSs(plane_packets, 
+				              packet.m_x, packet.m_y, packet.m_z, packet.m_r);
+			
+			for (size_t lane = 0; lane < 4; ++lane) {
+				if (packet_mask & (1u << lane)) {
+					indices.push_back(4 * i + lane);
+				}
+			}
+		}
+
+		return indices.size();
+	}
+
 	//-------------------------------------------------------------------------
 	// ViewFrustum: Intersecting = Partial Coverage
 	//-------------------------------------------------------------------------
@@ -6,6 +6,7 @@
 #pragma region
 
 #include "math\geometry\bounding_volume.hpp"
+#include "utils\memory\memory_arena.hpp"
 
 #pragma endregion
 
@@ -14,6 +15,406 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	//-------------------------------------------------------------------------
+	// AABBBatch
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of batches of AABBs.
+
+	 The AABBs are stored in packets of four AABBs with a
+	 structure-of-arrays layout per packet, which allows view frustums to
+	 test four AABBs at once.
+	 */
+	struct AABBBatch final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an (empty) AABB batch.
+		 */
+		AABBBatch();
+
+		/**
+		 Constructs an AABB batch from the given AABB batch.
+
+		 @param[in]		batch
+						A reference to the AABB batch to copy.
+		 */
+		AABBBatch(const AABBBatch &batch);
+
+		/**
+		 Constructs an AABB batch by moving the given AABB batch.
+
+		 @param[in]		batch
+						A reference to the AABB batch to move.
+		 */
+		AABBBatch(AABBBatch &&batch) noexcept;
+
+		/**
+		 Destructs this AABB batch.
+		 */
+		~AABBBatch();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given AABB batch to this AABB batch.
+
+		 @param[in]		batch
+						A reference to the AABB batch to copy.
+		 @return		A reference to the copy of the given AABB batch (i.e.
+						this AABB batch).
+		 */
+		AABBBatch &operator=(const AABBBatch &batch);
+
+		/**
+		 Moves the given AABB batch to this AABB batch.
+
+		 @param[in]		batch
+						A reference to the AABB batch to move.
+		 @return		A reference to the moved AABB batch (i.e. this AABB
+						batch).
+		 */
+		AABBBatch &operator=(AABBBatch &&batch) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of AABBs of this AABB batch.
+
+		 @return		The number of AABBs of this AABB batch.
+		 */
+		size_t size() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Checks whether this AABB batch is empty.
+
+		 @return		@c true if this AABB batch contains no AABBs. @c false
+						otherwise.
+		 */
+		bool empty() const noexcept {
+			return 0 == m_size;
+		}
+
+		/**
+		 Removes all AABBs of this AABB batch. The allocated memory is
+		 retained for reuse.
+		 */
+		void clear() noexcept;
+
+		/**
+		 Reserves memory for the given number of AABBs.
+
+		 @param[in]		nb_aabbs
+						The number of AABBs.
+		 */
+		void reserve(size_t nb_aabbs);
+
+		/**
+		 Removes all AABBs of this AABB batch and rebinds the storage of this 
+		 AABB batch to the given memory arena.
+
+		 @param[in]		memory_arena
+						A pointer to the memory arena. If @c nullptr, this 
+						AABB batch allocates from the general heap.
+		 @throws		std::bad_alloc
+						Failed to allocate the memory block.
+		 */
+		void Rebind(MemoryArena *memory_arena);
+
+		/**
+		 Adds the given AABB to this AABB batch.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 */
+		void push_back(const AABB &aabb);
+
+		/**
+		 Adds the AABB enclosing the given AABB transformed by the given
+		 transformation matrix to this AABB batch.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @param[in]		transform
+						The (affine) transformation matrix (e.g. the
+						object-to-world transformation matrix).
+		 */
+		void XM_CALLCONV push_back(const AABB &aabb, FXMMATRIX transform);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Friends
+		//---------------------------------------------------------------------
+
+		friend struct ViewFrustum;
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of packets of four AABBs.
+		 */
+		struct alignas(16) Packet final {
+
+		public:
+
+			/**
+			 The minimum x-coordinates of the AABBs of this packet.
+			 */
+			F32 m_min_x[4];
+
+			/**
+			 The minimum y-coordinates of the AABBs of this packet.
+			 */
+			F32 m_min_y[4];
+
+			/**
+			 The minimum z-coordinates of the AABBs of this packet.
+			 */
+			F32 m_min_z[4];
+
+			/**
+			 The maximum x-coordinates of the AABBs of this packet.
+			 */
+			F32 m_max_x[4];
+
+			/**
+			 The maximum y-coordinates of the AABBs of this packet.
+			 */
+			F32 m_max_y[4];
+
+			/**
+			 The maximum z-coordinates of the AABBs of this packet.
+			 */
+			F32 m_max_z[4];
+		};
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The packets of this AABB batch.
+		 */
+		ArenaVector< Packet > m_packets;
+
+		/**
+		 The number of AABBs of this AABB batch.
+		 */
+		size_t m_size;
+	};
+
+	//-------------------------------------------------------------------------
+	// BSBatch
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of batches of BSs.
+
+	 The BSs are stored in packets of four BSs with a structure-of-arrays
+	 layout per packet, which allows view frustums to test four BSs at
+	 once.
+	 */
+	struct BSBatch final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an (empty) BS batch.
+		 */
+		BSBatch();
+
+		/**
+		 Constructs a BS batch from the given BS batch.
+
+		 @param[in]		batch
+						A reference to the BS batch to copy.
+		 */
+		BSBatch(const BSBatch &batch);
+
+		/**
+		 Constructs a BS batch by moving the given BS batch.
+
+		 @param[in]		batch
+						A reference to the BS batch to move.
+		 */
+		BSBatch(BSBatch &&batch) noexcept;
+
+		/**
+		 Destructs this BS batch.
+		 */
+		~BSBatch();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given BS batch to this BS batch.
+
+		 @param[in]		batch
+						A reference to the BS batch to copy.
+		 @return		A reference to the copy of the given BS batch (i.e.
+						this BS batch).
+		 */
+		BSBatch &operator=(const BSBatch &batch);
+
+		/**
+		 Moves the given BS batch to this BS batch.
+
+		 @param[in]		batch
+						A reference to the BS batch to move.
+		 @return		A reference to the moved BS batch (i.e. this BS
+						batch).
+		 */
+		BSBatch &operator=(BSBatch &&batch) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of BSs of this BS batch.
+
+		 @return		The number of BSs of this BS batch.
+		 */
+		size_t size() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Checks whether this BS batch is empty.
+
+		 @return		@c true if this BS batch contains no BSs. @c false
+						otherwise.
+		 */
+		bool empty() const noexcept {
+			return 0 == m_size;
+		}
+
+		/**
+		 Removes all BSs of this BS batch. The allocated memory is retained
+		 for reuse.
+		 */
+		void clear() noexcept;
+
+		/**
+		 Reserves memory for the given number of BSs.
+
+		 @param[in]		nb_bss
+						The number of BSs.
+		 */
+		void reserve(size_t nb_bss);
+
+		/**
+		 Removes all BSs of this BS batch and rebinds the storage of this BS 
+		 batch to the given memory arena.
+
+		 @param[in]		memory_arena
+						A pointer to the memory arena. If @c nullptr, this BS 
+						batch allocates from the general heap.
+		 @throws		std::bad_alloc
+						Failed to allocate the memory block.
+		 */
+		void Rebind(MemoryArena *memory_arena);
+
+		/**
+		 Adds the given BS to this BS batch.
+
+		 @param[in]		bs
+						A reference to the BS.
+		 */
+		void push_back(const BS &bs);
+
+		/**
+		 Adds the BS enclosing the given BS transformed by the given
+		 transformation matrix to this BS batch.
+
+		 @param[in]		bs
+						A reference to the BS.
+		 @param[in]		transform
+						The (affine) transformation matrix (e.g. the
+						object-to-world transformation matrix).
+		 */
+		void XM_CALLCONV push_back(const BS &bs, FXMMATRIX transform);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Friends
+		//---------------------------------------------------------------------
+
+		friend struct ViewFrustum;
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of packets of four BSs.
+		 */
+		struct alignas(16) Packet final {
+
+		public:
+
+			/**
+			 The x-coordinates of the centers of the BSs of this packet.
+			 */
+			F32 m_x[4];
+
+			/**
+			 The y-coordinates of the centers of the BSs of this packet.
+			 */
+			F32 m_y[4];
+
+			/**
+			 The z-coordinates of the centers of the BSs of this packet.
+			 */
+			F32 m_z[4];
+
+			/**
+			 The radii of the BSs of this packet.
+			 */
+			F32 m_r[4];
+		};
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The packets of this BS batch.
+		 */
+		ArenaVector< Packet > m_packets;
+
+		/**
+		 The number of BSs of this BS batch.
+		 */
+		size_t m_size;
+	};
+
+	//-------------------------------------------------------------------------
+	// ViewFrustum
+	//-------------------------------------------------------------------------
+
 	/**
 	 A struct of view frustums.
 	 */
@@ -277,6 +678,90 @@ namespace mage {
 		 */
 		bool OverlapsStrict(const BS &bs) const noexcept;
 
+		//---------------------------------------------------------------------
+		// Member Methods: Overlapping = Partial | Full Coverage (Batches)
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks which AABBs of the given AABB batch overlap this view frustum.
+
+		 The AABBs are tested four at a time.
+
+		 @pre			@a mask points to an array of at least
+						<tt>(aabbs.size() + 31) / 32</tt> elements.
+		 @param[in]		aabbs
+						A reference to the AABB batch. The AABBs must be
+						expressed in the same coordinate space as the planes
+						of this view frustum.
+		 @param[out]	mask
+						A pointer to the visibility bitmask. The i-th bit is
+						set if and only if this view frustum overlaps the
+						i-th AABB of @a aabbs.
+		 @return		The number of AABBs of @a aabbs overlapping this view
+						frustum.
+		 */
+		size_t Overlaps(const AABBBatch &aabbs, U32 *mask) const noexcept;
+
+		/**
+		 Checks which AABBs of the given AABB batch overlap this view frustum.
+
+		 The AABBs are tested four at a time.
+
+		 @param[in]		aabbs
+						A reference to the AABB batch. The AABBs must be
+						expressed in the same coordinate space as the planes
+						of this view frustum.
+		 @param[out]	indices
+						A reference to the vector which will contain (in
+						increasing order) the indices of the AABBs of
+						@a aabbs overlapping this view frustum. The
+						original content of @a indices is discarded.
+		 @return		The number of AABBs of @a aabbs overlapping this view
+						frustum.
+		 */
+		size_t Overlaps(const AABBBatch &aabbs,
+			ArenaVector< size_t > &indices) const;
+
+		/**
+		 Checks which BSs of the given BS batch overlap this view frustum.
+
+		 The BSs are tested four at a time.
+
+		 @pre			@a mask points to an array of at least
+						<tt>(bss.size() + 31) / 32</tt> elements.
+		 @param[in]		bss
+						A reference to the BS batch. The BSs must be expressed
+						in the same coordinate space as the planes of this
+						view frustum.
+		 @param[out]	mask
+						A pointer to the visibility bitmask. The i-th bit is
+						set if and only if this view frustum overlaps the
+						i-th BS of @a bss.
+		 @return		The number of BSs of @a bss overlapping this view
+						frustum.
+		 */
+		size_t Overlaps(const BSBatch &bss, U32 *mask) const noexcept;
+
+		/**
+		 Checks which BSs of the given BS batch overlap this view frustum.
+
+		 The BSs are tested four at a time.
+
+		 @param[in]		bss
+						A reference to the BS batch. The BSs must be expressed
+						in the same coordinate space as the planes of this
+						view frustum.
+		 @param[out]	indices
+						A reference to the vector which will contain (in
+						increasing order) the indices of the BSs of @a bss
+						overlapping this view frustum. The original content
+						of @a indices is discarded.
+		 @return		The number of BSs of @a bss overlapping this view
+						frustum.
+		 */
+		size_t Overlaps(const BSBatch &bss,
+			ArenaVector< size_t > &indices) const;
+
 		//---------------------------------------------------------------------
 		// Member Methods: Intersecting = Partial Coverage
 		//---------------------------------------------------------------------
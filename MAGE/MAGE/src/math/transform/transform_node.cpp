@@ -20,7 +20,10 @@ namespace mage {
 	TransformNode::TransformNode()
 		: m_transform(),
 		m_parent(nullptr), 
-		m_childs() {
+		m_childs(),
+		m_system(nullptr),
+		m_system_index(0),
+		m_system_version(0u) {
 		
 		SetDirty();
 	}
@@ -28,7 +31,10 @@ namespace mage {
 	TransformNode::TransformNode(const TransformNode &transform_node)
 		: m_transform(transform_node.m_transform),
 		m_parent(nullptr), 
-		m_childs() {
+		m_childs(),
+		m_system(nullptr),
+		m_system_index(0),
+		m_system_version(0u) {
 		
 		SetDirty();
 	}
@@ -36,12 +42,19 @@ namespace mage {
 	TransformNode::TransformNode(TransformNode &&transform_node) noexcept
 		: m_transform(std::move(transform_node.m_transform)),
 		m_parent(std::move(transform_node.m_parent)),
-		m_childs(std::move(transform_node.m_childs)) {
+		m_childs(std::move(transform_node.m_childs)),
+		m_system(nullptr),
+		m_system_index(0),
+		m_system_version(0u) {
 
 		SetDirty();
 	}
 
-	TransformNode::~TransformNode() = default;
+	TransformNode::~TransformNode() {
+		if (m_system) {
+			m_system->Unregister(this);
+		}
+	}
 
 	bool TransformNode::HasChildNode(const Node *node) const {
 		return std::find(m_childs.begin(), m_childs.end(), node) 
@@ -51,8 +64,7 @@ namespace mage {
 	void TransformNode::RemoveAllChildNodes() noexcept {
 
 		ForEachChildTransformNode([](TransformNode *transform_node) {
-			transform_node->m_parent = nullptr;
-			transform_node->SetDirty();
+			transform_node->SetParentNode(nullptr);
 		});
 
 		m_childs.clear();
@@ -127,8 +139,7 @@ namespace mage {
 			node->m_transform->m_parent->RemoveChildNode(node);
 		}
 
-		node->m_transform->m_parent = this;
-		node->m_transform->SetDirty();
+		node->m_transform->SetParentNode(this);
 
 		m_transform->m_childs.push_back(node);
 	}
@@ -138,8 +149,7 @@ namespace mage {
 			return;
 		}
 
-		node->m_transform->m_parent = nullptr;
-		node->m_transform->SetDirty();
+		node->m_transform->SetParentNode(nullptr);
 
 		if (const auto it = std::find(
 			m_transform->m_childs.begin(), 
@@ -6,6 +6,7 @@
 #pragma region
 
 #include "math\transform\transform.hpp"
+#include "math\transform\transform_system.hpp"
 #include "utils\collection\collection.hpp"
 #include "utils\parallel\id_generator.hpp"
 
@@ -1240,6 +1241,10 @@ namespace mage {
 		 @return		The object-to-world matrix of this transform node.
 		 */
 		const XMMATRIX XM_CALLCONV GetObjectToWorldMatrix() const noexcept {
+			if (m_system) {
+				return GetSystemObjectToWorldMatrix();
+			}
+
 			UpdateObjectToWorldMatrix();
 			return m_object_to_world;
 		}
@@ -1250,6 +1255,10 @@ namespace mage {
 		 @return		The world-to-object matrix of this transform node.
 		 */
 		const XMMATRIX XM_CALLCONV GetWorldToObjectMatrix() const noexcept {
+			if (m_system) {
+				return GetSystemWorldToObjectMatrix();
+			}
+
 			UpdateWorldToObjectMatrix();
 			return m_world_to_object;
 		}
@@ -1468,6 +1477,10 @@ namespace mage {
 		// directly, one has to first obtain a pointer to the TransformNode. 
 		friend class Node;
 
+		// Transform systems store the world matrices of their registered
+		// transform nodes and take over the propagation of dirty flags.
+		friend class TransformSystem;
+
 		//---------------------------------------------------------------------
 		// Member Methods
 		//---------------------------------------------------------------------
@@ -1479,12 +1492,43 @@ namespace mage {
 			m_dirty_object_to_world = true;
 			m_dirty_world_to_object = true;
 			
+			if (m_system) {
+				// The transform system propagates the dirty flag to the 
+				// descendants of this transform node on its next update.
+				m_system->SetDirty(m_system_index);
+				
+				// Sets the childs outside the transform system to dirty.
+				ForEachChildTransformNode([this](const TransformNode *transform_node) {
+					if (m_system != transform_node->m_system) {
+						transform_node->SetDirty();
+					}
+				});
+
+				return;
+			}
+
 			// Sets the descendants of this transform node to dirty.
 			ForEachChildTransformNode([](const TransformNode *transform_node) {
 				transform_node->SetDirty();
 			});
 		}
 
+		/**
+		 Sets the parent node of this transform node.
+
+		 @param[in]		parent
+						A pointer to the parent node.
+		 */
+		void SetParentNode(Node *parent) noexcept {
+			m_parent = parent;
+
+			if (m_system) {
+				m_system->SetHierarchyDirty();
+			}
+
+			SetDirty();
+		}
+
 		/**
 		 Updates the object-to-world matrix of this transform node if dirty.
 		 */
@@ -1495,6 +1539,35 @@ namespace mage {
 		 */
 		void UpdateWorldToObjectMatrix() const noexcept;
 
+		/**
+		 Invalidates the cached world matrices of this transform node if the 
+		 version of its transform system changed.
+
+		 @pre			This transform node is registered with a transform 
+						system.
+		 */
+		void UpdateSystemVersion() const noexcept;
+
+		/**
+		 Returns the object-to-world matrix of this transform node from its
+		 transform system.
+
+		 @pre			This transform node is registered with a transform 
+						system.
+		 @return		The object-to-world matrix of this transform node.
+		 */
+		const XMMATRIX XM_CALLCONV GetSystemObjectToWorldMatrix() const noexcept;
+
+		/**
+		 Returns the world-to-object matrix of this transform node from its
+		 transform system.
+
+		 @pre			This transform node is registered with a transform 
+						system.
+		 @return		The world-to-object matrix of this transform node.
+		 */
+		const XMMATRIX XM_CALLCONV GetSystemWorldToObjectMatrix() const noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Methods: Graph
 		//---------------------------------------------------------------------
@@ -1631,6 +1704,22 @@ namespace mage {
 		 of this transform node are dirty.
 		 */
 		mutable bool m_dirty_world_to_object;
+
+		/**
+		 A pointer to the transform system of this transform node.
+		 */
+		TransformSystem *m_system;
+
+		/**
+		 The index of this transform node in its transform system.
+		 */
+		size_t m_system_index;
+
+		/**
+		 The version of the transform system of this transform node for which
+		 the cached matrices of this transform node were evaluated.
+		 */
+		mutable U64 m_system_version;
 	};
 
 	//-------------------------------------------------------------------------
@@ -2019,6 +2108,44 @@ namespace mage {
 			m_dirty_world_to_object = false;
 		}
 	}
+
+	inline void TransformNode::UpdateSystemVersion() const noexcept {
+		// The cached matrices are invalidated by any pending change of the 
+		// transform system (e.g., a change of an ancestor).
+		if (const U64 version = m_system->GetVersion(); 
+			m_system_version != version) {
+
+			m_system_version        = version;
+			m_dirty_object_to_world = true;
+			m_dirty_world_to_object = true;
+		}
+	}
+
+	inline const XMMATRIX XM_CALLCONV 
+		TransformNode::GetSystemObjectToWorldMatrix() const noexcept {
+		
+		if (m_system->IsUpToDate()) {
+			return m_system->GetObjectToWorldMatrix(m_system_index);
+		}
+
+		// The transform system has pending changes.
+		UpdateSystemVersion();
+		UpdateObjectToWorldMatrix();
+		return m_object_to_world;
+	}
+
+	inline const XMMATRIX XM_CALLCONV 
+		TransformNode::GetSystemWorldToObjectMatrix() const noexcept {
+		
+		if (m_system->IsUpToDate()) {
+			return m_system->GetWorldToObjectMatrix(m_system_index);
+		}
+
+		// The transform system has pending changes.
+		UpdateSystemVersion();
+		UpdateWorldToObjectMatrix();
+		return m_world_to_object;
+	}
 }
 
 //-----------------------------------------------------------------------------
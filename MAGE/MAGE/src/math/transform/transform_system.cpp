@@ -0,0 +1,355 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "math\transform\transform_node.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <execution>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The parent index used for transform nodes without a parent transform 
+	 node.
+	 */
+	constexpr size_t g_no_parent = static_cast< size_t >(-1);
+
+	/**
+	 The parent index used for transform nodes with a parent transform node 
+	 outside the transform system.
+	 */
+	constexpr size_t g_external_parent = static_cast< size_t >(-2);
+
+	/**
+	 The minimum number of transform nodes of a depth level before that
+	 depth level is updated in parallel.
+	 */
+	constexpr size_t g_parallel_threshold = 256;
+
+	/**
+	 Checks whether the given bit of the given bitset is set.
+
+	 @param[in]		bits
+					A reference to the bitset.
+	 @param[in]		index
+					The index of the bit.
+	 @return		@c true if the given bit of the given bitset is set.
+					@c false otherwise.
+	 */
+	inline bool TestBit(const vector< U64 > &bits, size_t index) noexcept {
+		return 0u != (bits[index >> 6u] & (U64(1u) << (index & 63u)));
+	}
+
+	/**
+	 Sets the given bit of the given bitset.
+
+	 @param[in]		bits
+					A reference to the bitset.
+	 @param[in]		index
+					The index of the bit.
+	 */
+	inline void SetBit(vector< U64 > &bits, size_t index) noexcept {
+		bits[index >> 6u] |= U64(1u) << (index & 63u);
+	}
+
+	/**
+	 Returns the number of words needed for a bitset of the given size.
+
+	 @param[in]		nb_bits
+					The number of bits.
+	 @return		The number of words needed for a bitset of the given
+					size.
+	 */
+	constexpr size_t GetNumberOfWords(size_t nb_bits) noexcept {
+		return (nb_bits + 63u) >> 6u;
+	}
+
+	TransformSystem::TransformSystem()
+		: m_transforms(),
+		m_parents(),
+		m_levels(1u, 0u),
+		m_object_to_parent(),
+		m_parent_to_object(),
+		m_object_to_world(),
+		m_world_to_object(),
+		m_dirty_local(),
+		m_dirty_world(),
+		m_external_childs(),
+		m_nb_transforms(0),
+		m_dirty_hierarchy(false),
+		m_up_to_date(true),
+		m_version(0u) {}
+
+	TransformSystem::~TransformSystem() {
+		for (const auto transform : m_transforms) {
+			if (transform) {
+				transform->m_system = nullptr;
+				transform->m_dirty_object_to_world = true;
+				transform->m_dirty_world_to_object = true;
+			}
+		}
+	}
+
+	void TransformSystem::Register(TransformNode *transform) {
+		Assert(transform);
+
+		if (this == transform->m_system) {
+			return;
+		}
+		if (transform->m_system) {
+			transform->m_system->Unregister(transform);
+		}
+
+		transform->m_system       = this;
+		transform->m_system_index = m_transforms.size();
+		transform->m_dirty_object_to_world = true;
+		transform->m_dirty_world_to_object = true;
+		m_transforms.push_back(transform);
+		++m_nb_transforms;
+
+		SetHierarchyDirty();
+	}
+
+	void TransformSystem::Unregister(TransformNode *transform) noexcept {
+		Assert(transform);
+
+		if (this != transform->m_system) {
+			return;
+		}
+
+		m_transforms[transform->m_system_index] = nullptr;
+		--m_nb_transforms;
+
+		// The descendants are not visited, since they may already be
+		// destructed.
+		transform->m_system = nullptr;
+		transform->m_dirty_object_to_world = true;
+		transform->m_dirty_world_to_object = true;
+
+		SetHierarchyDirty();
+	}
+
+	void TransformSystem::SetDirty(size_t index) noexcept {
+		m_up_to_date = false;
+		++m_version;
+
+		// All transform nodes are set to dirty on hierarchy updates.
+		if (m_dirty_hierarchy) {
+			return;
+		}
+
+		SetBit(m_dirty_local, index);
+		SetBit(m_dirty_world, index);
+	}
+
+	void TransformSystem::UpdateHierarchy() {
+		vector< TransformNode * > transforms;
+		transforms.reserve(m_nb_transforms);
+
+		// Collect the roots: transform nodes without a parent transform node
+		// in this transform system.
+		for (const auto transform : m_transforms) {
+			if (!transform) {
+				continue;
+			}
+
+			const Node * const parent = transform->GetParentNode();
+			if (!parent || this != parent->GetTransform()->m_system) {
+				transforms.push_back(transform);
+			}
+		}
+
+		// Collect the remaining transform nodes breadth-first.
+		m_levels.clear();
+		m_levels.push_back(0);
+		for (size_t begin = 0; begin < transforms.size();) {
+			const size_t end = transforms.size();
+			m_levels.push_back(end);
+
+			for (size_t i = begin; i < end; ++i) {
+				transforms[i]->ForEachChildTransformNode(
+					[this, &transforms](TransformNode *child) {
+
+					if (this == child->m_system) {
+						transforms.push_back(child);
+					}
+				});
+			}
+
+			begin = end;
+		}
+
+		Assert(transforms.size() == m_nb_transforms);
+
+		const size_t nb_transforms = transforms.size();
+
+		const size_t nb_words = GetNumberOfWords(nb_transforms);
+
+		m_parents.resize(nb_transforms);
+		m_external_childs.assign(nb_words, U64(0u));
+		for (size_t i = 0; i < nb_transforms; ++i) {
+			TransformNode * const transform = transforms[i];
+			transform->m_system_index = i;
+
+			// Parents precede their childs.
+			if (const Node * const parent = transform->GetParentNode(); !parent) {
+				m_parents[i] = g_no_parent;
+			}
+			else if (this == parent->GetTransform()->m_system) {
+				m_parents[i] = parent->GetTransform()->m_system_index;
+			}
+			else {
+				m_parents[i] = g_external_parent;
+			}
+
+			transform->ForEachChildTransformNode(
+				[this, i](const TransformNode *child) noexcept {
+
+				if (this != child->m_system) {
+					SetBit(m_external_childs, i);
+				}
+			});
+		}
+
+		m_transforms = std::move(transforms);
+
+		m_object_to_parent.resize(nb_transforms);
+		m_parent_to_object.resize(nb_transforms);
+		m_object_to_world.resize(nb_transforms);
+		m_world_to_object.resize(nb_transforms);
+
+		m_dirty_local.assign(nb_words, ~U64(0u));
+		m_dirty_world.assign(nb_words, ~U64(0u));
+
+		m_dirty_hierarchy = false;
+	}
+
+	void TransformSystem::UpdateTransform(size_t index) noexcept {
+		const TransformNode * const transform = m_transforms[index];
+
+		if (TestBit(m_dirty_local, index)) {
+			m_object_to_parent[index] = transform->GetObjectToParentMatrix();
+			m_parent_to_object[index] = transform->GetParentToObjectMatrix();
+		}
+
+		if (const size_t parent = m_parents[index]; g_no_parent == parent) {
+			m_object_to_world[index] = m_object_to_parent[index];
+			m_world_to_object[index] = m_parent_to_object[index];
+		}
+		else if (g_external_parent == parent) {
+			const TransformNode * const parent
+				= transform->GetParentNode()->GetTransform();
+			m_object_to_world[index] = m_object_to_parent[index]
+				                     * parent->GetObjectToWorldMatrix();
+			m_world_to_object[index] = parent->GetWorldToObjectMatrix()
+				                     * m_parent_to_object[index];
+		}
+		else {
+			m_object_to_world[index] = m_object_to_parent[index]
+				                     * m_object_to_world[parent];
+			m_world_to_object[index] = m_world_to_object[parent]
+				                     * m_parent_to_object[index];
+		}
+	}
+
+	void TransformSystem::UpdateLevel(size_t level) {
+		const size_t begin = m_levels[level];
+		const size_t end   = m_levels[level + 1u];
+
+		// Propagate the dirty bits of the parents.
+		for (size_t i = begin; i < end; ++i) {
+			const size_t parent = m_parents[i];
+
+			if (g_external_parent == parent) {
+				// Transform nodes with a parent outside this transform system
+				// lazily update the cached matrices of that parent, and are
+				// therefore updated sequentially.
+				if (TestBit(m_dirty_world, i)) {
+					UpdateTransform(i);
+				}
+			}
+			else if (g_no_parent != parent && TestBit(m_dirty_world, parent)) {
+				SetBit(m_dirty_world, i);
+			}
+		}
+
+		const auto update = [this](size_t index) noexcept {
+			if (g_external_parent != m_parents[index] 
+				&& TestBit(m_dirty_world, index)) {
+
+				UpdateTransform(index);
+			}
+		};
+
+		if (end - begin < g_parallel_threshold) {
+			for (size_t i = begin; i < end; ++i) {
+				update(i);
+			}
+			return;
+		}
+
+		// Transform nodes at the same depth level only read the world
+		// matrices of the previous depth levels and write their own.
+		TransformNode * const * const first = m_transforms.data();
+		std::for_each(std::execution::par, first + begin, first + end,
+			[first, &update](TransformNode * const &transform) noexcept {
+				update(static_cast< size_t >(&transform - first));
+			});
+	}
+
+	void TransformSystem::Update() {
+		if (m_up_to_date) {
+			return;
+		}
+
+		if (m_dirty_hierarchy) {
+			UpdateHierarchy();
+		}
+
+		const size_t nb_levels = m_levels.size() - 1u;
+		for (size_t level = 0; level < nb_levels; ++level) {
+			UpdateLevel(level);
+		}
+
+		// Set the childs outside this transform system to dirty.
+		for (size_t word = 0; word < m_dirty_world.size(); ++word) {
+			if (0u == (m_dirty_world[word] & m_external_childs[word])) {
+				continue;
+			}
+
+			const size_t end = std::min((word + 1u) << 6u, m_transforms.size());
+			for (size_t i = word << 6u; i < end; ++i) {
+				if (!TestBit(m_dirty_world, i) || !TestBit(m_external_childs, i)) {
+					continue;
+				}
+
+				m_transforms[i]->ForEachChildTransformNode(
+					[this](const TransformNode *child) noexcept {
+
+					if (this != child->m_system) {
+						child->SetDirty();
+					}
+				});
+			}
+		}
+
+		std::fill(m_dirty_local.begin(), m_dirty_local.end(), U64(0u));
+		std::fill(m_dirty_world.begin(), m_dirty_world.end(), U64(0u));
+
+		m_up_to_date = true;
+	}
+}
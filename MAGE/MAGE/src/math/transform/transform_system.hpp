@@ -0,0 +1,338 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "math\math.hpp"
+#include "utils\collection\collection.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	class TransformNode;
+}
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of transform systems.
+
+	 A transform system stores the local and world matrices of its registered
+	 transform nodes in contiguous arrays which are sorted by hierarchy depth
+	 (i.e. breadth-first). Instead of recursively invalidating descendants,
+	 registered transform nodes only set their own dirty bit. The dirty bits
+	 are propagated and all world matrices are recomputed in a single pass
+	 per update, with the transform nodes at the same depth processed in
+	 parallel.
+
+	 The accessors of registered transform nodes keep working: they return
+	 the matrices of the last update if this transform system is up to date,
+	 and evaluate their matrices otherwise. Evaluated matrices are cached per
+	 transform node until the version of this transform system changes.
+	 */
+	class TransformSystem final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a transform system.
+		 */
+		TransformSystem();
+
+		/**
+		 Constructs a transform system from the given transform system.
+
+		 @param[in]		system
+						A reference to the transform system to copy.
+		 */
+		TransformSystem(const TransformSystem &system) = delete;
+
+		/**
+		 Constructs a transform system by moving the given transform system.
+
+		 @param[in]		system
+						A reference to the transform system to move.
+		 */
+		TransformSystem(TransformSystem &&system) = delete;
+
+		/**
+		 Destructs this transform system.
+
+		 All remaining transform nodes are unregistered.
+		 */
+		~TransformSystem();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given transform system to this transform system.
+
+		 @param[in]		system
+						A reference to the transform system to copy.
+		 @return		A reference to the copy of the given transform system
+						(i.e. this transform system).
+		 */
+		TransformSystem &operator=(const TransformSystem &system) = delete;
+
+		/**
+		 Moves the given transform system to this transform system.
+
+		 @param[in]		system
+						A reference to the transform system to move.
+		 @return		A reference to the moved transform system (i.e. this
+						transform system).
+		 */
+		TransformSystem &operator=(TransformSystem &&system) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Registers the given transform node with this transform system.
+
+		 @param[in]		transform
+						A pointer to the transform node.
+		 @note			If the given transform node is already registered with
+						another transform system, it will be unregistered
+						from that transform system first.
+		 */
+		void Register(TransformNode *transform);
+
+		/**
+		 Unregisters the given transform node from this transform system.
+
+		 @param[in]		transform
+						A pointer to the transform node.
+		 */
+		void Unregister(TransformNode *transform) noexcept;
+
+		/**
+		 Returns the number of transform nodes registered with this transform
+		 system.
+
+		 @return		The number of transform nodes registered with this
+						transform system.
+		 */
+		size_t GetNumberOfTransforms() const noexcept {
+			return m_nb_transforms;
+		}
+
+		/**
+		 Checks whether the world matrices of this transform system are up to
+		 date.
+
+		 @return		@c true if the world matrices of this transform system
+						are up to date. @c false otherwise.
+		 */
+		bool IsUpToDate() const noexcept {
+			return m_up_to_date;
+		}
+
+		/**
+		 Updates the world matrices of all dirty transform nodes registered
+		 with this transform system.
+		 */
+		void Update();
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Friends
+		//---------------------------------------------------------------------
+
+		friend class TransformNode;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Sets the transform node at the given index to dirty.
+
+		 @param[in]		index
+						The index of the transform node.
+		 */
+		void SetDirty(size_t index) noexcept;
+
+		/**
+		 Sets the hierarchy of this transform system to dirty.
+		 */
+		void SetHierarchyDirty() noexcept {
+			m_dirty_hierarchy = true;
+			m_up_to_date      = false;
+			++m_version;
+		}
+
+		/**
+		 Returns the version of this transform system. The version changes
+		 whenever a registered transform node or the hierarchy is set to
+		 dirty.
+
+		 @return		The version of this transform system.
+		 */
+		U64 GetVersion() const noexcept {
+			return m_version;
+		}
+
+		/**
+		 Returns the object-to-world matrix of the transform node at the given
+		 index.
+
+		 @pre			This transform system is up to date.
+		 @param[in]		index
+						The index of the transform node.
+		 @return		The object-to-world matrix of the transform node at
+						the given index.
+		 */
+		const XMMATRIX XM_CALLCONV GetObjectToWorldMatrix(
+			size_t index) const noexcept {
+
+			return m_object_to_world[index];
+		}
+
+		/**
+		 Returns the world-to-object matrix of the transform node at the given
+		 index.
+
+		 @pre			This transform system is up to date.
+		 @param[in]		index
+						The index of the transform node.
+		 @return		The world-to-object matrix of the transform node at
+						the given index.
+		 */
+		const XMMATRIX XM_CALLCONV GetWorldToObjectMatrix(
+			size_t index) const noexcept {
+
+			return m_world_to_object[index];
+		}
+
+		/**
+		 Sorts the registered transform nodes of this transform system by
+		 hierarchy depth and sets all of them to dirty.
+		 */
+		void UpdateHierarchy();
+
+		/**
+		 Updates the local and world matrices of the transform node at the
+		 given index.
+
+		 @pre			The world matrices of the parent of the transform node
+						at the given index are up to date.
+		 @param[in]		index
+						The index of the transform node.
+		 */
+		void UpdateTransform(size_t index) noexcept;
+
+		/**
+		 Updates the local and world matrices of all dirty transform nodes of
+		 the given depth level.
+
+		 @param[in]		level
+						The depth level.
+		 */
+		void UpdateLevel(size_t level);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing pointers to the registered transform nodes of
+		 this transform system sorted by hierarchy depth. Unregistered
+		 transform nodes leave a @c nullptr until the next hierarchy update.
+		 */
+		vector< TransformNode * > m_transforms;
+
+		/**
+		 A vector containing the index of the parent of each transform node
+		 of this transform system.
+		 */
+		vector< size_t > m_parents;
+
+		/**
+		 A vector containing the start index of each depth level of this
+		 transform system followed by the total number of indices.
+		 */
+		vector< size_t > m_levels;
+
+		/**
+		 A vector containing the object-to-parent matrices of the transform
+		 nodes of this transform system.
+		 */
+		vector< XMMATRIX > m_object_to_parent;
+
+		/**
+		 A vector containing the parent-to-object matrices of the transform
+		 nodes of this transform system.
+		 */
+		vector< XMMATRIX > m_parent_to_object;
+
+		/**
+		 A vector containing the object-to-world matrices of the transform
+		 nodes of this transform system.
+		 */
+		vector< XMMATRIX > m_object_to_world;
+
+		/**
+		 A vector containing the world-to-object matrices of the transform
+		 nodes of this transform system.
+		 */
+		vector< XMMATRIX > m_world_to_object;
+
+		/**
+		 A bitset indicating which local matrices of the transform nodes of
+		 this transform system are dirty.
+		 */
+		vector< U64 > m_dirty_local;
+
+		/**
+		 A bitset indicating which world matrices of the transform nodes of
+		 this transform system are dirty.
+		 */
+		vector< U64 > m_dirty_world;
+
+		/**
+		 A bitset indicating which transform nodes of this transform system 
+		 have child transform nodes outside this transform system.
+		 */
+		vector< U64 > m_external_childs;
+
+		/**
+		 The number of transform nodes registered with this transform system.
+		 */
+		size_t m_nb_transforms;
+
+		/**
+		 A flag indicating whether the hierarchy of this transform system is
+		 dirty.
+		 */
+		bool m_dirty_hierarchy;
+
+		/**
+		 A flag indicating whether the world matrices of this transform system
+		 are up to date.
+		 */
+		bool m_up_to_date;
+
+		/**
+		 The version of this transform system.
+		 */
+		U64 m_version;
+	};
+}
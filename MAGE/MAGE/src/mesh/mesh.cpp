@@ -4,6 +4,13 @@
 #pragma region
 
 #include "mesh\mesh.hpp"
+#include "rendering\rendering_factory.hpp"
+#include "shader\shader_factory.hpp"
+#include "utils\logging\error.hpp"
+#include "utils\exception\exception.hpp"
+
+// Include HLSL bindings.
+#include "..\..\shaders\hlsl.hpp"
 
 #pragma endregion
 
@@ -15,11 +22,38 @@ namespace mage {
 	Mesh::Mesh(size_t vertex_size, DXGI_FORMAT index_format, 
 		D3D11_PRIMITIVE_TOPOLOGY primitive_topology)
 		: m_vertex_buffer(), m_index_buffer(),
+		m_input_layout(), m_mesh_buffer(),
 		m_nb_vertices(0), m_nb_indices(0), 
 		m_vertex_size(vertex_size), m_index_format(index_format),
-		m_primitive_topology(primitive_topology) {}
+		m_primitive_topology(primitive_topology),
+		m_clusters() {}
 
 	Mesh::Mesh(Mesh &&mesh) = default;
 
 	Mesh::~Mesh() = default;
+
+	void Mesh::SetupVertexDecoding(ID3D11Device5 *device,
+		const D3D11_INPUT_ELEMENT_DESC *input_element_desc, 
+		size_t nb_input_elements, const MeshBuffer &buffer) {
+
+		Assert(device);
+		Assert(input_element_desc);
+
+		const HRESULT result_mesh_buffer = CreateStaticConstantBuffer(
+			device, m_mesh_buffer.ReleaseAndGetAddressOf(), &buffer);
+		ThrowIfFailed(result_mesh_buffer, 
+			"Mesh buffer creation failed: %08X.", result_mesh_buffer);
+
+		m_input_layout = CreateModelInputLayout(
+			device, input_element_desc, nb_input_elements);
+	}
+
+	void Mesh::BindVertexDecoding(
+		ID3D11DeviceContext4 *device_context) const noexcept {
+
+		Pipeline::IA::BindInputLayout(device_context, 
+			m_input_layout.Get());
+		Pipeline::VS::BindConstantBuffer(device_context, 
+			SLOT_CBUFFER_MESH, m_mesh_buffer.Get());
+	}
 }
\ No newline at end of file
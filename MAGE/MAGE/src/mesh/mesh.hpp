@@ -6,6 +6,8 @@
 #pragma region
 
 #include "rendering\pipeline.hpp"
+#include "rendering\buffer\mesh_buffer.hpp"
+#include "mesh\mesh_cluster.hpp"
 
 #pragma endregion
 
@@ -101,6 +103,35 @@ namespace mage {
 		D3D11_PRIMITIVE_TOPOLOGY GetPrimitiveTopology() const noexcept {
 			return m_primitive_topology;
 		}
+
+		/**
+		 Returns the mesh clusters of this mesh.
+
+		 @return		A pointer to the mesh clusters of this mesh.
+		 */
+		const MeshCluster *GetClusters() const noexcept {
+			return m_clusters.data();
+		}
+
+		/**
+		 Returns the number of mesh clusters of this mesh.
+
+		 @return		The number of mesh clusters of this mesh.
+		 */
+		size_t GetNumberOfClusters() const noexcept {
+			return m_clusters.size();
+		}
+
+		/**
+		 Sets the mesh clusters of this mesh to the given mesh clusters.
+
+		 @param[in]		clusters
+						The mesh clusters (with start indices relative to 
+						the index buffer of this mesh).
+		 */
+		void SetClusters(vector< MeshCluster > clusters) noexcept {
+			m_clusters = std::move(clusters);
+		}
 		
 		/**
 		 Binds this mesh.
@@ -137,7 +168,40 @@ namespace mage {
 				m_index_buffer.Get(), m_index_format);
 			Pipeline::IA::BindPrimitiveTopology(device_context, 
 				topology);
+
+			if (m_input_layout) {
+				BindVertexDecoding(device_context);
+			}
 		}
+
+		/**
+		 Sets up the vertex decoding of this mesh.
+
+		 The vertex input layout and mesh buffer of this mesh will be bound 
+		 together with this mesh, overriding the vertex input layout of the 
+		 bound vertex shader.
+
+		 @pre			@a device is not equal to @c nullptr.
+		 @pre			@a input_element_desc is not equal to @c nullptr.
+		 @pre			The array pointed to by @a input_element_desc contains 
+						@a nb_input_elements elements.
+		 @param[in]		device
+						A pointer to the device.
+		 @param[in]		input_element_desc
+						A pointer to an array of input element descriptors of 
+						the vertices of this mesh.
+		 @param[in]		nb_input_elements
+						The number of elements contained in the 
+						@a input_element_desc array.
+		 @param[in]		buffer
+						A reference to the mesh buffer for decoding the 
+						vertices of this mesh.
+		 @throws		FormattedException
+						Failed to set up the vertex decoding.
+		 */
+		void SetupVertexDecoding(ID3D11Device5 *device,
+			const D3D11_INPUT_ELEMENT_DESC *input_element_desc, 
+			size_t nb_input_elements, const MeshBuffer &buffer);
 		
 		/**
 		 Draws this complete mesh.
@@ -163,13 +227,45 @@ namespace mage {
 						The start index.
 		 @param[in]		nb_indices
 						The number of indices.
+		 @param[in]		base_vertex
+						The vertex added to each index before reading a vertex 
+						from the vertex buffer.
 		 */
 		void Draw(ID3D11DeviceContext4 *device_context,
-			size_t start_index, size_t nb_indices) const noexcept {
+			size_t start_index, size_t nb_indices, 
+			size_t base_vertex = 0) const noexcept {
 
 			Pipeline::DrawIndexed(device_context,
 				static_cast< U32 >(nb_indices), 
-				static_cast< U32 >(start_index));
+				static_cast< U32 >(start_index),
+				static_cast< U32 >(base_vertex));
+		}
+
+		/**
+		 Draws multiple instances of a submesh of this mesh.
+
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		start_index
+						The start index.
+		 @param[in]		nb_indices
+						The number of indices.
+		 @param[in]		nb_instances
+						The number of instances.
+		 @param[in]		base_vertex
+						The vertex added to each index before reading a vertex 
+						from the vertex buffer.
+		 */
+		void DrawInstanced(ID3D11DeviceContext4 *device_context,
+			size_t start_index, size_t nb_indices, 
+			size_t nb_instances, size_t base_vertex = 0) const noexcept {
+
+			Pipeline::DrawIndexedInstanced(device_context,
+				static_cast< U32 >(nb_indices), 
+				static_cast< U32 >(nb_instances), 
+				static_cast< U32 >(start_index),
+				static_cast< U32 >(base_vertex));
 		}
 
 	protected:
@@ -231,6 +327,16 @@ namespace mage {
 			m_nb_indices = nb_indices;
 		}
 
+		/**
+		 Binds the vertex input layout and mesh buffer of this mesh.
+
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 */
+		void BindVertexDecoding(
+			ID3D11DeviceContext4 *device_context) const noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -245,6 +351,16 @@ namespace mage {
 		 */
 		ComPtr< ID3D11Buffer > m_index_buffer;
 
+		/**
+		 A pointer to the vertex input layout of this mesh.
+		 */
+		ComPtr< ID3D11InputLayout > m_input_layout;
+
+		/**
+		 A pointer to the mesh buffer of this mesh.
+		 */
+		ComPtr< ID3D11Buffer > m_mesh_buffer;
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -275,5 +391,10 @@ namespace mage {
 		 The primitive topology of this mesh.
 		 */
 		const D3D11_PRIMITIVE_TOPOLOGY m_primitive_topology;
+
+		/**
+		 A vector containing the mesh clusters of this mesh.
+		 */
+		vector< MeshCluster > m_clusters;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,242 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "mesh\mesh_cluster.hpp"
+#include "utils\logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The minimal cosine of the angle between the normals and the axis of a
+	 normal cone for which backface culling of a mesh cluster is enabled.
+	 */
+	constexpr F32 g_min_cone_cos = 0.1f;
+
+	namespace {
+
+		/**
+		 Sets up the bounding sphere and normal cone of the given mesh
+		 cluster.
+
+		 @pre			All indices of the mesh cluster are smaller than the
+						number of vertices.
+		 @param[in,out]	cluster
+						A reference to the mesh cluster.
+		 @param[in]		indices
+						A pointer to the indices of the triangle list.
+		 @param[in]		positions
+						A pointer to the vertex positions.
+		 */
+		void SetupMeshCluster(MeshCluster &cluster,
+			const U32 *indices, const Point3 *positions) noexcept {
+
+			const U32 start = cluster.m_start_index;
+			const U32 end   = start + cluster.m_nb_indices;
+
+			// Bounding sphere: centered at the centroid of the AABB.
+			AABB aabb;
+			for (U32 i = start; i < end; ++i) {
+				aabb = Union(aabb, positions[indices[i]]);
+			}
+
+			const Point3   aabb_centroid = aabb.Centroid();
+			const XMVECTOR centroid      = XMLoadFloat3(&aabb_centroid);
+			XMVECTOR sqr_radius = XMVectorZero();
+			for (U32 i = start; i < end; ++i) {
+				const XMVECTOR p = XMLoadFloat3(&positions[indices[i]]);
+				sqr_radius = XMVectorMax(sqr_radius,
+					XMVector3LengthSq(p - centroid));
+			}
+
+			XMStoreFloat3(reinterpret_cast< XMFLOAT3 * >(
+				&cluster.m_bs_centroid), centroid);
+			cluster.m_bs_radius = std::sqrt(XMVectorGetX(sqr_radius));
+
+			// Normal cone: the triangle normals point to the front side of
+			// the clockwise triangles.
+			XMVECTOR axis = XMVectorZero();
+			for (U32 i = start; i < end; i += 3u) {
+				const XMVECTOR p0 = XMLoadFloat3(&positions[indices[i]]);
+				const XMVECTOR p1 = XMLoadFloat3(&positions[indices[i+1u]]);
+				const XMVECTOR p2 = XMLoadFloat3(&positions[indices[i+2u]]);
+				const XMVECTOR n  = XMVector3Cross(p1 - p0, p2 - p0);
+				if (0.0f < XMVectorGetX(XMVector3LengthSq(n))) {
+					axis += XMVector3Normalize(n);
+				}
+			}
+
+			cluster.m_cone_axis   = F32x3(0.0f, 0.0f, 0.0f);
+			cluster.m_cone_cutoff = 1.0f;
+
+			if (0.0f == XMVectorGetX(XMVector3LengthSq(axis))) {
+				return;
+			}
+
+			axis = XMVector3Normalize(axis);
+
+			F32 min_cos = 1.0f;
+			for (U32 i = start; i < end; i += 3u) {
+				const XMVECTOR p0 = XMLoadFloat3(&positions[indices[i]]);
+				const XMVECTOR p1 = XMLoadFloat3(&positions[indices[i+1u]]);
+				const XMVECTOR p2 = XMLoadFloat3(&positions[indices[i+2u]]);
+				const XMVECTOR n  = XMVector3Cross(p1 - p0, p2 - p0);
+				if (0.0f < XMVectorGetX(XMVector3LengthSq(n))) {
+					min_cos = std::min(min_cos, XMVectorGetX(
+						XMVector3Dot(XMVector3Normalize(n), axis)));
+				}
+			}
+
+			XMStoreFloat3(reinterpret_cast< XMFLOAT3 * >(
+				&cluster.m_cone_axis), axis);
+
+			// Normal cones wider than (almost) a hemisphere cannot be culled.
+			if (g_min_cone_cos <= min_cos) {
+				cluster.m_cone_cutoff = std::sqrt(1.0f - min_cos * min_cos);
+			}
+		}
+	}
+
+	void BuildMeshClusters(const U32 *indices, size_t nb_indices,
+		const Point3 *positions, size_t nb_vertices,
+		vector< MeshCluster > &clusters,
+		size_t max_triangles, size_t max_vertices) {
+
+		Assert(0 == nb_indices % 3);
+		Assert(3 <= max_vertices);
+		Assert(1 <= max_triangles);
+
+		// The cluster which last referenced each vertex.
+		vector< size_t > vertex_cluster(nb_vertices,
+			std::numeric_limits< size_t >::max());
+
+		MeshCluster cluster;
+		cluster.m_start_index = 0u;
+		cluster.m_nb_indices  = 0u;
+		size_t cluster_id     = 0;
+		size_t nb_cluster_vertices = 0;
+
+		for (size_t i = 0; i < nb_indices; i += 3) {
+			size_t nb_new_vertices = 0;
+			for (size_t j = i; j < i + 3; ++j) {
+				Assert(indices[j] < nb_vertices);
+				if (cluster_id != vertex_cluster[indices[j]]) {
+					++nb_new_vertices;
+				}
+			}
+
+			const size_t nb_triangles = cluster.m_nb_indices / 3u;
+			if (0 != nb_triangles
+				&& (max_triangles <= nb_triangles
+				 || max_vertices < nb_cluster_vertices + nb_new_vertices)) {
+
+				SetupMeshCluster(cluster, indices, positions);
+				clusters.push_back(cluster);
+
+				cluster.m_start_index = static_cast< U32 >(i);
+				cluster.m_nb_indices  = 0u;
+				++cluster_id;
+				nb_cluster_vertices   = 0;
+			}
+
+			for (size_t j = i; j < i + 3; ++j) {
+				if (cluster_id != vertex_cluster[indices[j]]) {
+					vertex_cluster[indices[j]] = cluster_id;
+					++nb_cluster_vertices;
+				}
+			}
+
+			cluster.m_nb_indices += 3u;
+		}
+
+		if (0u != cluster.m_nb_indices) {
+			SetupMeshCluster(cluster, indices, positions);
+			clusters.push_back(cluster);
+		}
+	}
+
+	bool XM_CALLCONV CullMeshCluster(const MeshCluster &cluster,
+		const ViewFrustum &view_frustum, FXMVECTOR eye) noexcept {
+
+		const BS bs(Point3(cluster.m_bs_centroid), cluster.m_bs_radius);
+		if (!view_frustum.Overlaps(bs)) {
+			return true;
+		}
+
+		// All triangles are back facing if the direction from the eye to each
+		// point of the bounding sphere makes an angle of less than 90 - theta
+		// degrees with the cone axis (theta = half angle of the normal cone).
+		const XMVECTOR centroid = XMLoadFloat3(&cluster.m_bs_centroid);
+		const XMVECTOR axis     = XMLoadFloat3(&cluster.m_cone_axis);
+		const F32      w        = XMVectorGetW(eye);
+		const XMVECTOR v        = centroid * w - XMVectorSetW(eye, 0.0f);
+
+		const F32 v_dot_axis = XMVectorGetX(XMVector3Dot(v, axis));
+		const F32 v_length   = XMVectorGetX(XMVector3Length(v));
+		const F32 cutoff     = cluster.m_cone_cutoff;
+
+		return cutoff * v_length + w * cluster.m_bs_radius * (1.0f + cutoff)
+			   < v_dot_axis;
+	}
+
+	void XM_CALLCONV MarkVisibleMeshClusters(const MeshCluster *clusters,
+		size_t nb_clusters, FXMMATRIX object_to_projection, FXMVECTOR eye,
+		ArenaVector< bool > &visible) {
+
+		Assert(nb_clusters <= visible.size());
+
+		const ViewFrustum view_frustum(object_to_projection);
+
+		for (size_t i = 0; i < nb_clusters; ++i) {
+			if (!visible[i] && !CullMeshCluster(clusters[i], view_frustum, eye)) {
+				visible[i] = true;
+			}
+		}
+	}
+
+	size_t CompactMeshClusters(const MeshCluster *clusters,
+		size_t nb_clusters, const ArenaVector< bool > &visible,
+		ArenaVector< IndexRange > &ranges) {
+
+		Assert(nb_clusters <= visible.size());
+
+		const size_t nb_ranges = ranges.size();
+		bool extend = false;
+
+		for (size_t i = 0; i < nb_clusters; ++i) {
+			if (!visible[i]) {
+				extend = false;
+				continue;
+			}
+
+			const MeshCluster &cluster = clusters[i];
+			if (extend && ranges.back().m_start_index + ranges.back().m_nb_indices
+				          == cluster.m_start_index) {
+				ranges.back().m_nb_indices += cluster.m_nb_indices;
+			}
+			else {
+				ranges.push_back({ cluster.m_start_index, cluster.m_nb_indices });
+			}
+			extend = true;
+		}
+
+		return ranges.size() - nb_ranges;
+	}
+}
\ No newline at end of file
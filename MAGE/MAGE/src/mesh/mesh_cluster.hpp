@@ -0,0 +1,189 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "math\geometry\view_frustum.hpp"
+#include "utils\collection\collection.hpp"
+#include "utils\memory\memory_arena.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The maximal number of triangles of a mesh cluster.
+	 */
+	constexpr size_t g_max_mesh_cluster_triangles = 124;
+
+	/**
+	 The maximal number of distinct vertices of a mesh cluster.
+	 */
+	constexpr size_t g_max_mesh_cluster_vertices  = 64;
+
+	/**
+	 A struct of mesh clusters (i.e. contiguous ranges of triangles of a
+	 triangle list together with their bounding sphere and normal cone).
+	 */
+	struct MeshCluster final {
+
+	public:
+
+		/**
+		 The start index of this mesh cluster.
+		 */
+		U32 m_start_index;
+
+		/**
+		 The number of indices of this mesh cluster.
+		 */
+		U32 m_nb_indices;
+
+		/**
+		 The centroid of the bounding sphere of this mesh cluster.
+		 */
+		F32x3 m_bs_centroid;
+
+		/**
+		 The radius of the bounding sphere of this mesh cluster.
+		 */
+		F32 m_bs_radius;
+
+		/**
+		 The (normalized) axis of the normal cone of this mesh cluster.
+		 */
+		F32x3 m_cone_axis;
+
+		/**
+		 The sine of the half angle of the normal cone of this mesh cluster
+		 (i.e. 1 if this mesh cluster cannot be backface culled).
+		 */
+		F32 m_cone_cutoff;
+	};
+
+	static_assert(40 == sizeof(MeshCluster), "Mesh cluster layout mismatch");
+
+	/**
+	 A struct of index ranges.
+	 */
+	struct IndexRange final {
+
+	public:
+
+		/**
+		 The start index of this index range.
+		 */
+		U32 m_start_index;
+
+		/**
+		 The number of indices of this index range.
+		 */
+		U32 m_nb_indices;
+	};
+
+	/**
+	 Splits the given triangle list into mesh clusters of consecutive
+	 triangles.
+
+	 A mesh cluster is ended as soon as it contains @a max_triangles
+	 triangles or as soon as the next triangle would exceed @a max_vertices
+	 distinct vertices. The triangle order is preserved, so that vertex cache
+	 optimized triangle lists remain optimized.
+
+	 @pre			All indices are smaller than @a nb_vertices.
+	 @pre			@a nb_indices is a multiple of three.
+	 @param[in]		indices
+					A pointer to the indices of the triangle list.
+	 @param[in]		nb_indices
+					The number of indices.
+	 @param[in]		positions
+					A pointer to the vertex positions.
+	 @param[in]		nb_vertices
+					The number of vertices.
+	 @param[out]	clusters
+					A reference to a vector to which the mesh clusters will
+					be appended. The start indices of the mesh clusters are
+					relative to @a indices.
+	 @param[in]		max_triangles
+					The maximal number of triangles of a mesh cluster.
+	 @param[in]		max_vertices
+					The maximal number of distinct vertices of a mesh
+					cluster.
+	 */
+	void BuildMeshClusters(const U32 *indices, size_t nb_indices,
+		const Point3 *positions, size_t nb_vertices,
+		vector< MeshCluster > &clusters,
+		size_t max_triangles = g_max_mesh_cluster_triangles,
+		size_t max_vertices  = g_max_mesh_cluster_vertices);
+
+	/**
+	 Checks whether the given mesh cluster is culled.
+
+	 A mesh cluster is culled if its bounding sphere does not overlap the
+	 given view frustum, or if all its triangles are back facing (i.e. have
+	 a clockwise front face and are seen from behind) from the given eye.
+
+	 @param[in]		cluster
+					A reference to the mesh cluster.
+	 @param[in]		view_frustum
+					A reference to the object-space view frustum.
+	 @param[in]		eye
+					The homogeneous object-space eye position (i.e. @c w = 1
+					for perspective projections, or the negated view
+					direction with @c w = 0 for orthographic projections).
+					@c XMVectorZero() disables backface culling.
+	 @return		@c true if the given mesh cluster is culled. @c false
+					otherwise.
+	 */
+	bool XM_CALLCONV CullMeshCluster(const MeshCluster &cluster,
+		const ViewFrustum &view_frustum, FXMVECTOR eye) noexcept;
+
+	/**
+	 Marks the given mesh clusters which are not culled as visible.
+
+	 Mesh clusters marked as visible are never unmarked, which allows
+	 accumulating the visible mesh clusters of multiple instances.
+
+	 @pre			@a visible contains at least @a nb_clusters elements.
+	 @param[in]		clusters
+					A pointer to the mesh clusters.
+	 @param[in]		nb_clusters
+					The number of mesh clusters.
+	 @param[in]		object_to_projection
+					The object-to-projection transformation matrix.
+	 @param[in]		eye
+					The homogeneous object-space eye position.
+	 @param[in,out]	visible
+					A reference to a vector containing the visibility of
+					each mesh cluster.
+	 */
+	void XM_CALLCONV MarkVisibleMeshClusters(const MeshCluster *clusters,
+		size_t nb_clusters, FXMMATRIX object_to_projection, FXMVECTOR eye,
+		ArenaVector< bool > &visible);
+
+	/**
+	 Compacts the visible mesh clusters into index ranges. Consecutive
+	 visible mesh clusters are merged into a single index range.
+
+	 @pre			@a visible contains at least @a nb_clusters elements.
+	 @param[in]		clusters
+					A pointer to the mesh clusters.
+	 @param[in]		nb_clusters
+					The number of mesh clusters.
+	 @param[in]		visible
+					A reference to a vector containing the visibility of
+					each mesh cluster.
+	 @param[out]	ranges
+					A reference to a vector to which the index ranges will
+					be appended.
+	 @return		The number of appended index ranges.
+	 */
+	size_t CompactMeshClusters(const MeshCluster *clusters,
+		size_t nb_clusters, const ArenaVector< bool > &visible,
+		ArenaVector< IndexRange > &ranges);
+}
\ No newline at end of file
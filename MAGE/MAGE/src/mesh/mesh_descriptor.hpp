@@ -1,5 +1,14 @@
 #pragma once
 
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "mesh\vertex_compression.hpp"
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -30,12 +39,29 @@ namespace mage {
 						A flag indicating whether the face vertices should be 
 						defined in clockwise order or not (i.e. 
 						counterclockwise order).
+		 @param[in]		optimize
+						A flag indicating whether the triangles and vertices 
+						of the mesh should be reordered for vertex cache 
+						locality, reduced overdraw and vertex fetch locality.
+		 @param[in]		compression
+						The compression of the vertices of the mesh on the 
+						GPU.
+		 @param[in]		nb_lods
+						The number of coarser LODs to generate for each model 
+						part of the mesh (if the mesh does not contain LODs 
+						yet).
 		 */
 		explicit MeshDescriptor(
-			bool invert_handedness = false, 
-			bool clockwise_order   = true)
+			bool invert_handedness        = false, 
+			bool clockwise_order          = true,
+			bool optimize                 = true,
+			VertexCompression compression = VertexCompression::None,
+			size_t nb_lods                = 0)
 			: m_invert_handedness(invert_handedness), 
-			m_clockwise_order(clockwise_order) {}
+			m_clockwise_order(clockwise_order),
+			m_optimize(optimize),
+			m_compression(compression),
+			m_nb_lods(nb_lods) {}
 		
 		/**
 		 Constructs a mesh descriptor from the given mesh descriptor.
@@ -109,6 +135,39 @@ namespace mage {
 			return m_clockwise_order;
 		}
 
+		/**
+		 Checks whether the triangles and vertices of the mesh should be 
+		 reordered according to this mesh descriptor.
+
+		 @return		@c true if the triangles and vertices of the mesh 
+						should be reordered. @c false otherwise.
+		 */
+		bool OptimizeMesh() const noexcept {
+			return m_optimize;
+		}
+
+		/**
+		 Returns the compression of the vertices of the mesh on the GPU 
+		 according to this mesh descriptor.
+
+		 @return		The compression of the vertices of the mesh on the 
+						GPU.
+		 */
+		VertexCompression GetVertexCompression() const noexcept {
+			return m_compression;
+		}
+
+		/**
+		 Returns the number of coarser LODs to generate for each model part 
+		 of the mesh according to this mesh descriptor.
+
+		 @return		The number of coarser LODs to generate for each model 
+						part of the mesh.
+		 */
+		size_t GetNumberOfLODs() const noexcept {
+			return m_nb_lods;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -127,5 +186,23 @@ namespace mage {
 		 descriptor.
 		 */
 		bool m_clockwise_order;
+
+		/**
+		 A flag indicating whether the triangles and vertices of the mesh 
+		 should be reordered or not for this mesh descriptor.
+		 */
+		bool m_optimize;
+
+		/**
+		 The compression of the vertices of the mesh on the GPU for this mesh 
+		 descriptor.
+		 */
+		VertexCompression m_compression;
+
+		/**
+		 The number of coarser LODs to generate for each model part of the 
+		 mesh for this mesh descriptor.
+		 */
+		size_t m_nb_lods;
 	};
 }
\ No newline at end of file
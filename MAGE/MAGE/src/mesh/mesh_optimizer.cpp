@@ -0,0 +1,486 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "mesh\mesh_optimizer.hpp"
+#include "utils\logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The number of entries of the LRU vertex cache used for scoring vertices.
+	 */
+	constexpr size_t g_vertex_score_cache_size = 32;
+
+	/**
+	 The maximal number of live triangles used for scoring vertices.
+	 */
+	constexpr size_t g_vertex_score_max_valence = 32;
+
+	/**
+	 The invalid (vertex or triangle) index.
+	 */
+	constexpr U32 g_invalid_index = 0xFFFFFFFFu;
+
+	namespace {
+
+		/**
+		 A class of vertex score tables.
+		 */
+		class VertexScoreTable final {
+
+		public:
+
+			/**
+			 Constructs a vertex score table.
+			 */
+			VertexScoreTable() noexcept {
+				// Vertices of the last triangle get a fixed score to avoid
+				// favouring the same triangle strip direction.
+				constexpr F32 last_triangle_score = 0.75f;
+				constexpr F32 cache_decay_power   = 1.5f;
+				constexpr F32 valence_boost_scale = 2.0f;
+				constexpr F32 valence_boost_power = 0.5f;
+
+				for (size_t i = 0; i < g_vertex_score_cache_size; ++i) {
+					if (3 > i) {
+						m_cache_scores[i] = last_triangle_score;
+					}
+					else {
+						const F32 scale = 1.0f / (g_vertex_score_cache_size - 3);
+						m_cache_scores[i] = std::pow(
+							1.0f - (i - 3) * scale, cache_decay_power);
+					}
+				}
+
+				m_valence_scores[0] = 0.0f;
+				for (size_t i = 1; i <= g_vertex_score_max_valence; ++i) {
+					m_valence_scores[i] = valence_boost_scale
+						* std::pow(static_cast< F32 >(i), -valence_boost_power);
+				}
+			}
+
+			/**
+			 Returns the score of a vertex.
+
+			 @param[in]		cache_position
+							The position of the vertex in the cache, or
+							@c g_invalid_index if the vertex is not cached.
+			 @param[in]		nb_live_triangles
+							The number of not yet emitted triangles
+							referencing the vertex.
+			 @return		The score of the vertex.
+			 */
+			F32 GetScore(U32 cache_position,
+				U32 nb_live_triangles) const noexcept {
+
+				if (0u == nb_live_triangles) {
+					return -1.0f;
+				}
+
+				const F32 cache_score = (g_invalid_index == cache_position)
+					? 0.0f : m_cache_scores[cache_position];
+				const size_t valence = std::min(
+					static_cast< size_t >(nb_live_triangles),
+					g_vertex_score_max_valence);
+
+				return cache_score + m_valence_scores[valence];
+			}
+
+		private:
+
+			/**
+			 The scores indexed by cache position.
+			 */
+			F32 m_cache_scores[g_vertex_score_cache_size];
+
+			/**
+			 The scores indexed by the number of live triangles.
+			 */
+			F32 m_valence_scores[g_vertex_score_max_valence + 1];
+		};
+
+		/**
+		 Simulates a FIFO vertex cache for each triangle of the given
+		 triangle list.
+
+		 @param[in]		indices
+						A pointer to the indices of the triangle list.
+		 @param[in]		nb_indices
+						The number of indices.
+		 @param[in]		nb_vertices
+						The number of vertices.
+		 @param[in]		cache_size
+						The number of entries of the vertex cache.
+		 @param[in]		action
+						The action to perform for each triangle given the
+						number of cache misses of that triangle.
+		 */
+		template< typename ActionT >
+		void SimulateVertexCache(const U32 *indices, size_t nb_indices,
+			size_t nb_vertices, size_t cache_size, ActionT action) {
+
+			// A vertex is cached if fewer than cache_size vertices were
+			// pushed since its own push.
+			vector< size_t > timestamps(nb_vertices, 0);
+			size_t time = cache_size + 1;
+
+			for (size_t i = 0; i + 2 < nb_indices; i += 3) {
+				U32 nb_misses = 0u;
+				for (size_t j = 0; j < 3; ++j) {
+					const U32 v = indices[i + j];
+					if (time - timestamps[v] > cache_size) {
+						timestamps[v] = time++;
+						++nb_misses;
+					}
+				}
+
+				action(nb_misses);
+			}
+		}
+	}
+
+	const VertexCacheStatistics AnalyzeVertexCache(const U32 *indices,
+		size_t nb_indices, size_t nb_vertices, size_t cache_size) {
+
+		Assert(indices || 0 == nb_indices);
+
+		VertexCacheStatistics statistics;
+		statistics.m_nb_triangles = nb_indices / 3;
+
+		SimulateVertexCache(indices, nb_indices, nb_vertices, cache_size,
+			[&statistics](U32 nb_misses) noexcept {
+				statistics.m_nb_transformed_vertices += nb_misses;
+			});
+
+		vector< bool > referenced(nb_vertices, false);
+		for (size_t i = 0; i < nb_indices; ++i) {
+			if (!referenced[indices[i]]) {
+				referenced[indices[i]] = true;
+				++statistics.m_nb_vertices;
+			}
+		}
+
+		return statistics;
+	}
+
+	void OptimizeVertexCache(U32 *indices,
+		size_t nb_indices, size_t nb_vertices) {
+
+		Assert(indices || 0 == nb_indices);
+
+		static const VertexScoreTable score_table;
+
+		const size_t nb_triangles = nb_indices / 3;
+		if (2 > nb_triangles) {
+			return;
+		}
+
+		// Build the vertex-triangle adjacency.
+		vector< U32 > nb_live_triangles(nb_vertices, 0u);
+		for (size_t i = 0; i < nb_triangles * 3; ++i) {
+			++nb_live_triangles[indices[i]];
+		}
+
+		vector< U32 > adjacency_offsets(nb_vertices + 1, 0u);
+		for (size_t v = 0; v < nb_vertices; ++v) {
+			adjacency_offsets[v + 1]
+				= adjacency_offsets[v] + nb_live_triangles[v];
+		}
+
+		vector< U32 > adjacency(nb_triangles * 3);
+		{
+			vector< U32 > fill(adjacency_offsets.begin(),
+				               adjacency_offsets.end() - 1);
+			for (size_t t = 0; t < nb_triangles; ++t) {
+				for (size_t j = 0; j < 3; ++j) {
+					adjacency[fill[indices[3 * t + j]]++]
+						= static_cast< U32 >(t);
+				}
+			}
+		}
+
+		// Compute the initial scores.
+		vector< U32 > cache_positions(nb_vertices, g_invalid_index);
+		vector< F32 > vertex_scores(nb_vertices);
+		for (size_t v = 0; v < nb_vertices; ++v) {
+			vertex_scores[v] = score_table.GetScore(
+				g_invalid_index, nb_live_triangles[v]);
+		}
+
+		vector< F32 > triangle_scores(nb_triangles);
+		vector< bool > emitted(nb_triangles, false);
+		U32 best_triangle = 0u;
+		for (size_t t = 0; t < nb_triangles; ++t) {
+			triangle_scores[t] = vertex_scores[indices[3 * t]]
+				               + vertex_scores[indices[3 * t + 1]]
+				               + vertex_scores[indices[3 * t + 2]];
+			if (triangle_scores[best_triangle] < triangle_scores[t]) {
+				best_triangle = static_cast< U32 >(t);
+			}
+		}
+
+		vector< U32 > output;
+		output.reserve(nb_triangles * 3);
+
+		U32    cache[g_vertex_score_cache_size + 3];
+		size_t cache_count = 0;
+		size_t cursor      = 0;
+
+		for (size_t i = 0; i < nb_triangles; ++i) {
+
+			if (g_invalid_index == best_triangle) {
+				// Dead end: continue with the next triangle in input order.
+				while (emitted[cursor]) {
+					++cursor;
+				}
+				best_triangle = static_cast< U32 >(cursor);
+			}
+
+			const U32 * const triangle = &indices[3 * best_triangle];
+			output.insert(output.end(), triangle, triangle + 3);
+			emitted[best_triangle] = true;
+
+			// Remove the triangle from the adjacency of its vertices.
+			for (size_t j = 0; j < 3; ++j) {
+				const U32 v = triangle[j];
+				U32 * const begin = &adjacency[adjacency_offsets[v]];
+				U32 * const end   = begin + nb_live_triangles[v];
+				*std::find(begin, end, best_triangle) = *(end - 1);
+				--nb_live_triangles[v];
+			}
+
+			// Push the vertices of the triangle to the front of the cache.
+			U32    new_cache[g_vertex_score_cache_size + 3];
+			size_t new_cache_count = 0;
+			for (size_t j = 0; j < 3; ++j) {
+				const U32 v = triangle[j];
+				if (new_cache + new_cache_count 
+					== std::find(new_cache, new_cache + new_cache_count, v)) {
+					new_cache[new_cache_count++] = v;
+				}
+			}
+			for (size_t j = 0; j < cache_count; ++j) {
+				const U32 v = cache[j];
+				if (v != triangle[0] && v != triangle[1] && v != triangle[2]) {
+					new_cache[new_cache_count++] = v;
+				}
+			}
+
+			// Update the scores of the affected vertices and triangles.
+			best_triangle = g_invalid_index;
+			F32 best_score = -1.0f;
+			for (size_t j = 0; j < new_cache_count; ++j) {
+				const U32 v = new_cache[j];
+				cache_positions[v] = (g_vertex_score_cache_size > j)
+					? static_cast< U32 >(j) : g_invalid_index;
+				vertex_scores[v] = score_table.GetScore(
+					cache_positions[v], nb_live_triangles[v]);
+			}
+			for (size_t j = 0; j < new_cache_count; ++j) {
+				const U32 v = new_cache[j];
+				const U32 * const begin = &adjacency[adjacency_offsets[v]];
+				const U32 * const end   = begin + nb_live_triangles[v];
+				for (const U32 *it = begin; it != end; ++it) {
+					const U32 t = *it;
+					triangle_scores[t] = vertex_scores[indices[3 * t]]
+						               + vertex_scores[indices[3 * t + 1]]
+						               + vertex_scores[indices[3 * t + 2]];
+					if (best_score < triangle_scores[t]) {
+						best_score    = triangle_scores[t];
+						best_triangle = t;
+					}
+				}
+			}
+
+			cache_count = std::min(new_cache_count, g_vertex_score_cache_size);
+			std::copy(new_cache, new_cache + cache_count, cache);
+		}
+
+		std::copy(output.begin(), output.end(), indices);
+	}
+
+	void OptimizeOverdraw(U32 *indices, size_t nb_indices,
+		const Point3 *positions, size_t nb_vertices, F32 threshold) {
+
+		Assert(indices   || 0 == nb_indices);
+		Assert(positions || 0 == nb_vertices);
+
+		const size_t nb_triangles = nb_indices / 3;
+		if (2 > nb_triangles) {
+			return;
+		}
+
+		// Split at cache flushes (i.e. triangles missing all vertices).
+		vector< U32 > nb_misses;
+		nb_misses.reserve(nb_triangles);
+		SimulateVertexCache(indices, nb_indices, nb_vertices,
+			g_vertex_cache_size, [&nb_misses](U32 misses) {
+				nb_misses.push_back(misses);
+			});
+
+		vector< size_t > hard_clusters;
+		for (size_t t = 0; t < nb_triangles; ++t) {
+			if (0 == t || 3u == nb_misses[t]) {
+				hard_clusters.push_back(t);
+			}
+		}
+		hard_clusters.push_back(nb_triangles);
+
+		// Split further where the local ACMR is close enough to the cluster
+		// ACMR, so that reordering these clusters barely affects the ACMR.
+		vector< size_t > clusters;
+		for (size_t c = 0; c + 1 < hard_clusters.size(); ++c) {
+			const size_t begin = hard_clusters[c];
+			const size_t end   = hard_clusters[c + 1];
+
+			size_t cluster_misses = 0;
+			for (size_t t = begin; t < end; ++t) {
+				cluster_misses += nb_misses[t];
+			}
+			const F32 cluster_acmr = threshold
+				* static_cast< F32 >(cluster_misses)
+				/ static_cast< F32 >(end - begin);
+
+			clusters.push_back(begin);
+			size_t misses = 0;
+			size_t start  = begin;
+			for (size_t t = begin; t + 1 < end; ++t) {
+				misses += nb_misses[t];
+				const F32 acmr = static_cast< F32 >(misses)
+					           / static_cast< F32 >(t + 1 - start);
+				if (acmr <= cluster_acmr) {
+					clusters.push_back(t + 1);
+					misses = 0;
+					start  = t + 1;
+				}
+			}
+		}
+		clusters.push_back(nb_triangles);
+
+		// Compute the mesh centroid.
+		F32 mesh_centroid[3] = {};
+		{
+			vector< bool > referenced(nb_vertices, false);
+			size_t nb_referenced = 0;
+			for (size_t i = 0; i < nb_triangles * 3; ++i) {
+				const U32 v = indices[i];
+				if (!referenced[v]) {
+					referenced[v] = true;
+					++nb_referenced;
+					mesh_centroid[0] += positions[v].m_x;
+					mesh_centroid[1] += positions[v].m_y;
+					mesh_centroid[2] += positions[v].m_z;
+				}
+			}
+			for (F32 &coordinate : mesh_centroid) {
+				coordinate /= static_cast< F32 >(nb_referenced);
+			}
+		}
+
+		// Sort the clusters by the projection of their area-weighted
+		// centroid on their area-weighted normal: clusters facing outwards
+		// are drawn first and occlude the clusters drawn afterwards.
+		const size_t nb_clusters = clusters.size() - 1;
+		vector< F32 > sort_keys(nb_clusters);
+		for (size_t c = 0; c < nb_clusters; ++c) {
+			F32 centroid[3] = {};
+			F32 normal[3]   = {};
+			F32 area        = 0.0f;
+
+			for (size_t t = clusters[c]; t < clusters[c + 1]; ++t) {
+				const Point3 &p0 = positions[indices[3 * t]];
+				const Point3 &p1 = positions[indices[3 * t + 1]];
+				const Point3 &p2 = positions[indices[3 * t + 2]];
+
+				const F32 e1[3] = { p1.m_x - p0.m_x, p1.m_y - p0.m_y, p1.m_z - p0.m_z };
+				const F32 e2[3] = { p2.m_x - p0.m_x, p2.m_y - p0.m_y, p2.m_z - p0.m_z };
+				const F32 n[3]  = { e1[1] * e2[2] - e1[2] * e2[1],
+					                e1[2] * e2[0] - e1[0] * e2[2],
+					                e1[0] * e2[1] - e1[1] * e2[0] };
+				const F32 a = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+				centroid[0] += a * (p0.m_x + p1.m_x + p2.m_x) / 3.0f;
+				centroid[1] += a * (p0.m_y + p1.m_y + p2.m_y) / 3.0f;
+				centroid[2] += a * (p0.m_z + p1.m_z + p2.m_z) / 3.0f;
+				normal[0]   += n[0];
+				normal[1]   += n[1];
+				normal[2]   += n[2];
+				area        += a;
+			}
+
+			const F32 inv_area = (0.0f == area) ? 0.0f : 1.0f / area;
+			const F32 length   = std::sqrt(normal[0] * normal[0]
+				                         + normal[1] * normal[1]
+				                         + normal[2] * normal[2]);
+			const F32 inv_length = (0.0f == length) ? 0.0f : 1.0f / length;
+
+			sort_keys[c] = 0.0f;
+			for (size_t j = 0; j < 3; ++j) {
+				sort_keys[c] += (centroid[j] * inv_area - mesh_centroid[j])
+					          * (normal[j] * inv_length);
+			}
+		}
+
+		vector< U32 > order(nb_clusters);
+		for (size_t c = 0; c < nb_clusters; ++c) {
+			order[c] = static_cast< U32 >(c);
+		}
+		std::stable_sort(order.begin(), order.end(),
+			[&sort_keys](U32 lhs, U32 rhs) noexcept {
+				return sort_keys[lhs] > sort_keys[rhs];
+			});
+
+		vector< U32 > output;
+		output.reserve(nb_triangles * 3);
+		for (const U32 c : order) {
+			output.insert(output.end(),
+				          indices + 3 * clusters[c],
+				          indices + 3 * clusters[c + 1]);
+		}
+
+		// Keep the reordering only if the ACMR stays within the threshold.
+		const F32 acmr_before = AnalyzeVertexCache(
+			indices, nb_triangles * 3, nb_vertices).GetACMR();
+		const F32 acmr_after  = AnalyzeVertexCache(
+			output.data(), output.size(), nb_vertices).GetACMR();
+		if (acmr_after <= acmr_before * threshold) {
+			std::copy(output.begin(), output.end(), indices);
+		}
+	}
+
+	size_t OptimizeVertexFetch(U32 *indices, size_t nb_indices,
+		size_t nb_vertices, vector< U32 > &remap) {
+
+		Assert(indices || 0 == nb_indices);
+
+		remap.assign(nb_vertices, g_invalid_index);
+
+		U32 nb_referenced = 0u;
+		for (size_t i = 0; i < nb_indices; ++i) {
+			U32 &index = remap[indices[i]];
+			if (g_invalid_index == index) {
+				index = nb_referenced++;
+			}
+			indices[i] = index;
+		}
+
+		return nb_referenced;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,186 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "math\geometry\geometry.hpp"
+#include "utils\collection\collection.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The number of entries of the FIFO post-transform vertex cache used for
+	 analyzing meshes.
+	 */
+	constexpr size_t g_vertex_cache_size = 16;
+
+	/**
+	 A struct of post-transform vertex cache statistics.
+	 */
+	struct VertexCacheStatistics final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Adds the given vertex cache statistics to these vertex cache 
+		 statistics.
+
+		 @param[in]		statistics
+						A reference to the vertex cache statistics to add.
+		 @return		A reference to the sum of the given vertex cache 
+						statistics and these vertex cache statistics (i.e. 
+						these vertex cache statistics).
+		 */
+		VertexCacheStatistics &operator+=(
+			const VertexCacheStatistics &statistics) noexcept {
+
+			m_nb_triangles            += statistics.m_nb_triangles;
+			m_nb_vertices             += statistics.m_nb_vertices;
+			m_nb_transformed_vertices += statistics.m_nb_transformed_vertices;
+			return *this;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the average cache miss ratio (ACMR) of these statistics.
+
+		 @return		The average number of transformed vertices per
+						triangle (i.e. 0.5 in the best case for large
+						meshes and 3 in the worst case).
+		 */
+		F32 GetACMR() const noexcept {
+			return (0 == m_nb_triangles) ? 0.0f
+				: static_cast< F32 >(m_nb_transformed_vertices)
+				/ static_cast< F32 >(m_nb_triangles);
+		}
+
+		/**
+		 Returns the average transform to vertex ratio (ATVR) of these
+		 statistics.
+
+		 @return		The average number of times each vertex is
+						transformed (i.e. 1 in the best case).
+		 */
+		F32 GetATVR() const noexcept {
+			return (0 == m_nb_vertices) ? 0.0f
+				: static_cast< F32 >(m_nb_transformed_vertices)
+				/ static_cast< F32 >(m_nb_vertices);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of triangles.
+		 */
+		size_t m_nb_triangles = 0;
+
+		/**
+		 The number of distinct referenced vertices.
+		 */
+		size_t m_nb_vertices = 0;
+
+		/**
+		 The number of vertex shader invocations (i.e. cache misses).
+		 */
+		size_t m_nb_transformed_vertices = 0;
+	};
+
+	/**
+	 Simulates a FIFO post-transform vertex cache for the given triangle list.
+
+	 @pre			All indices are smaller than @a nb_vertices.
+	 @param[in]		indices
+					A pointer to the indices of the triangle list.
+	 @param[in]		nb_indices
+					The number of indices.
+	 @param[in]		nb_vertices
+					The number of vertices.
+	 @param[in]		cache_size
+					The number of entries of the vertex cache.
+	 @return		The vertex cache statistics of the given triangle list.
+	 */
+	const VertexCacheStatistics AnalyzeVertexCache(const U32 *indices,
+		size_t nb_indices, size_t nb_vertices,
+		size_t cache_size = g_vertex_cache_size);
+
+	/**
+	 Reorders the triangles of the given triangle list for post-transform
+	 vertex cache locality.
+
+	 The triangles are greedily emitted in order of their score with regard
+	 to a simulated LRU cache (Forsyth, "Linear-Speed Vertex Cache
+	 Optimisation", 2006).
+
+	 @pre			All indices are smaller than @a nb_vertices.
+	 @param[in,out]	indices
+					A pointer to the indices of the triangle list.
+	 @param[in]		nb_indices
+					The number of indices.
+	 @param[in]		nb_vertices
+					The number of vertices.
+	 */
+	void OptimizeVertexCache(U32 *indices,
+		size_t nb_indices, size_t nb_vertices);
+
+	/**
+	 Reorders clusters of triangles of the given vertex cache optimized
+	 triangle list for reducing overdraw.
+
+	 The triangle list is split in clusters at cache flushes and at points
+	 where the local ACMR is within the given threshold of the cluster ACMR.
+	 The clusters are sorted front to back from the outside in (Sander et
+	 al., "Fast Triangle Reordering for Vertex Locality and Reduced
+	 Overdraw", 2007).
+
+	 @pre			All indices are smaller than @a nb_vertices.
+	 @param[in,out]	indices
+					A pointer to the indices of the triangle list.
+	 @param[in]		nb_indices
+					The number of indices.
+	 @param[in]		positions
+					A pointer to the vertex positions.
+	 @param[in]		nb_vertices
+					The number of vertices.
+	 @param[in]		threshold
+					The maximal ratio between the ACMR after and before
+					this reordering.
+	 */
+	void OptimizeOverdraw(U32 *indices, size_t nb_indices,
+		const Point3 *positions, size_t nb_vertices,
+		F32 threshold = 1.05f);
+
+	/**
+	 Remaps the vertices of the given triangle list in order of first use for
+	 vertex fetch locality. Unreferenced vertices are discarded.
+
+	 @pre			All indices are smaller than @a nb_vertices.
+	 @param[in,out]	indices
+					A pointer to the indices of the triangle list.
+	 @param[in]		nb_indices
+					The number of indices.
+	 @param[in]		nb_vertices
+					The number of vertices.
+	 @param[out]	remap
+					A reference to a vector containing the new index of
+					each vertex, or @c U32 max for unreferenced vertices.
+	 @return		The number of referenced vertices.
+	 */
+	size_t OptimizeVertexFetch(U32 *indices, size_t nb_indices,
+		size_t nb_vertices, vector< U32 > &remap);
+}
\ No newline at end of file
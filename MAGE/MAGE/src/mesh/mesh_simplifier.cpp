@@ -0,0 +1,424 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "mesh\mesh_simplifier.hpp"
+#include "utils\logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 A struct of (symmetric) error quadrics.
+		 */
+		struct Quadric final {
+
+		public:
+
+			/**
+			 Adds the given quadric to this quadric.
+
+			 @param[in]		quadric
+							A reference to the quadric to add.
+			 @return		A reference to the sum of the given quadric and
+							this quadric (i.e. this quadric).
+			 */
+			Quadric &operator+=(const Quadric &quadric) noexcept {
+				m_a2 += quadric.m_a2;
+				m_b2 += quadric.m_b2;
+				m_c2 += quadric.m_c2;
+				m_ab += quadric.m_ab;
+				m_ac += quadric.m_ac;
+				m_bc += quadric.m_bc;
+				m_ad += quadric.m_ad;
+				m_bd += quadric.m_bd;
+				m_cd += quadric.m_cd;
+				m_d2 += quadric.m_d2;
+				return *this;
+			}
+
+			/**
+			 Evaluates this quadric at the given point.
+
+			 @param[in]		p
+							A reference to the point.
+			 @return		The sum of the squared distances of the given
+							point to the planes of this quadric.
+			 */
+			F64 Evaluate(const Point3 &p) const noexcept {
+				const F64 x = p.m_x;
+				const F64 y = p.m_y;
+				const F64 z = p.m_z;
+
+				return x * x * m_a2 + y * y * m_b2 + z * z * m_c2
+					 + 2.0 * (x * y * m_ab + x * z * m_ac + y * z * m_bc)
+					 + 2.0 * (x * m_ad + y * m_bd + z * m_cd)
+					 + m_d2;
+			}
+
+			/**
+			 The coefficients of this quadric (i.e. the sums of the products
+			 of the plane coefficients a, b, c and d of its planes).
+			 */
+			F64 m_a2 = 0.0;
+			F64 m_b2 = 0.0;
+			F64 m_c2 = 0.0;
+			F64 m_ab = 0.0;
+			F64 m_ac = 0.0;
+			F64 m_bc = 0.0;
+			F64 m_ad = 0.0;
+			F64 m_bd = 0.0;
+			F64 m_cd = 0.0;
+			F64 m_d2 = 0.0;
+		};
+
+		/**
+		 A struct of edge collapses.
+		 */
+		struct EdgeCollapse final {
+
+		public:
+
+			/**
+			 The vertex which is moved by this edge collapse.
+			 */
+			U32 m_from;
+
+			/**
+			 The vertex onto which the vertex is moved by this edge collapse.
+			 */
+			U32 m_to;
+
+			/**
+			 The quadric error of this edge collapse.
+			 */
+			F64 m_cost;
+		};
+
+		/**
+		 Computes the (non-normalized) normal of the given triangle.
+
+		 @param[in]		p0
+						A reference to the first vertex position.
+		 @param[in]		p1
+						A reference to the second vertex position.
+		 @param[in]		p2
+						A reference to the third vertex position.
+		 @param[out]	n
+						A pointer to the three components of the normal.
+		 */
+		void ComputeNormal(const Point3 &p0, const Point3 &p1,
+			const Point3 &p2, F64 *n) noexcept {
+
+			const F64 e1[] = { F64(p1.m_x) - p0.m_x,
+				               F64(p1.m_y) - p0.m_y,
+				               F64(p1.m_z) - p0.m_z };
+			const F64 e2[] = { F64(p2.m_x) - p0.m_x,
+				               F64(p2.m_y) - p0.m_y,
+				               F64(p2.m_z) - p0.m_z };
+
+			n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+			n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+			n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+		}
+
+		/**
+		 Returns the quadric of the plane of the given triangle.
+
+		 @param[in]		p0
+						A reference to the first vertex position.
+		 @param[in]		p1
+						A reference to the second vertex position.
+		 @param[in]		p2
+						A reference to the third vertex position.
+		 @return		The quadric of the plane of the given triangle, or a
+						zero quadric if the triangle is degenerate.
+		 */
+		const Quadric MakePlaneQuadric(const Point3 &p0, const Point3 &p1,
+			const Point3 &p2) noexcept {
+
+			F64 n[3];
+			ComputeNormal(p0, p1, p2, n);
+
+			Quadric quadric;
+
+			const F64 length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+			if (0.0 == length) {
+				return quadric;
+			}
+
+			const F64 a = n[0] / length;
+			const F64 b = n[1] / length;
+			const F64 c = n[2] / length;
+			const F64 d = -(a * p0.m_x + b * p0.m_y + c * p0.m_z);
+
+			quadric.m_a2 = a * a;
+			quadric.m_b2 = b * b;
+			quadric.m_c2 = c * c;
+			quadric.m_ab = a * b;
+			quadric.m_ac = a * c;
+			quadric.m_bc = b * c;
+			quadric.m_ad = a * d;
+			quadric.m_bd = b * d;
+			quadric.m_cd = c * d;
+			quadric.m_d2 = d * d;
+			return quadric;
+		}
+
+		/**
+		 Locks the vertices on borders, on non-manifold edges and on
+		 attribute seams of the given triangle list.
+
+		 @param[in]		indices
+						A pointer to the indices of the triangle list.
+		 @param[in]		nb_indices
+						The number of indices.
+		 @param[in]		positions
+						A pointer to the vertex positions.
+		 @param[in]		nb_vertices
+						The number of vertices.
+		 @param[out]	locked
+						A reference to a vector which will contain for each
+						vertex whether it is locked.
+		 */
+		void LockVertices(const U32 *indices, size_t nb_indices,
+			const Point3 *positions, size_t nb_vertices,
+			vector< bool > &locked) {
+
+			// Vertices with equal positions are welded.
+			vector< U32 > order(nb_vertices);
+			std::iota(order.begin(), order.end(), 0u);
+			const auto less = [positions](U32 v0, U32 v1) noexcept {
+				const Point3 &p0 = positions[v0];
+				const Point3 &p1 = positions[v1];
+				if (p0.m_x != p1.m_x) { return p0.m_x < p1.m_x; }
+				if (p0.m_y != p1.m_y) { return p0.m_y < p1.m_y; }
+				return p0.m_z < p1.m_z;
+			};
+			std::sort(order.begin(), order.end(), less);
+
+			vector< U32 >  welded(nb_vertices);
+			vector< bool > locked_welded;
+			for (size_t i = 0; i < nb_vertices; ++i) {
+				if (0 == i || less(order[i - 1], order[i])) {
+					locked_welded.push_back(false);
+				}
+				else {
+					// Attribute seam
+					locked_welded.back() = true;
+				}
+				welded[order[i]] = static_cast< U32 >(locked_welded.size() - 1);
+			}
+
+			// Edges which are not shared by exactly two triangles.
+			vector< pair< U32, U32 > > edges;
+			edges.reserve(nb_indices);
+			for (size_t i = 0; i < nb_indices; i += 3) {
+				for (size_t j = 0; j < 3; ++j) {
+					const U32 v0 = welded[indices[i + j]];
+					const U32 v1 = welded[indices[i + (j + 1) % 3]];
+					if (v0 != v1) {
+						edges.emplace_back(std::min(v0, v1), std::max(v0, v1));
+					}
+				}
+			}
+			std::sort(edges.begin(), edges.end());
+
+			for (size_t i = 0; i < edges.size();) {
+				size_t j = i + 1;
+				while (j < edges.size() && edges[i] == edges[j]) {
+					++j;
+				}
+				if (2 != j - i) {
+					locked_welded[edges[i].first]  = true;
+					locked_welded[edges[i].second] = true;
+				}
+				i = j;
+			}
+
+			locked.resize(nb_vertices);
+			for (size_t i = 0; i < nb_vertices; ++i) {
+				locked[i] = locked_welded[welded[i]];
+			}
+		}
+	}
+
+	F32 SimplifyMesh(const U32 *indices, size_t nb_indices,
+		const Point3 *positions, size_t nb_vertices,
+		size_t target_nb_indices, F32 max_error, vector< U32 > &result) {
+
+		Assert(0 == nb_indices % 3);
+
+		result.assign(indices, indices + nb_indices);
+		if (nb_indices <= target_nb_indices) {
+			return 0.0f;
+		}
+
+		vector< bool > locked;
+		LockVertices(indices, nb_indices, positions, nb_vertices, locked);
+
+		vector< Quadric > quadrics(nb_vertices);
+		for (size_t i = 0; i < nb_indices; i += 3) {
+			const Quadric quadric = MakePlaneQuadric(positions[indices[i]],
+				positions[indices[i + 1]], positions[indices[i + 2]]);
+			quadrics[indices[i]]     += quadric;
+			quadrics[indices[i + 1]] += quadric;
+			quadrics[indices[i + 2]] += quadric;
+		}
+
+		const F64 max_cost = F64(max_error) * F64(max_error);
+		F64 error = 0.0;
+
+		vector< U32 >          offsets(nb_vertices + 1);
+		vector< U32 >          adjacency;
+		vector< EdgeCollapse > collapses;
+		vector< U32 >          remap(nb_vertices);
+		vector< bool >         collapse_locked(nb_vertices);
+
+		while (target_nb_indices < result.size()) {
+			const size_t nb_triangles = result.size() / 3;
+
+			// Triangles adjacent to each vertex.
+			std::fill(offsets.begin(), offsets.end(), 0u);
+			for (const U32 index : result) {
+				++offsets[index + 1];
+			}
+			std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+			adjacency.resize(result.size());
+			for (size_t i = 0; i < result.size(); ++i) {
+				adjacency[offsets[result[i]]++] = static_cast< U32 >(i / 3);
+			}
+			for (size_t i = nb_vertices; 0 < i; --i) {
+				offsets[i] = offsets[i - 1];
+			}
+			offsets[0] = 0u;
+
+			// Candidate edge collapses in order of increasing cost.
+			collapses.clear();
+			for (size_t i = 0; i < result.size(); i += 3) {
+				for (size_t j = 0; j < 3; ++j) {
+					const U32 v0 = result[i + j];
+					const U32 v1 = result[i + (j + 1) % 3];
+					if (!locked[v0]) {
+						collapses.push_back({ v0, v1,
+							quadrics[v0].Evaluate(positions[v1])
+							+ quadrics[v1].Evaluate(positions[v1]) });
+					}
+					if (!locked[v1]) {
+						collapses.push_back({ v1, v0,
+							quadrics[v0].Evaluate(positions[v0])
+							+ quadrics[v1].Evaluate(positions[v0]) });
+					}
+				}
+			}
+			std::sort(collapses.begin(), collapses.end(),
+				[](const EdgeCollapse &lhs, const EdgeCollapse &rhs) noexcept {
+					return lhs.m_cost < rhs.m_cost;
+				});
+
+			std::iota(remap.begin(), remap.end(), 0u);
+			std::fill(collapse_locked.begin(), collapse_locked.end(), false);
+
+			const size_t target_nb_triangles = target_nb_indices / 3;
+			size_t nb_removed_triangles = 0;
+			bool collapsed = false;
+
+			for (const auto &collapse : collapses) {
+				if (max_cost < collapse.m_cost
+					|| nb_triangles - nb_removed_triangles <= target_nb_triangles) {
+					break;
+				}
+
+				const U32 from = collapse.m_from;
+				const U32 to   = collapse.m_to;
+
+				// The one-ring of each moved vertex stays fixed during a
+				// pass, so that the flip test below remains valid.
+				if (collapse_locked[from]) {
+					continue;
+				}
+
+				// Reject edge collapses which flip a triangle.
+				bool flips = false;
+				size_t nb_collapsed_triangles = 0;
+				for (U32 k = offsets[from]; k < offsets[from + 1] && !flips; ++k) {
+					const U32 * const triangle = &result[3u * adjacency[k]];
+					if (to == triangle[0] || to == triangle[1] || to == triangle[2]) {
+						++nb_collapsed_triangles;
+						continue;
+					}
+
+					Point3 p[3] = { positions[triangle[0]],
+						            positions[triangle[1]],
+						            positions[triangle[2]] };
+					F64 n_before[3];
+					ComputeNormal(p[0], p[1], p[2], n_before);
+					for (size_t j = 0; j < 3; ++j) {
+						if (from == triangle[j]) {
+							p[j] = positions[to];
+						}
+					}
+					F64 n_after[3];
+					ComputeNormal(p[0], p[1], p[2], n_after);
+
+					flips = (n_before[0] * n_after[0] + n_before[1] * n_after[1]
+						   + n_before[2] * n_after[2]) <= 0.0;
+				}
+				if (flips) {
+					continue;
+				}
+
+				for (U32 k = offsets[from]; k < offsets[from + 1]; ++k) {
+					const U32 * const triangle = &result[3u * adjacency[k]];
+					collapse_locked[triangle[0]] = true;
+					collapse_locked[triangle[1]] = true;
+					collapse_locked[triangle[2]] = true;
+				}
+
+				remap[from] = to;
+				quadrics[to] += quadrics[from];
+				error = std::max(error, collapse.m_cost);
+				nb_removed_triangles += nb_collapsed_triangles;
+				collapsed = true;
+			}
+
+			if (!collapsed) {
+				break;
+			}
+
+			// Remove the collapsed triangles.
+			size_t nb_result_indices = 0;
+			for (size_t i = 0; i < result.size(); i += 3) {
+				const U32 v0 = remap[result[i]];
+				const U32 v1 = remap[result[i + 1]];
+				const U32 v2 = remap[result[i + 2]];
+				if (v0 != v1 && v1 != v2 && v0 != v2) {
+					result[nb_result_indices++] = v0;
+					result[nb_result_indices++] = v1;
+					result[nb_result_indices++] = v2;
+				}
+			}
+			result.resize(nb_result_indices);
+		}
+
+		return static_cast< F32 >(std::sqrt(error));
+	}
+}
\ No newline at end of file
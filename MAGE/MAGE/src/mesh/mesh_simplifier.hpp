@@ -0,0 +1,52 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "math\geometry\geometry.hpp"
+#include "utils\collection\collection.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 Simplifies the given triangle list by collapsing edges in order of their
+	 quadric error (Garland and Heckbert, "Surface Simplification Using
+	 Quadric Error Metrics", 1997).
+
+	 Each edge collapse moves a vertex onto one of its neighbors, so that the
+	 simplified triangle list references a subset of the given vertices.
+	 Vertices on borders and on attribute seams (i.e. vertices sharing their
+	 position with other vertices) are never moved.
+
+	 @pre			All indices are smaller than @a nb_vertices.
+	 @pre			@a nb_indices is a multiple of three.
+	 @param[in]		indices
+					A pointer to the indices of the triangle list.
+	 @param[in]		nb_indices
+					The number of indices.
+	 @param[in]		positions
+					A pointer to the vertex positions.
+	 @param[in]		nb_vertices
+					The number of vertices.
+	 @param[in]		target_nb_indices
+					The number of indices to reach.
+	 @param[in]		max_error
+					The maximal object-space error of an edge collapse.
+	 @param[out]	result
+					A reference to a vector which will contain the indices
+					of the simplified triangle list.
+	 @return		The object-space error of the simplified triangle list
+					(i.e. the square root of the maximal quadric error of
+					the applied edge collapses).
+	 */
+	F32 SimplifyMesh(const U32 *indices, size_t nb_indices,
+		const Point3 *positions, size_t nb_vertices,
+		size_t target_nb_indices, F32 max_error, vector< U32 > &result);
+}
\ No newline at end of file
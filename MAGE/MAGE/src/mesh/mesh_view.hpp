@@ -0,0 +1,154 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "utils\io\mapped_file.hpp"
+#include "utils\logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A struct of read-only views of the vertices and indices of a mesh stored
+	 in a memory-mapped file.
+
+	 @tparam		VertexT
+					The vertex type.
+	 */
+	template < typename VertexT >
+	struct MeshView final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a mesh view.
+		 */
+		MeshView() noexcept
+			: m_file(),
+			m_vertices(nullptr),
+			m_nb_vertices(0),
+			m_indices(nullptr),
+			m_nb_indices(0),
+			m_index_size(sizeof(U32)) {}
+
+		/**
+		 Constructs a mesh view from the given mesh view.
+
+		 @param[in]		view
+						A reference to the mesh view to copy.
+		 */
+		MeshView(const MeshView &view) = delete;
+
+		/**
+		 Constructs a mesh view by moving the given mesh view.
+
+		 @param[in]		view
+						A reference to the mesh view to move.
+		 */
+		MeshView(MeshView &&view) = default;
+
+		/**
+		 Destructs this mesh view.
+		 */
+		~MeshView() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given mesh view to this mesh view.
+
+		 @param[in]		view
+						A reference to the mesh view to copy.
+		 @return		A reference to the copy of the given mesh view (i.e.
+						this mesh view).
+		 */
+		MeshView &operator=(const MeshView &view) = delete;
+
+		/**
+		 Moves the given mesh view to this mesh view.
+
+		 @param[in]		view
+						A reference to the mesh view to move.
+		 @return		A reference to the moved mesh view (i.e. this mesh
+						view).
+		 */
+		MeshView &operator=(MeshView &&view) = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this mesh view refers to a memory-mapped file.
+
+		 @return		@c true if this mesh view refers to a memory-mapped
+						file. @c false otherwise.
+		 */
+		bool IsMapped() const noexcept {
+			return nullptr != m_file;
+		}
+
+		/**
+		 Returns the index at the given position of this mesh view.
+
+		 @pre			@a i < @c m_nb_indices.
+		 @param[in]		i
+						The position of the index.
+		 @return		The index at the given position of this mesh view.
+		 */
+		U32 GetIndex(size_t i) const noexcept {
+			Assert(i < m_nb_indices);
+
+			return (sizeof(U16) == m_index_size)
+				? static_cast< const U16 * >(m_indices)[i]
+				: static_cast< const U32 * >(m_indices)[i];
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the memory-mapped file of this mesh view.
+		 */
+		UniquePtr< MappedFile > m_file;
+
+		/**
+		 A pointer to the first vertex of this mesh view.
+		 */
+		const VertexT *m_vertices;
+
+		/**
+		 The number of vertices of this mesh view.
+		 */
+		size_t m_nb_vertices;
+
+		/**
+		 A pointer to the first index of this mesh view.
+		 */
+		const void *m_indices;
+
+		/**
+		 The number of indices of this mesh view.
+		 */
+		size_t m_nb_indices;
+
+		/**
+		 The size in bytes of an index of this mesh view (2 or 4).
+		 */
+		size_t m_index_size;
+	};
+}
\ No newline at end of file
@@ -88,4 +88,22 @@ namespace mage {
 
 	static_assert(sizeof(VertexPositionTextureTexture) == 28, 
 		"Vertex struct/layout mismatch");
+
+	const D3D11_INPUT_ELEMENT_DESC CompressedVertexPositionNormalTexture::s_input_element_desc[] = {
+		{ MAGE_VERTEX_SEMANTIC_NAME_POSITION, 0, DXGI_FORMAT_R32G32B32_FLOAT,    0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ MAGE_VERTEX_SEMANTIC_NAME_NORMAL,	  0, DXGI_FORMAT_R16G16_SNORM,       0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ MAGE_VERTEX_SEMANTIC_NAME_TEXTURE,  0, DXGI_FORMAT_R16G16_FLOAT,       0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 }
+	};
+
+	static_assert(sizeof(CompressedVertexPositionNormalTexture) == 20, 
+		"Vertex struct/layout mismatch");
+
+	const D3D11_INPUT_ELEMENT_DESC QuantizedVertexPositionNormalTexture::s_input_element_desc[] = {
+		{ MAGE_VERTEX_SEMANTIC_NAME_POSITION, 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ MAGE_VERTEX_SEMANTIC_NAME_NORMAL,	  0, DXGI_FORMAT_R16G16_SNORM,       0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ MAGE_VERTEX_SEMANTIC_NAME_TEXTURE,  0, DXGI_FORMAT_R16G16_FLOAT,       0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 }
+	};
+
+	static_assert(sizeof(QuantizedVertexPositionNormalTexture) == 16, 
+		"Vertex struct/layout mismatch");
 }
\ No newline at end of file
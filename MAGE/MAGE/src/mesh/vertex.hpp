@@ -1359,4 +1359,208 @@ namespace mage {
 		 */
 		static const D3D11_INPUT_ELEMENT_DESC s_input_element_desc[s_nb_input_elements];
 	};
+
+	/**
+	 A struct of compressed vertices containing position and normal 
+	 coordinates and texture coordinates.
+	 */
+	struct CompressedVertexPositionNormalTexture final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a vertex.
+		 */
+		CompressedVertexPositionNormalTexture() = default;
+
+		/**
+		 Constructs a vertex from the given vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to copy.
+		 */
+		CompressedVertexPositionNormalTexture(
+			const CompressedVertexPositionNormalTexture &vertex) = default;
+
+		/**
+		 Constructs a vertex by moving the given vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to move.
+		 */
+		CompressedVertexPositionNormalTexture(
+			CompressedVertexPositionNormalTexture &&vertex) = default;
+
+		/**
+		 Destructs this vertex.
+		 */
+		~CompressedVertexPositionNormalTexture() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given vertex to this vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to copy.
+		 @return		A reference to the copy of the given vertex (i.e. this 
+						vertex).
+		 */
+		CompressedVertexPositionNormalTexture &operator=(
+			const CompressedVertexPositionNormalTexture &vertex) = default;
+
+		/**
+		 Moves the given vertex to this vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to move.
+		 @return		A reference to the moved vertex (i.e. this vertex).
+		 */
+		CompressedVertexPositionNormalTexture &operator=(
+			CompressedVertexPositionNormalTexture &&vertex) = default;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The position of this vertex.
+		 */
+		Point3 p;
+
+		/**
+		 The octahedral encoded (SNORM) normal of this vertex.
+		 */
+		S16x2 n;
+
+		/**
+		 The (half-precision floating point) texture coordinates of this 
+		 vertex.
+		 */
+		U16x2 tex;
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of elements in the input element descriptor of a vertex.
+		 */
+		static const size_t s_nb_input_elements = 3;
+
+		/**
+		 The input element descriptor of a vertex.
+		 */
+		static const D3D11_INPUT_ELEMENT_DESC s_input_element_desc[s_nb_input_elements];
+	};
+
+	/**
+	 A struct of quantized vertices containing position and normal 
+	 coordinates and texture coordinates.
+
+	 The position is quantized relative to the AABB of the mesh and needs to 
+	 be dequantized with the mesh buffer of the mesh.
+	 */
+	struct QuantizedVertexPositionNormalTexture final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a vertex.
+		 */
+		QuantizedVertexPositionNormalTexture() = default;
+
+		/**
+		 Constructs a vertex from the given vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to copy.
+		 */
+		QuantizedVertexPositionNormalTexture(
+			const QuantizedVertexPositionNormalTexture &vertex) = default;
+
+		/**
+		 Constructs a vertex by moving the given vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to move.
+		 */
+		QuantizedVertexPositionNormalTexture(
+			QuantizedVertexPositionNormalTexture &&vertex) = default;
+
+		/**
+		 Destructs this vertex.
+		 */
+		~QuantizedVertexPositionNormalTexture() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given vertex to this vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to copy.
+		 @return		A reference to the copy of the given vertex (i.e. this 
+						vertex).
+		 */
+		QuantizedVertexPositionNormalTexture &operator=(
+			const QuantizedVertexPositionNormalTexture &vertex) = default;
+
+		/**
+		 Moves the given vertex to this vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to move.
+		 @return		A reference to the moved vertex (i.e. this vertex).
+		 */
+		QuantizedVertexPositionNormalTexture &operator=(
+			QuantizedVertexPositionNormalTexture &&vertex) = default;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The (UNORM) quantized position of this vertex. The fourth component 
+		 is unused.
+		 */
+		U16x4 p;
+
+		/**
+		 The octahedral encoded (SNORM) normal of this vertex.
+		 */
+		S16x2 n;
+
+		/**
+		 The (half-precision floating point) texture coordinates of this 
+		 vertex.
+		 */
+		U16x2 tex;
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of elements in the input element descriptor of a vertex.
+		 */
+		static const size_t s_nb_input_elements = 3;
+
+		/**
+		 The input element descriptor of a vertex.
+		 */
+		static const D3D11_INPUT_ELEMENT_DESC s_input_element_desc[s_nb_input_elements];
+	};
 }
\ No newline at end of file
@@ -0,0 +1,279 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "mesh\vertex_compression.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <DirectXPackedVector.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 Returns the sign of the given value treating zero as positive.
+
+		 @param[in]		v
+						The value.
+		 @return		-1 if @a v is negative. 1 otherwise.
+		 */
+		inline F32 SignNotZero(F32 v) noexcept {
+			return (0.0f <= v) ? 1.0f : -1.0f;
+		}
+
+		/**
+		 Converts the given SNORM16 value to a floating point value in the 
+		 same way as the input assembler.
+
+		 @param[in]		v
+						The SNORM16 value.
+		 @return		The floating point value in the [-1,1] range.
+		 */
+		inline F32 SNORM16ToF32(S16 v) noexcept {
+			return std::max(v / 32767.0f, -1.0f);
+		}
+
+		/**
+		 Decodes the given octahedral encoded unit vector.
+
+		 @param[in]		x
+						The first octahedral coordinate in the [-1,1] range.
+		 @param[in]		y
+						The second octahedral coordinate in the [-1,1] range.
+		 @return		The decoded unit vector.
+		 */
+		const F32x3 DecodeOctahedralUnitVector(F32 x, F32 y) noexcept {
+			F32x3 v(x, y, 1.0f - std::abs(x) - std::abs(y));
+			if (v.m_z < 0.0f) {
+				v.m_x = (1.0f - std::abs(y)) * SignNotZero(x);
+				v.m_y = (1.0f - std::abs(x)) * SignNotZero(y);
+			}
+
+			const F32 inv_length = 1.0f / std::sqrt(
+				v.m_x * v.m_x + v.m_y * v.m_y + v.m_z * v.m_z);
+			return F32x3(v.m_x * inv_length, 
+				         v.m_y * inv_length, 
+				         v.m_z * inv_length);
+		}
+
+		/**
+		 Encodes the given unit vector as an octahedral encoded SNORM16 
+		 vector.
+
+		 Of the four SNORM16 roundings of the octahedral coordinates, the one 
+		 which decodes closest to the given unit vector is chosen (Cigolle et 
+		 al., "A Survey of Efficient Representations for Independent Unit 
+		 Vectors", 2014).
+
+		 @param[in]		n
+						A reference to the unit vector.
+		 @param[out]	cos_error
+						The cosine of the angle between the given and the 
+						decoded unit vector.
+		 @return		The octahedral encoded SNORM16 vector.
+		 */
+		const S16x2 EncodeOctahedralUnitVector(
+			const Normal3 &n, F32 &cos_error) noexcept {
+
+			const F32 l1 = std::abs(n.m_x) + std::abs(n.m_y) + std::abs(n.m_z);
+			if (0.0f == l1) {
+				cos_error = 1.0f;
+				return S16x2(S16(0), S16(0));
+			}
+
+			F32 x = n.m_x / l1;
+			F32 y = n.m_y / l1;
+			if (n.m_z < 0.0f) {
+				const F32 ox = x;
+				x = (1.0f - std::abs(y))  * SignNotZero(ox);
+				y = (1.0f - std::abs(ox)) * SignNotZero(y);
+			}
+
+			const F32 inv_length = 1.0f / std::sqrt(
+				n.m_x * n.m_x + n.m_y * n.m_y + n.m_z * n.m_z);
+
+			const F32 fx = std::floor(std::clamp(x, -1.0f, 1.0f) * 32767.0f);
+			const F32 fy = std::floor(std::clamp(y, -1.0f, 1.0f) * 32767.0f);
+
+			S16x2 best(S16(0), S16(0));
+			cos_error = -std::numeric_limits< F32 >::infinity();
+			for (U32 i = 0u; i < 4u; ++i) {
+				const F32 cx = std::clamp(fx + (i & 1u), -32767.0f, 32767.0f);
+				const F32 cy = std::clamp(fy + (i >> 1u), -32767.0f, 32767.0f);
+				const S16x2 candidate(static_cast< S16 >(cx), 
+					                  static_cast< S16 >(cy));
+				
+				const F32x3 v = DecodeOctahedralUnitVector(
+					SNORM16ToF32(candidate.m_x), SNORM16ToF32(candidate.m_y));
+				const F32 cos_angle = (v.m_x * n.m_x 
+					                 + v.m_y * n.m_y 
+					                 + v.m_z * n.m_z) * inv_length;
+				if (cos_error < cos_angle) {
+					cos_error = cos_angle;
+					best      = candidate;
+				}
+			}
+
+			return best;
+		}
+
+		/**
+		 Encodes the given texture coordinates as half-precision floating 
+		 point values.
+
+		 @param[in]		tex
+						A reference to the texture coordinates.
+		 @param[out]	error
+						The maximal absolute difference between the given and 
+						the decoded texture coordinates.
+		 @return		The half-precision floating point texture coordinates.
+		 */
+		const U16x2 EncodeTexture(const UV &tex, F32 &error) noexcept {
+			using DirectX::PackedVector::XMConvertFloatToHalf;
+			using DirectX::PackedVector::XMConvertHalfToFloat;
+
+			const U16x2 encoded(XMConvertFloatToHalf(tex.m_x), 
+				                XMConvertFloatToHalf(tex.m_y));
+			error = std::max(
+				std::abs(XMConvertHalfToFloat(encoded.m_x) - tex.m_x),
+				std::abs(XMConvertHalfToFloat(encoded.m_y) - tex.m_y));
+			
+			return encoded;
+		}
+
+		/**
+		 Compresses the normal and texture coordinates of the given vertex.
+
+		 @tparam		VertexT
+						The compressed vertex type.
+		 @param[in]		vertex
+						A reference to the vertex.
+		 @param[out]	output
+						A reference to the compressed vertex.
+		 @param[in,out]	statistics
+						A reference to the vertex compression statistics.
+		 */
+		template< typename VertexT >
+		void CompressNormalTexture(const VertexPositionNormalTexture &vertex,
+			VertexT &output, VertexCompressionStatistics &statistics) noexcept {
+
+			F32 cos_error;
+			output.n = EncodeOctahedralUnitVector(vertex.n, cos_error);
+			
+			F32 texture_error;
+			output.tex = EncodeTexture(vertex.tex, texture_error);
+
+			const F32 normal_error = XMConvertToDegrees(
+				std::acos(std::clamp(cos_error, -1.0f, 1.0f)));
+			statistics.m_max_normal_error 
+				= std::max(statistics.m_max_normal_error, normal_error);
+			statistics.m_max_texture_error 
+				= std::max(statistics.m_max_texture_error, texture_error);
+		}
+	}
+
+	const VertexCompressionStatistics CompressVertices(
+		const VertexPositionNormalTexture *vertices, size_t nb_vertices,
+		vector< CompressedVertexPositionNormalTexture > &output, 
+		MeshBuffer &buffer) {
+
+		VertexCompressionStatistics statistics;
+
+		output.resize(nb_vertices);
+		for (size_t i = 0; i < nb_vertices; ++i) {
+			output[i].p = vertices[i].p;
+			CompressNormalTexture(vertices[i], output[i], statistics);
+		}
+
+		buffer = MeshBuffer();
+		buffer.m_octahedral_normals = 1u;
+
+		return statistics;
+	}
+
+	const VertexCompressionStatistics QuantizeVertices(
+		const VertexPositionNormalTexture *vertices, size_t nb_vertices,
+		vector< QuantizedVertexPositionNormalTexture > &output, 
+		MeshBuffer &buffer) {
+
+		VertexCompressionStatistics statistics;
+
+		F32x3 p_min( std::numeric_limits< F32 >::infinity());
+		F32x3 p_max(-std::numeric_limits< F32 >::infinity());
+		for (size_t i = 0; i < nb_vertices; ++i) {
+			const Point3 &p = vertices[i].p;
+			p_min = F32x3(std::min(p_min.m_x, p.m_x), 
+				          std::min(p_min.m_y, p.m_y), 
+				          std::min(p_min.m_z, p.m_z));
+			p_max = F32x3(std::max(p_max.m_x, p.m_x), 
+				          std::max(p_max.m_y, p.m_y), 
+				          std::max(p_max.m_z, p.m_z));
+		}
+		if (0 == nb_vertices) {
+			p_min = F32x3(0.0f);
+			p_max = F32x3(0.0f);
+		}
+
+		const F32 extent[] = {
+			p_max.m_x - p_min.m_x,
+			p_max.m_y - p_min.m_y,
+			p_max.m_z - p_min.m_z
+		};
+		const F32 offset[] = {
+			p_min.m_x,
+			p_min.m_y,
+			p_min.m_z
+		};
+
+		output.resize(nb_vertices);
+		for (size_t i = 0; i < nb_vertices; ++i) {
+			const Point3 &p = vertices[i].p;
+			const F32 coordinates[] = { p.m_x, p.m_y, p.m_z };
+
+			U16 quantized[4] = {};
+			F32 sqr_error    = 0.0f;
+			for (size_t j = 0; j < _countof(coordinates); ++j) {
+				const F32 t = (0.0f == extent[j]) ? 0.0f
+					: (coordinates[j] - offset[j]) / extent[j];
+				quantized[j] = static_cast< U16 >(
+					std::lround(std::clamp(t, 0.0f, 1.0f) * 65535.0f));
+				
+				const F32 decoded = quantized[j] / 65535.0f * extent[j] 
+					              + offset[j];
+				sqr_error += (decoded - coordinates[j]) 
+					       * (decoded - coordinates[j]);
+			}
+
+			output[i].p = U16x4(quantized[0], quantized[1], quantized[2], 
+				                quantized[3]);
+			CompressNormalTexture(vertices[i], output[i], statistics);
+
+			statistics.m_max_position_error 
+				= std::max(statistics.m_max_position_error, 
+					       std::sqrt(sqr_error));
+		}
+
+		buffer.m_position_scale     = F32x3(extent[0], extent[1], extent[2]);
+		buffer.m_octahedral_normals = 1u;
+		buffer.m_position_offset    = p_min;
+		buffer.m_padding            = 0u;
+
+		return statistics;
+	}
+}
\ No newline at end of file
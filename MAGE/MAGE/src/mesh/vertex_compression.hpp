@@ -0,0 +1,107 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "mesh\vertex.hpp"
+#include "rendering\buffer\mesh_buffer.hpp"
+#include "utils\collection\collection.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 An enumeration of the different vertex compressions.
+
+	 This contains:
+	 @c None (F32 positions, normals and texture coordinates),
+	 @c NormalTexture (octahedral SNORM16 normals and F16 texture 
+	 coordinates), and
+	 @c PositionNormalTexture (additionally UNORM16 positions relative to 
+	 the AABB of the mesh).
+	 */
+	enum struct VertexCompression : U8 {
+		None = 0,
+		NormalTexture,
+		PositionNormalTexture
+	};
+
+	/**
+	 A struct of vertex compression statistics.
+
+	 The errors are measured by decoding the compressed vertices in the same 
+	 way as the shaders.
+	 */
+	struct VertexCompressionStatistics final {
+
+	public:
+
+		/**
+		 The maximal distance between an original and decoded position.
+		 */
+		F32 m_max_position_error = 0.0f;
+
+		/**
+		 The maximal angle (in degrees) between an original and decoded 
+		 normal.
+		 */
+		F32 m_max_normal_error = 0.0f;
+
+		/**
+		 The maximal absolute difference between an original and decoded 
+		 texture coordinate.
+		 */
+		F32 m_max_texture_error = 0.0f;
+	};
+
+	/**
+	 Compresses the normals and texture coordinates of the given vertices.
+
+	 @pre			@a vertices points to an array containing at least 
+					@a nb_vertices elements.
+	 @param[in]		vertices
+					A pointer to the vertices.
+	 @param[in]		nb_vertices
+					The number of vertices.
+	 @param[out]	output
+					A reference to a vector containing the compressed 
+					vertices.
+	 @param[out]	buffer
+					A reference to the mesh buffer for decoding the compressed 
+					vertices.
+	 @return		The vertex compression statistics.
+	 */
+	const VertexCompressionStatistics CompressVertices(
+		const VertexPositionNormalTexture *vertices, size_t nb_vertices,
+		vector< CompressedVertexPositionNormalTexture > &output, 
+		MeshBuffer &buffer);
+
+	/**
+	 Compresses the normals and texture coordinates, and quantizes the 
+	 positions relative to the AABB of the given vertices.
+
+	 @pre			@a vertices points to an array containing at least 
+					@a nb_vertices elements.
+	 @param[in]		vertices
+					A pointer to the vertices.
+	 @param[in]		nb_vertices
+					The number of vertices.
+	 @param[out]	output
+					A reference to a vector containing the quantized 
+					vertices.
+	 @param[out]	buffer
+					A reference to the mesh buffer for decoding the quantized 
+					vertices.
+	 @return		The vertex compression statistics.
+	 */
+	const VertexCompressionStatistics QuantizeVertices(
+		const VertexPositionNormalTexture *vertices, size_t nb_vertices,
+		vector< QuantizedVertexPositionNormalTexture > &output, 
+		MeshBuffer &buffer);
+}
\ No newline at end of file
@@ -13,20 +13,35 @@
 namespace mage {
 
 	Model::Model(SharedPtr< const Mesh > mesh, 
-		size_t start_index, size_t nb_indices,
-		AABB aabb, BS bs)
+		size_t start_index, size_t nb_indices, size_t base_vertex,
+		size_t first_cluster, size_t nb_clusters, AABB aabb, BS bs,
+		const vector< ModelLOD > &lods)
 		: m_mesh(std::move(mesh)), 
-		m_start_index(start_index), 
-		m_nb_indices(nb_indices),
+		m_base_vertex(base_vertex),
+		m_lods(),
+		m_lod(0),
 		m_aabb(std::move(aabb)), 
 		m_bs(std::move(bs)), 
 		m_material(MakeUnique< Material >()),
-		m_light_occlusion(true) {}
+		m_light_occlusion(true) {
+
+		ModelLOD lod;
+		lod.m_start_index   = static_cast< U32 >(start_index);
+		lod.m_nb_indices    = static_cast< U32 >(nb_indices);
+		lod.m_first_cluster = static_cast< U32 >(first_cluster);
+		lod.m_nb_clusters   = static_cast< U32 >(nb_clusters);
+		lod.m_error         = 0.0f;
+
+		m_lods.reserve(1 + lods.size());
+		m_lods.push_back(lod);
+		m_lods.insert(m_lods.end(), lods.cbegin(), lods.cend());
+	}
 
 	Model::Model(const Model &model)
 		: m_mesh(model.m_mesh), 
-		m_start_index(model.m_start_index), 
-		m_nb_indices(model.m_nb_indices),
+		m_base_vertex(model.m_base_vertex),
+		m_lods(model.m_lods),
+		m_lod(model.m_lod),
 		m_aabb(model.m_aabb), 
 		m_bs(model.m_bs),
 		m_material(MakeUnique< Material >(*model.m_material)),
@@ -6,6 +6,7 @@
 #pragma region
 
 #include "mesh\static_mesh.hpp"
+#include "model\model_lod.hpp"
 #include "math\geometry\bounding_volume.hpp"
 #include "material\material.hpp"
 
@@ -37,14 +38,23 @@ namespace mage {
 						The start index in the mesh.
 		 @param[in]		nb_indices
 						The number of indices in the mesh.
+		 @param[in]		base_vertex
+						The base vertex in the mesh.
+		 @param[in]		first_cluster
+						The index of the first mesh cluster in the mesh.
+		 @param[in]		nb_clusters
+						The number of mesh clusters in the mesh.
 		 @param[in]		aabb
 						The AABB.
 		 @param[in]		bs
 						The BS.
+		 @param[in]		lods
+						The coarser LODs ordered from fine to coarse.
 		 */
 		explicit Model(SharedPtr< const Mesh > mesh, 
-			size_t start_index, size_t nb_indices, 
-			AABB aabb, BS bs);
+			size_t start_index, size_t nb_indices, size_t base_vertex, 
+			size_t first_cluster, size_t nb_clusters, AABB aabb, BS bs,
+			const vector< ModelLOD > &lods = {});
 
 		/**
 		 Constructs a model from the given model.
@@ -126,22 +136,102 @@ namespace mage {
 		}
 
 		/**
-		 Returns the start index of this model in the mesh of this model.
+		 Returns the start index of the selected LOD of this model in the 
+		 mesh of this model.
 
-		 @return		The start index of this model in the mesh of this model.
+		 @return		The start index of the selected LOD of this model in 
+						the mesh of this model.
 		 */
 		size_t GetStartIndex() const noexcept {
-			return m_start_index;
+			return m_lods[m_lod].m_start_index;
 		}
 
 		/**
-		 Returns the number of indices of this model in the mesh of this model.
+		 Returns the number of indices of the selected LOD of this model in 
+		 the mesh of this model.
 
-		 @return		The number of indices of this model in the mesh of this 
-						model.
+		 @return		The number of indices of the selected LOD of this 
+						model in the mesh of this model.
 		 */
 		size_t GetNumberOfIndices() const noexcept {
-			return m_nb_indices;
+			return m_lods[m_lod].m_nb_indices;
+		}
+
+		/**
+		 Returns the base vertex of this model in the mesh of this model.
+
+		 @return		The vertex added to each index of this model before 
+						reading a vertex from the mesh of this model.
+		 */
+		size_t GetBaseVertex() const noexcept {
+			return m_base_vertex;
+		}
+
+		/**
+		 Returns the mesh clusters of the selected LOD of this model.
+
+		 @return		A pointer to the mesh clusters of the selected LOD of 
+						this model. The start indices of the mesh clusters are 
+						relative to the mesh of this model.
+		 */
+		const MeshCluster *GetClusters() const noexcept {
+			return m_mesh->GetClusters() + m_lods[m_lod].m_first_cluster;
+		}
+
+		/**
+		 Returns the number of mesh clusters of the selected LOD of this 
+		 model.
+
+		 @return		The number of mesh clusters of the selected LOD of 
+						this model.
+		 */
+		size_t GetNumberOfClusters() const noexcept {
+			return m_lods[m_lod].m_nb_clusters;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: LOD
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of LODs of this model.
+
+		 @return		The number of LODs (including the full detail LOD) of 
+						this model.
+		 */
+		size_t GetNumberOfLODs() const noexcept {
+			return m_lods.size();
+		}
+
+		/**
+		 Returns the selected LOD of this model.
+
+		 @return		The index of the selected LOD of this model (i.e. 0 
+						for the full detail LOD).
+		 */
+		size_t GetLOD() const noexcept {
+			return m_lod;
+		}
+
+		/**
+		 Selects the LOD of this model for the given error scale.
+
+		 @param[in]		error_scale
+						The scale converting object-space errors to fractions 
+						of the height of the viewport.
+		 */
+		void SelectLOD(F32 error_scale) const noexcept {
+			m_lod = SelectModelLOD(m_lods.data(), m_lods.size(), 
+				                   m_lod, error_scale);
+		}
+
+		/**
+		 Returns the mesh of this model.
+
+		 @return		A pointer to the mesh of this model.
+		 */
+		const Mesh *GetMesh() const noexcept {
+			return m_mesh.get();
 		}
 
 		/**
@@ -178,7 +268,47 @@ namespace mage {
 						A pointer to the device context.
 		 */
 		void Draw(ID3D11DeviceContext4 *device_context) const noexcept {
-			m_mesh->Draw(device_context, m_start_index, m_nb_indices);
+			m_mesh->Draw(device_context, 
+				GetStartIndex(), GetNumberOfIndices(), m_base_vertex);
+		}
+
+		/**
+		 Draws multiple instances of this model.
+
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		nb_instances
+						The number of instances.
+		 */
+		void DrawInstanced(ID3D11DeviceContext4 *device_context, 
+			size_t nb_instances) const noexcept {
+
+			m_mesh->DrawInstanced(device_context, 
+				GetStartIndex(), GetNumberOfIndices(), nb_instances, 
+				m_base_vertex);
+		}
+
+		/**
+		 Draws multiple instances of the given index range of this model.
+
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			@a range is contained in the index range of this 
+						model.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		range
+						A reference to the index range in the mesh of this 
+						model.
+		 @param[in]		nb_instances
+						The number of instances.
+		 */
+		void DrawInstanced(ID3D11DeviceContext4 *device_context, 
+			const IndexRange &range, size_t nb_instances) const noexcept {
+
+			m_mesh->DrawInstanced(device_context, 
+				range.m_start_index, range.m_nb_indices, nb_instances, 
+				m_base_vertex);
 		}
 
 		//---------------------------------------------------------------------
@@ -272,14 +402,22 @@ namespace mage {
 		SharedPtr< const Mesh > m_mesh;
 
 		/**
-		 The start index of this model in the mesh of this model.
+		 The base vertex of this model in the mesh of this model.
+		 */
+		const size_t m_base_vertex;
+
+		/**
+		 A vector containing the LODs of this model ordered from fine to 
+		 coarse. The first LOD is the full detail LOD.
 		 */
-		const size_t m_start_index;
+		vector< ModelLOD > m_lods;
 
 		/**
-		 The number of indices of this model in the mesh of this model.
+		 The index of the selected LOD of this model. The selected LOD is 
+		 rendering state which is selected once per frame for the primary 
+		 camera and kept across frames for hysteresis.
 		 */
-		const size_t m_nb_indices;
+		mutable size_t m_lod;
 
 		/**
 		 The AABB of this model.
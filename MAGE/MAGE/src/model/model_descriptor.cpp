@@ -4,6 +4,7 @@
 #pragma region
 
 #include "model\model_descriptor.hpp"
+#include "utils\logging\error.hpp"
 
 #pragma endregion
 
@@ -39,4 +40,17 @@ namespace mage {
 		
 		return nullptr;
 	}
+
+	void ModelDescriptor::LogVertexCompression(size_t vertex_size, 
+		const VertexCompressionStatistics &statistics) const noexcept {
+
+		Info("%ls: compressed vertices from %zu to %zu bytes "
+			 "(max position error: %f, max normal error: %f degrees, "
+			 "max texture coordinate error: %f).",
+			 GetFilename().c_str(), 
+			 sizeof(VertexPositionNormalTexture), vertex_size,
+			 statistics.m_max_position_error, 
+			 statistics.m_max_normal_error,
+			 statistics.m_max_texture_error);
+	}
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include "loaders\model_loader.hpp"
 #include "mesh\static_mesh.hpp"
+#include "mesh\vertex_compression.hpp"
 
 #pragma endregion
 
@@ -177,6 +178,22 @@ namespace mage {
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Logs the given vertex compression statistics of the mesh of this 
+		 model descriptor.
+
+		 @param[in]		vertex_size
+						The size of the compressed vertices in bytes.
+		 @param[in]		statistics
+						A reference to the vertex compression statistics.
+		 */
+		void LogVertexCompression(size_t vertex_size, 
+			const VertexCompressionStatistics &statistics) const noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
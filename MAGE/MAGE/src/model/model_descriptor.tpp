@@ -1,5 +1,14 @@
 #pragma once
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <type_traits>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -26,8 +35,114 @@ namespace mage {
 			ExportModelToFile(mdl_fname, buffer);
 		}
 
-		m_mesh = MakeShared< StaticMesh >(device, 
-			buffer.m_vertex_buffer, buffer.m_index_buffer, DXGI_FORMAT_R32_UINT);
+		const MeshView< VertexT > &mesh_view = buffer.m_mesh_view;
+		
+		const VertexT *vertices;
+		size_t nb_vertices;
+		if (mesh_view.IsMapped()) {
+			// Upload directly from the mapped MSH file.
+			vertices    = mesh_view.m_vertices;
+			nb_vertices = mesh_view.m_nb_vertices;
+		}
+		else {
+			vertices    = buffer.m_vertex_buffer.data();
+			nb_vertices = buffer.m_vertex_buffer.size();
+		}
+
+		const auto create_mesh = [device, &buffer, &mesh_view](
+			const auto *mesh_vertices, size_t nb_mesh_vertices) {
+
+			if (!mesh_view.IsMapped()) {
+				if (buffer.HasU16Indices()) {
+					const vector< U16 > indices = buffer.GetU16IndexBuffer();
+					return MakeShared< StaticMesh >(device, 
+						mesh_vertices, nb_mesh_vertices, 
+						indices.data(), indices.size(), 
+						DXGI_FORMAT_R16_UINT);
+				}
+				
+				return MakeShared< StaticMesh >(device, 
+					mesh_vertices, nb_mesh_vertices, 
+					buffer.m_index_buffer.data(), buffer.m_index_buffer.size(), 
+					DXGI_FORMAT_R32_UINT);
+			}
+			
+			if (sizeof(U16) == mesh_view.m_index_size) {
+				// Upload directly from the mapped MSH file.
+				return MakeShared< StaticMesh >(device, 
+					mesh_vertices, nb_mesh_vertices, 
+					static_cast< const U16 * >(mesh_view.m_indices), 
+					mesh_view.m_nb_indices, DXGI_FORMAT_R16_UINT);
+			}
+			
+			// Upload directly from the mapped MSH file.
+			return MakeShared< StaticMesh >(device, 
+				mesh_vertices, nb_mesh_vertices, 
+				static_cast< const U32 * >(mesh_view.m_indices), 
+				mesh_view.m_nb_indices, DXGI_FORMAT_R32_UINT);
+		};
+
+		SharedPtr< StaticMesh > mesh;
+		
+		if constexpr (std::is_same_v< VertexT, VertexPositionNormalTexture >) {
+			// The vertices are decoded by the vertex shaders of all models.
+			// Uncompressed vertices are decoded with an identity mesh buffer.
+			MeshBuffer decoding;
+
+			switch (desc.GetVertexCompression()) {
+			
+			case VertexCompression::NormalTexture: {
+				using CompressedVertexT = CompressedVertexPositionNormalTexture;
+
+				vector< CompressedVertexT > compressed_vertices;
+				const VertexCompressionStatistics statistics 
+					= CompressVertices(vertices, nb_vertices, 
+						               compressed_vertices, decoding);
+				
+				mesh = create_mesh(compressed_vertices.data(), 
+					               compressed_vertices.size());
+				mesh->SetupVertexDecoding(device, 
+					CompressedVertexT::s_input_element_desc,
+					CompressedVertexT::s_nb_input_elements, decoding);
+				
+				LogVertexCompression(sizeof(CompressedVertexT), statistics);
+				break;
+			}
+			
+			case VertexCompression::PositionNormalTexture: {
+				using QuantizedVertexT = QuantizedVertexPositionNormalTexture;
+
+				vector< QuantizedVertexT > quantized_vertices;
+				const VertexCompressionStatistics statistics 
+					= QuantizeVertices(vertices, nb_vertices, 
+						               quantized_vertices, decoding);
+				
+				mesh = create_mesh(quantized_vertices.data(), 
+					               quantized_vertices.size());
+				mesh->SetupVertexDecoding(device, 
+					QuantizedVertexT::s_input_element_desc,
+					QuantizedVertexT::s_nb_input_elements, decoding);
+				
+				LogVertexCompression(sizeof(QuantizedVertexT), statistics);
+				break;
+			}
+			
+			default: {
+				mesh = create_mesh(vertices, nb_vertices);
+				mesh->SetupVertexDecoding(device, 
+					VertexT::s_input_element_desc,
+					VertexT::s_nb_input_elements, decoding);
+				break;
+			}
+			}
+		}
+		else {
+			mesh = create_mesh(vertices, nb_vertices);
+		}
+
+		mesh->SetClusters(std::move(buffer.m_cluster_buffer));
+		m_mesh = std::move(mesh);
+
 		m_materials   = std::move(buffer.m_material_buffer);
 		m_model_parts = std::move(buffer.m_model_parts);
 	}
@@ -0,0 +1,113 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "utils\type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The maximal projected error of a model LOD as a fraction of the height
+	 of the viewport (i.e. about one pixel at a resolution of 1080p).
+	 */
+	constexpr F32 g_model_lod_error_threshold = 1.0f / 1080.0f;
+
+	/**
+	 The fraction of the projected error threshold which a coarser model LOD
+	 must additionally stay below before it is selected. This hysteresis
+	 avoids popping between model LODs at the threshold distance.
+	 */
+	constexpr F32 g_model_lod_hysteresis = 0.25f;
+
+	/**
+	 A struct of model LODs (i.e. index ranges of simplified versions of a
+	 model which reference the vertices of that model).
+	 */
+	struct ModelLOD final {
+
+	public:
+
+		/**
+		 The start index of this model LOD in the mesh.
+		 */
+		U32 m_start_index;
+
+		/**
+		 The number of indices of this model LOD in the mesh.
+		 */
+		U32 m_nb_indices;
+
+		/**
+		 The index of the first mesh cluster of this model LOD in the mesh
+		 clusters of the mesh.
+		 */
+		U32 m_first_cluster;
+
+		/**
+		 The number of mesh clusters of this model LOD.
+		 */
+		U32 m_nb_clusters;
+
+		/**
+		 The object-space geometric error of this model LOD with regard to
+		 the full detail model.
+		 */
+		F32 m_error;
+	};
+
+	static_assert(20 == sizeof(ModelLOD), "Model LOD layout mismatch");
+
+	/**
+	 Selects a model LOD of the given model LODs.
+
+	 The coarsest model LOD whose projected error does not exceed
+	 @c g_model_lod_error_threshold is selected. The current model LOD is
+	 kept as long as its projected error does not exceed the threshold and
+	 no coarser model LOD is below the threshold reduced by
+	 @c g_model_lod_hysteresis.
+
+	 @pre			@a nb_lods is not equal to zero.
+	 @pre			@a current is smaller than @a nb_lods.
+	 @pre			The errors of the given model LODs are non-decreasing.
+	 @param[in]		lods
+					A pointer to the model LODs ordered from fine to coarse.
+	 @param[in]		nb_lods
+					The number of model LODs.
+	 @param[in]		current
+					The index of the current model LOD.
+	 @param[in]		error_scale
+					The scale converting object-space errors to fractions
+					of the height of the viewport.
+	 @return		The index of the selected model LOD.
+	 */
+	inline size_t SelectModelLOD(const ModelLOD *lods, size_t nb_lods,
+		size_t current, F32 error_scale) noexcept {
+
+		const auto select = [lods, nb_lods, error_scale](F32 threshold) {
+			size_t lod = 0;
+			while (lod + 1 < nb_lods
+				   && lods[lod + 1].m_error * error_scale <= threshold) {
+				++lod;
+			}
+			return lod;
+		};
+
+		// Refine as soon as the current model LOD exceeds the threshold.
+		if (g_model_lod_error_threshold < lods[current].m_error * error_scale) {
+			return select(g_model_lod_error_threshold);
+		}
+
+		// Coarsen only once the coarser model LOD is well below the threshold.
+		const size_t coarser = select(g_model_lod_error_threshold
+			                          * (1.0f - g_model_lod_hysteresis));
+		return (current < coarser) ? coarser : current;
+	}
+}
\ No newline at end of file
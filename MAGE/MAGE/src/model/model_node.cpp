@@ -8,6 +8,17 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -34,4 +45,37 @@ namespace mage {
 	UniquePtr< Node > ModelNode::CloneImplementation() const {
 		return MakeUnique< ModelNode >(*this);
 	}
+
+	void XM_CALLCONV ModelNode::SelectLOD(FXMMATRIX object_to_view, 
+		CXMMATRIX view_to_projection) const noexcept {
+
+		const Model * const model = m_model.get();
+		if (1 >= model->GetNumberOfLODs()) {
+			return;
+		}
+
+		// The largest scale factor of the object-to-view transformation.
+		const F32 scale = std::sqrt(std::max({
+			XMVectorGetX(XMVector3LengthSq(object_to_view.r[0])),
+			XMVectorGetX(XMVector3LengthSq(object_to_view.r[1])),
+			XMVectorGetX(XMVector3LengthSq(object_to_view.r[2])) }));
+
+		const BS      &bs       = model->GetBS();
+		const Point3   centroid = bs.Centroid();
+		const XMVECTOR p_view   = XMVector3TransformCoord(
+			XMLoadFloat3(&centroid), object_to_view);
+
+		// NDC span two units of the viewport height.
+		const F32 height_scale = 0.5f * XMVectorGetY(view_to_projection.r[1]);
+
+		F32 error_scale = scale * height_scale;
+		if (0.0f != XMVectorGetW(view_to_projection.r[2])) {
+			// Perspective projection
+			const F32 distance = XMVectorGetZ(p_view) - scale * bs.m_r;
+			error_scale = (0.0f < distance) ? error_scale / distance 
+				                            : std::numeric_limits< F32 >::max();
+		}
+
+		model->SelectLOD(error_scale);
+	}
 }
\ No newline at end of file
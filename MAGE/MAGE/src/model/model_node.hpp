@@ -145,6 +145,24 @@ namespace mage {
 			return m_model.get();
 		}
 
+		/**
+		 Selects the LOD of the model of this model node from the projected 
+		 size of the BS of that model.
+
+		 The projected size is evaluated at the point of the BS nearest to 
+		 the camera. The full detail LOD is selected if the camera is inside 
+		 the BS.
+
+		 @param[in]		object_to_view
+						The object-to-view transformation matrix of this model 
+						node.
+		 @param[in]		view_to_projection
+						The view-to-projection transformation matrix of the 
+						camera.
+		 */
+		void XM_CALLCONV SelectLOD(FXMMATRIX object_to_view, 
+			CXMMATRIX view_to_projection) const noexcept;
+
 	private:
 
 		//---------------------------------------------------------------------
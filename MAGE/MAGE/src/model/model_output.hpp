@@ -7,6 +7,11 @@
 
 #include "math\geometry\bounding_volume.hpp"
 #include "material\material.hpp"
+#include "mesh\mesh_view.hpp"
+#include "mesh\mesh_optimizer.hpp"
+#include "mesh\mesh_simplifier.hpp"
+#include "mesh\mesh_cluster.hpp"
+#include "model\model_lod.hpp"
 #include "utils\collection\collection.hpp"
 
 #pragma endregion
@@ -50,6 +55,10 @@ namespace mage {
 			m_material(MAGE_MDL_PART_DEFAULT_MATERIAL),
 			m_start_index(0), 
 			m_nb_indices(0),
+			m_base_vertex(0),
+			m_first_cluster(0),
+			m_nb_clusters(0),
+			m_lods(),
 			m_aabb(), 
 			m_bs() {}
 		
@@ -187,6 +196,31 @@ namespace mage {
 		 */
 		U32 m_nb_indices;
 
+		/**
+		 The base vertex of this model part in the mesh of the corresponding 
+		 model. The base vertex is added to each index of this model part 
+		 before reading a vertex.
+		 */
+		U32 m_base_vertex;
+
+		/**
+		 The index of the first mesh cluster of this model part in the mesh 
+		 clusters of the corresponding model.
+		 */
+		U32 m_first_cluster;
+
+		/**
+		 The number of mesh clusters of this model part.
+		 */
+		U32 m_nb_clusters;
+
+		/**
+		 A vector containing the coarser LODs of this model part ordered from 
+		 fine to coarse. The index ranges of the LODs share the base vertex 
+		 of this model part.
+		 */
+		vector< ModelLOD > m_lods;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Bounding Volumes
 		//---------------------------------------------------------------------
@@ -320,6 +354,105 @@ namespace mage {
 		 */
 		void EndModelPart(bool create_bounding_volumes = true) noexcept;
 
+		/**
+		 Optimizes the mesh of this model output.
+
+		 The triangles of each model part are reordered for vertex cache 
+		 locality and reduced overdraw. Afterwards, the vertices are 
+		 reordered for vertex fetch locality and unreferenced vertices are 
+		 discarded. The model parts and their bounding volumes remain valid.
+
+		 @pre			The mesh view of this model output is not mapped.
+		 @pre			The base vertex of each model part is equal to zero.
+		 @pre			This model output contains no mesh clusters.
+		 @pre			The model parts of this model output have no LODs.
+		 @param[out]	before
+						A reference to the vertex cache statistics of all 
+						model parts before the optimization.
+		 @param[out]	after
+						A reference to the vertex cache statistics of all 
+						model parts after the optimization.
+		 */
+		void Optimize(VertexCacheStatistics &before, 
+			VertexCacheStatistics &after);
+
+		/**
+		 Rebases the indices of each model part of this model output on the 
+		 smallest vertex referenced by that model part, so that the indices 
+		 fit in 16 bits whenever possible.
+
+		 Model parts referencing a vertex range exceeding the 16-bit range 
+		 are split in consecutive triangle ranges, each with its own base 
+		 vertex. The additional ranges are added as child model parts with an 
+		 identity transform and the same material. If some triangle on its 
+		 own exceeds the 16-bit range, this model output remains unchanged.
+
+		 @pre			The mesh view of this model output is not mapped.
+		 @pre			The base vertex of each model part is equal to zero.
+		 @pre			This model output contains no mesh clusters.
+		 @pre			The model parts of this model output have no LODs.
+		 */
+		void RebaseIndices();
+
+		/**
+		 Checks whether all indices of this model output fit in 16 bits.
+
+		 @pre			The mesh view of this model output is not mapped.
+		 @return		@c true if all indices of this model output fit in 16 
+						bits. @c false otherwise.
+		 */
+		bool HasU16Indices() const noexcept;
+
+		/**
+		 Returns the indices of this model output as 16-bit indices.
+
+		 @pre			The mesh view of this model output is not mapped.
+		 @pre			All indices of this model output fit in 16 bits.
+		 @return		A vector containing the 16-bit indices of this model 
+						output.
+		 */
+		const vector< U16 > GetU16IndexBuffer() const;
+
+		/**
+		 Copies the vertices and indices of the mapped mesh view of this model 
+		 output to the vertex and index buffer of this model output and 
+		 releases the memory-mapped file.
+
+		 @pre			The mesh view of this model output is mapped.
+		 @pre			The vertex and index buffer of this model output are 
+						empty.
+		 @pre			This model output contains no mesh clusters.
+		 */
+		void Unmap();
+
+		/**
+		 Generates the LODs of each model part of this model output without 
+		 LODs by simplifying the full detail index range of that model part.
+
+		 The indices of each LOD are appended to the index buffer of this 
+		 model output and reference the vertices of the corresponding model 
+		 part. LOD @c i targets @a reduction to the power @c i of the 
+		 triangles of its model part. The generation stops early for a model 
+		 part once a LOD cannot be simplified sufficiently.
+
+		 @pre			The mesh view of this model output is not mapped.
+		 @pre			This model output contains no mesh clusters.
+		 @param[in]		nb_lods
+						The maximal number of LODs to generate per model part.
+		 @param[in]		reduction
+						The triangle ratio between consecutive LODs.
+		 */
+		void GenerateLODs(size_t nb_lods, F32 reduction = 0.5f);
+
+		/**
+		 Splits the index range of each model part and each LOD of this model 
+		 output without mesh clusters into mesh clusters.
+
+		 The mesh clusters of each index range are consecutive and cover that 
+		 index range in order.
+		 */
+		void BuildClusters();
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -334,6 +467,12 @@ namespace mage {
 		 */
 		vector< U32 > m_index_buffer;
 
+		/**
+		 The mesh view of this model output. If mapped, the mesh view is used
+		 instead of the vertex and index buffer.
+		 */
+		MeshView< VertexT > m_mesh_view;
+
 		/**
 		 A vector containing the materials of this model output.
 		 */
@@ -344,6 +483,12 @@ namespace mage {
 		 */
 		vector< ModelPart > m_model_parts;
 
+		/**
+		 A vector containing the mesh clusters of this model output. The 
+		 start indices of the mesh clusters are relative to the index buffer.
+		 */
+		vector< MeshCluster > m_cluster_buffer;
+
 	private:
 
 		//---------------------------------------------------------------------
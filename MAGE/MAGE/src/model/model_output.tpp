@@ -9,6 +9,17 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+#include <string>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -71,6 +82,386 @@ namespace mage {
 		}
 	}
 
+	template < typename VertexT >
+	void ModelOutput< VertexT >::Optimize(VertexCacheStatistics &before, 
+		VertexCacheStatistics &after) {
+
+		Assert(!m_mesh_view.IsMapped());
+		Assert(m_cluster_buffer.empty());
+
+		constexpr U32 no_index = std::numeric_limits< U32 >::max();
+
+		before = VertexCacheStatistics();
+		after  = VertexCacheStatistics();
+
+		// Each model part is drawn separately and is therefore optimized in
+		// its own compact vertex index space.
+		vector< U32 >    global_to_local(m_vertex_buffer.size(), no_index);
+		vector< U32 >    local_to_global;
+		vector< U32 >    local_indices;
+		vector< Point3 > local_positions;
+
+		for (const auto &model_part : m_model_parts) {
+			Assert(0u == model_part.m_base_vertex);
+			Assert(model_part.m_lods.empty());
+			Assert(model_part.m_start_index + model_part.m_nb_indices 
+				   <= m_index_buffer.size());
+
+			U32 * const  indices    = m_index_buffer.data() 
+				                    + model_part.m_start_index;
+			const size_t nb_indices = model_part.m_nb_indices;
+
+			local_to_global.clear();
+			local_positions.clear();
+			local_indices.resize(nb_indices);
+			for (size_t i = 0; i < nb_indices; ++i) {
+				U32 &local = global_to_local[indices[i]];
+				if (no_index == local) {
+					local = static_cast< U32 >(local_to_global.size());
+					local_to_global.push_back(indices[i]);
+					local_positions.push_back(m_vertex_buffer[indices[i]].p);
+				}
+				local_indices[i] = local;
+			}
+
+			const size_t nb_vertices = local_to_global.size();
+			before += AnalyzeVertexCache(
+				local_indices.data(), nb_indices, nb_vertices);
+			
+			OptimizeVertexCache(local_indices.data(), nb_indices, nb_vertices);
+			OptimizeOverdraw(local_indices.data(), nb_indices, 
+				local_positions.data(), nb_vertices);
+			
+			after  += AnalyzeVertexCache(
+				local_indices.data(), nb_indices, nb_vertices);
+
+			for (size_t i = 0; i < nb_indices; ++i) {
+				indices[i] = local_to_global[local_indices[i]];
+			}
+			for (const U32 index : local_to_global) {
+				global_to_local[index] = no_index;
+			}
+		}
+
+		vector< U32 > remap;
+		const size_t nb_vertices = OptimizeVertexFetch(m_index_buffer.data(),
+			m_index_buffer.size(), m_vertex_buffer.size(), remap);
+
+		vector< VertexT > vertices(nb_vertices, VertexT());
+		for (size_t i = 0; i < remap.size(); ++i) {
+			if (no_index != remap[i]) {
+				vertices[remap[i]] = m_vertex_buffer[i];
+			}
+		}
+		m_vertex_buffer = std::move(vertices);
+	}
+
+	template < typename VertexT >
+	void ModelOutput< VertexT >::RebaseIndices() {
+		Assert(!m_mesh_view.IsMapped());
+		Assert(m_cluster_buffer.empty());
+
+		constexpr U32 max_range = std::numeric_limits< U16 >::max();
+
+		// Splitting only pays off if all model parts end up with 16-bit 
+		// indices.
+		for (const auto &model_part : m_model_parts) {
+			Assert(0u == model_part.m_base_vertex);
+			Assert(model_part.m_lods.empty());
+			Assert(0u == model_part.m_nb_indices % 3u);
+
+			const U32 *indices = m_index_buffer.data() 
+				               + model_part.m_start_index;
+			for (U32 i = 0u; i < model_part.m_nb_indices; i += 3u) {
+				const U32 min_index 
+					= std::min({ indices[i], indices[i+1u], indices[i+2u] });
+				const U32 max_index 
+					= std::max({ indices[i], indices[i+1u], indices[i+2u] });
+				if (max_range < max_index - min_index) {
+					return;
+				}
+			}
+		}
+
+		vector< ModelPart > split_model_parts;
+
+		for (auto &model_part : m_model_parts) {
+			U32 * const indices = m_index_buffer.data();
+			const U32   end     = model_part.m_start_index 
+				                + model_part.m_nb_indices;
+			
+			U32 range_start = model_part.m_start_index;
+			U32 range_min   = std::numeric_limits< U32 >::max();
+			U32 range_max   = 0u;
+			U32 nb_ranges   = 0u;
+
+			const auto end_range = [&](U32 range_end) {
+				for (U32 i = range_start; i < range_end; ++i) {
+					indices[i] -= range_min;
+				}
+
+				if (0u == nb_ranges) {
+					model_part.m_nb_indices  = range_end - range_start;
+					model_part.m_base_vertex = range_min;
+				}
+				else {
+					ModelPart split_model_part;
+					split_model_part.m_child       = model_part.m_child + "#" 
+						                           + std::to_string(nb_ranges);
+					split_model_part.m_parent      = model_part.m_child;
+					split_model_part.m_material    = model_part.m_material;
+					split_model_part.m_start_index = range_start;
+					split_model_part.m_nb_indices  = range_end - range_start;
+					split_model_part.m_base_vertex = range_min;
+					split_model_parts.push_back(std::move(split_model_part));
+				}
+				
+				++nb_ranges;
+			};
+
+			for (U32 i = range_start; i < end; i += 3u) {
+				const U32 min_index = std::min({ range_min, 
+					indices[i], indices[i+1u], indices[i+2u] });
+				const U32 max_index = std::max({ range_max, 
+					indices[i], indices[i+1u], indices[i+2u] });
+				
+				if (max_range < max_index - min_index) {
+					end_range(i);
+					range_start = i;
+					range_min   = std::min({ 
+						indices[i], indices[i+1u], indices[i+2u] });
+					range_max   = std::max({ 
+						indices[i], indices[i+1u], indices[i+2u] });
+				}
+				else {
+					range_min   = min_index;
+					range_max   = max_index;
+				}
+			}
+
+			if (range_start != end) {
+				end_range(end);
+			}
+			else {
+				model_part.m_base_vertex = 0u;
+			}
+
+			if (1u < nb_ranges) {
+				model_part.m_aabb = AABB();
+				model_part.m_bs   = BS();
+				SetupBoundingVolumes(model_part);
+			}
+		}
+
+		for (auto &model_part : split_model_parts) {
+			SetupBoundingVolumes(model_part);
+			m_model_parts.push_back(std::move(model_part));
+		}
+	}
+
+	template < typename VertexT >
+	bool ModelOutput< VertexT >::HasU16Indices() const noexcept {
+		Assert(!m_mesh_view.IsMapped());
+
+		constexpr U32 max_index = std::numeric_limits< U16 >::max();
+
+		for (const U32 index : m_index_buffer) {
+			if (max_index < index) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template < typename VertexT >
+	const vector< U16 > ModelOutput< VertexT >::GetU16IndexBuffer() const {
+		Assert(HasU16Indices());
+
+		vector< U16 > indices;
+		indices.reserve(m_index_buffer.size());
+		for (const U32 index : m_index_buffer) {
+			indices.push_back(static_cast< U16 >(index));
+		}
+		return indices;
+	}
+
+	template < typename VertexT >
+	void ModelOutput< VertexT >::Unmap() {
+		Assert(m_mesh_view.IsMapped());
+		Assert(m_vertex_buffer.empty());
+		Assert(m_index_buffer.empty());
+		Assert(m_cluster_buffer.empty());
+
+		m_vertex_buffer.assign(m_mesh_view.m_vertices, 
+			m_mesh_view.m_vertices + m_mesh_view.m_nb_vertices);
+		
+		m_index_buffer.reserve(m_mesh_view.m_nb_indices);
+		for (size_t i = 0; i < m_mesh_view.m_nb_indices; ++i) {
+			m_index_buffer.push_back(m_mesh_view.GetIndex(i));
+		}
+
+		m_mesh_view = MeshView< VertexT >();
+	}
+
+	template < typename VertexT >
+	void ModelOutput< VertexT >::GenerateLODs(size_t nb_lods, F32 reduction) {
+		Assert(!m_mesh_view.IsMapped());
+		Assert(m_cluster_buffer.empty());
+
+		constexpr U32 no_index = std::numeric_limits< U32 >::max();
+
+		// Each model part is simplified in its own compact vertex index space.
+		vector< U32 >    global_to_local(m_vertex_buffer.size(), no_index);
+		vector< U32 >    local_to_global;
+		vector< U32 >    local_indices;
+		vector< Point3 > local_positions;
+		vector< U32 >    lod_indices;
+
+		for (auto &model_part : m_model_parts) {
+			if (!model_part.m_lods.empty()) {
+				continue;
+			}
+
+			const size_t start = model_part.m_start_index;
+			const size_t end   = start + model_part.m_nb_indices;
+			const U32    base  = model_part.m_base_vertex;
+
+			local_to_global.clear();
+			local_positions.clear();
+			local_indices.clear();
+			for (size_t i = start; i < end; ++i) {
+				const U32 global = base + m_index_buffer[i];
+				
+				U32 &local = global_to_local[global];
+				if (no_index == local) {
+					local = static_cast< U32 >(local_to_global.size());
+					local_to_global.push_back(global);
+					local_positions.push_back(m_vertex_buffer[global].p);
+				}
+				local_indices.push_back(local);
+			}
+
+			size_t nb_lod_indices = local_indices.size();
+			F32    error          = 0.0f;
+			F32    ratio          = 1.0f;
+			
+			for (size_t lod = 0; lod < nb_lods; ++lod) {
+				ratio *= reduction;
+				const size_t target_nb_indices = 3 * static_cast< size_t >(
+					ratio * static_cast< F32 >(local_indices.size() / 3));
+				if (0 == target_nb_indices) {
+					break;
+				}
+
+				// Each LOD is simplified from the full detail model part, so 
+				// that the errors do not accumulate.
+				const F32 lod_error = SimplifyMesh(
+					local_indices.data(), local_indices.size(), 
+					local_positions.data(), local_positions.size(), 
+					target_nb_indices, std::numeric_limits< F32 >::max(), 
+					lod_indices);
+
+				// LODs which do not save at least 10% of the triangles of the 
+				// previous LOD (e.g. due to locked borders) are not worth it.
+				if (lod_indices.empty() 
+					|| 10 * lod_indices.size() > 9 * nb_lod_indices) {
+					break;
+				}
+
+				OptimizeVertexCache(lod_indices.data(), lod_indices.size(), 
+					                local_positions.size());
+
+				error = std::max(error, lod_error);
+				nb_lod_indices = lod_indices.size();
+
+				ModelLOD model_lod;
+				model_lod.m_start_index   = static_cast< U32 >(m_index_buffer.size());
+				model_lod.m_nb_indices    = static_cast< U32 >(lod_indices.size());
+				model_lod.m_first_cluster = 0u;
+				model_lod.m_nb_clusters   = 0u;
+				model_lod.m_error         = error;
+				model_part.m_lods.push_back(model_lod);
+
+				for (const U32 local : lod_indices) {
+					m_index_buffer.push_back(local_to_global[local] - base);
+				}
+			}
+
+			for (const U32 global : local_to_global) {
+				global_to_local[global] = no_index;
+			}
+		}
+	}
+
+	template < typename VertexT >
+	void ModelOutput< VertexT >::BuildClusters() {
+		constexpr U32 no_index = std::numeric_limits< U32 >::max();
+
+		const size_t nb_vertices = m_mesh_view.IsMapped()
+			? m_mesh_view.m_nb_vertices : m_vertex_buffer.size();
+
+		// Each index range is clustered in its own compact vertex index space.
+		vector< U32 >    global_to_local(nb_vertices, no_index);
+		vector< U32 >    local_to_global;
+		vector< U32 >    local_indices;
+		vector< Point3 > local_positions;
+
+		const auto build_clusters = [&](U32 start, U32 nb_indices, U32 base,
+			U32 &first_cluster, U32 &nb_clusters) {
+
+			if (0u != nb_clusters) {
+				return;
+			}
+
+			local_to_global.clear();
+			local_positions.clear();
+			local_indices.clear();
+			for (size_t i = start; i < start + nb_indices; ++i) {
+				const U32 global = base 
+					+ (m_mesh_view.IsMapped() 
+					   ? m_mesh_view.GetIndex(i) : m_index_buffer[i]);
+				
+				U32 &local = global_to_local[global];
+				if (no_index == local) {
+					local = static_cast< U32 >(local_to_global.size());
+					local_to_global.push_back(global);
+					local_positions.push_back(m_mesh_view.IsMapped()
+						? m_mesh_view.m_vertices[global].p 
+						: m_vertex_buffer[global].p);
+				}
+				local_indices.push_back(local);
+			}
+
+			const size_t first = m_cluster_buffer.size();
+			BuildMeshClusters(local_indices.data(), local_indices.size(),
+				local_positions.data(), local_positions.size(), 
+				m_cluster_buffer);
+
+			for (size_t i = first; i < m_cluster_buffer.size(); ++i) {
+				m_cluster_buffer[i].m_start_index += start;
+			}
+
+			first_cluster = static_cast< U32 >(first);
+			nb_clusters   = static_cast< U32 >(m_cluster_buffer.size() - first);
+
+			for (const U32 global : local_to_global) {
+				global_to_local[global] = no_index;
+			}
+		};
+
+		for (auto &model_part : m_model_parts) {
+			build_clusters(model_part.m_start_index, model_part.m_nb_indices, 
+				model_part.m_base_vertex, 
+				model_part.m_first_cluster, model_part.m_nb_clusters);
+
+			for (auto &model_lod : model_part.m_lods) {
+				build_clusters(model_lod.m_start_index, model_lod.m_nb_indices, 
+					model_part.m_base_vertex, 
+					model_lod.m_first_cluster, model_lod.m_nb_clusters);
+			}
+		}
+	}
+
 	template < typename VertexT >
 	inline void ModelOutput< VertexT >::SetupBoundingVolumes(
 		ModelPart &model_part) noexcept {
@@ -78,16 +469,22 @@ namespace mage {
 		const size_t start = model_part.m_start_index;
 		const size_t end   = start + model_part.m_nb_indices;
 		
+		const size_t base = model_part.m_base_vertex;
+		
+		const auto vertex = [this, base](size_t i) noexcept -> const VertexT & {
+			return m_mesh_view.IsMapped()
+				? m_mesh_view.m_vertices[base + m_mesh_view.GetIndex(i)]
+				: m_vertex_buffer[base + m_index_buffer[i]];
+		};
+
 		for (size_t i = start; i < end; ++i) {
-			const VertexT &v  = m_vertex_buffer[m_index_buffer[i]];
-			model_part.m_aabb = Union(model_part.m_aabb, v);
+			model_part.m_aabb = Union(model_part.m_aabb, vertex(i));
 		}
 
 		model_part.m_bs.m_p = model_part.m_aabb.Centroid();
 
 		for (size_t i = start; i < end; ++i) {
-			const VertexT &v = m_vertex_buffer[m_index_buffer[i]];
-			model_part.m_bs  = Union(model_part.m_bs, v);
+			model_part.m_bs   = Union(model_part.m_bs, vertex(i));
 		}
 	}
 }
\ No newline at end of file
@@ -51,7 +51,7 @@ namespace mage {
 
 		memcpy(mapped_buffer.pData, &data, sizeof(DataT));
 
-		device_context->Unmap(m_buffer.Get(), 0);
+		Pipeline::Unmap(device_context, m_buffer.Get(), 0u);
 	}
 
 	template< typename DataT >
@@ -0,0 +1,153 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering\buffer\constant_buffer_ring.hpp"
+#include "rendering\rendering_factory.hpp"
+#include "utils\logging\error.hpp"
+#include "utils\exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	ConstantBufferRing::ConstantBufferRing(size_t size)
+		: ConstantBufferRing(Pipeline::GetDevice(), size) {}
+
+	ConstantBufferRing::ConstantBufferRing(ID3D11Device5 *device, size_t size)
+		: m_device(device),
+		m_buffer(),
+		m_fence(),
+		m_fence_value(0u),
+		m_allocator(),
+		m_mapped(nullptr),
+		m_discard(true),
+		m_no_overwrite(false) {
+
+		Assert(m_device);
+
+		D3D11_FEATURE_DATA_D3D11_OPTIONS options = {};
+		const HRESULT result = m_device->CheckFeatureSupport(
+			D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options));
+		ThrowIfFailed(result,
+			"Feature support check failed: %08X.", result);
+		if (!options.ConstantBufferOffsetting) {
+			throw FormattedException(
+				"Constant buffer offsetting is not supported.");
+		}
+		m_no_overwrite = (FALSE != options.MapNoOverwriteOnDynamicConstantBuffer);
+
+		SetupBuffer(size);
+		SetupFence();
+	}
+
+	void ConstantBufferRing::SetupBuffer(size_t size) {
+		Assert(0u == size % g_constant_buffer_ring_alignment);
+
+		const HRESULT result = CreateDynamicConstantBuffer< U8 >(
+			m_device.Get(), m_buffer.ReleaseAndGetAddressOf(), nullptr, size);
+		ThrowIfFailed(result,
+			"Constant buffer ring creation failed: %08X.", result);
+
+		// The ranges of the previous buffer resource remain valid.
+		m_allocator.Reset(size);
+		m_discard = true;
+	}
+
+	void ConstantBufferRing::SetupFence() noexcept {
+		const HRESULT result = m_device->CreateFence(0u,
+			D3D11_FENCE_FLAG_NONE, IID_PPV_ARGS(m_fence.ReleaseAndGetAddressOf()));
+		if (FAILED(result)) {
+			// Without a fence, ranges are only released by discarding.
+			Warning("Constant buffer ring fence creation failed: %08X.", result);
+			m_fence.Reset();
+		}
+	}
+
+	void ConstantBufferRing::Map(ID3D11DeviceContext4 *device_context,
+		size_t size) {
+
+		Assert(device_context);
+		Assert(!m_mapped);
+		Assert(0u == size % g_constant_buffer_ring_alignment);
+
+		if (m_allocator.GetSize() < size) {
+			SetupBuffer(std::max(2u * m_allocator.GetSize(), size));
+		}
+
+		// Release the ranges of all frames completed by the GPU.
+		if (m_allocator.HasPendingFrames()) {
+			m_allocator.Release(m_fence->GetCompletedValue());
+		}
+
+		size_t offset = 0u;
+		const bool discard = m_discard || !m_no_overwrite 
+			              || !m_allocator.Reserve(size, offset);
+		if (discard) {
+			// The driver renames the buffer resource, so the ranges which
+			// may still be in flight are not overwritten.
+			m_allocator.Discard(size);
+			m_discard = false;
+		}
+
+		D3D11_MAPPED_SUBRESOURCE mapped_buffer;
+		const HRESULT result = Pipeline::Map(device_context, m_buffer.Get(),
+			0u, discard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE,
+			0u, &mapped_buffer);
+		ThrowIfFailed(result,
+			"Constant buffer ring mapping failed: %08X.", result);
+
+		m_mapped = static_cast< U8 * >(mapped_buffer.pData);
+	}
+
+	void ConstantBufferRing::Unmap(
+		ID3D11DeviceContext4 *device_context) noexcept {
+
+		Assert(device_context);
+		Assert(m_mapped);
+
+		Pipeline::Unmap(device_context, m_buffer.Get(), 0u);
+		m_mapped = nullptr;
+
+		// Release the unwritten part of the block.
+		m_allocator.ReleaseUnused();
+	}
+
+	void ConstantBufferRing::Discard() noexcept {
+		Assert(!m_mapped);
+
+		m_discard = true;
+	}
+
+	void ConstantBufferRing::EndFrame(
+		ID3D11DeviceContext4 *device_context) noexcept {
+
+		Assert(device_context);
+		Assert(!m_mapped);
+
+		if (m_fence && !m_allocator.IsFrameEmpty()) {
+			const HRESULT result
+				= device_context->Signal(m_fence.Get(), m_fence_value + 1u);
+			if (SUCCEEDED(result)) {
+				++m_fence_value;
+				m_allocator.EndFrame(m_fence_value);
+				return;
+			}
+		}
+
+		m_allocator.EndFrame();
+	}
+}
\ No newline at end of file
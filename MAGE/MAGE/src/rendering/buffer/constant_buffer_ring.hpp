@@ -0,0 +1,312 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering\buffer\constant_buffer_ring_allocator.hpp"
+#include "rendering\pipeline.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The default size in bytes of constant buffer rings.
+	 */
+	constexpr size_t g_constant_buffer_ring_size = 4u << 20u;
+
+	/**
+	 A class of constant buffer rings (for binding ranges of a single dynamic
+	 constant buffer to the rendering pipeline).
+
+	 The data of consecutive draws is written sequentially through a single
+	 map with @c D3D11_MAP_WRITE_NO_OVERWRITE, and each draw binds its own
+	 range of shader constants. A fence signaled at the end of each frame
+	 releases the ranges of that frame once the GPU completed the frame. If
+	 not enough space is released, the buffer is discarded (i.e. renamed by
+	 the driver) instead of overwriting ranges which may still be in flight.
+	 If the device does not support @c D3D11_MAP_WRITE_NO_OVERWRITE on 
+	 dynamic constant buffers, each map discards the buffer.
+	 */
+	class ConstantBufferRing final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the size in bytes of an allocation for the given data type.
+
+		 @tparam		DataT
+						The data type.
+		 @return		The size in bytes of an allocation for the given data
+						type.
+		 */
+		template< typename DataT >
+		static constexpr size_t GetAllocationSize() noexcept {
+			return (sizeof(DataT) + g_constant_buffer_ring_alignment - 1u)
+				& ~(g_constant_buffer_ring_alignment - 1u);
+		}
+
+		/**
+		 Binds the given range of this constant buffer ring.
+
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			@a slot <
+						@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+		 @tparam		PipelineStageT
+						The pipeline stage type.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		slot
+						The index into the device's zero-based array to set the
+						constant buffer to (ranges from 0 to
+						@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT
+						- 1).
+		 @param[in]		binding
+						A reference to the range of this constant buffer ring.
+		 */
+		template< typename PipelineStageT >
+		static void Bind(ID3D11DeviceContext4 *device_context, U32 slot,
+			const ConstantBufferBinding &binding) noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a constant buffer ring.
+
+		 @pre			The device associated of the rendering manager
+						associated with the current engine must be loaded.
+		 @param[in]		size
+						The initial size in bytes.
+		 @throws		FormattedException
+						Failed to setup this constant buffer ring.
+		 */
+		explicit ConstantBufferRing(
+			size_t size = g_constant_buffer_ring_size);
+
+		/**
+		 Constructs a constant buffer ring.
+
+		 @pre			@a device is not equal to @c nullptr.
+		 @param[in]		device
+						A pointer to the device.
+		 @param[in]		size
+						The initial size in bytes.
+		 @throws		FormattedException
+						Failed to setup this constant buffer ring.
+		 */
+		explicit ConstantBufferRing(ID3D11Device5 *device,
+			size_t size = g_constant_buffer_ring_size);
+
+		/**
+		 Constructs a constant buffer ring from the given constant buffer
+		 ring.
+
+		 @param[in]		ring
+						A reference to the constant buffer ring to copy.
+		 */
+		ConstantBufferRing(const ConstantBufferRing &ring) = delete;
+
+		/**
+		 Constructs a constant buffer ring by moving the given constant
+		 buffer ring.
+
+		 @param[in]		ring
+						A reference to the constant buffer ring to move.
+		 */
+		ConstantBufferRing(ConstantBufferRing &&ring) = default;
+
+		/**
+		 Destructs this constant buffer ring.
+		 */
+		~ConstantBufferRing() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given constant buffer ring to this constant buffer ring.
+
+		 @param[in]		ring
+						A reference to the constant buffer ring to copy.
+		 @return		A reference to the copy of the given constant buffer
+						ring (i.e. this constant buffer ring).
+		 */
+		ConstantBufferRing &operator=(const ConstantBufferRing &ring) = delete;
+
+		/**
+		 Moves the given constant buffer ring to this constant buffer ring.
+
+		 @param[in]		ring
+						A reference to the constant buffer ring to move.
+		 @return		A reference to the moved constant buffer ring (i.e.
+						this constant buffer ring).
+		 */
+		ConstantBufferRing &operator=(ConstantBufferRing &&ring) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Maps a block of this constant buffer ring for writing.
+
+		 The buffer may not be bound for drawing while it is mapped: write
+		 the data of all draws of a batch first, unmap this constant buffer
+		 ring and bind the ranges afterwards.
+
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			This constant buffer ring is not mapped.
+		 @pre			@a size is a multiple of
+						@c g_constant_buffer_ring_alignment.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		size
+						The maximum size in bytes of the data to write (i.e.
+						the sum of the allocation sizes).
+		 @throws		FormattedException
+						Failed to map the block.
+		 */
+		void Map(ID3D11DeviceContext4 *device_context, size_t size);
+
+		/**
+		 Writes the given data to the next range of the mapped block of this
+		 constant buffer ring.
+
+		 @pre			This constant buffer ring is mapped.
+		 @pre			The mapped block has space for the given data.
+		 @tparam		DataT
+						The data type.
+		 @param[in]		data
+						A reference to the data.
+		 @return		The range of this constant buffer ring containing the
+						given data.
+		 */
+		template< typename DataT >
+		ConstantBufferBinding Write(const DataT &data) noexcept;
+
+		/**
+		 Unmaps the mapped block of this constant buffer ring. The unwritten
+		 part of the block is released.
+
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			This constant buffer ring is mapped.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 */
+		void Unmap(ID3D11DeviceContext4 *device_context) noexcept;
+
+		/**
+		 Discards the buffer resource of this constant buffer ring on the 
+		 next map.
+
+		 The first map of a dynamic resource on a deferred device context 
+		 must discard the resource, so call this method before recording 
+		 each command list.
+
+		 @pre			This constant buffer ring is not mapped.
+		 */
+		void Discard() noexcept;
+
+		/**
+		 Ends the current frame of this constant buffer ring. The ranges
+		 written during the current frame are released once the GPU
+		 completed the current frame.
+
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			This constant buffer ring is not mapped.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 */
+		void EndFrame(ID3D11DeviceContext4 *device_context) noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Sets up the resource buffer of this constant buffer ring.
+
+		 @param[in]		size
+						The size in bytes.
+		 @throws		FormattedException
+						Failed to setup the resource buffer.
+		 */
+		void SetupBuffer(size_t size);
+
+		/**
+		 Sets up the fence of this constant buffer ring.
+		 */
+		void SetupFence() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the device of this constant buffer ring.
+		 */
+		ComPtr< ID3D11Device5 > m_device;
+
+		/**
+		 A pointer to the buffer resource of this constant buffer ring.
+		 */
+		ComPtr< ID3D11Buffer > m_buffer;
+
+		/**
+		 A pointer to the fence of this constant buffer ring.
+		 */
+		ComPtr< ID3D11Fence > m_fence;
+
+		/**
+		 The last fence value signaled by this constant buffer ring.
+		 */
+		U64 m_fence_value;
+
+		/**
+		 The offset bookkeeping of this constant buffer ring.
+		 */
+		ConstantBufferRingAllocator m_allocator;
+
+		/**
+		 A pointer to the mapped buffer resource of this constant buffer
+		 ring.
+		 */
+		U8 *m_mapped;
+
+		/**
+		 A flag indicating whether the next map of this constant buffer ring
+		 discards the buffer resource.
+		 */
+		bool m_discard;
+
+		/**
+		 A flag indicating whether the device of this constant buffer ring
+		 supports @c D3D11_MAP_WRITE_NO_OVERWRITE on dynamic constant 
+		 buffers.
+		 */
+		bool m_no_overwrite;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering\buffer\constant_buffer_ring.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "utils\logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename PipelineStageT >
+	inline void ConstantBufferRing::Bind(
+		ID3D11DeviceContext4 *device_context, U32 slot,
+		const ConstantBufferBinding &binding) noexcept {
+
+		PipelineStageT::BindConstantBuffer(device_context, slot,
+			binding.m_buffer, binding.m_first_constant, binding.m_nb_constants);
+	}
+
+	template< typename DataT >
+	ConstantBufferBinding ConstantBufferRing::Write(
+		const DataT &data) noexcept {
+
+		constexpr size_t size = GetAllocationSize< DataT >();
+
+		Assert(m_mapped);
+
+		const size_t offset = m_allocator.Allocate(size);
+		memcpy(m_mapped + offset, &data, sizeof(DataT));
+
+		return {
+			m_buffer.Get(),
+			static_cast< U32 >(offset / 16u),
+			static_cast< U32 >(size   / 16u)
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering\buffer\constant_buffer_ring_allocator.hpp"
+#include "utils\logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	ConstantBufferRingAllocator::ConstantBufferRingAllocator(size_t size)
+		: m_frames(),
+		m_size(size),
+		m_used(0u),
+		m_frame_size(0u),
+		m_head(0u),
+		m_cursor(0u),
+		m_end(0u) {}
+
+	void ConstantBufferRingAllocator::Reset(size_t size) noexcept {
+		m_frames.clear();
+		m_size       = size;
+		m_used       = 0u;
+		m_frame_size = 0u;
+		m_head       = 0u;
+		m_cursor     = 0u;
+		m_end        = 0u;
+	}
+
+	void ConstantBufferRingAllocator::Release(U64 completed_value) noexcept {
+		auto it = m_frames.cbegin();
+		for (; it != m_frames.cend() && it->first <= completed_value; ++it) {
+			m_used -= it->second;
+		}
+		m_frames.erase(m_frames.cbegin(), it);
+	}
+
+	bool ConstantBufferRingAllocator::Reserve(size_t size,
+		size_t &offset) noexcept {
+
+		if (0u == m_used) {
+			m_head = 0u;
+		}
+
+		// The oldest range which may still be in flight starts at the tail.
+		const size_t tail = (m_head + m_size - m_used) % m_size;
+		const bool   full = (m_size == m_used);
+
+		if (!full && m_head >= tail) {
+			if (size <= m_size - m_head) {
+				offset = m_head;
+			}
+			else if (size <= tail) {
+				// Skip the end of the buffer resource and wrap around.
+				const size_t skipped = m_size - m_head;
+				m_used       += skipped;
+				m_frame_size += skipped;
+				offset = 0u;
+			}
+			else {
+				return false;
+			}
+		}
+		else if (!full && size <= tail - m_head) {
+			offset = m_head;
+		}
+		else {
+			return false;
+		}
+
+		m_used       += size;
+		m_frame_size += size;
+		m_head        = (offset + size) % m_size;
+		m_cursor      = offset;
+		m_end         = offset + size;
+
+		return true;
+	}
+
+	void ConstantBufferRingAllocator::Discard(size_t size) noexcept {
+		Assert(size <= m_size);
+
+		m_frames.clear();
+		m_used       = size;
+		m_frame_size = size;
+		m_head       = size % m_size;
+		m_cursor     = 0u;
+		m_end        = size;
+	}
+
+	size_t ConstantBufferRingAllocator::Allocate(size_t size) noexcept {
+		Assert(0u == size % g_constant_buffer_ring_alignment);
+		Assert(m_cursor + size <= m_end);
+
+		const size_t offset = m_cursor;
+		m_cursor += size;
+		return offset;
+	}
+
+	void ConstantBufferRingAllocator::ReleaseUnused() noexcept {
+		const size_t unused = m_end - m_cursor;
+		m_used       -= unused;
+		m_frame_size -= unused;
+		m_head        = m_cursor % m_size;
+		m_end         = m_cursor;
+	}
+
+	void ConstantBufferRingAllocator::EndFrame(U64 fence_value) {
+		if (0u != m_frame_size) {
+			m_frames.emplace_back(fence_value, m_frame_size);
+		}
+
+		m_frame_size = 0u;
+	}
+}
\ No newline at end of file
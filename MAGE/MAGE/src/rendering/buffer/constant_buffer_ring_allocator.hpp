@@ -0,0 +1,287 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "utils\type\types.hpp"
+#include "utils\collection\collection.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The alignment in bytes of the allocations of constant buffer rings (i.e.
+	 16 shader constants of 16 bytes).
+	 */
+	constexpr size_t g_constant_buffer_ring_alignment = 256;
+
+	/**
+	 A class of constant buffer ring allocators (i.e. the offset bookkeeping
+	 of constant buffer rings without a device).
+
+	 Blocks are reserved sequentially from the head of the ring. The ranges
+	 reserved during a frame are tracked with the fence value signaled at
+	 the end of that frame, and released once that fence value is
+	 completed.
+	 */
+	class ConstantBufferRingAllocator final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a constant buffer ring allocator.
+
+		 @param[in]		size
+						The size in bytes.
+		 */
+		explicit ConstantBufferRingAllocator(size_t size = 0u);
+
+		/**
+		 Constructs a constant buffer ring allocator from the given constant
+		 buffer ring allocator.
+
+		 @param[in]		allocator
+						A reference to the constant buffer ring allocator to
+						copy.
+		 */
+		ConstantBufferRingAllocator(
+			const ConstantBufferRingAllocator &allocator) = default;
+
+		/**
+		 Constructs a constant buffer ring allocator by moving the given
+		 constant buffer ring allocator.
+
+		 @param[in]		allocator
+						A reference to the constant buffer ring allocator to
+						move.
+		 */
+		ConstantBufferRingAllocator(
+			ConstantBufferRingAllocator &&allocator) noexcept = default;
+
+		/**
+		 Destructs this constant buffer ring allocator.
+		 */
+		~ConstantBufferRingAllocator() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given constant buffer ring allocator to this constant
+		 buffer ring allocator.
+
+		 @param[in]		allocator
+						A reference to the constant buffer ring allocator to
+						copy.
+		 @return		A reference to the copy of the given constant buffer
+						ring allocator (i.e. this constant buffer ring
+						allocator).
+		 */
+		ConstantBufferRingAllocator &operator=(
+			const ConstantBufferRingAllocator &allocator) = default;
+
+		/**
+		 Moves the given constant buffer ring allocator to this constant
+		 buffer ring allocator.
+
+		 @param[in]		allocator
+						A reference to the constant buffer ring allocator to
+						move.
+		 @return		A reference to the moved constant buffer ring
+						allocator (i.e. this constant buffer ring allocator).
+		 */
+		ConstantBufferRingAllocator &operator=(
+			ConstantBufferRingAllocator &&allocator) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the size in bytes of this constant buffer ring allocator.
+
+		 @return		The size in bytes of this constant buffer ring
+						allocator.
+		 */
+		size_t GetSize() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Returns the number of bytes in use (i.e. not released) of this
+		 constant buffer ring allocator.
+
+		 @return		The number of bytes in use of this constant buffer
+						ring allocator.
+		 */
+		size_t GetNumberOfUsedBytes() const noexcept {
+			return m_used;
+		}
+
+		/**
+		 Checks whether frames of this constant buffer ring allocator may
+		 still be in flight.
+
+		 @return		@c true if frames of this constant buffer ring
+						allocator may still be in flight. @c false otherwise.
+		 */
+		bool HasPendingFrames() const noexcept {
+			return !m_frames.empty();
+		}
+
+		/**
+		 Checks whether nothing is reserved during the current frame of this
+		 constant buffer ring allocator.
+
+		 @return		@c true if nothing is reserved during the current
+						frame of this constant buffer ring allocator.
+						@c false otherwise.
+		 */
+		bool IsFrameEmpty() const noexcept {
+			return 0u == m_frame_size;
+		}
+
+		/**
+		 Resets this constant buffer ring allocator to the given size. All
+		 ranges are released.
+
+		 @param[in]		size
+						The size in bytes.
+		 */
+		void Reset(size_t size) noexcept;
+
+		/**
+		 Releases the ranges of all frames whose fence value is completed.
+
+		 @param[in]		completed_value
+						The completed fence value.
+		 */
+		void Release(U64 completed_value) noexcept;
+
+		/**
+		 Reserves a contiguous block of this constant buffer ring allocator
+		 without overwriting ranges which may still be in flight.
+
+		 @pre			No block of this constant buffer ring allocator is
+						reserved.
+		 @param[in]		size
+						The size in bytes.
+		 @param[out]	offset
+						The offset in bytes of the reserved block.
+		 @return		@c true if the block is reserved. @c false otherwise.
+		 */
+		[[nodiscard]] bool Reserve(size_t size, size_t &offset) noexcept;
+
+		/**
+		 Reserves a block at the start of this constant buffer ring allocator
+		 after discarding (i.e. renaming) the buffer resource. All ranges
+		 which may still be in flight are released, since they belong to the
+		 previous buffer resource.
+
+		 @pre			No block of this constant buffer ring allocator is
+						reserved.
+		 @pre			@a size is not greater than the size of this
+						constant buffer ring allocator.
+		 @param[in]		size
+						The size in bytes.
+		 */
+		void Discard(size_t size) noexcept;
+
+		/**
+		 Allocates the next range of the reserved block of this constant
+		 buffer ring allocator.
+
+		 @pre			The reserved block has space for @a size bytes.
+		 @pre			@a size is a multiple of
+						@c g_constant_buffer_ring_alignment.
+		 @param[in]		size
+						The size in bytes.
+		 @return		The offset in bytes of the allocated range.
+		 */
+		size_t Allocate(size_t size) noexcept;
+
+		/**
+		 Releases the unallocated part of the reserved block of this constant
+		 buffer ring allocator.
+		 */
+		void ReleaseUnused() noexcept;
+
+		/**
+		 Ends the current frame of this constant buffer ring allocator. The
+		 ranges reserved during the current frame are released once the
+		 given fence value is completed.
+
+		 @param[in]		fence_value
+						The fence value signaled at the end of the current
+						frame.
+		 */
+		void EndFrame(U64 fence_value);
+
+		/**
+		 Ends the current frame of this constant buffer ring allocator
+		 without a fence value. The ranges reserved during the current frame
+		 are only released by discarding.
+		 */
+		void EndFrame() noexcept {
+			m_frame_size = 0u;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The fence values and sizes in bytes of the frames of this constant
+		 buffer ring allocator which may still be in flight.
+		 */
+		vector< pair< U64, size_t > > m_frames;
+
+		/**
+		 The size in bytes of this constant buffer ring allocator.
+		 */
+		size_t m_size;
+
+		/**
+		 The number of bytes in use (i.e. not released) of this constant
+		 buffer ring allocator.
+		 */
+		size_t m_used;
+
+		/**
+		 The number of bytes reserved during the current frame of this
+		 constant buffer ring allocator.
+		 */
+		size_t m_frame_size;
+
+		/**
+		 The offset in bytes of the next block of this constant buffer ring
+		 allocator.
+		 */
+		size_t m_head;
+
+		/**
+		 The offset in bytes of the next range of the reserved block of this
+		 constant buffer ring allocator.
+		 */
+		size_t m_cursor;
+
+		/**
+		 The end offset in bytes of the reserved block of this constant
+		 buffer ring allocator.
+		 */
+		size_t m_end;
+	};
+}
\ No newline at end of file
@@ -6,6 +6,7 @@
 #pragma region
 
 #include "material\spectrum.hpp"
+#include "rendering\pass\shadow_cascades.hpp"
 
 #pragma endregion
 
@@ -44,7 +45,11 @@ namespace mage {
 			m_nb_sm_directional_lights(0), 
 			m_nb_sm_omni_lights(0), 
 			m_nb_sm_spot_lights(0), 
-			m_padding2(0) {}
+			m_padding2(0),
+			m_light_grid_size(), 
+			m_light_grid_depth_scale(0.0f), 
+			m_light_grid_depth_bias(0.0f), 
+			m_padding3() {}
 		
 		/**
 		 Constructs a light buffer from the given light buffer.
@@ -156,9 +161,34 @@ namespace mage {
 		 The padding of this light buffer. 
 		 */
 		U32 m_padding2;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Light Grid
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of light clusters of the light grid of this light buffer 
+		 along each axis.
+		 */
+		U32x3 m_light_grid_size;
+
+		/**
+		 The depth scale of the light grid of this light buffer.
+		 */
+		F32 m_light_grid_depth_scale;
+
+		/**
+		 The depth bias of the light grid of this light buffer.
+		 */
+		F32 m_light_grid_depth_bias;
+
+		/**
+		 The padding of this light buffer. 
+		 */
+		U32x3 m_padding3;
 	};
 
-	static_assert(sizeof(LightBuffer) == 64, 
+	static_assert(sizeof(LightBuffer) == 96, 
 		"CPU/GPU struct mismatch");
 
 	//-------------------------------------------------------------------------
@@ -498,7 +528,8 @@ namespace mage {
 		 */
 		DirectionalLightWithShadowMappingBuffer()
 			: m_light(), 
-			m_cview_to_lprojection() {}
+			m_cview_to_lprojection{}, 
+			m_cascade_ends{} {}
 		
 		/**
 		 Constructs an directional light with shadow mapping buffer from the 
@@ -578,13 +609,23 @@ namespace mage {
 
 		/**
 		 The (column-major packed, row-major matrix) 
-		 camera-view-to-light-projection matrix of this directional light 
-		 buffer with shadow mapping for use in HLSL.
+		 camera-view-to-light-projection matrices of the shadow cascades of 
+		 this directional light buffer with shadow mapping for use in HLSL.
 		 */
-		XMMATRIX m_cview_to_lprojection;
+		XMMATRIX m_cview_to_lprojection[g_nb_shadow_cascades];
+
+		//---------------------------------------------------------------------
+		// Member Variables: Shadow Cascades
+		//---------------------------------------------------------------------
+
+		/**
+		 The camera-view-space depths of the far planes of the shadow cascades 
+		 of this directional light buffer with shadow mapping.
+		 */
+		F32 m_cascade_ends[g_nb_shadow_cascades];
 	};
 
-	static_assert(sizeof(DirectionalLightWithShadowMappingBuffer) == 96, 
+	static_assert(sizeof(DirectionalLightWithShadowMappingBuffer) == 304, 
 		"CPU/GPU struct mismatch");
 
 	//-------------------------------------------------------------------------
@@ -0,0 +1,117 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "math\math.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// MeshBuffer
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of mesh buffers used by shaders for decoding the vertices of a 
+	 mesh.
+
+	 The decoded position is equal to the stored position multiplied by the 
+	 position scale and translated by the position offset.
+	 */
+	struct alignas(16) MeshBuffer final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a mesh buffer for decoding uncompressed vertices.
+		 */
+		MeshBuffer()
+			: m_position_scale(1.0f, 1.0f, 1.0f),
+			m_octahedral_normals(0u),
+			m_position_offset(0.0f, 0.0f, 0.0f),
+			m_padding(0u) {}
+
+		/**
+		 Constructs a mesh buffer from the given mesh buffer.
+
+		 @param[in]		buffer
+						A reference to the mesh buffer to copy.
+		 */
+		MeshBuffer(const MeshBuffer &buffer) = default;
+		
+		/**
+		 Constructs a mesh buffer by moving the given mesh buffer.
+
+		 @param[in]		buffer
+						A reference to the mesh buffer to move.
+		 */
+		MeshBuffer(MeshBuffer &&buffer) = default;
+
+		/**
+		 Destructs this mesh buffer.
+		 */
+		~MeshBuffer() = default;
+		
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+		
+		/**
+		 Copies the given mesh buffer to this mesh buffer.
+
+		 @param[in]		buffer
+						A reference to the mesh buffer to copy.
+		 @return		A reference to the copy of the given mesh buffer (i.e. 
+						this mesh buffer).
+		 */
+		MeshBuffer &operator=(const MeshBuffer &buffer) = default;
+
+		/**
+		 Moves the given mesh buffer to this mesh buffer.
+
+		 @param[in]		buffer
+						A reference to the mesh buffer to move.
+		 @return		A reference to the moved mesh buffer (i.e. this mesh 
+						buffer).
+		 */
+		MeshBuffer &operator=(MeshBuffer &&buffer) = default;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Decoding
+		//---------------------------------------------------------------------
+
+		/**
+		 The scale of the positions of this mesh buffer.
+		 */
+		F32x3 m_position_scale;
+
+		/**
+		 A flag indicating whether the normals are octahedral encoded for 
+		 this mesh buffer.
+		 */
+		U32 m_octahedral_normals;
+
+		/**
+		 The offset of the positions of this mesh buffer.
+		 */
+		F32x3 m_position_offset;
+
+		/**
+		 The padding of this mesh buffer.
+		 */
+		U32 m_padding;
+	};
+
+	static_assert(sizeof(MeshBuffer) == 32, "CPU/GPU struct mismatch");
+}
\ No newline at end of file
@@ -334,7 +334,8 @@ namespace mage {
 			m_base_color{}, 
 			m_roughness(0.0f),
 			m_metalness(0.0f),
-			m_padding{} {}
+			m_instance_start(0u),
+			m_padding(0u) {}
 
 		/**
 		 Constructs a model buffer from the given model buffer.
@@ -410,12 +411,32 @@ namespace mage {
 		 */
 		F32 m_metalness;
 
+		//---------------------------------------------------------------------
+		// Member Variables: Instancing
+		//---------------------------------------------------------------------
+
+		/**
+		 The index of the first instance in the model instance buffer of this 
+		 model buffer (only used for instanced draw calls).
+		 */
+		U32 m_instance_start;
+
 		/**
-		 The padding of this game buffer.
+		 The padding of this model buffer.
 		 */
-		U32 m_padding[2];
+		U32 m_padding;
 	};
 
 	static_assert(sizeof(ModelBuffer) == 224, 
 		"CPU/GPU struct mismatch");
+
+	//-------------------------------------------------------------------------
+	// ModelInstance
+	//-------------------------------------------------------------------------
+
+	/**
+	 The per-instance data of instanced models (i.e. the transformation 
+	 matrices of a single model instance).
+	 */
+	using ModelInstance = ModelNormalTextureTransformBuffer;
 }
\ No newline at end of file
@@ -15,7 +15,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#define MAGE_DEFAULT_SHADOW_MAP_RESOLUTION   512
+#define MAGE_DEFAULT_SHADOW_MAP_RESOLUTION         512
+#define MAGE_DEFAULT_CASCADE_SHADOW_MAP_RESOLUTION 1024
 
 //TODO: make configurable
 #define MAGE_DEFAULT_DEPTH_BIAS              100
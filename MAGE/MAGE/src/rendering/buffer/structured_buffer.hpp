@@ -7,6 +7,7 @@
 
 #include "rendering\pipeline.hpp"
 #include "utils\collection\collection.hpp"
+#include "utils\logging\error.hpp"
 
 #pragma endregion
 
@@ -15,10 +16,221 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	/**
+	 The number of consecutive maps of a structured buffer using at most a 
+	 quarter of its capacity before the structured buffer shrinks.
+	 */
+	constexpr size_t g_structured_buffer_shrink_delay = 64;
+
+	/**
+	 Returns the capacity of a structured buffer for storing the given number 
+	 of data elements.
+
+	 The capacity grows geometrically. The capacity shrinks to twice the 
+	 given number of data elements (never below the minimum capacity) once 
+	 at most a quarter of the capacity is used during 
+	 @c g_structured_buffer_shrink_delay consecutive maps.
+
+	 @param[in]		nb_data_elements
+					The number of data elements to store.
+	 @param[in]		capacity
+					The current capacity.
+	 @param[in]		min_capacity
+					The minimum capacity.
+	 @param[in,out]	nb_underused_maps
+					A reference to the number of consecutive maps using at 
+					most a quarter of the capacity.
+	 @return		The capacity for storing @a nb_data_elements data 
+					elements.
+	 */
+	[[nodiscard]] size_t GetStructuredBufferCapacity(size_t nb_data_elements, 
+		size_t capacity, size_t min_capacity, 
+		size_t &nb_underused_maps) noexcept;
+
+	/**
+	 A class of spans of mapped structured buffers.
+
+	 The data elements are located in write-combined memory: the data 
+	 elements should be written sequentially and should never be read.
+
+	 @tparam		DataT
+					The data type.
+	 */
+	template< typename DataT >
+	class StructuredBufferSpan final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an empty structured buffer span.
+		 */
+		StructuredBufferSpan() noexcept
+			: StructuredBufferSpan(nullptr, 0) {}
+
+		/**
+		 Constructs a structured buffer span.
+
+		 @param[in]		data
+						A pointer to the first data element.
+		 @param[in]		size
+						The number of data elements.
+		 */
+		explicit StructuredBufferSpan(DataT *data, size_t size) noexcept
+			: m_data(data), m_size(size) {}
+
+		/**
+		 Constructs a structured buffer span from the given structured 
+		 buffer span.
+
+		 @param[in]		span
+						A reference to the structured buffer span to copy.
+		 */
+		StructuredBufferSpan(const StructuredBufferSpan &span) noexcept 
+			= default;
+
+		/**
+		 Constructs a structured buffer span by moving the given structured 
+		 buffer span.
+
+		 @param[in]		span
+						A reference to the structured buffer span to move.
+		 */
+		StructuredBufferSpan(StructuredBufferSpan &&span) noexcept = default;
+
+		/**
+		 Destructs this structured buffer span.
+		 */
+		~StructuredBufferSpan() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------	
+
+		/**
+		 Copies the given structured buffer span to this structured buffer 
+		 span.
+
+		 @param[in]		span
+						A reference to the structured buffer span to copy.
+		 @return		A reference to the copy of the given structured buffer 
+						span (i.e. this structured buffer span).
+		 */
+		StructuredBufferSpan &operator=(
+			const StructuredBufferSpan &span) noexcept = default;
+
+		/**
+		 Moves the given structured buffer span to this structured buffer 
+		 span.
+
+		 @param[in]		span
+						A reference to the structured buffer span to move.
+		 @return		A reference to the moved structured buffer span (i.e. 
+						this structured buffer span).
+		 */
+		StructuredBufferSpan &operator=(
+			StructuredBufferSpan &&span) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the data element at the given index of this structured 
+		 buffer span.
+
+		 @pre			@a index < size().
+		 @param[in]		index
+						The index.
+		 @return		A reference to the data element at the given index of 
+						this structured buffer span.
+		 */
+		DataT &operator[](size_t index) const noexcept {
+			Assert(index < m_size);
+			return m_data[index];
+		}
+
+		/**
+		 Returns a pointer to the first data element of this structured 
+		 buffer span.
+
+		 @return		A pointer to the first data element of this structured 
+						buffer span.
+		 */
+		DataT *data() const noexcept {
+			return m_data;
+		}
+
+		/**
+		 Returns the number of data elements of this structured buffer span.
+
+		 @return		The number of data elements of this structured buffer 
+						span.
+		 */
+		size_t size() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Checks whether this structured buffer span is empty.
+
+		 @return		@c true if this structured buffer span is empty. 
+						@c false otherwise.
+		 */
+		bool empty() const noexcept {
+			return 0 == m_size;
+		}
+
+		/**
+		 Returns an iterator to the first data element of this structured 
+		 buffer span.
+
+		 @return		An iterator to the first data element of this 
+						structured buffer span.
+		 */
+		DataT *begin() const noexcept {
+			return m_data;
+		}
+
+		/**
+		 Returns an iterator past the last data element of this structured 
+		 buffer span.
+
+		 @return		An iterator past the last data element of this 
+						structured buffer span.
+		 */
+		DataT *end() const noexcept {
+			return m_data + m_size;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the first data element of this structured buffer span.
+		 */
+		DataT *m_data;
+
+		/**
+		 The number of data elements of this structured buffer span.
+		 */
+		size_t m_size;
+	};
+
 	/**
 	 A class of structured buffers (for binding arrays of buffers to the 
 	 rendering pipeline).
 
+	 The capacity of a structured buffer grows geometrically. The capacity 
+	 shrinks (never below the initial capacity) once it is underused during 
+	 @c g_structured_buffer_shrink_delay consecutive maps.
+
 	 @tparam		DataT
 					The data type.
 	 */
@@ -124,6 +336,8 @@ namespace mage {
 		 @pre			The device associated of the rendering manager 
 						associated with the current engine must be loaded.
 		 @pre			@a device_context is not equal to @c nullptr.
+		 @tparam		AllocatorT
+						The allocator type of the vector.
 		 @param[in]		device_context
 						A pointer to the device context.
 		 @param[in]		data
@@ -131,14 +345,17 @@ namespace mage {
 		  @throws		FormattedException
 						Failed to update the data.
 		 */
+		template< typename AllocatorT >
 		void UpdateData(ID3D11DeviceContext4 *device_context, 
-			const vector< DataT > &data);
+			const vector< DataT, AllocatorT > &data);
 
 		/**
 		 Updates the data of this structured buffer with the given data.
 
 		 @pre			@a device is not equal to @c nullptr.
 		 @pre			@a device_context is not equal to @c nullptr.
+		 @tparam		AllocatorT
+						The allocator type of the vector.
 		 @param[in]		device
 						A pointer to the device.
 		 @param[in]		device_context
@@ -148,9 +365,67 @@ namespace mage {
 	     @throws		FormattedException
 						Failed to update the data.
 		 */
+		template< typename AllocatorT >
 		void UpdateData(ID3D11Device5 *device, 
 			ID3D11DeviceContext4 *device_context,
-			const vector< DataT > &data);
+			const vector< DataT, AllocatorT > &data);
+
+		/**
+		 Maps this structured buffer for writing the given number of data 
+		 elements. The previous data of this structured buffer is discarded.
+
+		 @pre			The device associated of the rendering manager 
+						associated with the current engine must be loaded.
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			This structured buffer is not mapped.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		nb_data_elements
+						The maximum number of data elements to write.
+		 @return		A span of @a nb_data_elements writable data elements 
+						of this structured buffer.
+		 @throws		FormattedException
+						Failed to map this structured buffer.
+		 */
+		StructuredBufferSpan< DataT > Map(
+			ID3D11DeviceContext4 *device_context, size_t nb_data_elements);
+
+		/**
+		 Maps this structured buffer for writing the given number of data 
+		 elements. The previous data of this structured buffer is discarded.
+
+		 @pre			@a device is not equal to @c nullptr.
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			This structured buffer is not mapped.
+		 @param[in]		device
+						A pointer to the device.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		nb_data_elements
+						The maximum number of data elements to write.
+		 @return		A span of @a nb_data_elements writable data elements 
+						of this structured buffer.
+		 @throws		FormattedException
+						Failed to map this structured buffer.
+		 */
+		StructuredBufferSpan< DataT > Map(ID3D11Device5 *device,
+			ID3D11DeviceContext4 *device_context, size_t nb_data_elements);
+
+		/**
+		 Unmaps this structured buffer.
+
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			This structured buffer is mapped.
+		 @pre			@a nb_used_data_elements is not greater than the 
+						number of mapped data elements.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		nb_used_data_elements
+						The number of written data elements (i.e. the new 
+						size of this structured buffer).
+		 */
+		void Unmap(ID3D11DeviceContext4 *device_context, 
+			size_t nb_used_data_elements) noexcept;
 
 		/**
 		 Returns the shader resource view of this structured buffer.
@@ -203,6 +478,20 @@ namespace mage {
 		void SetupStructuredBuffer(ID3D11Device5 *device, 
 			size_t nb_data_elements);
 
+		/**
+		 Grows or shrinks the capacity of this structured buffer for storing 
+		 the given number of data elements.
+
+		 @pre			@a device is not equal to @c nullptr.
+		 @param[in]		device
+						A pointer to the device.
+		 @param[in]		nb_data_elements
+						The number of data elements to store.
+		 @throws		FormattedException
+						Failed to resize this structured buffer.
+		 */
+		void Reserve(ID3D11Device5 *device, size_t nb_data_elements);
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -228,6 +517,28 @@ namespace mage {
 		 structured buffer.
 		 */
 		size_t m_nb_used_data_elements;
+
+		/**
+		 The minimum number of slots available for storing data elements of 
+		 this structured buffer.
+		 */
+		size_t m_nb_min_data_elements;
+
+		/**
+		 The number of consecutive maps of this structured buffer using at 
+		 most a quarter of the available slots.
+		 */
+		size_t m_nb_underused_maps;
+
+		/**
+		 The number of mapped slots of this structured buffer.
+		 */
+		size_t m_nb_mapped_data_elements;
+
+		/**
+		 A pointer to the mapped buffer resource of this structured buffer.
+		 */
+		DataT *m_mapped;
 	};
 }
 
@@ -11,6 +11,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -25,7 +34,10 @@ namespace mage {
 	StructuredBuffer< DataT >::StructuredBuffer(ID3D11Device5 *device,
 		size_t nb_initial_data_elements)
 		: m_buffer(), m_buffer_srv(),
-		m_nb_data_elements(0), m_nb_used_data_elements(0) {
+		m_nb_data_elements(0), m_nb_used_data_elements(0), 
+		m_nb_min_data_elements(nb_initial_data_elements), 
+		m_nb_underused_maps(0), m_nb_mapped_data_elements(0), 
+		m_mapped(nullptr) {
 
 		SetupStructuredBuffer(device, nb_initial_data_elements);
 	}
@@ -57,36 +69,115 @@ namespace mage {
 	}
 
 	template< typename DataT >
+	template< typename AllocatorT >
 	inline void StructuredBuffer< DataT >::UpdateData(
-		ID3D11DeviceContext4 *device_context, const vector< DataT > &data) {
+		ID3D11DeviceContext4 *device_context, 
+		const vector< DataT, AllocatorT > &data) {
 
 		UpdateData(Pipeline::GetDevice(), device_context, data);
 	}
 
+	inline size_t GetStructuredBufferCapacity(size_t nb_data_elements, 
+		size_t capacity, size_t min_capacity, 
+		size_t &nb_underused_maps) noexcept {
+
+		if (capacity < nb_data_elements) {
+			// Grow geometrically.
+			nb_underused_maps = 0;
+			return std::max(nb_data_elements, 2 * capacity);
+		}
+
+		if (4 * nb_data_elements > capacity || min_capacity >= capacity) {
+			nb_underused_maps = 0;
+			return capacity;
+		}
+
+		// Shrink to half usage once underused for long enough.
+		if (g_structured_buffer_shrink_delay <= ++nb_underused_maps) {
+			nb_underused_maps = 0;
+			return std::max(2 * nb_data_elements, min_capacity);
+		}
+
+		return capacity;
+	}
+
+	template< typename DataT >
+	void StructuredBuffer< DataT >::Reserve(
+		ID3D11Device5 *device, size_t nb_data_elements) {
+
+		const size_t capacity = GetStructuredBufferCapacity(nb_data_elements, 
+			m_nb_data_elements, m_nb_min_data_elements, m_nb_underused_maps);
+		
+		if (capacity != m_nb_data_elements) {
+			SetupStructuredBuffer(device, capacity);
+		}
+	}
+
 	template< typename DataT >
+	template< typename AllocatorT >
 	void StructuredBuffer< DataT >::UpdateData(ID3D11Device5 *device, 
-		ID3D11DeviceContext4 *device_context, const vector< DataT > &data) {
+		ID3D11DeviceContext4 *device_context, 
+		const vector< DataT, AllocatorT > &data) {
 		
+		const StructuredBufferSpan< DataT > buffer 
+			= Map(device, device_context, data.size());
+
+		if (!buffer.empty()) {
+			memcpy(buffer.data(), data.data(), data.size() * sizeof(DataT));
+		}
+
+		Unmap(device_context, data.size());
+	}
+
+	template< typename DataT >
+	inline StructuredBufferSpan< DataT > StructuredBuffer< DataT >::Map(
+		ID3D11DeviceContext4 *device_context, size_t nb_data_elements) {
+
+		return Map(Pipeline::GetDevice(), device_context, nb_data_elements);
+	}
+
+	template< typename DataT >
+	StructuredBufferSpan< DataT > StructuredBuffer< DataT >::Map(
+		ID3D11Device5 *device, ID3D11DeviceContext4 *device_context, 
+		size_t nb_data_elements) {
+
 		Assert(device_context);
 		Assert(m_buffer);
+		Assert(!m_mapped);
 
-		m_nb_used_data_elements = data.size();
-		if (0 == m_nb_used_data_elements) {
-			return;
-		}
-		if (m_nb_data_elements < m_nb_used_data_elements) {
-			SetupStructuredBuffer(device, m_nb_used_data_elements);
+		Reserve(device, nb_data_elements);
+
+		m_nb_mapped_data_elements = nb_data_elements;
+		if (0 == nb_data_elements) {
+			return StructuredBufferSpan< DataT >();
 		}
 
 		D3D11_MAPPED_SUBRESOURCE mapped_buffer;
 		const HRESULT result = Pipeline::Map(device_context,
 			m_buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped_buffer);
-		Assert(SUCCEEDED(result));
+		ThrowIfFailed(result, 
+			"Structured buffer mapping failed: %08X.", result);
 
-		memcpy(mapped_buffer.pData, data.data(), 
-			m_nb_used_data_elements * sizeof(DataT));
+		m_mapped = static_cast< DataT * >(mapped_buffer.pData);
 
-		device_context->Unmap(m_buffer.Get(), 0);
+		return StructuredBufferSpan< DataT >(m_mapped, nb_data_elements);
+	}
+
+	template< typename DataT >
+	void StructuredBuffer< DataT >::Unmap(
+		ID3D11DeviceContext4 *device_context, 
+		size_t nb_used_data_elements) noexcept {
+
+		Assert(device_context);
+		Assert(nb_used_data_elements <= m_nb_mapped_data_elements);
+
+		m_nb_used_data_elements   = nb_used_data_elements;
+		m_nb_mapped_data_elements = 0;
+
+		if (m_mapped) {
+			Pipeline::Unmap(device_context, m_buffer.Get(), 0u);
+			m_mapped = nullptr;
+		}
 	}
 
 	template< typename DataT >
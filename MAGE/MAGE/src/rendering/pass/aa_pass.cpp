@@ -23,10 +23,13 @@ namespace mage {
 		return Renderer::Get()->GetAAPass();
 	}
 
-	AAPass::AAPass()
-		: m_device_context(Pipeline::GetImmediateDeviceContext()),
+	AAPass::AAPass(ID3D11DeviceContext4 *device_context)
+		: m_device_context(device_context),
 		m_preprocess_cs(), m_cs(), 
-		m_aa_desc(AADescriptor::None) {}
+		m_aa_desc(AADescriptor::None) {
+
+		Assert(m_device_context);
+	}
 
 	AAPass::AAPass(AAPass &&render_pass) = default;
 
@@ -20,10 +20,13 @@ namespace mage {
 		return Renderer::Get()->GetBackBufferPass();
 	}
 
-	BackBufferPass::BackBufferPass()
-		: m_device_context(Pipeline::GetImmediateDeviceContext()),
+	BackBufferPass::BackBufferPass(ID3D11DeviceContext4 *device_context)
+		: m_device_context(device_context),
 		m_vs(CreateNearFullscreenTriangleVS()), 
-		m_ps(CreateBackBufferPS()) {}
+		m_ps(CreateBackBufferPS()) {
+
+		Assert(m_device_context);
+	}
 
 	BackBufferPass::BackBufferPass(BackBufferPass &&render_pass) = default;
 
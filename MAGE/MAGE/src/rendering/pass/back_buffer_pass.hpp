@@ -47,8 +47,11 @@ namespace mage {
 						loaded.
 		 @pre			The resource manager associated with the current engine 
 						must be loaded.
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @param[in]		device_context
+						A pointer to the device context.
 		 */
-		BackBufferPass();
+		explicit BackBufferPass(ID3D11DeviceContext4 *device_context);
 
 		/**
 		 Constructs an back buffer pass from the given back buffer pass.
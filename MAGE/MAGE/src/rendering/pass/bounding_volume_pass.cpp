@@ -24,12 +24,18 @@ namespace mage {
 		return Renderer::Get()->GetBoundingVolumePass();
 	}
 
-	BoundingVolumePass::BoundingVolumePass()
-		: m_device_context(Pipeline::GetImmediateDeviceContext()),
+	BoundingVolumePass::BoundingVolumePass(ID3D11DeviceContext4 *device_context,
+		ConstantBufferRing *constant_buffer_ring)
+		: m_device_context(device_context),
+		m_constant_buffer_ring(constant_buffer_ring),
 		m_vs(CreateLineCubeVS()), 
 		m_ps(CreateLineCubePS()),
 		m_color_buffer(), 
-		m_model_buffer() {}
+		m_model_bindings() {
+
+		Assert(m_device_context);
+		Assert(m_constant_buffer_ring);
+	}
 
 	BoundingVolumePass::BoundingVolumePass(
 		BoundingVolumePass &&render_pass) = default;
@@ -61,15 +67,34 @@ namespace mage {
 		BindColorData(color);
 	}
 
-	void XM_CALLCONV BoundingVolumePass::BindModelData(
-		FXMMATRIX box_to_view) {
+	void BoundingVolumePass::MapModelData(size_t nb_boxes) {
+		ConstantBufferRing &ring = *m_constant_buffer_ring;
+
+		m_model_bindings.clear();
+		ring.Map(m_device_context, 
+			nb_boxes * ConstantBufferRing::GetAllocationSize< XMMATRIX >());
+	}
 
-		// Update the model buffer.
-		m_model_buffer.UpdateData(m_device_context, 
-			XMMatrixTranspose(box_to_view));
-		// Bind the model buffer.
-		m_model_buffer.Bind< Pipeline::VS >(
-			m_device_context, SLOT_CBUFFER_MODEL);
+	void XM_CALLCONV BoundingVolumePass::WriteModelData(
+		FXMMATRIX box_to_view) noexcept {
+
+		ConstantBufferRing &ring = *m_constant_buffer_ring;
+
+		m_model_bindings.push_back(ring.Write(XMMatrixTranspose(box_to_view)));
+	}
+
+	void BoundingVolumePass::DrawBoxes() noexcept {
+		ConstantBufferRing &ring = *m_constant_buffer_ring;
+
+		ring.Unmap(m_device_context);
+
+		for (const auto &model_binding : m_model_bindings) {
+			// Bind the model buffer.
+			ConstantBufferRing::Bind< Pipeline::VS >(
+				m_device_context, SLOT_CBUFFER_MODEL, model_binding);
+			// Draw the line cube.
+			Pipeline::Draw(m_device_context, 24u, 0u);
+		}
 	}
 
 	void BoundingVolumePass::BindFixedState() {
@@ -122,21 +147,23 @@ namespace mage {
 		BindModelColorData();
 
 		// Process the models.
-		ProcessModels(scene->GetOpaqueEmissiveModels(),
-			world_to_projection, world_to_view);
-		ProcessModels(scene->GetOpaqueBRDFModels(),
-			world_to_projection, world_to_view);
-		ProcessModels(scene->GetTransparentEmissiveModels(),
-			world_to_projection, world_to_view);
-		ProcessModels(scene->GetTransparentBRDFModels(),
-			world_to_projection, world_to_view);
+		ProcessModels(scene->GetVisibleOpaqueEmissiveModels());
+		ProcessModels(scene->GetVisibleOpaqueBRDFModels());
+		ProcessModels(scene->GetVisibleTransparentEmissiveModels());
+		ProcessModels(scene->GetVisibleTransparentBRDFModels());
 	}
 
 	void XM_CALLCONV BoundingVolumePass::ProcessLights(
-		const vector< const OmniLightNode * > &lights,
+		const ArenaVector< const OmniLightNode * > &lights,
 		FXMMATRIX world_to_projection,
 		CXMMATRIX world_to_view) {
 
+		if (lights.empty()) {
+			return;
+		}
+
+		MapModelData(lights.size());
+
 		for (const auto node : lights) {
 
 			// Obtain node components (1/2).
@@ -160,18 +187,25 @@ namespace mage {
 			const XMMATRIX object_to_view         = object_to_world * world_to_view;
 			const XMMATRIX box_to_view            = box_transform.GetObjectToParentMatrix() * object_to_view;
 
-			// Bind the model data.
-			BindModelData(box_to_view);
-			// Draw the line cube.
-			Pipeline::Draw(m_device_context, 24u, 0u);
+			// Write the model data.
+			WriteModelData(box_to_view);
 		}
+
+		// Draw the line cubes.
+		DrawBoxes();
 	}
 
 	void XM_CALLCONV BoundingVolumePass::ProcessLights(
-		const vector< const SpotLightNode * > &lights,
+		const ArenaVector< const SpotLightNode * > &lights,
 		FXMMATRIX world_to_projection,
 		CXMMATRIX world_to_view) {
 
+		if (lights.empty()) {
+			return;
+		}
+
+		MapModelData(lights.size());
+
 		for (const auto node : lights) {
 
 			// Obtain node components (1/2).
@@ -194,44 +228,40 @@ namespace mage {
 			const XMMATRIX object_to_view         = object_to_world * world_to_view;
 			const XMMATRIX box_to_view            = box_transform.GetObjectToParentMatrix() * object_to_view;
 
-			// Bind the model data.
-			BindModelData(box_to_view);
-			// Draw the line cube.
-			Pipeline::Draw(m_device_context, 24u, 0u);
+			// Write the model data.
+			WriteModelData(box_to_view);
 		}
+
+		// Draw the line cubes.
+		DrawBoxes();
 	}
 
-	void XM_CALLCONV BoundingVolumePass::ProcessModels(
-		const vector< const ModelNode * > &models,
-		FXMMATRIX world_to_projection,
-		CXMMATRIX world_to_view) {
+	void BoundingVolumePass::ProcessModels(
+		const ArenaVector< VisibleModel > &models) {
 
-		for (const auto node : models) {
+		if (models.empty()) {
+			return;
+		}
 
-			// Obtain node components (1/2).
-			const TransformNode * const transform = node->GetTransform();
-			const Model         * const model     = node->GetModel();
-			const XMMATRIX object_to_world        = transform->GetObjectToWorldMatrix();
-			const XMMATRIX object_to_projection   = object_to_world * world_to_projection;
-			const AABB &aabb                      = model->GetAABB();
+		MapModelData(models.size());
 
-			// Apply view frustum culling.
-			if (ViewFrustum::Cull(object_to_projection, aabb)) {
-				continue;
-			}
+		for (const auto &visible_model : models) {
+
+			// Obtain node components.
+			const Model * const model             = visible_model.m_node->GetModel();
+			const AABB &aabb                      = model->GetAABB();
 
-			// Obtain node components (2/2).
 			Transform box_transform;
 			box_transform.SetScale(aabb.Diagonal());
 			box_transform.SetTranslation(aabb.Centroid());
 
-			const XMMATRIX object_to_view         = object_to_world * world_to_view;
-			const XMMATRIX box_to_view            = box_transform.GetObjectToParentMatrix() * object_to_view;
+			const XMMATRIX box_to_view            = box_transform.GetObjectToParentMatrix() * visible_model.m_object_to_view;
 
-			// Bind the model data.
-			BindModelData(box_to_view);
-			// Draw the line cube.
-			Pipeline::Draw(m_device_context, 24u, 0u);
+			// Write the model data.
+			WriteModelData(box_to_view);
 		}
+
+		// Draw the line cubes.
+		DrawBoxes();
 	}
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include "rendering\pass\pass_buffer.hpp"
 #include "rendering\buffer\constant_buffer.hpp"
+#include "rendering\buffer\constant_buffer_ring.hpp"
 #include "shader\shader.hpp"
 
 #pragma endregion
@@ -49,8 +50,15 @@ namespace mage {
 						loaded.
 		 @pre			The resource manager associated with the current engine 
 						must be loaded.
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			@a constant_buffer_ring is not equal to @c nullptr.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		constant_buffer_ring
+						A pointer to the constant buffer ring.
 		 */
-		BoundingVolumePass();
+		BoundingVolumePass(ID3D11DeviceContext4 *device_context,
+			ConstantBufferRing *constant_buffer_ring);
 
 		/**
 		 Constructs a bounding volume pass from the given bounding volume pass.
@@ -167,16 +175,34 @@ namespace mage {
 		void BindModelColorData();
 
 		/**
-		 Binds the model data of this bounding volume pass.
+		 Maps the constant buffer ring of the renderer for writing the model 
+		 data of the given number of boxes of this bounding volume pass.
 
+		 @param[in]		nb_boxes
+						The maximum number of boxes.
+		 @throws		FormattedException
+						Failed to map the model data of this bounding volume 
+						pass.
+		 */
+		void MapModelData(size_t nb_boxes);
+
+		/**
+		 Writes the model data of a box of this bounding volume pass.
+
+		 @pre			The model data of this bounding volume pass is mapped.
 		 @param[in]		box_to_view
 						The box-to-view transformation matrix used for
 						transforming box vertices.
-		 @throws		FormattedException
-						Failed to bind the model data of this bounding volume 
-						pass.
 		 */
-		void XM_CALLCONV BindModelData(FXMMATRIX box_to_view);
+		void XM_CALLCONV WriteModelData(FXMMATRIX box_to_view) noexcept;
+
+		/**
+		 Unmaps the model data of this bounding volume pass and draws the 
+		 written boxes.
+
+		 @pre			The model data of this bounding volume pass is mapped.
+		 */
+		void DrawBoxes() noexcept;
 		
 		/**
 		 Process the given omni lights.
@@ -197,7 +223,7 @@ namespace mage {
 						Failed to process the lights.
 		 */
 		void XM_CALLCONV ProcessLights(
-			const vector< const OmniLightNode * > &lights,
+			const ArenaVector< const OmniLightNode * > &lights,
 			FXMMATRIX world_to_projection,
 			CXMMATRIX world_to_view);
 		
@@ -220,7 +246,7 @@ namespace mage {
 						Failed to process the lights.
 		 */
 		void XM_CALLCONV ProcessLights(
-			const vector< const SpotLightNode * > &lights,
+			const ArenaVector< const SpotLightNode * > &lights,
 			FXMMATRIX world_to_projection,
 			CXMMATRIX world_to_view);
 		
@@ -228,24 +254,12 @@ namespace mage {
 		 Process the given models.
 
 		 @param[in]		models
-						A reference to a vector containing the model pointers
+						A reference to a vector containing the visible models 
 						to process.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix. This 
-						transformation matrix will be used for culling and 
-						transforming box vertices.
-		 @param[in]		world_to_view
-						The world-to-view transformation matrix. This 
-						transformation matrix will be chained with the 
-						object-to-view transformation matrix for transforming 
-						vertices.
 		 @throws		FormattedException
 						Failed to process the models.
 		 */
-		void XM_CALLCONV ProcessModels(
-			const vector< const ModelNode * > &models,
-			FXMMATRIX world_to_projection,
-			CXMMATRIX world_to_view);
+		void ProcessModels(const ArenaVector< VisibleModel > &models);
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -256,6 +270,11 @@ namespace mage {
 		 */
 		ID3D11DeviceContext4 * const m_device_context;
 
+		/**
+		 A pointer to the constant buffer ring of this bounding volume pass.
+		 */
+		ConstantBufferRing * const m_constant_buffer_ring;
+
 		/**
 		 A pointer to the vertex shader of this bounding volume pass.
 		 */
@@ -272,8 +291,9 @@ namespace mage {
 		ConstantBuffer< RGBA > m_color_buffer;
 
 		/**
-		 The model buffer of this bounding volume pass.
+		 A vector containing the ranges of the model data of the written 
+		 boxes of this bounding volume pass.
 		 */
-		ConstantBuffer< XMMATRIX > m_model_buffer;
+		vector< ConstantBufferBinding > m_model_bindings;
 	};
 }
@@ -50,8 +50,11 @@ namespace mage {
 						loaded.
 		 @pre			The resource manager associated with the current engine 
 						must be loaded.
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @param[in]		device_context
+						A pointer to the device context.
 		 */
-		ConstantComponentPass();
+		explicit ConstantComponentPass(ID3D11DeviceContext4 *device_context);
 		
 		/**
 		 Constructs a constant component pass from the given constant component 
@@ -126,20 +129,10 @@ namespace mage {
 		 @pre			@a scene is not equal to @c nullptr.
 		 @param[in]		scene
 						A pointer to the scene.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
-		 @param[in]		world_to_view
-						The world-to-view transformation matrix.
-		 @param[in]		view_to_world
-						The view-to-world transformation matrix.
 		 @throws		FormattedException
 						Failed to render the scene.
 		 */
-		void XM_CALLCONV Render(
-			const PassBuffer *scene,
-			FXMMATRIX world_to_projection,
-			CXMMATRIX world_to_view,
-			CXMMATRIX view_to_world);
+		void Render(const PassBuffer *scene);
 
 	private:
 
@@ -198,29 +191,12 @@ namespace mage {
 		 Process the given models.
 
 		 @param[in]		models
-						A reference to a vector containing the model pointers
+						A reference to a vector containing the visible models 
 						to process.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix. This 
-						transformation matrix will be used for culling.
-		 @param[in]		world_to_view
-						The world-to-view transformation matrix. This 
-						transformation matrix will be chained with the 
-						object-to-view transformation matrix for transforming 
-						vertices.
-		 @param[in]		view_to_world
-						The view-to-world transformation matrix. This 
-						transformation matrix will be chained with the 
-						world-to-object transformation matrix for transforming 
-						normals.
 		 @throws		FormattedException
 						Failed to process the models.
 		 */
-		void XM_CALLCONV ProcessModels(
-			const vector< const ModelNode * > &models,
-			FXMMATRIX world_to_projection, 
-			CXMMATRIX world_to_view, 
-			CXMMATRIX view_to_world);
+		void ProcessModels(const ArenaVector< VisibleModel > &models);
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -23,12 +23,15 @@ namespace mage {
 		return Renderer::Get()->GetDeferredShadingPass();
 	}
 
-	DeferredShadingPass::DeferredShadingPass()
-		: m_device_context(Pipeline::GetImmediateDeviceContext()),
+	DeferredShadingPass::DeferredShadingPass(ID3D11DeviceContext4 *device_context)
+		: m_device_context(device_context),
 		m_cs(CreateDeferredCS(BRDFType::Unknown)),
 		m_vs(CreateNearFullscreenTriangleVS()),
 		m_msaa_ps(CreateDeferredMSAAPS(BRDFType::Unknown)),
-		m_brdf(BRDFType::Unknown) {}
+		m_brdf(BRDFType::Unknown) {
+
+		Assert(m_device_context);
+	}
 
 	DeferredShadingPass::DeferredShadingPass(
 		DeferredShadingPass &&render_pass) = default;
@@ -4,6 +4,7 @@
 #pragma region
 
 #include "rendering\rendering_manager.hpp"
+#include "core\engine_statistics.hpp"
 #include "resource\resource_factory.hpp"
 #include "math\geometry\view_frustum.hpp"
 #include "utils\logging\error.hpp"
@@ -24,15 +25,20 @@ namespace mage {
 		return Renderer::Get()->GetDepthPass();
 	}
 
-	DepthPass::DepthPass()
-		: m_device_context(Pipeline::GetImmediateDeviceContext()),
+	DepthPass::DepthPass(ID3D11DeviceContext4 *device_context,
+		ConstantBufferRing *constant_buffer_ring)
+		: m_device_context(device_context),
+		m_constant_buffer_ring(constant_buffer_ring),
 		m_opaque_vs(CreateDepthVS()),
+		m_opaque_instanced_vs(CreateDepthInstancedVS()),
 		m_transparent_vs(CreateDepthTransparentVS()),
 		m_transparent_ps(CreateDepthTransparentPS()),
 		m_projection_buffer(), 
-		m_opaque_model_buffer(),
-		m_transparent_model_buffer(), 
-		m_dissolve_buffer() {}
+		m_model_draws() {
+
+		Assert(m_device_context);
+		Assert(m_constant_buffer_ring);
+	}
 
 	DepthPass::DepthPass(DepthPass &&render_pass) = default;
 
@@ -45,6 +51,13 @@ namespace mage {
 		Pipeline::PS::BindShader(m_device_context, nullptr);
 	}
 
+	void DepthPass::BindOpaqueInstancedModelShaders() const noexcept {
+		// Bind the vertex shader.
+		m_opaque_instanced_vs->BindShader(m_device_context);
+		// Bind no pixel shader.
+		Pipeline::PS::BindShader(m_device_context, nullptr);
+	}
+
 	void DepthPass::BindTransparentModelShaders() const noexcept {
 		// Bind the vertex shader.
 		m_transparent_vs->BindShader(m_device_context);
@@ -63,43 +76,116 @@ namespace mage {
 			m_device_context, SLOT_CBUFFER_SECONDARY_CAMERA);
 	}
 
-	void XM_CALLCONV DepthPass::BindOpaqueModelData(
-		FXMMATRIX object_to_view) {
+	void DepthPass::WriteOpaqueInstanceData(
+		const ArenaVector< ModelInstanceGroup > &groups) {
+
+		ConstantBufferRing &ring = *m_constant_buffer_ring;
+
+		m_model_draws.clear();
+		ring.Map(m_device_context, groups.size() 
+			* ConstantBufferRing::GetAllocationSize< U32x4 >());
 
-		// Update the model buffer.
-		m_opaque_model_buffer.UpdateData(m_device_context,
-			XMMatrixTranspose(object_to_view));
-		// Bind the model buffer.
-		m_opaque_model_buffer.Bind< Pipeline::VS >(
-			m_device_context, SLOT_CBUFFER_MODEL);
+		for (const auto &group : groups) {
+			const ConstantBufferBinding model_binding 
+				= ring.Write(U32x4(group.m_instance_start, 0u, 0u, 0u));
+			m_model_draws.push_back({ 
+				group.m_node->GetModel(), model_binding, {} });
+		}
+
+		ring.Unmap(m_device_context);
+	}
+
+	void DepthPass::MapOpaqueModelData(size_t nb_models) {
+		m_model_draws.clear();
+		m_constant_buffer_ring->Map(m_device_context, 
+			nb_models * ConstantBufferRing::GetAllocationSize< XMMATRIX >());
 	}
 
-	void XM_CALLCONV DepthPass::BindTransparentModelData(
+	void DepthPass::MapTransparentModelData(size_t nb_models) {
+		constexpr size_t size 
+			= ConstantBufferRing::GetAllocationSize< ModelTextureTransformBuffer >()
+			+ ConstantBufferRing::GetAllocationSize< XMVECTOR >();
+
+		m_model_draws.clear();
+		m_constant_buffer_ring->Map(m_device_context, 
+			nb_models * size);
+	}
+
+	void XM_CALLCONV DepthPass::WriteOpaqueModelData(const Model *model,
+		FXMMATRIX object_to_view) noexcept {
+
+		ConstantBufferRing &ring = *m_constant_buffer_ring;
+
+		const ConstantBufferBinding model_binding 
+			= ring.Write(XMMatrixTranspose(object_to_view));
+		m_model_draws.push_back({ model, model_binding, {} });
+	}
+
+	void XM_CALLCONV DepthPass::WriteTransparentModelData(const Model *model,
 		FXMMATRIX object_to_view,
-		CXMMATRIX texture_transform,
-		const Material *material) {
+		CXMMATRIX texture_transform) noexcept {
+
+		ConstantBufferRing &ring = *m_constant_buffer_ring;
 
 		ModelTextureTransformBuffer transform;
 		transform.m_object_to_view    = XMMatrixTranspose(object_to_view);
 		transform.m_texture_transform = XMMatrixTranspose(texture_transform);
 
-		// Update the model buffer.
-		m_transparent_model_buffer.UpdateData(m_device_context,
-			transform);
-		// Bind the model buffer.
-		m_transparent_model_buffer.Bind< Pipeline::VS >(
-			m_device_context, SLOT_CBUFFER_MODEL);
-
-		// Update the dissolve buffer.
-		m_dissolve_buffer.UpdateData(m_device_context,
-			XMVectorSet(material->GetBaseColor().m_w, 0.0f, 0.0f, 0.0f));
-		// Bind the dissolve buffer.
-		m_dissolve_buffer.Bind< Pipeline::PS >(
-			m_device_context, SLOT_CBUFFER_MODEL);
-
-		// Bind the diffuse SRV.
-		Pipeline::PS::BindSRV(m_device_context,
-			SLOT_SRV_BASE_COLOR, material->GetBaseColorSRV());
+		const ConstantBufferBinding model_binding = ring.Write(transform);
+		const ConstantBufferBinding dissolve_binding = ring.Write(
+			XMVectorSet(model->GetMaterial()->GetBaseColor().m_w, 
+				0.0f, 0.0f, 0.0f));
+		m_model_draws.push_back({ model, model_binding, dissolve_binding });
+	}
+
+	void DepthPass::DrawOpaqueModels() noexcept {
+		m_constant_buffer_ring->Unmap(m_device_context);
+
+		const Mesh *bound_mesh = nullptr;
+
+		for (const auto &draw : m_model_draws) {
+			const Model * const model = draw.m_model;
+
+			// Bind the model data.
+			ConstantBufferRing::Bind< Pipeline::VS >(
+				m_device_context, SLOT_CBUFFER_MODEL, draw.m_model_binding);
+			// Bind the model mesh.
+			if (bound_mesh != model->GetMesh()) {
+				model->BindMesh(m_device_context);
+				bound_mesh = model->GetMesh();
+				EngineStatistics::Get()->IncrementNumberOfMeshBinds();
+			}
+			// Draw the model.
+			model->Draw(m_device_context);
+		}
+	}
+
+	void DepthPass::DrawTransparentModels() noexcept {
+		m_constant_buffer_ring->Unmap(m_device_context);
+
+		const Mesh *bound_mesh = nullptr;
+
+		for (const auto &draw : m_model_draws) {
+			const Model * const model = draw.m_model;
+
+			// Bind the model data.
+			ConstantBufferRing::Bind< Pipeline::VS >(
+				m_device_context, SLOT_CBUFFER_MODEL, draw.m_model_binding);
+			// Bind the dissolve data.
+			ConstantBufferRing::Bind< Pipeline::PS >(
+				m_device_context, SLOT_CBUFFER_MODEL, draw.m_dissolve_binding);
+			// Bind the diffuse SRV.
+			Pipeline::PS::BindSRV(m_device_context,
+				SLOT_SRV_BASE_COLOR, model->GetMaterial()->GetBaseColorSRV());
+			// Bind the model mesh.
+			if (bound_mesh != model->GetMesh()) {
+				model->BindMesh(m_device_context);
+				bound_mesh = model->GetMesh();
+				EngineStatistics::Get()->IncrementNumberOfMeshBinds();
+			}
+			// Draw the model.
+			model->Draw(m_device_context);
+		}
 	}
 
 	void DepthPass::BindFixedState() {
@@ -121,9 +207,7 @@ namespace mage {
 
 	void XM_CALLCONV DepthPass::Render(
 		const PassBuffer *scene,
-		FXMMATRIX world_to_projection,
-		CXMMATRIX world_to_view,
-		CXMMATRIX view_to_projection) {
+		FXMMATRIX view_to_projection) {
 
 		Assert(scene);
 
@@ -131,13 +215,13 @@ namespace mage {
 		BindProjectionData(view_to_projection);
 
 		// Bind the shaders.
-		BindOpaqueModelShaders();
+		BindOpaqueInstancedModelShaders();
 
 		// Process the opaque models.
-		ProcessOpaqueModels(scene->GetOpaqueEmissiveModels(),
-			world_to_projection, world_to_view);
-		ProcessOpaqueModels(scene->GetOpaqueBRDFModels(),
-			world_to_projection, world_to_view);
+		ProcessOpaqueModels(scene->GetVisibleOpaqueEmissiveInstanceGroups(), 
+			scene->GetIndexRanges());
+		ProcessOpaqueModels(scene->GetVisibleOpaqueBRDFInstanceGroups(), 
+			scene->GetIndexRanges());
 	}
 
 	void XM_CALLCONV DepthPass::RenderOccluders(
@@ -170,41 +254,77 @@ namespace mage {
 			world_to_projection, world_to_view);
 	}
 
-	void XM_CALLCONV DepthPass::ProcessOpaqueModels(
-		const vector< const ModelNode * > &models,
-		FXMMATRIX world_to_projection,
-		CXMMATRIX world_to_view) {
+	void XM_CALLCONV DepthPass::RenderShadowCasters(
+		const ShadowCasterList &casters,
+		U32 faces,
+		FXMMATRIX world_to_view,
+		CXMMATRIX view_to_projection) {
 
-		for (const auto node : models) {
-			
-			// Obtain node components (1/2).
-			const TransformNode * const transform = node->GetTransform();
-			const Model         * const model     = node->GetModel();
-			const XMMATRIX object_to_world        = transform->GetObjectToWorldMatrix();
-			const XMMATRIX object_to_projection   = object_to_world * world_to_projection;
+		// Bind the projection data.
+		BindProjectionData(view_to_projection);
 
-			// Cull the model against the view frustum.
-			if (ViewFrustum::Cull(object_to_projection, model->GetAABB())) {
-				continue;
-			}
+		// Bind the shaders.
+		BindOpaqueModelShaders();
 
-			// Obtain node components (2/2).
-			const XMMATRIX object_to_view         = object_to_world * world_to_view;
+		// Process the opaque shadow casters.
+		ProcessOpaqueShadowCasters(casters.m_opaque_casters,
+			faces, world_to_view);
 
-			// Bind the model data.
-			BindOpaqueModelData(object_to_view);
+		// Bind the shaders.
+		BindTransparentModelShaders();
+
+		// Process the transparent shadow casters.
+		ProcessTransparentShadowCasters(casters.m_transparent_casters,
+			faces, world_to_view);
+	}
+
+	void DepthPass::ProcessOpaqueModels(
+		const ArenaVector< ModelInstanceGroup > &groups,
+		const ArenaVector< IndexRange > &ranges) {
+
+		if (groups.empty()) {
+			return;
+		}
+
+		// Write the model instance data of all model instance groups at once.
+		WriteOpaqueInstanceData(groups);
+
+		const Mesh *bound_mesh = nullptr;
+
+		for (size_t g = 0; g < groups.size(); ++g) {
+			const auto &group = groups[g];
+
+			// Obtain node components.
+			const Model * const model = m_model_draws[g].m_model;
+
+			// Bind the model instance data.
+			ConstantBufferRing::Bind< Pipeline::VS >(m_device_context, 
+				SLOT_CBUFFER_MODEL, m_model_draws[g].m_model_binding);
 			// Bind the model mesh.
-			model->BindMesh(m_device_context);
-			// Draw the model.
-			model->Draw(m_device_context);
+			if (bound_mesh != model->GetMesh()) {
+				model->BindMesh(m_device_context);
+				bound_mesh = model->GetMesh();
+				EngineStatistics::Get()->IncrementNumberOfMeshBinds();
+			}
+			// Draw the visible mesh clusters of the model instances.
+			for (U32 i = 0u; i < group.m_nb_ranges; ++i) {
+				model->DrawInstanced(m_device_context, 
+					ranges[group.m_range_start + i], group.m_nb_instances);
+			}
 		}
 	}
 
 	void XM_CALLCONV DepthPass::ProcessOpaqueOccluderModels(
-		const vector< const ModelNode * > &models,
+		const ArenaVector< const ModelNode * > &models,
 		FXMMATRIX world_to_projection,
 		CXMMATRIX world_to_view) {
 
+		if (models.empty()) {
+			return;
+		}
+
+		MapOpaqueModelData(models.size());
+
 		for (const auto node : models) {
 
 			// Obtain node components (1/3).
@@ -228,20 +348,24 @@ namespace mage {
 			// Obtain node components (3/3).
 			const XMMATRIX object_to_view         = object_to_world * world_to_view;
 
-			// Bind the model data.
-			BindOpaqueModelData(object_to_view);
-			// Bind the model mesh.
-			model->BindMesh(m_device_context);
-			// Draw the model.
-			model->Draw(m_device_context);
+			// Write the model data.
+			WriteOpaqueModelData(model, object_to_view);
 		}
+
+		DrawOpaqueModels();
 	}
 
 	void XM_CALLCONV DepthPass::ProcessTransparentOccluderModels(
-		const vector< const ModelNode * > &models,
+		const ArenaVector< const ModelNode * > &models,
 		FXMMATRIX world_to_projection,
 		CXMMATRIX world_to_view) {
 
+		if (models.empty()) {
+			return;
+		}
+
+		MapTransparentModelData(models.size());
+
 		for (const auto node : models) {
 
 			// Obtain node components (1/3).
@@ -268,12 +392,73 @@ namespace mage {
 			const XMMATRIX object_to_view         = object_to_world * world_to_view;
 			const XMMATRIX texture_transform      = node->GetTextureTransform()->GetTransformMatrix();
 			
-			// Bind the model data.
-			BindTransparentModelData(object_to_view, texture_transform, material);
-			// Bind the model mesh.
-			model->BindMesh(m_device_context);
-			// Draw the model.
-			model->Draw(m_device_context);
+			// Write the model data.
+			WriteTransparentModelData(model, object_to_view, texture_transform);
 		}
+
+		DrawTransparentModels();
+	}
+
+	void XM_CALLCONV DepthPass::ProcessOpaqueShadowCasters(
+		const vector< ShadowCaster > &casters,
+		U32 faces,
+		FXMMATRIX world_to_view) {
+
+		if (casters.empty()) {
+			return;
+		}
+
+		MapOpaqueModelData(casters.size());
+
+		for (const auto &caster : casters) {
+
+			// Skip shadow casters outside the faces.
+			if (0u == (caster.m_faces & faces)) {
+				continue;
+			}
+
+			// Obtain node components.
+			const ModelNode     * const node      = caster.m_node;
+			const Model         * const model     = node->GetModel();
+			const TransformNode * const transform = node->GetTransform();
+			const XMMATRIX object_to_view         = transform->GetObjectToWorldMatrix() * world_to_view;
+
+			// Write the model data.
+			WriteOpaqueModelData(model, object_to_view);
+		}
+
+		DrawOpaqueModels();
+	}
+
+	void XM_CALLCONV DepthPass::ProcessTransparentShadowCasters(
+		const vector< ShadowCaster > &casters,
+		U32 faces,
+		FXMMATRIX world_to_view) {
+
+		if (casters.empty()) {
+			return;
+		}
+
+		MapTransparentModelData(casters.size());
+
+		for (const auto &caster : casters) {
+
+			// Skip shadow casters outside the faces.
+			if (0u == (caster.m_faces & faces)) {
+				continue;
+			}
+
+			// Obtain node components.
+			const ModelNode     * const node      = caster.m_node;
+			const Model         * const model     = node->GetModel();
+			const TransformNode * const transform = node->GetTransform();
+			const XMMATRIX object_to_view         = transform->GetObjectToWorldMatrix() * world_to_view;
+			const XMMATRIX texture_transform      = node->GetTextureTransform()->GetTransformMatrix();
+
+			// Write the model data.
+			WriteTransparentModelData(model, object_to_view, texture_transform);
+		}
+
+		DrawTransparentModels();
 	}
 }
\ No newline at end of file
@@ -6,7 +6,9 @@
 #pragma region
 
 #include "rendering\pass\pass_buffer.hpp"
+#include "rendering\pass\shadow_caster_cache.hpp"
 #include "rendering\buffer\constant_buffer.hpp"
+#include "rendering\buffer\constant_buffer_ring.hpp"
 #include "rendering\buffer\model_buffer.hpp"
 #include "shader\shader.hpp"
 
@@ -49,8 +51,15 @@ namespace mage {
 						loaded.
 		 @pre			The resource manager associated with the current engine 
 						must be loaded.
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			@a constant_buffer_ring is not equal to @c nullptr.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		constant_buffer_ring
+						A pointer to the constant buffer ring.
 		 */
-		DepthPass();
+		DepthPass(ID3D11DeviceContext4 *device_context,
+			ConstantBufferRing *constant_buffer_ring);
 
 		/**
 		 Constructs a depth pass from the given depth pass.
@@ -115,10 +124,6 @@ namespace mage {
 		 @pre			@a scene is not equal to @c nullptr.
 		 @param[in]		scene
 						A pointer to the scene.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
-		 @param[in]		world_to_view
-						The world-to-view transformation matrix.
 		 @param[in]		view_to_projection
 						The view-to-projection transformation matrix.
 		 @throws		FormattedException
@@ -126,9 +131,7 @@ namespace mage {
 		 */
 		void XM_CALLCONV Render(
 			const PassBuffer *scene,
-			FXMMATRIX world_to_projection,
-			CXMMATRIX world_to_view,
-			CXMMATRIX view_to_projection);
+			FXMMATRIX view_to_projection);
 
 		/**
 		 Renders the occluders of the scene.
@@ -151,8 +154,56 @@ namespace mage {
 			CXMMATRIX world_to_view,
 			CXMMATRIX view_to_projection);
 
+		/**
+		 Renders the given (pre-culled) shadow casters.
+
+		 @param[in]		casters
+						A reference to the shadow caster list.
+		 @param[in]		faces
+						The face mask. Only the shadow casters overlapping at
+						least one of these faces are rendered.
+		 @param[in]		world_to_view
+						The world-to-view transformation matrix.
+		 @param[in]		view_to_projection
+						The view-to-projection transformation matrix.
+		 @throws		FormattedException
+						Failed to render the shadow casters.
+		 */
+		void XM_CALLCONV RenderShadowCasters(
+			const ShadowCasterList &casters,
+			U32 faces,
+			FXMMATRIX world_to_view,
+			CXMMATRIX view_to_projection);
+
 	private:
 
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of model draws of depth passes.
+		 */
+		struct ModelDraw final {
+
+			/**
+			 A pointer to the model of this model draw.
+			 */
+			const Model *m_model;
+
+			/**
+			 The range of the model data of this model draw in the constant 
+			 buffer ring of the renderer.
+			 */
+			ConstantBufferBinding m_model_binding;
+
+			/**
+			 The range of the dissolve data of this model draw in the constant 
+			 buffer ring of the renderer (transparent models only).
+			 */
+			ConstantBufferBinding m_dissolve_binding;
+		};
+
 		//---------------------------------------------------------------------
 		// Member Methods
 		//---------------------------------------------------------------------
@@ -162,6 +213,11 @@ namespace mage {
 		 */
 		void BindOpaqueModelShaders() const noexcept;
 		
+		/**
+		 Binds the shaders for instanced opaque models.
+		 */
+		void BindOpaqueInstancedModelShaders() const noexcept;
+		
 		/**
 		 Binds the shaders for transparent models.
 		 */
@@ -179,57 +235,104 @@ namespace mage {
 		void XM_CALLCONV BindProjectionData(FXMMATRIX view_to_projection);
 
 		/**
-		 Binds the opaque model data of this depth pass.
+		 Writes the opaque model instance data of the given model instance 
+		 groups to the constant buffer ring of the renderer.
+
+		 @param[in]		groups
+						A reference to a vector containing the model instance 
+						groups.
+		 @throws		FormattedException
+						Failed to write the model instance data of this depth 
+						pass.
+		 */
+		void WriteOpaqueInstanceData(
+			const ArenaVector< ModelInstanceGroup > &groups);
+
+		/**
+		 Maps the constant buffer ring of the renderer for writing the model 
+		 data of the given number of opaque models of this depth pass.
+
+		 @param[in]		nb_models
+						The maximum number of opaque models.
+		 @throws		FormattedException
+						Failed to map the model data of this depth pass.
+		 */
+		void MapOpaqueModelData(size_t nb_models);
+
+		/**
+		 Maps the constant buffer ring of the renderer for writing the model 
+		 data of the given number of transparent models of this depth pass.
 
+		 @param[in]		nb_models
+						The maximum number of transparent models.
+		 @throws		FormattedException
+						Failed to map the model data of this depth pass.
+		 */
+		void MapTransparentModelData(size_t nb_models);
+
+		/**
+		 Writes the opaque model data of the given model of this depth pass.
+
+		 @pre			The model data of this depth pass is mapped.
+		 @pre			@a model is not equal to @c nullptr.
+		 @param[in]		model
+						A pointer to the model.
 		 @param[in]		object_to_view
 						The object-to-view transformation matrix used for
 						transforming vertices.
-		 @throws		FormattedException
-						Failed to bind the model data of this depth pass.
 		 */
-		void XM_CALLCONV BindOpaqueModelData(FXMMATRIX object_to_view);
+		void XM_CALLCONV WriteOpaqueModelData(const Model *model,
+			FXMMATRIX object_to_view) noexcept;
 
 		/**
-		 Binds the transparent model data of this depth pass.
+		 Writes the transparent model data of the given model of this depth 
+		 pass.
 
-		 @pre			@a material is not equal to @c nullptr.
+		 @pre			The model data of this depth pass is mapped.
+		 @pre			@a model is not equal to @c nullptr.
+		 @param[in]		model
+						A pointer to the model.
 		 @param[in]		object_to_view
 						The object-to-view transformation matrix used for
 						transforming vertices.
 		 @param[in]		texture_transform
 						The texture transformation matrix used for transforming 
 						texture coordinates.
-		 @param[in]		material
-						A pointer to the material.
-		 @throws		FormattedException
-						Failed to bind the model data of this depth pass.
 		 */
-		void XM_CALLCONV BindTransparentModelData(
+		void XM_CALLCONV WriteTransparentModelData(const Model *model,
 			FXMMATRIX object_to_view,
-			CXMMATRIX texture_transform,
-			const Material *material);
+			CXMMATRIX texture_transform) noexcept;
 
 		/**
-		 Process the given opaque models.
+		 Unmaps the model data of this depth pass and draws the written 
+		 opaque models.
 
-		 @param[in]		models
-						A reference to a vector containing the model pointers
-						to process.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix. This 
-						transformation matrix will be used for culling.
-		 @param[in]		world_to_view
-						The world-to-view transformation matrix. This 
-						transformation matrix will be chained with the 
-						object-to-view transformation matrix for transforming 
-						vertices.
+		 @pre			The model data of this depth pass is mapped.
+		 */
+		void DrawOpaqueModels() noexcept;
+
+		/**
+		 Unmaps the model data of this depth pass and draws the written 
+		 transparent models.
+
+		 @pre			The model data of this depth pass is mapped.
+		 */
+		void DrawTransparentModels() noexcept;
+
+		/**
+		 Process the given opaque model instance groups.
+
+		 @param[in]		groups
+						A reference to a vector containing the model instance 
+						groups to process.
+		 @param[in]		ranges
+						A reference to a vector containing the index ranges 
+						of the model instance groups.
 		 @throws		FormattedException
-						Failed to process the models.
+						Failed to process the model instance groups.
 		 */
-		void XM_CALLCONV ProcessOpaqueModels(
-			const vector< const ModelNode * > &models,
-			FXMMATRIX world_to_projection, 
-			CXMMATRIX world_to_view);
+		void ProcessOpaqueModels(const ArenaVector< ModelInstanceGroup > &groups,
+			const ArenaVector< IndexRange > &ranges);
 
 		/**
 		 Process the given opaque occluder models.
@@ -250,7 +353,7 @@ namespace mage {
 						Failed to process the models.
 		 */
 		void XM_CALLCONV ProcessOpaqueOccluderModels(
-			const vector< const ModelNode * > &models,
+			const ArenaVector< const ModelNode * > &models,
 			FXMMATRIX world_to_projection, 
 			CXMMATRIX world_to_view);
 
@@ -273,10 +376,52 @@ namespace mage {
 						Failed to process the models.
 		 */
 		void XM_CALLCONV ProcessTransparentOccluderModels(
-			const vector< const ModelNode * > &models,
+			const ArenaVector< const ModelNode * > &models,
 			FXMMATRIX world_to_projection, 
 			CXMMATRIX world_to_view);
 
+		/**
+		 Process the given opaque shadow casters.
+
+		 @param[in]		casters
+						A reference to a vector containing the shadow casters
+						to process.
+		 @param[in]		faces
+						The face mask.
+		 @param[in]		world_to_view
+						The world-to-view transformation matrix. This 
+						transformation matrix will be chained with the 
+						object-to-view transformation matrix for transforming 
+						vertices.
+		 @throws		FormattedException
+						Failed to process the shadow casters.
+		 */
+		void XM_CALLCONV ProcessOpaqueShadowCasters(
+			const vector< ShadowCaster > &casters,
+			U32 faces,
+			FXMMATRIX world_to_view);
+
+		/**
+		 Process the given transparent shadow casters.
+
+		 @param[in]		casters
+						A reference to a vector containing the shadow casters
+						to process.
+		 @param[in]		faces
+						The face mask.
+		 @param[in]		world_to_view
+						The world-to-view transformation matrix. This 
+						transformation matrix will be chained with the 
+						object-to-view transformation matrix for transforming 
+						vertices.
+		 @throws		FormattedException
+						Failed to process the shadow casters.
+		 */
+		void XM_CALLCONV ProcessTransparentShadowCasters(
+			const vector< ShadowCaster > &casters,
+			U32 faces,
+			FXMMATRIX world_to_view);
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -286,11 +431,22 @@ namespace mage {
 		 */
 		ID3D11DeviceContext4 * const m_device_context;
 
+		/**
+		 A pointer to the constant buffer ring of this depth pass.
+		 */
+		ConstantBufferRing * const m_constant_buffer_ring;
+
 		/**
 		 A pointer to the vertex shader of this depth pass.
 		 */
 		const SharedPtr< const VertexShader > m_opaque_vs;
 
+		/**
+		 A pointer to the vertex shader for instanced opaque models of this 
+		 depth pass.
+		 */
+		const SharedPtr< const VertexShader > m_opaque_instanced_vs;
+
 		/**
 		 A pointer to the vertex shader for transparent models
 		 of this depth pass.
@@ -309,18 +465,9 @@ namespace mage {
 		ConstantBuffer< XMMATRIX > m_projection_buffer;
 
 		/**
-		 The opaque model buffer of this depth pass.
-		 */
-		ConstantBuffer< XMMATRIX > m_opaque_model_buffer;
-
-		/**
-		 The transparent model buffer of this depth pass.
-		 */
-		ConstantBuffer< ModelTextureTransformBuffer > m_transparent_model_buffer;
-
-		/**
-		 The dissolve buffer of this depth pass. 
+		 A vector containing the models and the ranges of the model data of 
+		 the written models of this depth pass.
 		 */
-		ConstantBuffer< XMVECTOR > m_dissolve_buffer;
+		vector< ModelDraw > m_model_draws;
 	};
 }
\ No newline at end of file
@@ -23,9 +23,12 @@ namespace mage {
 		return Renderer::Get()->GetDOFPass();
 	}
 
-	DOFPass::DOFPass()
-		: m_device_context(Pipeline::GetImmediateDeviceContext()),
-		m_cs(CreateDepthOfFieldCS()) {}
+	DOFPass::DOFPass(ID3D11DeviceContext4 *device_context)
+		: m_device_context(device_context),
+		m_cs(CreateDepthOfFieldCS()) {
+
+		Assert(m_device_context);
+	}
 
 	DOFPass::DOFPass(DOFPass &&render_pass) = default;
 
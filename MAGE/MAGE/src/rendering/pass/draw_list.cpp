@@ -0,0 +1,152 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering\pass\draw_list.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The maximum number of draw items of a draw list before that draw list is
+	 radix sorted instead of insertion sorted.
+	 */
+	constexpr size_t g_insertion_sort_threshold = 32;
+
+	/**
+	 Appends the given field to the given sort key.
+
+	 @param[in]		key
+					The sort key.
+	 @param[in]		value
+					The value of the field (will be clamped).
+	 @param[in]		nb_bits
+					The number of bits of the field.
+	 @return		The sort key with the given field appended.
+	 */
+	constexpr U64 AppendSortKeyField(U64 key, U32 value, U32 nb_bits) noexcept {
+		return (key << nb_bits)
+			| std::min(value, GetMaxSortKeyField(nb_bits));
+	}
+
+	U32 QuantizeSortKeyDepth(F32 depth) noexcept {
+		// The bit patterns of non-negative floats preserve their order.
+		const F32 clamped_depth = std::max(depth, 0.0f);
+		U32 bits;
+		std::memcpy(&bits, &clamped_depth, sizeof(bits));
+		return bits >> (32u - g_sort_key_depth_bits);
+	}
+
+	U64 MakeOpaqueSortKey(U32 queue, U32 shader, U32 textures,
+		U32 mesh, U32 material, U32 depth) noexcept {
+
+		U64 key = 0u;
+		key = AppendSortKeyField(key, queue,    g_sort_key_queue_bits);
+		key = AppendSortKeyField(key, shader,   g_sort_key_shader_bits);
+		key = AppendSortKeyField(key, textures, g_sort_key_textures_bits);
+		key = AppendSortKeyField(key, mesh,     g_sort_key_mesh_bits);
+		key = AppendSortKeyField(key, material, g_sort_key_material_bits);
+		// Front-to-back
+		key = AppendSortKeyField(key, depth,    g_sort_key_depth_bits);
+		return key;
+	}
+
+	U64 MakeTransparentSortKey(U32 queue, U32 shader, U32 textures,
+		U32 mesh, U32 material, U32 depth) noexcept {
+
+		const U32 max_depth = GetMaxSortKeyField(g_sort_key_depth_bits);
+
+		U64 key = 0u;
+		// Back-to-front
+		key = AppendSortKeyField(key, max_depth - std::min(depth, max_depth),
+			                                    g_sort_key_depth_bits);
+		key = AppendSortKeyField(key, queue,    g_sort_key_queue_bits);
+		key = AppendSortKeyField(key, shader,   g_sort_key_shader_bits);
+		key = AppendSortKeyField(key, textures, g_sort_key_textures_bits);
+		key = AppendSortKeyField(key, mesh,     g_sort_key_mesh_bits);
+		key = AppendSortKeyField(key, material, g_sort_key_material_bits);
+		return key;
+	}
+
+	DrawList::DrawList()
+		: m_items(), m_buffer() {}
+
+	DrawList::DrawList(const DrawList &draw_list) = default;
+
+	DrawList::DrawList(DrawList &&draw_list) = default;
+
+	DrawList::~DrawList() = default;
+
+	DrawList &DrawList::operator=(const DrawList &draw_list) = default;
+
+	DrawList &DrawList::operator=(DrawList &&draw_list) = default;
+
+	void DrawList::Sort() {
+		const size_t nb_items = m_items.size();
+
+		if (nb_items <= g_insertion_sort_threshold) {
+			for (size_t i = 1; i < nb_items; ++i) {
+				const DrawItem item = m_items[i];
+
+				size_t j = i;
+				for (; 0 < j && item.m_key < m_items[j - 1].m_key; --j) {
+					m_items[j] = m_items[j - 1];
+				}
+				m_items[j] = item;
+			}
+			return;
+		}
+
+		// Least significant digit radix sort with 8-bit digits.
+		constexpr size_t nb_digits = sizeof(U64);
+		constexpr size_t nb_bins   = 256;
+
+		// Compute the histograms of all digits in a single pass.
+		size_t counts[nb_digits][nb_bins] = {};
+		for (const auto &item : m_items) {
+			for (size_t digit = 0; digit < nb_digits; ++digit) {
+				++counts[digit][(item.m_key >> (8u * digit)) & 0xFFu];
+			}
+		}
+
+		m_buffer.resize(nb_items);
+
+		for (size_t digit = 0; digit < nb_digits; ++digit) {
+			size_t (&count)[nb_bins] = counts[digit];
+			const size_t shift = 8u * digit;
+
+			// Skip the digits which are equal for all draw items.
+			if (nb_items == count[(m_items[0].m_key >> shift) & 0xFFu]) {
+				continue;
+			}
+
+			size_t offset = 0;
+			for (size_t bin = 0; bin < nb_bins; ++bin) {
+				const size_t nb_bin_items = count[bin];
+				count[bin] = offset;
+				offset    += nb_bin_items;
+			}
+
+			for (const auto &item : m_items) {
+				m_buffer[count[(item.m_key >> shift) & 0xFFu]++] = item;
+			}
+
+			m_items.swap(m_buffer);
+		}
+	}
+}
\ No newline at end of file
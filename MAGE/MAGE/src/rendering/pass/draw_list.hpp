@@ -0,0 +1,286 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "utils\type\types.hpp"
+#include "utils\collection\collection.hpp"
+#include "utils\memory\memory_arena.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// Sort Keys
+	//-------------------------------------------------------------------------
+
+	/**
+	 The number of bits of the queue field of a sort key.
+	 */
+	constexpr U32 g_sort_key_queue_bits    = 2u;
+
+	/**
+	 The number of bits of the shader permutation field of a sort key.
+	 */
+	constexpr U32 g_sort_key_shader_bits   = 3u;
+
+	/**
+	 The number of bits of the texture set field of a sort key.
+	 */
+	constexpr U32 g_sort_key_textures_bits = 12u;
+
+	/**
+	 The number of bits of the mesh field of a sort key.
+	 */
+	constexpr U32 g_sort_key_mesh_bits     = 12u;
+
+	/**
+	 The number of bits of the material field of a sort key.
+	 */
+	constexpr U32 g_sort_key_material_bits = 11u;
+
+	/**
+	 The number of bits of the depth field of a sort key.
+	 */
+	constexpr U32 g_sort_key_depth_bits    = 24u;
+
+	static_assert(64u == g_sort_key_queue_bits
+		               + g_sort_key_shader_bits
+		               + g_sort_key_textures_bits
+		               + g_sort_key_mesh_bits
+		               + g_sort_key_material_bits
+		               + g_sort_key_depth_bits,
+		"Sort key layout mismatch");
+
+	/**
+	 Returns the maximum value of a sort key field with the given number of
+	 bits.
+
+	 @param[in]		nb_bits
+					The number of bits of the sort key field.
+	 @return		The maximum value of a sort key field with the given
+					number of bits.
+	 */
+	constexpr U32 GetMaxSortKeyField(U32 nb_bits) noexcept {
+		return (1u << nb_bits) - 1u;
+	}
+
+	/**
+	 Quantizes the given view-space depth to the depth field of a sort key.
+
+	 @param[in]		depth
+					The view-space depth.
+	 @return		The quantized depth. Larger depths result in larger
+					quantized depths.
+	 */
+	U32 QuantizeSortKeyDepth(F32 depth) noexcept;
+
+	/**
+	 Constructs a sort key for opaque geometry. Opaque geometry is sorted by
+	 queue, shader permutation, texture set, mesh and material to minimize
+	 state changes, and front-to-back to reduce overdraw.
+
+	 @param[in]		queue
+					The queue.
+	 @param[in]		shader
+					The shader permutation.
+	 @param[in]		textures
+					The texture set identifier.
+	 @param[in]		mesh
+					The mesh identifier.
+	 @param[in]		material
+					The material identifier.
+	 @param[in]		depth
+					The quantized view-space depth.
+	 @return		The sort key.
+	 */
+	U64 MakeOpaqueSortKey(U32 queue, U32 shader, U32 textures,
+		U32 mesh, U32 material, U32 depth) noexcept;
+
+	/**
+	 Constructs a sort key for transparent geometry. Transparent geometry is
+	 sorted back-to-front for correct blending, and by queue, shader
+	 permutation, texture set, mesh and material for equal depths.
+
+	 @param[in]		queue
+					The queue.
+	 @param[in]		shader
+					The shader permutation.
+	 @param[in]		textures
+					The texture set identifier.
+	 @param[in]		mesh
+					The mesh identifier.
+	 @param[in]		material
+					The material identifier.
+	 @param[in]		depth
+					The quantized view-space depth.
+	 @return		The sort key.
+	 */
+	U64 MakeTransparentSortKey(U32 queue, U32 shader, U32 textures,
+		U32 mesh, U32 material, U32 depth) noexcept;
+
+	//-------------------------------------------------------------------------
+	// DrawItem
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of draw items.
+	 */
+	struct DrawItem final {
+
+		/**
+		 The sort key of this draw item.
+		 */
+		U64 m_key;
+
+		/**
+		 The index of the drawable of this draw item.
+		 */
+		U32 m_index;
+	};
+
+	//-------------------------------------------------------------------------
+	// DrawList
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of draw lists.
+
+	 A draw list contains draw items which are radix sorted on their 64-bit
+	 sort keys.
+	 */
+	class DrawList final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a draw list.
+		 */
+		DrawList();
+
+		/**
+		 Constructs a draw list from the given draw list.
+
+		 @param[in]		draw_list
+						A reference to the draw list to copy.
+		 */
+		DrawList(const DrawList &draw_list);
+
+		/**
+		 Constructs a draw list by moving the given draw list.
+
+		 @param[in]		draw_list
+						A reference to the draw list to move.
+		 */
+		DrawList(DrawList &&draw_list);
+
+		/**
+		 Destructs this draw list.
+		 */
+		~DrawList();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given draw list to this draw list.
+
+		 @param[in]		draw_list
+						A reference to the draw list to copy.
+		 @return		A reference to the copy of the given draw list (i.e.
+						this draw list).
+		 */
+		DrawList &operator=(const DrawList &draw_list);
+
+		/**
+		 Moves the given draw list to this draw list.
+
+		 @param[in]		draw_list
+						A reference to the draw list to move.
+		 @return		A reference to the moved draw list (i.e. this draw
+						list).
+		 */
+		DrawList &operator=(DrawList &&draw_list);
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the draw items of this draw list.
+
+		 @return		A reference to the vector containing the draw items
+						of this draw list.
+		 */
+		const ArenaVector< DrawItem > &GetItems() const noexcept {
+			return m_items;
+		}
+
+		/**
+		 Adds a draw item to this draw list.
+
+		 @param[in]		key
+						The sort key of the draw item.
+		 @param[in]		index
+						The index of the drawable of the draw item.
+		 */
+		void Add(U64 key, U32 index) {
+			m_items.push_back({ key, index });
+		}
+
+		/**
+		 Removes all draw items from this draw list.
+		 */
+		void Clear() noexcept {
+			m_items.clear();
+		}
+
+		/**
+		 Removes all draw items from this draw list and rebinds the storage 
+		 of this draw list to the given memory arena.
+
+		 @param[in]		memory_arena
+						A pointer to the memory arena. If @c nullptr, this 
+						draw list allocates from the general heap.
+		 @throws		std::bad_alloc
+						Failed to allocate the memory block.
+		 */
+		void Rebind(MemoryArena *memory_arena) {
+			RebindArenaVector(m_items,  memory_arena);
+			RebindArenaVector(m_buffer, memory_arena);
+		}
+
+		/**
+		 Sorts the draw items of this draw list in ascending order of their
+		 sort keys. The sort is stable.
+		 */
+		void Sort();
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the draw items of this draw list.
+		 */
+		ArenaVector< DrawItem > m_items;
+
+		/**
+		 A vector containing the scratch draw items of this draw list.
+		 */
+		ArenaVector< DrawItem > m_buffer;
+	};
+}
\ No newline at end of file
@@ -4,8 +4,8 @@
 #pragma region
 
 #include "rendering\rendering_manager.hpp"
+#include "core\engine_statistics.hpp"
 #include "resource\resource_factory.hpp"
-#include "math\geometry\view_frustum.hpp"
 #include "utils\logging\error.hpp"
 
 // Include HLSL bindings.
@@ -13,6 +13,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -24,12 +33,20 @@ namespace mage {
 		return Renderer::Get()->GetGBufferPass();
 	}
 
-	GBufferPass::GBufferPass()
-		: m_device_context(Pipeline::GetImmediateDeviceContext()),
-		m_vs(CreateTransformVS()),
+	GBufferPass::GBufferPass(ID3D11DeviceContext4 *device_context,
+		ConstantBufferRing *constant_buffer_ring)
+		: m_device_context(device_context),
+		m_constant_buffer_ring(constant_buffer_ring),
+		m_vs(CreateTransformInstancedVS()),
 		m_ps{ CreateGBufferPS(false), CreateGBufferPS(true) },
 		m_bound_ps(PSIndex::Count),
-		m_model_buffer() {}
+		m_bound_mesh(nullptr),
+		m_bound_srvs{},
+		m_model_bindings() {
+
+		Assert(m_device_context);
+		Assert(m_constant_buffer_ring);
+	}
 
 	GBufferPass::GBufferPass(GBufferPass &&render_pass) = default;
 
@@ -39,6 +56,7 @@ namespace mage {
 		if (m_bound_ps != index) {
 			m_ps[static_cast< size_t >(index)]->BindShader(m_device_context);
 			m_bound_ps = index;
+			EngineStatistics::Get()->IncrementNumberOfShaderBinds();
 		}
 	}
 
@@ -51,47 +69,85 @@ namespace mage {
 		}
 	}
 
-	void XM_CALLCONV GBufferPass::BindModelData(
-		FXMMATRIX object_to_view, 
-		CXMMATRIX view_to_object,
-		CXMMATRIX texture_transform,
-		const Material *material) {
-
-		ModelBuffer buffer;
-		// Transforms
-		buffer.m_transform.m_object_to_view    = XMMatrixTranspose(object_to_view);
-		buffer.m_transform.m_normal_to_view    = view_to_object;
-		buffer.m_transform.m_texture_transform = XMMatrixTranspose(texture_transform);
-		// Material
-		buffer.m_base_color = RGBA(material->GetBaseColor());
-		buffer.m_roughness  = material->GetRoughness();
-		buffer.m_metalness  = material->GetMetalness();
-		
-		// Update the model buffer.
-		m_model_buffer.UpdateData(m_device_context, buffer);
+	void GBufferPass::WriteModelData(
+		const ArenaVector< ModelInstanceGroup > &groups, 
+		size_t begin, size_t end) {
+
+		ConstantBufferRing &ring = *m_constant_buffer_ring;
+
+		m_model_bindings.clear();
+		ring.Map(m_device_context, (end - begin)
+			* ConstantBufferRing::GetAllocationSize< ModelBuffer >());
+
+		for (size_t g = begin; g < end; ++g) {
+			const auto &group = groups[g];
+			const Material * const material 
+				= group.m_node->GetModel()->GetMaterial();
+
+			ModelBuffer buffer;
+			// Instancing
+			buffer.m_instance_start = group.m_instance_start;
+			// Material
+			buffer.m_base_color = RGBA(material->GetBaseColor());
+			buffer.m_roughness  = material->GetRoughness();
+			buffer.m_metalness  = material->GetMetalness();
+
+			m_model_bindings.push_back(ring.Write(buffer));
+		}
+
+		ring.Unmap(m_device_context);
+	}
+
+	void GBufferPass::BindModelData(
+		const ConstantBufferBinding &model_binding, 
+		const Material *material) noexcept {
+
 		// Bind the model buffer.
-		m_model_buffer.Bind< Pipeline::VS >(
-			m_device_context, SLOT_CBUFFER_MODEL);
-		m_model_buffer.Bind< Pipeline::PS >(
-			m_device_context, SLOT_CBUFFER_MODEL);
-
-		// Bind the base color SRV.
-		Pipeline::PS::BindSRV(m_device_context, 
-			SLOT_SRV_BASE_COLOR, material->GetBaseColorSRV());
-		// Bind the material SRV.
-		Pipeline::PS::BindSRV(m_device_context, 
-			SLOT_SRV_MATERIAL, material->GetMaterialSRV());
-		// Bind the normal SRV.
-		Pipeline::PS::BindSRV(m_device_context, 
-			SLOT_SRV_NORMAL, material->GetNormalSRV());
+		ConstantBufferRing::Bind< Pipeline::VS >(
+			m_device_context, SLOT_CBUFFER_MODEL, model_binding);
+		ConstantBufferRing::Bind< Pipeline::PS >(
+			m_device_context, SLOT_CBUFFER_MODEL, model_binding);
+
+		const array< ID3D11ShaderResourceView *, 3 > srvs = {
+			material->GetBaseColorSRV(),
+			material->GetMaterialSRV(),
+			material->GetNormalSRV()
+		};
+		const U32 slots[] = {
+			SLOT_SRV_BASE_COLOR,
+			SLOT_SRV_MATERIAL,
+			SLOT_SRV_NORMAL
+		};
+
+		// Bind the base color, material and normal SRV.
+		for (size_t i = 0; i < srvs.size(); ++i) {
+			if (m_bound_srvs[i] == srvs[i]) {
+				continue;
+			}
+
+			Pipeline::PS::BindSRV(m_device_context, slots[i], srvs[i]);
+			m_bound_srvs[i] = srvs[i];
+			EngineStatistics::Get()->IncrementNumberOfSRVBinds();
+		}
+	}
+
+	void GBufferPass::BindMesh(const Model *model) noexcept {
+		if (m_bound_mesh != model->GetMesh()) {
+			model->BindMesh(m_device_context);
+			m_bound_mesh = model->GetMesh();
+			EngineStatistics::Get()->IncrementNumberOfMeshBinds();
+		}
 	}
 
 	void GBufferPass::BindFixedState() {
-		// Reset the bound pixel shader index.
-		m_bound_ps = PSIndex::Count;
+		// Reset the bound pixel shader index, mesh and SRVs.
+		m_bound_ps   = PSIndex::Count;
+		m_bound_mesh = nullptr;
+		m_bound_srvs.fill(nullptr);
 
 		// VS: Bind the vertex shader.
 		m_vs->BindShader(m_device_context);
+		EngineStatistics::Get()->IncrementNumberOfShaderBinds();
 		// HS: Bind the hull shader.
 		Pipeline::HS::BindShader(m_device_context, nullptr);
 		// DS: Bind the domain shader.
@@ -110,55 +166,67 @@ namespace mage {
 		RenderingStateManager::Get()->BindOpaqueBlendState(m_device_context);
 	}
 
-	void XM_CALLCONV GBufferPass::Render(
-		const PassBuffer *scene,
-		FXMMATRIX world_to_projection,
-		CXMMATRIX world_to_view,
-		CXMMATRIX view_to_world) {
+	void GBufferPass::Render(const PassBuffer *scene) {
+
+		Assert(scene);
+
+		Render(scene, 0u, 
+			scene->GetVisibleOpaqueBRDFInstanceGroups().size()
+			+ scene->GetVisibleTransparentBRDFInstanceGroups().size());
+	}
+
+	void GBufferPass::Render(const PassBuffer *scene, 
+		size_t begin, size_t end) {
 
 		Assert(scene);
 
+		const auto &opaque_groups 
+			= scene->GetVisibleOpaqueBRDFInstanceGroups();
+		const auto &transparent_groups 
+			= scene->GetVisibleTransparentBRDFInstanceGroups();
+		const size_t transparent_start = opaque_groups.size();
+
 		// Process the models.
-		ProcessModels(scene->GetOpaqueBRDFModels(), 
-			world_to_projection, world_to_view, view_to_world);
-		ProcessModels(scene->GetTransparentBRDFModels(),
-			world_to_projection, world_to_view, view_to_world);
+		ProcessModels(opaque_groups,
+			std::min(begin, transparent_start),
+			std::min(end,   transparent_start),
+			scene->GetIndexRanges());
+		ProcessModels(transparent_groups,
+			std::max(begin, transparent_start) - transparent_start,
+			std::max(end,   transparent_start) - transparent_start,
+			scene->GetIndexRanges());
 	}
 
-	void XM_CALLCONV GBufferPass::ProcessModels(
-		const vector< const ModelNode * > &models,
-		FXMMATRIX world_to_projection, 
-		CXMMATRIX world_to_view, 
-		CXMMATRIX view_to_world) {
-
-		for (const auto node : models) {
-			
-			// Obtain node components (1/2).
-			const TransformNode * const transform = node->GetTransform();
-			const Model         * const model     = node->GetModel();
-			const XMMATRIX object_to_world        = transform->GetObjectToWorldMatrix();
-			const XMMATRIX object_to_projection   = object_to_world * world_to_projection;
-
-			// Cull the model against the view frustum.
-			if (ViewFrustum::Cull(object_to_projection, model->GetAABB())) {
-				continue;
-			}
+	void GBufferPass::ProcessModels(
+		const ArenaVector< ModelInstanceGroup > &groups,
+		size_t begin, size_t end, 
+		const ArenaVector< IndexRange > &ranges) {
+
+		if (begin >= end) {
+			return;
+		}
+
+		// Write the model data of all model instance groups at once.
+		WriteModelData(groups, begin, end);
+
+		for (size_t g = begin; g < end; ++g) {
+			const auto &group = groups[g];
 
-			// Obtain node components (2/2).
-			const XMMATRIX object_to_view         = object_to_world * world_to_view;
-			const XMMATRIX world_to_object        = transform->GetWorldToObjectMatrix();
-			const XMMATRIX view_to_object         = view_to_world * world_to_object;
-			const XMMATRIX texture_transform      = node->GetTextureTransform()->GetTransformMatrix();
-			const Material * const material       = model->GetMaterial();
+			// Obtain node components.
+			const Model    * const model    = group.m_node->GetModel();
+			const Material * const material = model->GetMaterial();
 
 			// Bind the model data.
-			BindModelData(object_to_view, view_to_object, texture_transform, material);
+			BindModelData(m_model_bindings[g - begin], material);
 			// Bind the pixel shader.
 			BindPS(material);
 			// Bind the model mesh.
-			model->BindMesh(m_device_context);
-			// Draw the model.
-			model->Draw(m_device_context);
+			BindMesh(model);
+			// Draw the visible mesh clusters of the model instances.
+			for (U32 i = 0u; i < group.m_nb_ranges; ++i) {
+				model->DrawInstanced(m_device_context, 
+					ranges[group.m_range_start + i], group.m_nb_instances);
+			}
 		}
 	}
 }
\ No newline at end of file
@@ -6,12 +6,21 @@
 #pragma region
 
 #include "rendering\pass\pass_buffer.hpp"
-#include "rendering\buffer\constant_buffer.hpp"
+#include "rendering\buffer\constant_buffer_ring.hpp"
 #include "rendering\buffer\model_buffer.hpp"
 #include "shader\shader.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+#define MAGE_DEFAULT_GBUFFER_BATCH_SIZE 64
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations end Definitions
 //-----------------------------------------------------------------------------
@@ -49,8 +58,15 @@ namespace mage {
 						loaded.
 		 @pre			The resource manager associated with the current engine 
 						must be loaded.
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			@a constant_buffer_ring is not equal to @c nullptr.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		constant_buffer_ring
+						A pointer to the constant buffer ring.
 		 */
-		GBufferPass();
+		GBufferPass(ID3D11DeviceContext4 *device_context,
+			ConstantBufferRing *constant_buffer_ring);
 
 		/**
 		 Constructs a GBuffer pass from the given GBuffer pass.
@@ -115,20 +131,27 @@ namespace mage {
 		 @pre			@a scene is not equal to @c nullptr.
 		 @param[in]		scene
 						A pointer to the scene.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
-		 @param[in]		world_to_view
-						The world-to-view transformation matrix.
-		 @param[in]		view_to_world
-						The view-to-world transformation matrix.
 		 @throws		FormattedException
 						Failed to render the scene.
 		 */
-		void XM_CALLCONV Render(
-			const PassBuffer *scene,
-			FXMMATRIX world_to_projection,
-			CXMMATRIX world_to_view,
-			CXMMATRIX view_to_world);
+		void Render(const PassBuffer *scene);
+
+		/**
+		 Renders the given range of model instance groups of the scene. The 
+		 opaque and transparent model instance groups are numbered 
+		 consecutively.
+
+		 @pre			@a scene is not equal to @c nullptr.
+		 @param[in]		scene
+						A pointer to the scene.
+		 @param[in]		begin
+						The index of the first model instance group.
+		 @param[in]		end
+						The index past the last model instance group.
+		 @throws		FormattedException
+						Failed to render the scene.
+		 */
+		void Render(const PassBuffer *scene, size_t begin, size_t end);
 		
 	private:
 
@@ -169,58 +192,64 @@ namespace mage {
 		 */
 		void BindPS(const Material *material) noexcept;
 		
+		/**
+		 Writes the model data of the given range of model instance groups to 
+		 the constant buffer ring of this GBuffer pass.
+
+		 @param[in]		groups
+						A reference to a vector containing the model instance 
+						groups.
+		 @param[in]		begin
+						The index of the first model instance group.
+		 @param[in]		end
+						The index past the last model instance group.
+		 @throws		FormattedException
+						Failed to write the model data of this GBuffer pass.
+		 */
+		void WriteModelData(const ArenaVector< ModelInstanceGroup > &groups,
+			size_t begin, size_t end);
+
 		/**
 		 Binds the model data of this GBuffer pass.
 
 		 @pre			@a material is not equal to @c nullptr.
-		 @param[in]		object_to_view
-						The object-to-view transformation matrix used for 
-						transforming vertices.
-		 @param[in]		view_to_object
-						The view-to-object transformation matrix used for
-						transforming normals.
-		 @param[in]		texture_transform
-						The texture transformation matrix used for
-						transforming texture coordinates.
+		 @param[in]		model_binding
+						A reference to the range of the model data in the 
+						constant buffer ring of the renderer.
 		 @param[in]		material
 						A pointer to the material.
-		 @throws		FormattedException
-						Failed to bind the model data 
-						of this GBuffer pass.
-		 */
-		void XM_CALLCONV BindModelData(
-			FXMMATRIX object_to_view, 
-			CXMMATRIX view_to_object,
-			CXMMATRIX texture_transform,
-			const Material *material);
+		 */
+		void BindModelData(const ConstantBufferBinding &model_binding, 
+			const Material *material) noexcept;
 		
 		/**
-		 Process the given models.
-
-		 @param[in]		models
-						A reference to a vector containing the model pointers
-						to process.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix. This 
-						transformation matrix will be used for culling.
-		 @param[in]		world_to_view
-						The world-to-view transformation matrix. This 
-						transformation matrix will be chained with the 
-						object-to-view transformation matrix for transforming 
-						vertices.
-		 @param[in]		view_to_world
-						The view-to-world transformation matrix. This 
-						transformation matrix will be chained with the 
-						world-to-object transformation matrix for transforming 
-						normals.
+		 Binds the mesh of the given model of this GBuffer pass, if not already 
+		 bound.
+
+		 @pre			@a model is not equal to @c nullptr.
+		 @param[in]		model
+						A pointer to the model.
+		 */
+		void BindMesh(const Model *model) noexcept;
+
+		/**
+		 Process the given range of model instance groups.
+
+		 @param[in]		groups
+						A reference to a vector containing the model instance 
+						groups to process.
+		 @param[in]		begin
+						The index of the first model instance group.
+		 @param[in]		end
+						The index past the last model instance group.
+		 @param[in]		ranges
+						A reference to a vector containing the index ranges 
+						of the model instance groups.
 		 @throws		FormattedException
-						Failed to process the models.
+						Failed to process the model instance groups.
 		 */
-		void XM_CALLCONV ProcessModels(
-			const vector< const ModelNode * > &models,
-			FXMMATRIX world_to_projection, 
-			CXMMATRIX world_to_view, 
-			CXMMATRIX view_to_world);
+		void ProcessModels(const ArenaVector< ModelInstanceGroup > &groups,
+			size_t begin, size_t end, const ArenaVector< IndexRange > &ranges);
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -231,6 +260,11 @@ namespace mage {
 		 */
 		ID3D11DeviceContext4 * const m_device_context;
 
+		/**
+		 A pointer to the constant buffer ring of this GBuffer pass.
+		 */
+		ConstantBufferRing * const m_constant_buffer_ring;
+
 		/**
 		 A pointer to the vertex shader of this GBuffer pass.
 		 */
@@ -248,8 +282,20 @@ namespace mage {
 		PSIndex m_bound_ps;
 
 		/**
-		 The model buffer of this GBuffer pass.
+		 A pointer to the bound mesh of this GBuffer pass.
+		 */
+		const Mesh *m_bound_mesh;
+
+		/**
+		 An array containing pointers to the bound material shader resource 
+		 views (i.e. base color, material and normal SRV) of this GBuffer pass.
+		 */
+		array< ID3D11ShaderResourceView *, 3 > m_bound_srvs;
+
+		/**
+		 A vector containing the ranges of the model data of the processed 
+		 model instance groups of this GBuffer pass.
 		 */
-		ConstantBuffer< ModelBuffer > m_model_buffer;
+		vector< ConstantBufferBinding > m_model_bindings;
 	};
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "core\engine_statistics.hpp"
 #include "rendering\rendering_manager.hpp"
 #include "math\geometry\view_frustum.hpp"
 #include "utils\logging\error.hpp"
@@ -12,13 +13,64 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage {
 
-	LBufferPass::LBufferPass()
-		: m_device_context(Pipeline::GetImmediateDeviceContext()),
+	/**
+	 Returns the camera-view-space bounding sphere of the given spotlight.
+
+	 @param[in]		p
+					The camera-view-space position of the spotlight.
+	 @param[in]		d
+					The (normalized) camera-view-space direction of the 
+					spotlight.
+	 @param[in]		range
+					The range of the spotlight.
+	 @param[in]		cos_umbra
+					The cosine of the umbra angle of the spotlight.
+	 @return		The camera-view-space bounding sphere of the given 
+					spotlight.
+	 */
+	inline const BS XM_CALLCONV GetSpotLightVolume(FXMVECTOR p, 
+		FXMVECTOR d, F32 range, F32 cos_umbra) noexcept {
+
+		Point3 centroid;
+		F32 radius;
+
+		if (cos_umbra <= 0.0f) {
+			// The cone spans at least a hemisphere.
+			XMStoreFloat3(&centroid, p);
+			radius = range;
+		}
+		else if (cos_umbra <= 0.70710678f) {
+			// The umbra angle is at least 45 degrees: the sphere through the
+			// rim of the cone's cap.
+			XMStoreFloat3(&centroid, p + range * cos_umbra * d);
+			radius = range * std::sqrt(1.0f - cos_umbra * cos_umbra);
+		}
+		else {
+			// The sphere through the apex and the rim of the cone's cap.
+			const F32 distance = 0.5f * range / cos_umbra;
+			XMStoreFloat3(&centroid, p + distance * d);
+			radius = distance;
+		}
+
+		return BS(centroid, radius);
+	}
+
+	LBufferPass::LBufferPass(ID3D11DeviceContext4 *device_context)
+		: m_device_context(device_context),
 		m_light_buffer(),
 		m_directional_lights(3),
 		m_omni_lights(32),
@@ -26,12 +78,29 @@ namespace mage {
 		m_sm_directional_lights(1),
 		m_sm_omni_lights(1),
 		m_sm_spot_lights(1),
-		m_directional_sms(MakeUnique< ShadowMapBuffer >()),
+		m_directional_sms(MakeUnique< ShadowMapBuffer >(1, 
+			MAGE_DEFAULT_CASCADE_SHADOW_MAP_RESOLUTION, 
+			MAGE_DEFAULT_CASCADE_SHADOW_MAP_RESOLUTION, 
+			DepthFormat::D32)),
 		m_omni_sms(MakeUnique< ShadowCubeMapBuffer >()),
 		m_spot_sms(MakeUnique< ShadowMapBuffer >()),
 		m_directional_light_cameras(),
 		m_omni_light_cameras(),
-		m_spot_light_cameras() {}
+		m_spot_light_cameras(), 
+		m_shadow_casters(),
+		m_directional_light_casters(),
+		m_omni_light_casters(),
+		m_spot_light_casters(),
+		m_light_grid(),
+		m_light_clusters(1),
+		m_light_indices(256),
+		m_light_volumes(), 
+		m_light_bss(), 
+		m_light_aabbs(), 
+		m_visible_indices() {
+
+		Assert(m_device_context);
+	}
 
 	void XM_CALLCONV LBufferPass::Render(
 		const PassBuffer *scene, 
@@ -41,6 +110,8 @@ namespace mage {
 
 		Assert(scene);
 		
+		const XMMATRIX view_to_projection = view_to_world * world_to_projection;
+
 		// Process the lights without shadow mapping.
 		ProcessLights(scene->GetDirectionalLights(),
 			world_to_view);
@@ -49,9 +120,12 @@ namespace mage {
 		ProcessLights(scene->GetSpotLights(), 
 			world_to_projection, world_to_view);
 		
+		// Update the shadow casters.
+		m_shadow_casters.Update(scene);
+
 		// Process the lights with shadow mapping.
 		ProcessLightsWithShadowMapping(scene->GetDirectionalLightsWithShadowMapping(), 
-			world_to_view, view_to_world);
+			view_to_projection, world_to_view, view_to_world);
 		ProcessLightsWithShadowMapping(scene->GetOmniLightsWithShadowMapping(), 
 			world_to_projection, world_to_view, view_to_world);
 		ProcessLightsWithShadowMapping(scene->GetSpotLightsWithShadowMapping(), 
@@ -62,7 +136,10 @@ namespace mage {
 		// Setup the shadow maps.
 		SetupShadowMaps();
 		// Render the shadow maps.
-		RenderShadowMaps(scene, world_to_view);
+		RenderShadowMaps(world_to_view);
+
+		// Process the light clusters.
+		ProcessLightClusters(view_to_projection);
 
 		// Process the lights' data.
 		ProcessLightsData(scene);
@@ -71,6 +148,22 @@ namespace mage {
 		BindLBuffer();
 	}
 
+	void LBufferPass::Rebind(MemoryArena *memory_arena) {
+		// The shadow casters and the directional light casters persist 
+		// across frames and remain on the general heap.
+		RebindArenaVector(m_directional_light_cameras, memory_arena);
+		RebindArenaVector(m_omni_light_cameras,        memory_arena);
+		RebindArenaVector(m_spot_light_cameras,        memory_arena);
+		RebindArenaVector(m_omni_light_casters,        memory_arena);
+		RebindArenaVector(m_spot_light_casters,        memory_arena);
+		for (auto &volumes : m_light_volumes) {
+			RebindArenaVector(volumes, memory_arena);
+		}
+		m_light_bss.Rebind(memory_arena);
+		m_light_aabbs.Rebind(memory_arena);
+		RebindArenaVector(m_visible_indices,           memory_arena);
+	}
+
 	void LBufferPass::UnbindShadowMaps() const noexcept {
 		ID3D11ShaderResourceView * const srvs[3] = {};
 
@@ -114,6 +207,20 @@ namespace mage {
 		Pipeline::CS::BindSRVs(m_device_context,
 			SLOT_SRV_LIGHTS_START,
 			_countof(srvs), srvs);
+
+		// Bind the light cluster SRVs.
+		Pipeline::PS::BindSRV(m_device_context,
+			SLOT_SRV_LIGHT_CLUSTERS,
+			m_light_clusters.Get());
+		Pipeline::CS::BindSRV(m_device_context,
+			SLOT_SRV_LIGHT_CLUSTERS,
+			m_light_clusters.Get());
+		Pipeline::PS::BindSRV(m_device_context,
+			SLOT_SRV_LIGHT_INDEX_LIST,
+			m_light_indices.Get());
+		Pipeline::CS::BindSRV(m_device_context,
+			SLOT_SRV_LIGHT_INDEX_LIST,
+			m_light_indices.Get());
 	}
 
 	void LBufferPass::ProcessLightsData(const PassBuffer *scene) {
@@ -131,16 +238,39 @@ namespace mage {
 		buffer.m_nb_sm_omni_lights        = static_cast< U32 >(m_sm_omni_lights.size());
 		buffer.m_nb_sm_spot_lights        = static_cast< U32 >(m_sm_spot_lights.size());
 		
+		buffer.m_light_grid_size          = m_light_grid.GetSize();
+		buffer.m_light_grid_depth_scale   = m_light_grid.GetDepthScale();
+		buffer.m_light_grid_depth_bias    = m_light_grid.GetDepthBias();
+
 		// Update the light buffer.
 		m_light_buffer.UpdateData(m_device_context, buffer);
 	}
 
+	void XM_CALLCONV LBufferPass::ProcessLightClusters(
+		FXMMATRIX view_to_projection) {
+
+		// Assign the lights to the light clusters.
+		m_light_grid.Update(view_to_projection, m_light_volumes);
+		if (const size_t nb_dropped = m_light_grid.GetNumberOfDroppedLights(); 
+			0 != nb_dropped) {
+
+			// Lights beyond the capacity of a light cluster list are not 
+			// shaded in that light cluster.
+			EngineStatistics::Get()->IncrementNumberOfDroppedClusterLights(
+				static_cast< U32 >(nb_dropped));
+		}
+
+		// Update the buffers for the light clusters.
+		m_light_clusters.UpdateData(m_device_context, m_light_grid.GetClusters());
+		m_light_indices.UpdateData(m_device_context, m_light_grid.GetLightIndices());
+	}
+
 	void XM_CALLCONV LBufferPass::ProcessLights(
-		const vector< const DirectionalLightNode * > &lights,
+		const ArenaVector< const DirectionalLightNode * > &lights,
 		FXMMATRIX world_to_view) {
 
-		vector< DirectionalLightBuffer > buffer;
-		buffer.reserve(lights.size());
+		const auto buffer = m_directional_lights.Map(m_device_context, lights.size());
+		size_t nb_lights = 0;
 
 		for (const auto node : lights) {
 			const TransformNode    * const transform = node->GetTransform();
@@ -155,31 +285,36 @@ namespace mage {
 			light_buffer.m_L = light->GetRadianceSpectrum();
 
 			// Add directional light buffer to directional light buffers.
-			buffer.push_back(std::move(light_buffer));
+			buffer[nb_lights++] = light_buffer;
 		}
 
-		// Update the buffer for directional lights.
-		m_directional_lights.UpdateData(m_device_context, buffer);
+		// Unmap the buffer for directional lights.
+		m_directional_lights.Unmap(m_device_context, nb_lights);
 	}
 
 	void XM_CALLCONV LBufferPass::ProcessLights(
-		const vector< const OmniLightNode * > &lights,
+		const ArenaVector< const OmniLightNode * > &lights,
 		FXMMATRIX world_to_projection,
 		CXMMATRIX world_to_view) {
 
-		vector< OmniLightBuffer > buffer;
-		buffer.reserve(lights.size());
-
+		// Cull the lights against the view frustum.
+		const ViewFrustum view_frustum(world_to_projection);
+		m_light_bss.clear();
 		for (const auto node : lights) {
+			m_light_bss.push_back(node->GetLight()->GetBS(), 
+				                  node->GetTransform()->GetObjectToWorldMatrix());
+		}
+		view_frustum.Overlaps(m_light_bss, m_visible_indices);
+
+		const auto buffer = m_omni_lights.Map(m_device_context, m_visible_indices.size());
+		size_t nb_lights = 0;
+		ArenaVector< BS > &volumes = m_light_volumes[0];
+		volumes.clear();
+
+		for (const auto index : m_visible_indices) {
+			const OmniLightNode * const node      = lights[index];
 			const TransformNode * const transform = node->GetTransform();
 			const OmniLight     * const light     = node->GetLight();
-			const XMMATRIX object_to_world        = transform->GetObjectToWorldMatrix();
-			const XMMATRIX object_to_projection   = object_to_world * world_to_projection;
-
-			// Cull the light against the view frustum.
-			if (ViewFrustum::Cull(object_to_projection, light->GetBS())) {
-				continue;
-			}
 
 			// Transform to view space.
 			const XMVECTOR p = XMVector3TransformCoord(transform->GetWorldEye(), world_to_view);
@@ -190,32 +325,40 @@ namespace mage {
 			light_buffer.m_inv_sqr_range = 1.0f / (light->GetRange() * light->GetRange());
 			light_buffer.m_I             = light->GetIntensitySpectrum();
 			
+			// Add the bounding sphere to the light volumes.
+			volumes.push_back(BS(light_buffer.m_p, light->GetRange()));
+
 			// Add omni light buffer to omni light buffers.
-			buffer.push_back(std::move(light_buffer));
+			buffer[nb_lights++] = light_buffer;
 		}
 
-		// Update the buffer for omni lights.
-		m_omni_lights.UpdateData(m_device_context, buffer);
+		// Unmap the buffer for omni lights.
+		m_omni_lights.Unmap(m_device_context, nb_lights);
 	}
 
 	void XM_CALLCONV LBufferPass::ProcessLights(
-		const vector< const SpotLightNode * > &lights,
+		const ArenaVector< const SpotLightNode * > &lights,
 		FXMMATRIX world_to_projection,
 		CXMMATRIX world_to_view) {
 
-		vector< SpotLightBuffer > buffer;
-		buffer.reserve(lights.size());
-
+		// Cull the lights against the view frustum.
+		const ViewFrustum view_frustum(world_to_projection);
+		m_light_aabbs.clear();
 		for (const auto node : lights) {
+			m_light_aabbs.push_back(node->GetLight()->GetAABB(), 
+				                    node->GetTransform()->GetObjectToWorldMatrix());
+		}
+		view_frustum.Overlaps(m_light_aabbs, m_visible_indices);
+
+		const auto buffer = m_spot_lights.Map(m_device_context, m_visible_indices.size());
+		size_t nb_lights = 0;
+		ArenaVector< BS > &volumes = m_light_volumes[1];
+		volumes.clear();
+
+		for (const auto index : m_visible_indices) {
+			const SpotLightNode  * const node      = lights[index];
 			const TransformNode  * const transform = node->GetTransform();
 			const SpotLight      * const light     = node->GetLight();
-			const XMMATRIX object_to_world         = transform->GetObjectToWorldMatrix();
-			const XMMATRIX object_to_projection    = object_to_world * world_to_projection;
-
-			// Cull the light against the view frustum.
-			if (ViewFrustum::Cull(object_to_projection, light->GetAABB())) {
-				continue;
-			}
 
 			// Transform to view space.
 			const XMVECTOR p = XMVector3TransformCoord(transform->GetWorldEye(), world_to_view);
@@ -230,26 +373,41 @@ namespace mage {
 			light_buffer.m_cos_umbra     = light->GetEndAngularCutoff();
 			light_buffer.m_cos_inv_range = 1.0f / light->GetRangeAngularCutoff();
 
+			// Add the bounding sphere to the light volumes.
+			volumes.push_back(GetSpotLightVolume(p, d, light->GetRange(), 
+				                                 light->GetEndAngularCutoff()));
+
 			// Add spotlight buffer to spotlight buffers.
-			buffer.push_back(std::move(light_buffer));
+			buffer[nb_lights++] = light_buffer;
 		}
 
-		// Update the buffer for spotlights.
-		m_spot_lights.UpdateData(m_device_context, buffer);
+		// Unmap the buffer for spotlights.
+		m_spot_lights.Unmap(m_device_context, nb_lights);
 	}
 
 	void XM_CALLCONV LBufferPass::ProcessLightsWithShadowMapping(
-		const vector< const DirectionalLightNode * > &lights,
-		FXMMATRIX world_to_view,
+		const ArenaVector< const DirectionalLightNode * > &lights,
+		FXMMATRIX view_to_projection,
+		CXMMATRIX world_to_view,
 		CXMMATRIX view_to_world) {
 
-		vector< DirectionalLightWithShadowMappingBuffer > buffer;
-		buffer.reserve(lights.size());
+		// Compute the shadow cascade splits of the camera.
+		F32 near_z;
+		F32 ends[g_nb_shadow_cascades];
+		ComputeShadowCascadeSplits(view_to_projection, 
+			MAGE_DEFAULT_SHADOW_DISTANCE, MAGE_DEFAULT_SHADOW_CASCADE_LAMBDA, 
+			near_z, ends);
+
+		const auto buffer = m_sm_directional_lights.Map(m_device_context, lights.size());
+		size_t nb_lights = 0;
 		m_directional_light_cameras.clear();
+		m_directional_light_casters.resize(lights.size() * g_nb_shadow_cascades);
 
 		for (const auto node : lights) {
 			const TransformNode    * const transform = node->GetTransform();
 			const DirectionalLight * const light     = node->GetLight();
+			const XMMATRIX world_to_lview            = transform->GetWorldToViewMatrix();
+			const XMMATRIX cview_to_lview            = view_to_world * world_to_lview;
 
 			// Transform to view space.
 			const XMVECTOR d = XMVector3Normalize(XMVector3TransformNormal(transform->GetWorldForward(), world_to_view));
@@ -259,16 +417,44 @@ namespace mage {
 			XMStoreFloat3(&light_buffer.m_light.m_neg_d, -d);
 			light_buffer.m_light.m_L = light->GetRadianceSpectrum();
 
+			// Create one directional light camera per shadow cascade.
+			for (size_t i = 0; i < g_nb_shadow_cascades; ++i) {
+				// Fit the shadow cascade to its slice of the view frustum.
+				AABB bounds = FitShadowCascade(view_to_projection, cview_to_lview, 
+					(0 == i) ? near_z : ends[i - 1], ends[i], 
+					MAGE_DEFAULT_CASCADE_SHADOW_MAP_RESOLUTION);
+				
+				// Obtain the shadow casters of the shadow cascade and move the 
+				// near plane towards the light to include all of them.
+				ShadowCasterList &casters 
+					= m_directional_light_casters[m_directional_light_cameras.size()];
+				bounds.m_p_min.m_z = m_shadow_casters.GetShadowCasters(
+					world_to_lview, bounds, casters);
+
+				const XMMATRIX cview_to_lprojection 
+					= cview_to_lview * GetShadowCascadeViewToProjectionMatrix(bounds);
+				
+				// Create a directional light camera.
+				LightCameraInfo camera;
+				camera.cview_to_lprojection = cview_to_lprojection;
+
+				// Add directional light camera to the directional light cameras.
+				m_directional_light_cameras.push_back(std::move(camera));
+
+				light_buffer.m_cview_to_lprojection[i] = XMMatrixTranspose(cview_to_lprojection);
+				light_buffer.m_cascade_ends[i]         = ends[i];
+			}
+
 			// Add directional light buffer to directional light buffers.
-			buffer.push_back(std::move(light_buffer));
+			buffer[nb_lights++] = light_buffer;
 		}
 
-		// Update the buffer for directional lights.
-		m_sm_directional_lights.UpdateData(m_device_context, buffer);
+		// Unmap the buffer for directional lights.
+		m_sm_directional_lights.Unmap(m_device_context, nb_lights);
 	}
 
 	void XM_CALLCONV LBufferPass::ProcessLightsWithShadowMapping(
-		const vector< const OmniLightNode * > &lights,
+		const ArenaVector< const OmniLightNode * > &lights,
 		FXMMATRIX world_to_projection,
 		CXMMATRIX world_to_view,
 		CXMMATRIX view_to_world) {
@@ -282,9 +468,12 @@ namespace mage {
 			XMMatrixRotationY(XM_PI),      // Look: -z
 		};
 
-		vector< OmniLightWithShadowMappingBuffer > buffer;
-		buffer.reserve(lights.size());
+		const auto buffer = m_sm_omni_lights.Map(m_device_context, lights.size());
+		size_t nb_lights = 0;
 		m_omni_light_cameras.clear();
+		m_omni_light_casters.clear();
+		ArenaVector< BS > &volumes = m_light_volumes[2];
+		volumes.clear();
 
 		for (const auto node : lights) {
 			const TransformNode * const transform = node->GetTransform();
@@ -309,6 +498,10 @@ namespace mage {
 			}
 			const XMMATRIX cview_to_lview         = view_to_world * world_to_lview;
 
+			// Obtain the shadow casters of the omni light.
+			m_omni_light_casters.push_back(&m_shadow_casters.GetShadowCasters(
+				node, world_to_lview, light->GetRange()));
+
 			// Transform to view space.
 			const XMVECTOR p = XMVector3TransformCoord(transform->GetWorldEye(), world_to_view);
 
@@ -320,23 +513,29 @@ namespace mage {
 			light_buffer.m_cview_to_lview        = XMMatrixTranspose(cview_to_lview);
 			XMStoreFloat2(&light_buffer.m_projection_values, GetNDCZConstructionValues(lview_to_lprojection));
 
+			// Add the bounding sphere to the light volumes.
+			volumes.push_back(BS(light_buffer.m_light.m_p, light->GetRange()));
+
 			// Add omni light buffer to omni light buffers.
-			buffer.push_back(std::move(light_buffer));
+			buffer[nb_lights++] = light_buffer;
 		}
 
-		// Update the buffer for omni lights.
-		m_sm_omni_lights.UpdateData(m_device_context, buffer);
+		// Unmap the buffer for omni lights.
+		m_sm_omni_lights.Unmap(m_device_context, nb_lights);
 	}
 
 	void XM_CALLCONV LBufferPass::ProcessLightsWithShadowMapping(
-		const vector< const SpotLightNode * > &lights,
+		const ArenaVector< const SpotLightNode * > &lights,
 		FXMMATRIX world_to_projection,
 		CXMMATRIX world_to_view,
 		CXMMATRIX view_to_world) {
 
-		vector< SpotLightWithShadowMappingBuffer > buffer;
-		buffer.reserve(lights.size());
+		const auto buffer = m_sm_spot_lights.Map(m_device_context, lights.size());
+		size_t nb_lights = 0;
 		m_spot_light_cameras.clear();
+		m_spot_light_casters.clear();
+		ArenaVector< BS > &volumes = m_light_volumes[3];
+		volumes.clear();
 
 		for (const auto node : lights) {
 			const TransformNode  * const transform = node->GetTransform();
@@ -360,6 +559,10 @@ namespace mage {
 			// Add spotlight camera to the spotlight cameras.
 			m_spot_light_cameras.push_back(std::move(camera));
 
+			// Obtain the shadow casters of the spotlight.
+			m_spot_light_casters.push_back(&m_shadow_casters.GetShadowCasters(
+				node, world_to_lview * lview_to_lprojection));
+
 			// Transform to view space.
 			const XMVECTOR p = XMVector3TransformCoord(transform->GetWorldEye(), world_to_view);
 			const XMVECTOR d = XMVector3Normalize(XMVector3TransformNormal(transform->GetWorldForward(), world_to_view));
@@ -374,12 +577,16 @@ namespace mage {
 			light_buffer.m_light.m_cos_inv_range = 1.0f / light->GetRangeAngularCutoff();
 			light_buffer.m_cview_to_lprojection  = XMMatrixTranspose(cview_to_lprojection);
 
+			// Add the bounding sphere to the light volumes.
+			volumes.push_back(GetSpotLightVolume(p, d, light->GetRange(), 
+				                                 light->GetEndAngularCutoff()));
+
 			// Add spotlight buffer to spotlight buffers.
-			buffer.push_back(std::move(light_buffer));
+			buffer[nb_lights++] = light_buffer;
 		}
 
-		// Update the buffer for spotlights .
-		m_sm_spot_lights.UpdateData(m_device_context, buffer);
+		// Unmap the buffer for spotlights.
+		m_sm_spot_lights.Unmap(m_device_context, nb_lights);
 	}
 
 	void LBufferPass::SetupShadowMaps() {
@@ -392,11 +599,15 @@ namespace mage {
 	}
 
 	void LBufferPass::SetupDirectionalShadowMaps() {
-		const size_t nb_requested = GetNumberOfDirectionalLightsWithShadowMapping();
+		// One shadow map per shadow cascade.
+		const size_t nb_requested = m_directional_light_cameras.size();
 		const size_t nb_available = m_directional_sms->GetNumberOfShadowMaps();
 		
 		if (nb_available < nb_requested) {
-			m_directional_sms = MakeUnique< ShadowMapBuffer >(nb_requested);
+			m_directional_sms = MakeUnique< ShadowMapBuffer >(nb_requested, 
+				MAGE_DEFAULT_CASCADE_SHADOW_MAP_RESOLUTION, 
+				MAGE_DEFAULT_CASCADE_SHADOW_MAP_RESOLUTION, 
+				DepthFormat::D32);
 		}
 		
 		m_directional_sms->ClearDSVs(m_device_context);
@@ -425,90 +636,131 @@ namespace mage {
 	}
 
 	void LBufferPass::RenderShadowMaps(
-		const PassBuffer *scene, 
 		FXMMATRIX world_to_cview) {
 		
-		DepthPass * const pass = DepthPass::Get();
-		pass->BindFixedState();
-
-		// Render the shadow maps of the directional lights.
-		RenderDirectionalShadowMaps(pass, scene, world_to_cview);
-		// Render the shadow maps of the omni lights.
-		RenderOmniShadowMaps(pass, scene, world_to_cview);
-		// Render the shadow maps of the spotlights.
-		RenderSpotShadowMaps(pass, scene, world_to_cview);
+		// The shadow maps of all light cameras are independent: the light 
+		// cameras of the directional lights, omni lights and spotlights are
+		// numbered consecutively and partitioned into render batches.
+		const size_t omni_start = m_directional_light_cameras.size();
+		const size_t spot_start = omni_start + m_omni_light_cameras.size();
+		const size_t nb_cameras = spot_start + m_spot_light_cameras.size();
+
+		Renderer::Get()->GetRenderScheduler()->Record(nb_cameras, 
+			MAGE_DEFAULT_SHADOW_MAP_BATCH_SIZE,
+			[this, omni_start, spot_start, &world_to_cview](
+				RenderWorker &worker, size_t begin, size_t end) {
+
+			ID3D11DeviceContext4 * const device_context 
+				= worker.GetDeviceContext();
+			DepthPass * const pass = worker.GetDepthPass();
+			pass->BindFixedState();
+
+			// Render the shadow maps of the directional lights.
+			RenderDirectionalShadowMaps(device_context, pass,
+				std::min(begin, omni_start), 
+				std::min(end,   omni_start),
+				world_to_cview);
+			// Render the shadow maps of the omni lights.
+			RenderOmniShadowMaps(device_context, pass,
+				std::clamp(begin, omni_start, spot_start) - omni_start,
+				std::clamp(end,   omni_start, spot_start) - omni_start,
+				world_to_cview);
+			// Render the shadow maps of the spotlights.
+			RenderSpotShadowMaps(device_context, pass,
+				std::max(begin, spot_start) - spot_start,
+				std::max(end,   spot_start) - spot_start,
+				world_to_cview);
+		});
 	}
 
-	void LBufferPass::RenderDirectionalShadowMaps(
-		DepthPass *pass, const PassBuffer *scene, 
-		FXMMATRIX world_to_cview) {
+	void XM_CALLCONV LBufferPass::RenderDirectionalShadowMaps(
+		ID3D11DeviceContext4 *device_context,
+		DepthPass *pass, 
+		size_t begin,
+		size_t end,
+		FXMMATRIX world_to_cview) const {
+
+		if (begin >= end) {
+			return;
+		}
 
 		// Bind the viewport.
-		m_directional_sms->BindViewport(m_device_context);
+		m_directional_sms->BindViewport(device_context);
 		// Bind the rasterizer state.
-		m_directional_sms->BindRasterizerState(m_device_context);
+		m_directional_sms->BindRasterizerState(device_context);
 
-		for (size_t i = 0; i < m_directional_light_cameras.size(); ++i) {
+		for (size_t i = begin; i < end; ++i) {
 			const LightCameraInfo &camera = m_directional_light_cameras[i];
-			const XMMATRIX world_to_lprojection
-				= world_to_cview * camera.cview_to_lprojection;
+			// One shadow caster list per shadow cascade.
+			const ShadowCasterList &casters = m_directional_light_casters[i];
 
 			// Bind the DSV.
-			m_directional_sms->BindDSV(m_device_context, i);
+			m_directional_sms->BindDSV(device_context, i);
 
 			// Perform the depth pass.
-			pass->RenderOccluders(scene,
-				world_to_lprojection,
+			pass->RenderShadowCasters(casters, g_shadow_map_face_mask,
 				world_to_cview,
 				camera.cview_to_lprojection);
 		}
 	}
 
-	void LBufferPass::RenderOmniShadowMaps(
-		DepthPass *pass, const PassBuffer *scene, 
-		FXMMATRIX world_to_cview) {
+	void XM_CALLCONV LBufferPass::RenderOmniShadowMaps(
+		ID3D11DeviceContext4 *device_context,
+		DepthPass *pass, 
+		size_t begin,
+		size_t end,
+		FXMMATRIX world_to_cview) const {
+
+		if (begin >= end) {
+			return;
+		}
 
 		// Bind the viewport.
-		m_omni_sms->BindViewport(m_device_context);
+		m_omni_sms->BindViewport(device_context);
 		// Bind the rasterizer state.
-		m_omni_sms->BindRasterizerState(m_device_context);
+		m_omni_sms->BindRasterizerState(device_context);
 
-		for (size_t i = 0; i < m_omni_light_cameras.size(); ++i) {
+		for (size_t i = begin; i < end; ++i) {
 			const LightCameraInfo &camera = m_omni_light_cameras[i];
-			const XMMATRIX world_to_lprojection
-				= world_to_cview * camera.cview_to_lprojection;
+			// One shadow caster list per omni light and six faces.
+			const ShadowCasterList &casters = *m_omni_light_casters[i / 6];
+			const U32 face = 1u << (i % 6);
 
 			// Bind the DSV.
-			m_omni_sms->BindDSV(m_device_context, i);
+			m_omni_sms->BindDSV(device_context, i);
 
 			// Perform the depth pass.
-			pass->RenderOccluders(scene,
-				world_to_lprojection,
+			pass->RenderShadowCasters(casters, face,
 				world_to_cview,
 				camera.cview_to_lprojection);
 		}
 	}
 	
-	void LBufferPass::RenderSpotShadowMaps(
-		DepthPass *pass, const PassBuffer *scene, 
-		FXMMATRIX world_to_cview) {
+	void XM_CALLCONV LBufferPass::RenderSpotShadowMaps(
+		ID3D11DeviceContext4 *device_context,
+		DepthPass *pass, 
+		size_t begin,
+		size_t end,
+		FXMMATRIX world_to_cview) const {
+
+		if (begin >= end) {
+			return;
+		}
 
 		// Bind the viewport.
-		m_spot_sms->BindViewport(m_device_context);
+		m_spot_sms->BindViewport(device_context);
 		// Bind the rasterizer state.
-		m_spot_sms->BindRasterizerState(m_device_context);
+		m_spot_sms->BindRasterizerState(device_context);
 
-		for (size_t i = 0; i < m_spot_light_cameras.size(); ++i) {
+		for (size_t i = begin; i < end; ++i) {
 			const LightCameraInfo &camera = m_spot_light_cameras[i];
-			const XMMATRIX world_to_lprojection 
-				= world_to_cview * camera.cview_to_lprojection;
+			const ShadowCasterList &casters = *m_spot_light_casters[i];
 
 			// Bind the DSV.
-			m_spot_sms->BindDSV(m_device_context, i);
+			m_spot_sms->BindDSV(device_context, i);
 
 			// Perform the depth pass.
-			pass->RenderOccluders(scene,
-				world_to_lprojection,
+			pass->RenderShadowCasters(casters, g_shadow_map_face_mask,
 				world_to_cview,
 				camera.cview_to_lprojection);
 		}
@@ -6,6 +6,10 @@
 #pragma region
 
 #include "rendering\pass\pass_buffer.hpp"
+#include "rendering\pass\light_grid.hpp"
+#include "rendering\pass\shadow_caster_cache.hpp"
+#include "rendering\pass\shadow_cascades.hpp"
+#include "math\geometry\view_frustum.hpp"
 #include "rendering\buffer\constant_buffer.hpp"
 #include "rendering\buffer\structured_buffer.hpp"
 #include "rendering\buffer\light_buffer.hpp"
@@ -13,6 +17,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+#define MAGE_DEFAULT_SHADOW_MAP_BATCH_SIZE 2
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -30,7 +43,7 @@ namespace mage {
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
 
-		LBufferPass();
+		explicit LBufferPass(ID3D11DeviceContext4 *device_context);
 		LBufferPass(const LBufferPass &buffer) = delete;
 		LBufferPass(LBufferPass &&buffer) = default;
 		~LBufferPass() = default;
@@ -65,6 +78,8 @@ namespace mage {
 			return m_sm_spot_lights.size();
 		}
 
+		void Rebind(MemoryArena *memory_arena);
+
 		void XM_CALLCONV Render(
 			const PassBuffer *scene,
 			FXMMATRIX world_to_projection,
@@ -81,30 +96,32 @@ namespace mage {
 		void BindLBuffer() const noexcept;
 
 		void ProcessLightsData(const PassBuffer *scene);
+		void XM_CALLCONV ProcessLightClusters(FXMMATRIX view_to_projection);
 
 		void XM_CALLCONV ProcessLights(
-			const vector< const DirectionalLightNode * > &lights,
+			const ArenaVector< const DirectionalLightNode * > &lights,
 			FXMMATRIX world_to_view);
 		void XM_CALLCONV ProcessLights(
-			const vector< const OmniLightNode * > &lights,
+			const ArenaVector< const OmniLightNode * > &lights,
 			FXMMATRIX world_to_projection,
 			CXMMATRIX world_to_view);
 		void XM_CALLCONV ProcessLights(
-			const vector< const SpotLightNode * > &lights,
+			const ArenaVector< const SpotLightNode * > &lights,
 			FXMMATRIX world_to_projection,
 			CXMMATRIX world_to_view);
 
 		void XM_CALLCONV ProcessLightsWithShadowMapping(
-			const vector< const DirectionalLightNode * > &lights,
-			FXMMATRIX world_to_view,
+			const ArenaVector< const DirectionalLightNode * > &lights,
+			FXMMATRIX view_to_projection,
+			CXMMATRIX world_to_view,
 			CXMMATRIX view_to_world);
 		void XM_CALLCONV ProcessLightsWithShadowMapping(
-			const vector< const OmniLightNode * > &lights,
+			const ArenaVector< const OmniLightNode * > &lights,
 			FXMMATRIX world_to_projection,
 			CXMMATRIX world_to_view,
 			CXMMATRIX view_to_world);
 		void XM_CALLCONV ProcessLightsWithShadowMapping(
-			const vector< const SpotLightNode * > &lights,
+			const ArenaVector< const SpotLightNode * > &lights,
 			FXMMATRIX world_to_projection,
 			CXMMATRIX world_to_view,
 			CXMMATRIX view_to_world);
@@ -115,17 +132,25 @@ namespace mage {
 		void SetupSpotShadowMaps();
 
 		void RenderShadowMaps(
-			const PassBuffer *scene, 
-			FXMMATRIX world_to_cview);
-		void RenderDirectionalShadowMaps(
-			DepthPass *pass, const PassBuffer *scene, 
-			FXMMATRIX world_to_cview);
-		void RenderOmniShadowMaps(
-			DepthPass *pass, const PassBuffer *scene, 
-			FXMMATRIX world_to_cview);
-		void RenderSpotShadowMaps(
-			DepthPass *pass, const PassBuffer *scene, 
 			FXMMATRIX world_to_cview);
+		void XM_CALLCONV RenderDirectionalShadowMaps(
+			ID3D11DeviceContext4 *device_context,
+			DepthPass *pass, 
+			size_t begin,
+			size_t end,
+			FXMMATRIX world_to_cview) const;
+		void XM_CALLCONV RenderOmniShadowMaps(
+			ID3D11DeviceContext4 *device_context,
+			DepthPass *pass, 
+			size_t begin,
+			size_t end,
+			FXMMATRIX world_to_cview) const;
+		void XM_CALLCONV RenderSpotShadowMaps(
+			ID3D11DeviceContext4 *device_context,
+			DepthPass *pass, 
+			size_t begin,
+			size_t end,
+			FXMMATRIX world_to_cview) const;
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -151,8 +176,22 @@ namespace mage {
 		UniquePtr< ShadowCubeMapBuffer > m_omni_sms;
 		UniquePtr< ShadowMapBuffer > m_spot_sms;
 
-		vector< LightCameraInfo > m_directional_light_cameras;
-		vector< LightCameraInfo > m_omni_light_cameras;
-		vector< LightCameraInfo > m_spot_light_cameras;
+		ArenaVector< LightCameraInfo > m_directional_light_cameras;
+		ArenaVector< LightCameraInfo > m_omni_light_cameras;
+		ArenaVector< LightCameraInfo > m_spot_light_cameras;
+
+		ShadowCasterCache m_shadow_casters;
+		vector< ShadowCasterList > m_directional_light_casters;
+		ArenaVector< const ShadowCasterList * > m_omni_light_casters;
+		ArenaVector< const ShadowCasterList * > m_spot_light_casters;
+
+		LightGrid m_light_grid;
+		StructuredBuffer< LightCluster > m_light_clusters;
+		StructuredBuffer< U32 > m_light_indices;
+		ArenaVector< BS > m_light_volumes[g_nb_light_cluster_lists];
+
+		BSBatch m_light_bss;
+		AABBBatch m_light_aabbs;
+		ArenaVector< size_t > m_visible_indices;
 	};
 }
\ No newline at end of file
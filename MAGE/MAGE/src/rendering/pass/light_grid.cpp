@@ -0,0 +1,303 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering\pass\light_grid.hpp"
+#include "utils\logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The minimum view-space depth of the near plane used for the exponential
+	 depth slicing of light grids.
+	 */
+	constexpr F32 g_light_grid_min_near_z = 0.01f;
+
+	/**
+	 Checks whether the given AABB overlaps the given BS.
+
+	 @param[in]		aabb
+					A reference to the AABB.
+	 @param[in]		bs
+					A reference to the BS.
+	 @return		@c true if the given AABB overlaps the given BS. @c false
+					otherwise.
+	 */
+	inline bool Overlaps(const AABB &aabb, const BS &bs) noexcept {
+		const XMVECTOR p_min = XMLoadFloat3(&aabb.m_p_min);
+		const XMVECTOR p_max = XMLoadFloat3(&aabb.m_p_max);
+		const XMVECTOR p     = XMLoadFloat3(&bs.m_p);
+
+		// The distance from the centroid of the BS to the AABB.
+		const XMVECTOR d = XMVectorMax(p_min - p, XMVectorZero())
+			             + XMVectorMax(p - p_max, XMVectorZero());
+
+		return XMVectorGetX(XMVector3LengthSq(d)) <= bs.m_r * bs.m_r;
+	}
+
+	LightGrid::LightGrid(U32 nb_clusters_x,
+		                 U32 nb_clusters_y,
+		                 U32 nb_clusters_z)
+		: m_size(nb_clusters_x, nb_clusters_y, nb_clusters_z),
+		m_depth_scale(0.0f),
+		m_depth_bias(0.0f),
+		m_near_z(0.0f),
+		m_far_z(0.0f),
+		m_view_to_projection(),
+		m_cluster_aabbs(),
+		m_clusters(),
+		m_light_indices(),
+		m_counts(),
+		m_pairs(),
+		m_nb_dropped_lights(0) {
+
+		Assert(0u < nb_clusters_x);
+		Assert(0u < nb_clusters_y);
+		Assert(0u < nb_clusters_z);
+	}
+
+	LightGrid::LightGrid(const LightGrid &grid) = default;
+
+	LightGrid::LightGrid(LightGrid &&grid) = default;
+
+	LightGrid::~LightGrid() = default;
+
+	LightGrid &LightGrid::operator=(const LightGrid &grid) = default;
+
+	LightGrid &LightGrid::operator=(LightGrid &&grid) = default;
+
+	U32 LightGrid::GetSlice(F32 p_view_z) const noexcept {
+		const F32 p_log_z = std::log(std::max(p_view_z, g_light_grid_min_near_z));
+		const F32 slice   = std::floor(p_log_z * m_depth_scale + m_depth_bias);
+		const F32 max_slice = static_cast< F32 >(m_size.m_z - 1u);
+		return static_cast< U32 >(std::min(std::max(slice, 0.0f), max_slice));
+	}
+
+	U32 LightGrid::GetTile(F32 p_ndc, size_t axis) const noexcept {
+		const U32 nb_tiles = (0 == axis) ? m_size.m_x : m_size.m_y;
+		// NDC y-axis points up, tile y-axis points down.
+		const F32 uv   = (0 == axis) ? 0.5f + 0.5f * p_ndc : 0.5f - 0.5f * p_ndc;
+		const F32 tile = std::floor(uv * static_cast< F32 >(nb_tiles));
+		const F32 max_tile = static_cast< F32 >(nb_tiles - 1u);
+		return static_cast< U32 >(std::min(std::max(tile, 0.0f), max_tile));
+	}
+
+	size_t LightGrid::GetClusterIndex(F32 p_ndc_x, F32 p_ndc_y,
+		F32 p_view_z) const noexcept {
+
+		const size_t x = GetTile(p_ndc_x, 0);
+		const size_t y = GetTile(p_ndc_y, 1);
+		const size_t z = GetSlice(p_view_z);
+		return (z * m_size.m_y + y) * m_size.m_x + x;
+	}
+
+	void XM_CALLCONV LightGrid::UpdateClusters(FXMMATRIX view_to_projection) {
+		XMFLOAT4X4 matrix;
+		XMStoreFloat4x4(&matrix, view_to_projection);
+		if (!m_cluster_aabbs.empty()
+			&& 0 == std::memcmp(&matrix, &m_view_to_projection, sizeof(matrix))) {
+			return;
+		}
+		m_view_to_projection = matrix;
+
+		const XMMATRIX projection_to_view
+			= XMMatrixInverse(nullptr, view_to_projection);
+
+		// Obtain the view-space depth of the near and far plane (the depth
+		// buffer may be inverted).
+		const F32 z0 = XMVectorGetZ(XMVector3TransformCoord(
+			XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), projection_to_view));
+		const F32 z1 = XMVectorGetZ(XMVector3TransformCoord(
+			XMVectorSet(0.0f, 0.0f, 1.0f, 1.0f), projection_to_view));
+		m_near_z = std::min(z0, z1);
+		m_far_z  = std::max(z0, z1);
+
+		// Exponential depth slicing
+		const F32 near_z = std::max(m_near_z, g_light_grid_min_near_z);
+		const F32 far_z  = std::max(m_far_z, 2.0f * near_z);
+		m_depth_scale = static_cast< F32 >(m_size.m_z) / std::log(far_z / near_z);
+		m_depth_bias  = -std::log(near_z) * m_depth_scale;
+
+		// Unproject the tile corners to view-space rays: p = o + t d.
+		const size_t nb_corners_x = m_size.m_x + 1u;
+		const size_t nb_corners_y = m_size.m_y + 1u;
+		vector< XMFLOAT3 > ray_origins(nb_corners_x * nb_corners_y);
+		vector< XMFLOAT3 > ray_directions(nb_corners_x * nb_corners_y);
+		for (size_t y = 0; y < nb_corners_y; ++y) {
+			const F32 p_ndc_y = 1.0f - 2.0f * y / m_size.m_y;
+			for (size_t x = 0; x < nb_corners_x; ++x) {
+				const F32 p_ndc_x = 2.0f * x / m_size.m_x - 1.0f;
+
+				const XMVECTOR p0 = XMVector3TransformCoord(
+					XMVectorSet(p_ndc_x, p_ndc_y, 0.0f, 1.0f), projection_to_view);
+				const XMVECTOR p1 = XMVector3TransformCoord(
+					XMVectorSet(p_ndc_x, p_ndc_y, 1.0f, 1.0f), projection_to_view);
+
+				// Normalize the direction to a unit view-space depth.
+				const XMVECTOR d  = (p1 - p0) / XMVectorSplatZ(p1 - p0);
+
+				const size_t index = y * nb_corners_x + x;
+				XMStoreFloat3(&ray_origins[index], p0);
+				XMStoreFloat3(&ray_directions[index], d);
+			}
+		}
+
+		m_cluster_aabbs.resize(static_cast< size_t >(m_size.m_x)
+			                   * m_size.m_y * m_size.m_z);
+
+		for (size_t z = 0; z < m_size.m_z; ++z) {
+			const F32 slice_near_z = (0 == z) ? m_near_z
+				: std::exp((z - m_depth_bias) / m_depth_scale);
+			const F32 slice_far_z  = (m_size.m_z == z + 1u) ? m_far_z
+				: std::exp((z + 1u - m_depth_bias) / m_depth_scale);
+
+			for (size_t y = 0; y < m_size.m_y; ++y) {
+				for (size_t x = 0; x < m_size.m_x; ++x) {
+
+					XMVECTOR p_min = XMVectorReplicate( std::numeric_limits< F32 >::max());
+					XMVECTOR p_max = XMVectorReplicate(-std::numeric_limits< F32 >::max());
+
+					for (size_t corner = 0; corner < 4; ++corner) {
+						const size_t index = (y + (corner >> 1u)) * nb_corners_x
+							               + (x + (corner &  1u));
+						const XMVECTOR o = XMLoadFloat3(&ray_origins[index]);
+						const XMVECTOR d = XMLoadFloat3(&ray_directions[index]);
+						const XMVECTOR o_z = XMVectorSplatZ(o);
+
+						const XMVECTOR p_near = o + (XMVectorReplicate(slice_near_z) - o_z) * d;
+						const XMVECTOR p_far  = o + (XMVectorReplicate(slice_far_z)  - o_z) * d;
+
+						p_min = XMVectorMin(p_min, XMVectorMin(p_near, p_far));
+						p_max = XMVectorMax(p_max, XMVectorMax(p_near, p_far));
+					}
+
+					AABB &aabb = m_cluster_aabbs[(z * m_size.m_y + y) * m_size.m_x + x];
+					XMStoreFloat3(&aabb.m_p_min, p_min);
+					XMStoreFloat3(&aabb.m_p_max, p_max);
+				}
+			}
+		}
+	}
+
+	void XM_CALLCONV LightGrid::Update(FXMMATRIX view_to_projection,
+		const ArenaVector< BS > (&lights)[g_nb_light_cluster_lists]) {
+
+		UpdateClusters(view_to_projection);
+
+		const size_t nb_clusters = m_cluster_aabbs.size();
+		m_counts.assign(nb_clusters * g_nb_light_cluster_lists, 0u);
+		m_pairs.clear();
+		m_nb_dropped_lights = 0;
+
+		for (size_t list = 0; list < g_nb_light_cluster_lists; ++list) {
+			for (size_t i = 0; i < lights[list].size(); ++i) {
+				const BS &bs = lights[list][i];
+
+				const F32 bs_min_z = bs.m_p.m_z - bs.m_r;
+				const F32 bs_max_z = bs.m_p.m_z + bs.m_r;
+				if (bs_max_z < m_near_z || m_far_z < bs_min_z) {
+					continue;
+				}
+
+				// Obtain the range of depth slices.
+				const U32 z_begin = GetSlice(bs_min_z);
+				const U32 z_end   = GetSlice(bs_max_z) + 1u;
+
+				// Obtain the range of tiles by projecting the corners of the
+				// AABB of the BS.
+				U32 x_begin = 0u, x_end = m_size.m_x;
+				U32 y_begin = 0u, y_end = m_size.m_y;
+				XMVECTOR p_ndc_min = XMVectorReplicate( std::numeric_limits< F32 >::max());
+				XMVECTOR p_ndc_max = XMVectorReplicate(-std::numeric_limits< F32 >::max());
+				bool bounded = true;
+				for (size_t corner = 0; corner < 8 && bounded; ++corner) {
+					const XMVECTOR p = XMVectorSet(
+						bs.m_p.m_x + ((corner & 1u) ? bs.m_r : -bs.m_r),
+						bs.m_p.m_y + ((corner & 2u) ? bs.m_r : -bs.m_r),
+						bs.m_p.m_z + ((corner & 4u) ? bs.m_r : -bs.m_r),
+						1.0f);
+					const XMVECTOR p_proj = XMVector4Transform(p, view_to_projection);
+					const F32 w = XMVectorGetW(p_proj);
+
+					// The AABB crosses the plane through the camera eye.
+					bounded = (std::numeric_limits< F32 >::epsilon() < w);
+
+					const XMVECTOR p_ndc = p_proj / XMVectorReplicate(w);
+					p_ndc_min = XMVectorMin(p_ndc_min, p_ndc);
+					p_ndc_max = XMVectorMax(p_ndc_max, p_ndc);
+				}
+				if (bounded) {
+					x_begin = GetTile(XMVectorGetX(p_ndc_min), 0);
+					x_end   = GetTile(XMVectorGetX(p_ndc_max), 0) + 1u;
+					y_begin = GetTile(XMVectorGetY(p_ndc_max), 1);
+					y_end   = GetTile(XMVectorGetY(p_ndc_min), 1) + 1u;
+				}
+
+				for (U32 z = z_begin; z < z_end; ++z) {
+					for (U32 y = y_begin; y < y_end; ++y) {
+						for (U32 x = x_begin; x < x_end; ++x) {
+							const U32 cluster = (z * m_size.m_y + y) * m_size.m_x + x;
+							if (!Overlaps(m_cluster_aabbs[cluster], bs)) {
+								continue;
+							}
+
+							U32 &count = m_counts[cluster * g_nb_light_cluster_lists + list];
+							if (g_max_light_cluster_list_size <= count) {
+								++m_nb_dropped_lights;
+								continue;
+							}
+
+							++count;
+							m_pairs.emplace_back(cluster, static_cast< U32 >(i));
+						}
+					}
+				}
+			}
+		}
+
+		// Compute the offsets and counts of the light clusters.
+		m_clusters.resize(nb_clusters);
+		U32 offset = 0u;
+		for (size_t cluster = 0; cluster < nb_clusters; ++cluster) {
+			U32 counts = 0u;
+			U32 total  = 0u;
+			for (size_t list = 0; list < g_nb_light_cluster_lists; ++list) {
+				const U32 count = m_counts[cluster * g_nb_light_cluster_lists + list];
+				counts |= count << (8u * list);
+				total  += count;
+			}
+
+			m_clusters[cluster] = { offset, counts };
+			offset += total;
+		}
+
+		// Scatter the light indices. The pairs are in light list order, and
+		// therefore the light indices of each light cluster as well.
+		m_light_indices.resize(offset);
+		m_counts.resize(nb_clusters);
+		for (size_t cluster = 0; cluster < nb_clusters; ++cluster) {
+			m_counts[cluster] = m_clusters[cluster].m_offset;
+		}
+		for (const auto &p : m_pairs) {
+			m_light_indices[m_counts[p.first]++] = p.second;
+		}
+	}
+}
\ No newline at end of file
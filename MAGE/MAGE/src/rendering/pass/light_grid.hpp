@@ -0,0 +1,353 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "math\geometry\bounding_volume.hpp"
+#include "utils\memory\memory_arena.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The number of light lists of a light cluster (i.e. omni lights,
+	 spotlights, omni lights with shadow mapping and spotlights with shadow
+	 mapping).
+	 */
+	constexpr size_t g_nb_light_cluster_lists = 4;
+
+	/**
+	 The maximum number of lights per light list of a light cluster.
+	 */
+	constexpr U32 g_max_light_cluster_list_size = 255u;
+
+	//-------------------------------------------------------------------------
+	// LightCluster
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of light clusters used by shaders.
+	 */
+	struct LightCluster final {
+
+		/**
+		 The offset of the first light index of this light cluster in the
+		 light index list.
+		 */
+		U32 m_offset;
+
+		/**
+		 The number of lights of each light list of this light cluster (8
+		 bits per light list, starting at the least significant bits).
+		 */
+		U32 m_counts;
+	};
+
+	static_assert(sizeof(LightCluster) == 8,
+		"CPU/GPU struct mismatch");
+
+	//-------------------------------------------------------------------------
+	// LightGrid
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of light grids.
+
+	 A light grid partitions the view frustum of a camera into light clusters
+	 (i.e. froxels): a uniform grid of tiles in NDC space and an exponential
+	 partition of the view-space depth. Each light cluster refers to the
+	 lights whose bounding sphere overlaps that light cluster, which allows
+	 shaders to only evaluate the lights of the light cluster containing the
+	 shaded point.
+
+	 A shader obtains the light cluster of the view-space point p as follows:
+	 @code
+	 x = floor((0.5 + 0.5 * p_ndc.x) * nb_clusters_x)
+	 y = floor((0.5 - 0.5 * p_ndc.y) * nb_clusters_y)
+	 z = floor(log(p.z) * depth_scale + depth_bias)
+	 index = (z * nb_clusters_y + y) * nb_clusters_x + x
+	 @endcode
+	 with all coordinates clamped to the grid.
+	 */
+	class LightGrid final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a light grid.
+
+		 @pre			@a nb_clusters_x is not equal to zero.
+		 @pre			@a nb_clusters_y is not equal to zero.
+		 @pre			@a nb_clusters_z is not equal to zero.
+		 @param[in]		nb_clusters_x
+						The number of light clusters along the x-axis.
+		 @param[in]		nb_clusters_y
+						The number of light clusters along the y-axis.
+		 @param[in]		nb_clusters_z
+						The number of light clusters along the z-axis.
+		 */
+		explicit LightGrid(U32 nb_clusters_x = 16u,
+			               U32 nb_clusters_y = 8u,
+			               U32 nb_clusters_z = 24u);
+
+		/**
+		 Constructs a light grid from the given light grid.
+
+		 @param[in]		grid
+						A reference to the light grid to copy.
+		 */
+		LightGrid(const LightGrid &grid);
+
+		/**
+		 Constructs a light grid by moving the given light grid.
+
+		 @param[in]		grid
+						A reference to the light grid to move.
+		 */
+		LightGrid(LightGrid &&grid);
+
+		/**
+		 Destructs this light grid.
+		 */
+		~LightGrid();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given light grid to this light grid.
+
+		 @param[in]		grid
+						A reference to the light grid to copy.
+		 @return		A reference to the copy of the given light grid (i.e.
+						this light grid).
+		 */
+		LightGrid &operator=(const LightGrid &grid);
+
+		/**
+		 Moves the given light grid to this light grid.
+
+		 @param[in]		grid
+						A reference to the light grid to move.
+		 @return		A reference to the moved light grid (i.e. this light
+						grid).
+		 */
+		LightGrid &operator=(LightGrid &&grid);
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of light clusters of this light grid along each
+		 axis.
+
+		 @return		The number of light clusters of this light grid along
+						each axis.
+		 */
+		const U32x3 GetSize() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Returns the scale of the logarithm of the view-space depth used for
+		 selecting the depth slice of this light grid.
+
+		 @return		The depth scale of this light grid.
+		 */
+		F32 GetDepthScale() const noexcept {
+			return m_depth_scale;
+		}
+
+		/**
+		 Returns the bias of the scaled logarithm of the view-space depth
+		 used for selecting the depth slice of this light grid.
+
+		 @return		The depth bias of this light grid.
+		 */
+		F32 GetDepthBias() const noexcept {
+			return m_depth_bias;
+		}
+
+		/**
+		 Returns the light clusters of this light grid.
+
+		 @return		A reference to the vector containing the light
+						clusters of this light grid.
+		 */
+		const vector< LightCluster > &GetClusters() const noexcept {
+			return m_clusters;
+		}
+
+		/**
+		 Returns the light index list of this light grid.
+
+		 @return		A reference to the vector containing the light
+						indices of the light clusters of this light grid.
+		 */
+		const vector< U32 > &GetLightIndices() const noexcept {
+			return m_light_indices;
+		}
+
+		/**
+		 Returns the number of light cluster assignments which are dropped
+		 by the last update of this light grid, because the light list of
+		 the light cluster already contained the maximum number of lights.
+
+		 @return		The number of dropped light cluster assignments of
+						this light grid.
+		 */
+		size_t GetNumberOfDroppedLights() const noexcept {
+			return m_nb_dropped_lights;
+		}
+
+		/**
+		 Returns the index of the light cluster containing the given point.
+
+		 @param[in]		p_ndc_x
+						The NDC x-coordinate of the point.
+		 @param[in]		p_ndc_y
+						The NDC y-coordinate of the point.
+		 @param[in]		p_view_z
+						The view-space z-coordinate of the point.
+		 @return		The index of the light cluster containing the given
+						point.
+		 */
+		size_t GetClusterIndex(F32 p_ndc_x, F32 p_ndc_y,
+			F32 p_view_z) const noexcept;
+
+		/**
+		 Assigns the given lights to the light clusters of this light grid.
+
+		 @param[in]		view_to_projection
+						The view-to-projection transformation matrix of the
+						camera.
+		 @param[in]		lights
+						A reference to an array containing the view-space
+						bounding spheres of the lights of each light list.
+		 */
+		void XM_CALLCONV Update(FXMMATRIX view_to_projection,
+			const ArenaVector< BS > (&lights)[g_nb_light_cluster_lists]);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Updates the view-space AABBs of the light clusters of this light
+		 grid, if the given view-to-projection transformation matrix differs
+		 from the previous one.
+
+		 @param[in]		view_to_projection
+						The view-to-projection transformation matrix of the
+						camera.
+		 */
+		void XM_CALLCONV UpdateClusters(FXMMATRIX view_to_projection);
+
+		/**
+		 Returns the depth slice containing the given view-space depth.
+
+		 @param[in]		p_view_z
+						The view-space z-coordinate.
+		 @return		The depth slice containing the given view-space
+						depth.
+		 */
+		U32 GetSlice(F32 p_view_z) const noexcept;
+
+		/**
+		 Returns the tile containing the given NDC coordinate along the given
+		 axis.
+
+		 @param[in]		p_ndc
+						The NDC coordinate.
+		 @param[in]		axis
+						The axis (0 for x and 1 for y).
+		 @return		The tile containing the given NDC coordinate along
+						the given axis.
+		 */
+		U32 GetTile(F32 p_ndc, size_t axis) const noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of light clusters of this light grid along each axis.
+		 */
+		U32x3 m_size;
+
+		/**
+		 The depth scale of this light grid.
+		 */
+		F32 m_depth_scale;
+
+		/**
+		 The depth bias of this light grid.
+		 */
+		F32 m_depth_bias;
+
+		/**
+		 The view-space depth of the near plane of this light grid.
+		 */
+		F32 m_near_z;
+
+		/**
+		 The view-space depth of the far plane of this light grid.
+		 */
+		F32 m_far_z;
+
+		/**
+		 The view-to-projection transformation matrix of the light clusters
+		 of this light grid.
+		 */
+		XMFLOAT4X4 m_view_to_projection;
+
+		/**
+		 A vector containing the view-space AABBs of the light clusters of
+		 this light grid.
+		 */
+		vector< AABB > m_cluster_aabbs;
+
+		/**
+		 A vector containing the light clusters of this light grid.
+		 */
+		vector< LightCluster > m_clusters;
+
+		/**
+		 A vector containing the light indices of the light clusters of this
+		 light grid.
+		 */
+		vector< U32 > m_light_indices;
+
+		/**
+		 A vector containing the number of lights of each light list of each
+		 light cluster of this light grid.
+		 */
+		vector< U32 > m_counts;
+
+		/**
+		 A vector containing the (light cluster index, light index) pairs of
+		 this light grid in light list order.
+		 */
+		vector< pair< U32, U32 > > m_pairs;
+
+		/**
+		 The number of light cluster assignments which are dropped by the
+		 last update of this light grid.
+		 */
+		size_t m_nb_dropped_lights;
+	};
+}
\ No newline at end of file
@@ -13,10 +13,39 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	/**
+	 The draw queue of the opaque emissive models.
+	 */
+	constexpr U32 g_queue_opaque_emissive      = 0u;
+
+	/**
+	 The draw queue of the opaque BRDF models.
+	 */
+	constexpr U32 g_queue_opaque_brdf          = 1u;
+
+	/**
+	 The draw queue of the transparent emissive models.
+	 */
+	constexpr U32 g_queue_transparent_emissive = 2u;
+
+	/**
+	 The draw queue of the transparent BRDF models.
+	 */
+	constexpr U32 g_queue_transparent_brdf     = 3u;
+
 	PassBuffer::PassBuffer()
 		: m_cameras(),
 		m_opaque_emissive_models(), m_opaque_brdf_models(),
 		m_transparent_emissive_models(), m_transparent_brdf_models(),
+		m_visible_opaque_emissive_models(), m_visible_opaque_brdf_models(),
+		m_visible_transparent_emissive_models(), m_visible_transparent_brdf_models(),
+		m_aabbs(), m_visible_indices(),
+		m_model_instances(), m_index_ranges(), m_visible_clusters(),
+		m_opaque_emissive_instance_groups(), m_opaque_brdf_instance_groups(),
+		m_transparent_emissive_instance_groups(), m_transparent_brdf_instance_groups(),
+		m_transparent_instance_groups(),
+		m_draw_list(), m_draw_models(), m_draw_instances(),
+		m_mesh_ids(), m_texture_set_ids(), m_material_ids(),
 		m_directional_lights(), m_sm_directional_lights(),
 		m_omni_lights(), m_sm_omni_lights(),
 		m_spot_lights(), m_sm_spot_lights(),
@@ -32,6 +61,8 @@ namespace mage {
 		UpdateCameras(scene);
 		// Update the models.
 		UpdateModels(scene);
+		// Select the LODs of the models.
+		SelectLODs();
 		// Update the lights.
 		UpdateLights(scene);
 		// Update the sprites.
@@ -43,6 +74,371 @@ namespace mage {
 		m_sky = scene->GetSky();
 	}
 
+	void XM_CALLCONV PassBuffer::UpdateVisibleModels(
+		FXMMATRIX world_to_projection, 
+		CXMMATRIX world_to_view, 
+		CXMMATRIX view_to_world) {
+
+		// Extract the world-space view frustum once for all models.
+		const ViewFrustum view_frustum(world_to_projection);
+		const XMMATRIX view_to_projection = view_to_world * world_to_projection;
+
+		UpdateVisibleModels(m_opaque_emissive_models, view_frustum, 
+			m_visible_opaque_emissive_models, world_to_projection, 
+			world_to_view, view_to_world);
+		UpdateVisibleModels(m_opaque_brdf_models, view_frustum,
+			m_visible_opaque_brdf_models, world_to_projection, 
+			world_to_view, view_to_world);
+		UpdateVisibleModels(m_transparent_emissive_models, view_frustum,
+			m_visible_transparent_emissive_models, world_to_projection, 
+			world_to_view, view_to_world);
+		UpdateVisibleModels(m_transparent_brdf_models, view_frustum,
+			m_visible_transparent_brdf_models, world_to_projection, 
+			world_to_view, view_to_world);
+
+		// The eye is located at the origin of view space for perspective 
+		// projections and at infinity for orthographic projections.
+		const XMVECTOR eye = (0.0f != XMVectorGetW(view_to_projection.r[2]))
+			? XMVectorSet(0.0f, 0.0f,  0.0f, 1.0f)
+			: XMVectorSet(0.0f, 0.0f, -1.0f, 0.0f);
+
+		// Sort and group the visible models for instanced drawing.
+		m_model_instances.clear();
+		m_index_ranges.clear();
+		AddToDrawList(m_visible_opaque_emissive_models, 
+			g_queue_opaque_emissive, false);
+		UpdateInstanceGroups(m_opaque_emissive_instance_groups, eye);
+		AddToDrawList(m_visible_opaque_brdf_models, 
+			g_queue_opaque_brdf, false);
+		UpdateInstanceGroups(m_opaque_brdf_instance_groups, eye);
+		AddToDrawList(m_visible_transparent_emissive_models, 
+			g_queue_transparent_emissive, true);
+		UpdateInstanceGroups(m_transparent_emissive_instance_groups, eye);
+		AddToDrawList(m_visible_transparent_brdf_models, 
+			g_queue_transparent_brdf, true);
+		UpdateInstanceGroups(m_transparent_brdf_instance_groups, eye);
+		// Blended transparent models share a single back-to-front queue.
+		UpdateTransparentInstanceGroups();
+	}
+
+	/**
+	 Returns the sort key identifier of the given key.
+
+	 Identifiers are assigned in order of first use and are kept across 
+	 frames. If all identifiers are in use, all identifiers are released.
+
+	 @tparam		KeyT
+					The key type.
+	 @param[in]		ids
+					A reference to the map containing the identifiers.
+	 @param[in]		key
+					A reference to the key.
+	 @param[in]		nb_bits
+					The number of bits of the sort key field.
+	 @return		The sort key identifier of the given key.
+	 */
+	template< typename KeyT >
+	U32 GetSortKeyId(map< KeyT, U32 > &ids, const KeyT &key, U32 nb_bits) {
+		if (const auto it = ids.find(key); ids.cend() != it) {
+			return it->second;
+		}
+
+		if (GetMaxSortKeyField(nb_bits) < ids.size()) {
+			ids.clear();
+		}
+
+		const U32 id = static_cast< U32 >(ids.size());
+		ids.emplace(key, id);
+		return id;
+	}
+
+	/**
+	 Returns the instancing key of the given model node. Model nodes with 
+	 equal instancing keys share the same mesh, index range and material, 
+	 and can be drawn with a single instanced draw call.
+
+	 @pre			@a node is not equal to @c nullptr.
+	 @param[in]		node
+					A pointer to the model node.
+	 @return		The instancing key of the given model node.
+	 */
+	inline const auto GetInstanceKey(const ModelNode *node) noexcept {
+		const Model    * const model    = node->GetModel();
+		const Material * const material = model->GetMaterial();
+		const SRGBA    &base_color      = material->GetBaseColor();
+		
+		return std::make_tuple(model->GetMesh(), 
+			                   model->GetStartIndex(), 
+			                   model->GetNumberOfIndices(),
+			                   model->GetBaseVertex(),
+			                   material->GetBaseColorSRV(), 
+			                   material->GetMaterialSRV(), 
+			                   material->GetNormalSRV(),
+			                   base_color.m_x, base_color.m_y, 
+			                   base_color.m_z, base_color.m_w,
+			                   material->GetRoughness(), 
+			                   material->GetMetalness());
+	}
+
+	void PassBuffer::AddToDrawList(const ArenaVector< VisibleModel > &models,
+		U32 queue, bool transparency) {
+
+		for (const auto &model : models) {
+			const Model    * const node_model = model.m_node->GetModel();
+			const Material * const material   = node_model->GetMaterial();
+			const SRGBA    &base_color        = material->GetBaseColor();
+
+			// The shader permutation depends on the normal map only, since
+			// the queue already separates the emissive and BRDF models.
+			const U32 shader   = material->GetNormalSRV() ? 1u : 0u;
+			const U32 textures = GetSortKeyId(m_texture_set_ids, 
+				array< const void *, 3 >{
+					material->GetBaseColorSRV(),
+					material->GetMaterialSRV(),
+					material->GetNormalSRV() }, 
+				g_sort_key_textures_bits);
+			const U32 mesh     = GetSortKeyId(m_mesh_ids, 
+				static_cast< const void * >(node_model->GetMesh()),
+				g_sort_key_mesh_bits);
+			const U32 params   = GetSortKeyId(m_material_ids,
+				std::make_tuple(
+					node_model->GetStartIndex(), 
+					node_model->GetNumberOfIndices(),
+					node_model->GetBaseVertex(),
+					base_color.m_x, base_color.m_y, 
+					base_color.m_z, base_color.m_w,
+					material->GetRoughness(), 
+					material->GetMetalness()),
+				g_sort_key_material_bits);
+			const U32 depth    = QuantizeSortKeyDepth(
+				XMVectorGetZ(model.m_object_to_view.r[3]));
+
+			const U64 key = transparency
+				? MakeTransparentSortKey(queue, shader, textures, mesh, params, depth)
+				: MakeOpaqueSortKey(queue, shader, textures, mesh, params, depth);
+
+			m_draw_list.Add(key, static_cast< U32 >(m_draw_models.size()));
+			m_draw_models.push_back(&model);
+		}
+	}
+
+	void XM_CALLCONV PassBuffer::UpdateInstanceGroups(
+		ArenaVector< ModelInstanceGroup > &groups, FXMVECTOR eye) {
+
+		groups.clear();
+
+		m_draw_list.Sort();
+
+		for (const auto &item : m_draw_list.GetItems()) {
+			const VisibleModel &model = *m_draw_models[item.m_index];
+			const ModelNode * const node = model.m_node;
+
+			// Distinct meshes or materials may share a sort key if the sort 
+			// key identifiers were exhausted.
+			if (groups.empty() 
+				|| GetInstanceKey(groups.back().m_node) != GetInstanceKey(node)) {
+
+				if (!groups.empty()) {
+					CompactInstanceGroup(groups);
+				}
+
+				ModelInstanceGroup group;
+				group.m_node           = node;
+				group.m_instance_start = static_cast< U32 >(m_model_instances.size());
+				group.m_nb_instances   = 0u;
+				group.m_range_start    = 0u;
+				group.m_nb_ranges      = 0u;
+				groups.push_back(std::move(group));
+
+				m_visible_clusters.assign(
+					node->GetModel()->GetNumberOfClusters(), false);
+			}
+
+			++groups.back().m_nb_instances;
+
+			// A group draws the union of the visible mesh clusters of its 
+			// instances. Mirrored instances flip the winding order and are 
+			// only culled against the view frustum.
+			const Model * const node_model = node->GetModel();
+			if (0 != node_model->GetNumberOfClusters()) {
+				const bool mirrored = XMVectorGetX(
+					XMMatrixDeterminant(model.m_object_to_view)) < 0.0f;
+				const XMVECTOR object_eye = mirrored ? XMVectorZero()
+					: XMVector4Transform(eye, model.m_view_to_object);
+				
+				MarkVisibleMeshClusters(node_model->GetClusters(), 
+					node_model->GetNumberOfClusters(), 
+					model.m_object_to_projection, object_eye, 
+					m_visible_clusters);
+			}
+
+			const XMMATRIX texture_transform 
+				= node->GetTextureTransform()->GetTransformMatrix();
+
+			ModelInstance instance;
+			instance.m_object_to_view    = XMMatrixTranspose(model.m_object_to_view);
+			instance.m_normal_to_view    = model.m_view_to_object;
+			instance.m_texture_transform = XMMatrixTranspose(texture_transform);
+			m_model_instances.push_back(std::move(instance));
+		}
+
+		if (!groups.empty()) {
+			CompactInstanceGroup(groups);
+		}
+
+		m_draw_list.Clear();
+		m_draw_models.clear();
+	}
+
+	void PassBuffer::AddToDrawList(
+		const ArenaVector< ModelInstanceGroup > &groups, U32 queue) {
+
+		for (const auto &group : groups) {
+			const U32 end = group.m_instance_start + group.m_nb_instances;
+			for (U32 i = group.m_instance_start; i < end; ++i) {
+				// The model instances contain the transposed object-to-view 
+				// transformation matrices.
+				const F32 z = XMVectorGetW(m_model_instances[i].m_object_to_view.r[2]);
+				const U32 depth = QuantizeSortKeyDepth(z);
+				// The stable sort preserves the order of the model instance 
+				// groups for equal depths.
+				const U64 key = MakeTransparentSortKey(queue, 0u, 0u, 0u, 0u, depth);
+
+				m_draw_list.Add(key, static_cast< U32 >(m_draw_instances.size()));
+				m_draw_instances.emplace_back(&group, i);
+			}
+		}
+	}
+
+	void PassBuffer::UpdateTransparentInstanceGroups() {
+		m_transparent_instance_groups.clear();
+
+		AddToDrawList(m_transparent_emissive_instance_groups, 
+			g_queue_transparent_emissive);
+		AddToDrawList(m_transparent_brdf_instance_groups, 
+			g_queue_transparent_brdf);
+
+		m_draw_list.Sort();
+
+		const ModelInstanceGroup *previous_group = nullptr;
+		U32 previous_instance = 0u;
+
+		for (const auto &item : m_draw_list.GetItems()) {
+			const auto [group, instance] = m_draw_instances[item.m_index];
+
+			// Consecutive model instances of the same model instance group 
+			// are drawn with a single instanced draw call. The index ranges
+			// of a model instance group cover the visible mesh clusters of 
+			// all its model instances.
+			if (group == previous_group && instance == previous_instance + 1u) {
+				++m_transparent_instance_groups.back().m_nb_instances;
+			}
+			else {
+				ModelInstanceGroup range = *group;
+				range.m_instance_start = instance;
+				range.m_nb_instances   = 1u;
+				m_transparent_instance_groups.push_back(std::move(range));
+			}
+
+			previous_group    = group;
+			previous_instance = instance;
+		}
+
+		m_draw_list.Clear();
+		m_draw_instances.clear();
+	}
+
+	void PassBuffer::CompactInstanceGroup(
+		ArenaVector< ModelInstanceGroup > &groups) {
+
+		Assert(!groups.empty());
+
+		ModelInstanceGroup &group = groups.back();
+		const Model * const model = group.m_node->GetModel();
+
+		group.m_range_start = static_cast< U32 >(m_index_ranges.size());
+
+		// Models without mesh clusters are drawn as a whole.
+		if (0 == model->GetNumberOfClusters()) {
+			m_index_ranges.push_back({ 
+				static_cast< U32 >(model->GetStartIndex()), 
+				static_cast< U32 >(model->GetNumberOfIndices()) });
+			group.m_nb_ranges = 1u;
+			return;
+		}
+
+		group.m_nb_ranges = static_cast< U32 >(CompactMeshClusters(
+			model->GetClusters(), model->GetNumberOfClusters(), 
+			m_visible_clusters, m_index_ranges));
+	}
+
+	void XM_CALLCONV PassBuffer::UpdateVisibleModels(
+		const ArenaVector< const ModelNode * > &models,
+		const ViewFrustum &view_frustum,
+		ArenaVector< VisibleModel > &visible_models,
+		FXMMATRIX world_to_projection,
+		CXMMATRIX world_to_view,
+		CXMMATRIX view_to_world) {
+
+		// Cull the models against the view frustum.
+		m_aabbs.clear();
+		for (const auto node : models) {
+			m_aabbs.push_back(node->GetModel()->GetAABB(),
+				              node->GetTransform()->GetObjectToWorldMatrix());
+		}
+		view_frustum.Overlaps(m_aabbs, m_visible_indices);
+
+		// Collect the visible models.
+		visible_models.clear();
+		visible_models.reserve(m_visible_indices.size());
+		for (const auto index : m_visible_indices) {
+			const ModelNode     * const node      = models[index];
+			const TransformNode * const transform = node->GetTransform();
+			const XMMATRIX object_to_world        = transform->GetObjectToWorldMatrix();
+			const XMMATRIX world_to_object        = transform->GetWorldToObjectMatrix();
+
+			VisibleModel model;
+			model.m_object_to_view       = object_to_world * world_to_view;
+			model.m_view_to_object       = view_to_world   * world_to_object;
+			model.m_object_to_projection = object_to_world * world_to_projection;
+			model.m_node                 = node;
+
+			visible_models.push_back(std::move(model));
+		}
+	}
+
+	void PassBuffer::Rebind(MemoryArena *memory_arena) {
+		RebindArenaVector(m_cameras,                              memory_arena);
+		RebindArenaVector(m_opaque_emissive_models,               memory_arena);
+		RebindArenaVector(m_opaque_brdf_models,                   memory_arena);
+		RebindArenaVector(m_transparent_emissive_models,          memory_arena);
+		RebindArenaVector(m_transparent_brdf_models,              memory_arena);
+		RebindArenaVector(m_visible_opaque_emissive_models,       memory_arena);
+		RebindArenaVector(m_visible_opaque_brdf_models,           memory_arena);
+		RebindArenaVector(m_visible_transparent_emissive_models,  memory_arena);
+		RebindArenaVector(m_visible_transparent_brdf_models,      memory_arena);
+		m_aabbs.Rebind(memory_arena);
+		RebindArenaVector(m_visible_indices,                      memory_arena);
+		RebindArenaVector(m_model_instances,                      memory_arena);
+		RebindArenaVector(m_index_ranges,                         memory_arena);
+		RebindArenaVector(m_visible_clusters,                     memory_arena);
+		RebindArenaVector(m_opaque_emissive_instance_groups,      memory_arena);
+		RebindArenaVector(m_opaque_brdf_instance_groups,          memory_arena);
+		RebindArenaVector(m_transparent_emissive_instance_groups, memory_arena);
+		RebindArenaVector(m_transparent_brdf_instance_groups,     memory_arena);
+		RebindArenaVector(m_transparent_instance_groups,          memory_arena);
+		m_draw_list.Rebind(memory_arena);
+		RebindArenaVector(m_draw_models,                          memory_arena);
+		RebindArenaVector(m_draw_instances,                       memory_arena);
+		RebindArenaVector(m_directional_lights,                   memory_arena);
+		RebindArenaVector(m_sm_directional_lights,                memory_arena);
+		RebindArenaVector(m_omni_lights,                          memory_arena);
+		RebindArenaVector(m_sm_omni_lights,                       memory_arena);
+		RebindArenaVector(m_spot_lights,                          memory_arena);
+		RebindArenaVector(m_sm_spot_lights,                       memory_arena);
+		RebindArenaVector(m_sprites,                              memory_arena);
+	}
+
 	void PassBuffer::UpdateCameras(const Scene *scene) {
 		// Clear active cameras.
 		m_cameras.clear();
@@ -91,6 +487,31 @@ namespace mage {
 		});
 	}
 
+	void PassBuffer::SelectLODs() const noexcept {
+		// The LODs are selected once per frame for the primary camera, and 
+		// are shared by all cameras and shadow maps.
+		if (m_cameras.empty()) {
+			return;
+		}
+
+		const CameraNode * const node     = m_cameras.front();
+		const XMMATRIX world_to_view      = node->GetTransform()->GetWorldToViewMatrix();
+		const XMMATRIX view_to_projection = node->GetCamera()->GetViewToProjectionMatrix();
+
+		const auto select_lods = [&](const ArenaVector< const ModelNode * > &models) {
+			for (const auto model : models) {
+				const XMMATRIX object_to_view 
+					= model->GetTransform()->GetObjectToWorldMatrix() * world_to_view;
+				model->SelectLOD(object_to_view, view_to_projection);
+			}
+		};
+
+		select_lods(m_opaque_emissive_models);
+		select_lods(m_opaque_brdf_models);
+		select_lods(m_transparent_emissive_models);
+		select_lods(m_transparent_brdf_models);
+	}
+
 	void PassBuffer::UpdateLights(const Scene *scene) {
 		// Clear active lights.
 		m_directional_lights.clear();
@@ -6,6 +6,19 @@
 #pragma region
 
 #include "scene\scene.hpp"
+#include "mesh\mesh_cluster.hpp"
+#include "math\geometry\view_frustum.hpp"
+#include "rendering\buffer\model_buffer.hpp"
+#include "rendering\pass\draw_list.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <tuple>
 
 #pragma endregion
 
@@ -14,6 +27,78 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	/**
+	 A struct of visible models (i.e. models which are not culled by the 
+	 view frustum of a camera) together with their camera dependent 
+	 transformation matrices.
+	 */
+	struct alignas(16) VisibleModel final {
+
+	public:
+
+		/**
+		 The object-to-view transformation matrix of this visible model.
+		 */
+		XMMATRIX m_object_to_view;
+
+		/**
+		 The view-to-object transformation matrix of this visible model.
+		 */
+		XMMATRIX m_view_to_object;
+
+		/**
+		 The object-to-projection transformation matrix of this visible 
+		 model.
+		 */
+		XMMATRIX m_object_to_projection;
+
+		/**
+		 A pointer to the model node of this visible model.
+		 */
+		const ModelNode *m_node;
+	};
+
+	/**
+	 A struct of model instance groups (i.e. visible models sharing the same 
+	 mesh, index range and material) which can be drawn with a single 
+	 instanced draw call.
+	 */
+	struct ModelInstanceGroup final {
+
+	public:
+
+		/**
+		 A pointer to a model node of this model instance group. The mesh, 
+		 index range and material of this model node are shared by all 
+		 instances of this model instance group.
+		 */
+		const ModelNode *m_node;
+
+		/**
+		 The index of the first instance of this model instance group in the 
+		 model instances of the pass buffer.
+		 */
+		U32 m_instance_start;
+
+		/**
+		 The number of instances of this model instance group.
+		 */
+		U32 m_nb_instances;
+
+		/**
+		 The index of the first index range of this model instance group in 
+		 the index ranges of the pass buffer.
+		 */
+		U32 m_range_start;
+
+		/**
+		 The number of index ranges of this model instance group (i.e. the 
+		 compacted index ranges of the mesh clusters which are visible for 
+		 at least one instance).
+		 */
+		U32 m_nb_ranges;
+	};
+
 	/**
 	 A struct of pass buffers used as input by render passes.
 	 */
@@ -79,6 +164,21 @@ namespace mage {
 		// Member Methods
 		//---------------------------------------------------------------------
 
+		/**
+		 Clears the per-frame data of this pass buffer and rebinds its storage 
+		 to the given memory arena.
+
+		 @pre			The storage of the per-frame data of this pass buffer 
+						is not allocated on a memory arena which has been 
+						reset since.
+		 @param[in]		memory_arena
+						A pointer to the memory arena. If @c nullptr, the 
+						per-frame data is allocated from the general heap.
+		 @throws		std::bad_alloc
+						Failed to allocate the memory block.
+		 */
+		void Rebind(MemoryArena *memory_arena);
+
 		/**
 		 Updates this pass buffer for the given scene.
 
@@ -88,13 +188,38 @@ namespace mage {
 		 */
 		void Update(const Scene *scene);
 
+		/**
+		 Updates the visible models of this pass buffer for the camera with 
+		 the given transformation matrices.
+
+		 The models are culled once against the view frustum of the camera 
+		 and the camera dependent transformation matrices of the visible 
+		 models are computed once. All passes of the camera use the visible 
+		 models instead of culling the models themselves. The LODs of the 
+		 models are selected once per frame in @c Update. The mesh clusters 
+		 of the model instance groups are culled against the view frustum 
+		 and the normal cones of the mesh clusters.
+
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix of the 
+						camera.
+		 @param[in]		world_to_view
+						The world-to-view transformation matrix of the 
+						camera.
+		 @param[in]		view_to_world
+						The view-to-world transformation matrix of the 
+						camera.
+		 */
+		void XM_CALLCONV UpdateVisibleModels(FXMMATRIX world_to_projection, 
+			CXMMATRIX world_to_view, CXMMATRIX view_to_world);
+
 		/**
 		 Returns the cameras of this pass buffer.
 
 		 @return		A reference to a vector containing the camera nodes
 						of this pass buffer. 
 		 */
-		const vector< const CameraNode * > &GetCameras() const noexcept {
+		const ArenaVector< const CameraNode * > &GetCameras() const noexcept {
 			return m_cameras;
 		}
 		
@@ -104,7 +229,7 @@ namespace mage {
 		 @return		A reference to a vector containing the opaque emissive 
 						model nodes of this pass buffer. 
 		 */
-		const vector< const ModelNode * > &GetOpaqueEmissiveModels() const noexcept {
+		const ArenaVector< const ModelNode * > &GetOpaqueEmissiveModels() const noexcept {
 			return m_opaque_emissive_models;
 		}
 		
@@ -114,7 +239,7 @@ namespace mage {
 		 @return		A reference to a vector containing the opaque BRDF 
 						model nodes of this pass buffer. 
 		 */
-		const vector< const ModelNode * > &GetOpaqueBRDFModels() const noexcept {
+		const ArenaVector< const ModelNode * > &GetOpaqueBRDFModels() const noexcept {
 			return m_opaque_brdf_models;
 		}
 		
@@ -124,7 +249,7 @@ namespace mage {
 		 @return		A reference to a vector containing the transparent 
 						emissive model nodes of this pass buffer. 
 		 */
-		const vector< const ModelNode * > &GetTransparentEmissiveModels() const noexcept {
+		const ArenaVector< const ModelNode * > &GetTransparentEmissiveModels() const noexcept {
 			return m_transparent_emissive_models;
 		}
 		
@@ -134,9 +259,137 @@ namespace mage {
 		 @return		A reference to a vector containing the transparent BRDF 
 						model nodes of this pass buffer. 
 		 */
-		const vector< const ModelNode * > &GetTransparentBRDFModels() const noexcept {
+		const ArenaVector< const ModelNode * > &GetTransparentBRDFModels() const noexcept {
 			return m_transparent_brdf_models;
 		}
+
+		/**
+		 Returns the visible opaque emissive models of this pass buffer.
+
+		 @return		A reference to a vector containing the visible opaque 
+						emissive models of this pass buffer for the current 
+						camera.
+		 */
+		const ArenaVector< VisibleModel > &GetVisibleOpaqueEmissiveModels() const noexcept {
+			return m_visible_opaque_emissive_models;
+		}
+
+		/**
+		 Returns the visible opaque BRDF models of this pass buffer.
+
+		 @return		A reference to a vector containing the visible opaque 
+						BRDF models of this pass buffer for the current 
+						camera.
+		 */
+		const ArenaVector< VisibleModel > &GetVisibleOpaqueBRDFModels() const noexcept {
+			return m_visible_opaque_brdf_models;
+		}
+
+		/**
+		 Returns the visible transparent emissive models of this pass buffer.
+
+		 @return		A reference to a vector containing the visible 
+						transparent emissive models of this pass buffer for 
+						the current camera.
+		 */
+		const ArenaVector< VisibleModel > &GetVisibleTransparentEmissiveModels() const noexcept {
+			return m_visible_transparent_emissive_models;
+		}
+
+		/**
+		 Returns the visible transparent BRDF models of this pass buffer.
+
+		 @return		A reference to a vector containing the visible 
+						transparent BRDF models of this pass buffer for the 
+						current camera.
+		 */
+		const ArenaVector< VisibleModel > &GetVisibleTransparentBRDFModels() const noexcept {
+			return m_visible_transparent_brdf_models;
+		}
+
+		/**
+		 Returns the model instances of the visible models of this pass 
+		 buffer.
+
+		 @return		A reference to a vector containing the model instances 
+						of the visible models of this pass buffer for the 
+						current camera.
+		 */
+		const ArenaVector< ModelInstance > &GetModelInstances() const noexcept {
+			return m_model_instances;
+		}
+
+		/**
+		 Returns the index ranges of the model instance groups of this pass 
+		 buffer.
+
+		 @return		A reference to a vector containing the index ranges 
+						of the model instance groups of this pass buffer for 
+						the current camera.
+		 */
+		const ArenaVector< IndexRange > &GetIndexRanges() const noexcept {
+			return m_index_ranges;
+		}
+
+		/**
+		 Returns the instance groups of the visible opaque emissive models of 
+		 this pass buffer.
+
+		 @return		A reference to a vector containing the instance groups 
+						of the visible opaque emissive models of this pass 
+						buffer for the current camera.
+		 */
+		const ArenaVector< ModelInstanceGroup > &GetVisibleOpaqueEmissiveInstanceGroups() const noexcept {
+			return m_opaque_emissive_instance_groups;
+		}
+
+		/**
+		 Returns the instance groups of the visible opaque BRDF models of this 
+		 pass buffer.
+
+		 @return		A reference to a vector containing the instance groups 
+						of the visible opaque BRDF models of this pass buffer 
+						for the current camera.
+		 */
+		const ArenaVector< ModelInstanceGroup > &GetVisibleOpaqueBRDFInstanceGroups() const noexcept {
+			return m_opaque_brdf_instance_groups;
+		}
+
+		/**
+		 Returns the instance groups of the visible transparent emissive 
+		 models of this pass buffer.
+
+		 @return		A reference to a vector containing the instance groups 
+						of the visible transparent emissive models of this 
+						pass buffer for the current camera.
+		 */
+		const ArenaVector< ModelInstanceGroup > &GetVisibleTransparentEmissiveInstanceGroups() const noexcept {
+			return m_transparent_emissive_instance_groups;
+		}
+
+		/**
+		 Returns the instance groups of the visible transparent BRDF models of 
+		 this pass buffer.
+
+		 @return		A reference to a vector containing the instance groups 
+						of the visible transparent BRDF models of this pass 
+						buffer for the current camera.
+		 */
+		const ArenaVector< ModelInstanceGroup > &GetVisibleTransparentBRDFInstanceGroups() const noexcept {
+			return m_transparent_brdf_instance_groups;
+		}
+
+		/**
+		 Returns the instance groups of all visible transparent models of 
+		 this pass buffer sorted back-to-front.
+
+		 @return		A reference to a vector containing the instance groups 
+						of all visible transparent (emissive and BRDF) models 
+						of this pass buffer for the current camera.
+		 */
+		const ArenaVector< ModelInstanceGroup > &GetVisibleTransparentInstanceGroups() const noexcept {
+			return m_transparent_instance_groups;
+		}
 		
 		/**
 		 Returns the directional lights of this pass buffer.
@@ -144,7 +397,7 @@ namespace mage {
 		 @return		A reference to a vector containing the directional 
 						light nodes of this pass buffer. 
 		 */
-		const vector< const DirectionalLightNode * > &GetDirectionalLights() const noexcept {
+		const ArenaVector< const DirectionalLightNode * > &GetDirectionalLights() const noexcept {
 			return m_directional_lights;
 		}
 		
@@ -155,7 +408,7 @@ namespace mage {
 		 @return		A reference to a vector containing the directional 
 						light with shadow mapping nodes of this pass buffer. 
 		 */
-		const vector< const DirectionalLightNode * > &GetDirectionalLightsWithShadowMapping() const noexcept {
+		const ArenaVector< const DirectionalLightNode * > &GetDirectionalLightsWithShadowMapping() const noexcept {
 			return m_sm_directional_lights;
 		}
 		
@@ -165,7 +418,7 @@ namespace mage {
 		 @return		A reference to a vector containing the omni light nodes 
 						of this pass buffer. 
 		 */
-		const vector< const OmniLightNode * > &GetOmniLights() const noexcept {
+		const ArenaVector< const OmniLightNode * > &GetOmniLights() const noexcept {
 			return m_omni_lights;
 		}
 		
@@ -175,7 +428,7 @@ namespace mage {
 		 @return		A reference to a vector containing the omni light with 
 						shadow mapping nodes of this pass buffer. 
 		 */
-		const vector< const OmniLightNode * > &GetOmniLightsWithShadowMapping() const noexcept {
+		const ArenaVector< const OmniLightNode * > &GetOmniLightsWithShadowMapping() const noexcept {
 			return m_sm_omni_lights;
 		}
 		
@@ -185,7 +438,7 @@ namespace mage {
 		 @return		A reference to a vector containing the spotlight nodes 
 						of this pass buffer. 
 		 */
-		const vector< const SpotLightNode * > &GetSpotLights() const noexcept {
+		const ArenaVector< const SpotLightNode * > &GetSpotLights() const noexcept {
 			return m_spot_lights;
 		}
 		
@@ -195,7 +448,7 @@ namespace mage {
 		 @return		A reference to a vector containing the spotlight with 
 						shadow mapping nodes of this pass buffer. 
 		 */
-		const vector< const SpotLightNode * > &GetSpotLightsWithShadowMapping() const noexcept {
+		const ArenaVector< const SpotLightNode * > &GetSpotLightsWithShadowMapping() const noexcept {
 			return m_sm_spot_lights;
 		}
 		
@@ -205,7 +458,7 @@ namespace mage {
 		 @return		A reference to a vector containing the sprite nodes of 
 						this pass buffer. 
 		 */
-		const vector< const SpriteNode * > &GetSprites() const noexcept {
+		const ArenaVector< const SpriteNode * > &GetSprites() const noexcept {
 			return m_sprites;
 		}
 		
@@ -261,6 +514,12 @@ namespace mage {
 		 */
 		void UpdateModels(const Scene *scene);
 
+		/**
+		 Selects the LODs of the models of this pass buffer for the primary 
+		 (i.e. first) camera of this pass buffer.
+		 */
+		void SelectLODs() const noexcept;
+
 		/**
 		 Updates the lights of this pass buffer for the given scene.
 
@@ -279,6 +538,97 @@ namespace mage {
 		 */
 		void UpdateSprites(const Scene *scene);
 
+		/**
+		 Culls the given models against the given view frustum and collects 
+		 the visible models.
+
+		 @param[in]		models
+						A reference to a vector containing the model nodes.
+		 @param[in]		view_frustum
+						A reference to the world-space view frustum.
+		 @param[out]	visible_models
+						A reference to a vector which will contain the 
+						visible models.
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix.
+		 @param[in]		world_to_view
+						The world-to-view transformation matrix.
+		 @param[in]		view_to_world
+						The view-to-world transformation matrix.
+		 */
+		void XM_CALLCONV UpdateVisibleModels(
+			const ArenaVector< const ModelNode * > &models,
+			const ViewFrustum &view_frustum,
+			ArenaVector< VisibleModel > &visible_models,
+			FXMMATRIX world_to_projection, 
+			CXMMATRIX world_to_view, 
+			CXMMATRIX view_to_world);
+
+		/**
+		 Adds the given visible models to the draw list of this pass buffer.
+
+		 @param[in]		models
+						A reference to a vector containing the visible models.
+		 @param[in]		queue
+						The queue of the given visible models.
+		 @param[in]		transparency
+						@c true if the given visible models must be sorted 
+						back-to-front. @c false otherwise.
+		 */
+		void AddToDrawList(const ArenaVector< VisibleModel > &models, 
+			U32 queue, bool transparency);
+
+		/**
+		 Sorts the draw list of this pass buffer, groups consecutive visible 
+		 models with the same mesh, index range and material into model 
+		 instance groups and collects their model instances and the index 
+		 ranges of their visible mesh clusters. The draw list of this pass 
+		 buffer is cleared afterwards.
+
+		 @param[out]	groups
+						A reference to a vector which will contain the model 
+						instance groups.
+		 @param[in]		eye
+						The homogeneous view-space eye position (i.e. the 
+						origin for perspective projections, or the negated 
+						view direction for orthographic projections).
+		 */
+		void XM_CALLCONV UpdateInstanceGroups(
+			ArenaVector< ModelInstanceGroup > &groups, FXMVECTOR eye);
+
+		/**
+		 Adds the model instances of the given model instance groups to the 
+		 draw list of this pass buffer.
+
+		 @param[in]		groups
+						A reference to a vector containing the model instance 
+						groups.
+		 @param[in]		queue
+						The queue of the given model instance groups.
+		 */
+		void AddToDrawList(const ArenaVector< ModelInstanceGroup > &groups, 
+			U32 queue);
+
+		/**
+		 Merges the instance groups of the visible transparent emissive and 
+		 BRDF models into a single back-to-front queue. The model instances 
+		 and index ranges of the merged instance groups are shared with the 
+		 transparent emissive and BRDF instance groups (i.e. they are not 
+		 collected and uploaded twice).
+		 */
+		void UpdateTransparentInstanceGroups();
+
+		/**
+		 Compacts the visible mesh clusters of the last model instance group 
+		 of the given model instance groups into index ranges.
+
+		 @pre			@a groups is not empty.
+		 @param[in,out]	groups
+						A reference to a vector containing the model instance 
+						groups.
+		 */
+		void CompactInstanceGroup(ArenaVector< ModelInstanceGroup > &groups);
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -286,72 +636,194 @@ namespace mage {
 		/**
 		 A vector containing pointers to the camera nodes of this pass buffer.
 		 */
-		vector< const CameraNode * > m_cameras;
+		ArenaVector< const CameraNode * > m_cameras;
 
 		/**
 		 A vector containing pointers to the opaque emissive model nodes of 
 		 this pass buffer.
 		 */
-		vector< const ModelNode * >	m_opaque_emissive_models;
+		ArenaVector< const ModelNode * >	m_opaque_emissive_models;
 
 		/**
 		 A vector containing pointers to the opaque BRDF model nodes of this 
 		 pass buffer.
 		 */
-		vector< const ModelNode * >	m_opaque_brdf_models;
+		ArenaVector< const ModelNode * >	m_opaque_brdf_models;
 
 		/**
 		 A vector containing pointers to the transparent emissive model nodes
 		 of this pass buffer.
 		 */
-		vector< const ModelNode * >	m_transparent_emissive_models;
+		ArenaVector< const ModelNode * >	m_transparent_emissive_models;
 
 		/**
 		 A vector containing pointers to the transparent BRDF model nodes of 
 		 this pass buffer.
 		 */
-		vector< const ModelNode * >	m_transparent_brdf_models;
+		ArenaVector< const ModelNode * >	m_transparent_brdf_models;
+
+		/**
+		 A vector containing the visible opaque emissive models of this pass 
+		 buffer.
+		 */
+		ArenaVector< VisibleModel > m_visible_opaque_emissive_models;
+
+		/**
+		 A vector containing the visible opaque BRDF models of this pass 
+		 buffer.
+		 */
+		ArenaVector< VisibleModel > m_visible_opaque_brdf_models;
+
+		/**
+		 A vector containing the visible transparent emissive models of this 
+		 pass buffer.
+		 */
+		ArenaVector< VisibleModel > m_visible_transparent_emissive_models;
+
+		/**
+		 A vector containing the visible transparent BRDF models of this pass 
+		 buffer.
+		 */
+		ArenaVector< VisibleModel > m_visible_transparent_brdf_models;
+
+		/**
+		 The world-space AABBs of the models to cull of this pass buffer.
+		 */
+		AABBBatch m_aabbs;
+
+		/**
+		 The indices of the culled models which are visible of this pass 
+		 buffer.
+		 */
+		ArenaVector< size_t > m_visible_indices;
+
+		/**
+		 A vector containing the model instances of the visible models of 
+		 this pass buffer.
+		 */
+		ArenaVector< ModelInstance > m_model_instances;
+
+		/**
+		 A vector containing the index ranges of the model instance groups of 
+		 this pass buffer.
+		 */
+		ArenaVector< IndexRange > m_index_ranges;
+
+		/**
+		 A vector containing the visibility of the mesh clusters of the 
+		 model instance group which is currently collected by this pass 
+		 buffer.
+		 */
+		ArenaVector< bool > m_visible_clusters;
+
+		/**
+		 A vector containing the instance groups of the visible opaque 
+		 emissive models of this pass buffer.
+		 */
+		ArenaVector< ModelInstanceGroup > m_opaque_emissive_instance_groups;
+
+		/**
+		 A vector containing the instance groups of the visible opaque BRDF 
+		 models of this pass buffer.
+		 */
+		ArenaVector< ModelInstanceGroup > m_opaque_brdf_instance_groups;
+
+		/**
+		 A vector containing the instance groups of the visible transparent 
+		 emissive models of this pass buffer.
+		 */
+		ArenaVector< ModelInstanceGroup > m_transparent_emissive_instance_groups;
+
+		/**
+		 A vector containing the instance groups of the visible transparent 
+		 BRDF models of this pass buffer.
+		 */
+		ArenaVector< ModelInstanceGroup > m_transparent_brdf_instance_groups;
+
+		/**
+		 A vector containing the instance groups of all visible transparent 
+		 models of this pass buffer.
+		 */
+		ArenaVector< ModelInstanceGroup > m_transparent_instance_groups;
+
+		/**
+		 The draw list of this pass buffer.
+		 */
+		DrawList m_draw_list;
+
+		/**
+		 A vector containing pointers to the visible models of the draw list 
+		 of this pass buffer.
+		 */
+		ArenaVector< const VisibleModel * > m_draw_models;
+
+		/**
+		 A vector containing the model instance groups and indices of the 
+		 model instances of the draw list of this pass buffer (used for 
+		 merging model instance groups).
+		 */
+		ArenaVector< pair< const ModelInstanceGroup *, U32 > > m_draw_instances;
+
+		/**
+		 A map containing the sort key identifiers of the meshes of this 
+		 pass buffer.
+		 */
+		map< const void *, U32 > m_mesh_ids;
+
+		/**
+		 A map containing the sort key identifiers of the texture sets of 
+		 this pass buffer.
+		 */
+		map< array< const void *, 3 >, U32 > m_texture_set_ids;
+
+		/**
+		 A map containing the sort key identifiers of the index ranges and 
+		 material parameters of this pass buffer.
+		 */
+		map< std::tuple< size_t, size_t, size_t, 
+			F32, F32, F32, F32, F32, F32 >, U32 > 
+			m_material_ids;
 
 		/**
 		 A vector containing pointers to the directional nodes of this pass 
 		 buffer.
 		 */
-		vector< const DirectionalLightNode * > m_directional_lights;
+		ArenaVector< const DirectionalLightNode * > m_directional_lights;
 
 		/**
 		 A vector containing pointers to the directional with shadow mapping 
 		 nodes of this pass buffer.
 		 */
-		vector< const DirectionalLightNode * > m_sm_directional_lights;
+		ArenaVector< const DirectionalLightNode * > m_sm_directional_lights;
 
 		/**
 		 A vector containing pointers to the omni light nodes of this pass 
 		 buffer.
 		 */
-		vector< const OmniLightNode * >	m_omni_lights;
+		ArenaVector< const OmniLightNode * >	m_omni_lights;
 
 		/**
 		 A vector containing pointers to the omni light with shadow mapping 
 		 nodes of this pass buffer.
 		 */
-		vector< const OmniLightNode * >	m_sm_omni_lights;
+		ArenaVector< const OmniLightNode * >	m_sm_omni_lights;
 
 		/**
 		 A vector containing pointers to the spotlight nodes of this pass 
 		 buffer.
 		 */
-		vector< const SpotLightNode * >	m_spot_lights;
+		ArenaVector< const SpotLightNode * >	m_spot_lights;
 
 		/**
 		 A vector containing pointers to the spotlight with shadow mapping 
 		 nodes of this pass buffer.
 		 */
-		vector< const SpotLightNode * >	m_sm_spot_lights;
+		ArenaVector< const SpotLightNode * >	m_sm_spot_lights;
 
 		/**
 		 A vector containing pointers to the sprite nodes of this pass buffer.
 		 */
-		vector< const SpriteNode * > m_sprites;
+		ArenaVector< const SpriteNode * > m_sprites;
 
 		/**
 		 The radiance spectrum of the ambient light of this pass buffer.
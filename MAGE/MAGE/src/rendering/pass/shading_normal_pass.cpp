@@ -5,7 +5,6 @@
 
 #include "rendering\rendering_manager.hpp"
 #include "resource\resource_factory.hpp"
-#include "math\geometry\view_frustum.hpp"
 #include "utils\logging\error.hpp"
 
 // Include HLSL bindings.
@@ -24,13 +23,16 @@ namespace mage {
 		return Renderer::Get()->GetShadingNormalPass();
 	}
 
-	ShadingNormalPass::ShadingNormalPass()
-		: m_device_context(Pipeline::GetImmediateDeviceContext()), 
+	ShadingNormalPass::ShadingNormalPass(ID3D11DeviceContext4 *device_context)
+		: m_device_context(device_context), 
 		m_render_mode(RenderMode::None), 
 		m_vs(CreateShadingNormalVS()), 
 		m_ps{ CreateShadingNormalPS(false), CreateShadingNormalPS(true) },
 		m_bound_ps(PSIndex::Count),
-		m_model_buffer() {}
+		m_model_buffer() {
+
+		Assert(m_device_context);
+	}
 
 	ShadingNormalPass::ShadingNormalPass(
 		ShadingNormalPass &&render_pass) = default;
@@ -104,44 +106,28 @@ namespace mage {
 		RenderingStateManager::Get()->BindOpaqueBlendState(m_device_context);
 	}
 
-	void XM_CALLCONV ShadingNormalPass::Render(
-		const PassBuffer *scene, 
-		FXMMATRIX world_to_projection,
-		CXMMATRIX world_to_view) {
+	void ShadingNormalPass::Render(const PassBuffer *scene) {
 		
 		Assert(scene);
 
 		// Process the models (which interact with light).
-		ProcessModels(scene->GetOpaqueBRDFModels(), 
-			world_to_projection, world_to_view);
-		ProcessModels(scene->GetTransparentBRDFModels(), 
-			world_to_projection, world_to_view);
+		ProcessModels(scene->GetVisibleOpaqueBRDFModels());
+		ProcessModels(scene->GetVisibleTransparentBRDFModels());
 	}
 
-	void XM_CALLCONV ShadingNormalPass::ProcessModels(
-		const vector< const ModelNode * > &models,
-		FXMMATRIX world_to_projection, 
-		CXMMATRIX world_to_view) {
+	void ShadingNormalPass::ProcessModels(
+		const ArenaVector< VisibleModel > &models) {
 
-		for (const auto node : models) {
+		for (const auto &visible_model : models) {
 
-			// Obtain node components (1/2).
+			// Obtain node components.
+			const ModelNode     * const node      = visible_model.m_node;
 			const TransformNode * const transform = node->GetTransform();
 			const Model         * const model     = node->GetModel();
-			const XMMATRIX object_to_world        = transform->GetObjectToWorldMatrix();
-			const XMMATRIX object_to_projection   = object_to_world * world_to_projection;
-
-			// Apply view frustum culling.
-			if (ViewFrustum::Cull(object_to_projection, model->GetAABB())) {
-				continue;
-			}
-
-			// Obtain node components (2/2).
-			const XMMATRIX object_to_view         = object_to_world * world_to_view;
 			const XMMATRIX world_to_object        = transform->GetWorldToObjectMatrix();
 
 			// Bind the model data.
-			BindModelData(object_to_view, world_to_object);
+			BindModelData(visible_model.m_object_to_view, world_to_object);
 			// Bind the pixel shader.
 			BindPS(model->GetMaterial());
 			// Bind the model mesh.
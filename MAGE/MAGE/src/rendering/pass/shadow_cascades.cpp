@@ -0,0 +1,150 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering\pass\shadow_cascades.hpp"
+#include "utils\logging\error.hpp"
+
+// Include HLSL bindings.
+#include "..\..\..\shaders\hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	static_assert(NB_SHADOW_CASCADES == g_nb_shadow_cascades,
+		          "CPU/GPU shadow cascade count mismatch");
+
+	/**
+	 The minimum view-space depth of the near plane of the first shadow
+	 cascade.
+	 */
+	constexpr F32 g_shadow_cascade_min_near_z = 0.01f;
+
+	/**
+	 The granularity of the radii of shadow cascades.
+	 */
+	constexpr F32 g_shadow_cascade_radius_granularity = 16.0f;
+
+	void XM_CALLCONV ComputeShadowCascadeSplits(
+		FXMMATRIX view_to_projection,
+		F32 max_distance,
+		F32 lambda,
+		F32 &near_z,
+		F32 (&ends)[g_nb_shadow_cascades]) noexcept {
+
+		const XMMATRIX projection_to_view
+			= XMMatrixInverse(nullptr, view_to_projection);
+
+		// Obtain the view-space depth of the near and far plane (the depth
+		// buffer may be inverted).
+		const F32 z0 = XMVectorGetZ(XMVector3TransformCoord(
+			XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), projection_to_view));
+		const F32 z1 = XMVectorGetZ(XMVector3TransformCoord(
+			XMVectorSet(0.0f, 0.0f, 1.0f, 1.0f), projection_to_view));
+
+		near_z = std::max(std::min(z0, z1), g_shadow_cascade_min_near_z);
+		const F32 far_z = std::max(std::min(std::max(z0, z1), max_distance),
+			                       near_z);
+
+		// Practical split scheme
+		for (size_t i = 0; i < g_nb_shadow_cascades; ++i) {
+			const F32 f = static_cast< F32 >(i + 1)
+				        / static_cast< F32 >(g_nb_shadow_cascades);
+			const F32 log_z     = near_z * std::pow(far_z / near_z, f);
+			const F32 uniform_z = near_z + (far_z - near_z) * f;
+			ends[i] = lambda * log_z + (1.0f - lambda) * uniform_z;
+		}
+
+		// Avoid rounding errors for the last shadow cascade.
+		ends[g_nb_shadow_cascades - 1] = far_z;
+	}
+
+	const AABB XM_CALLCONV FitShadowCascade(
+		FXMMATRIX view_to_projection,
+		CXMMATRIX cview_to_lview,
+		F32 near_z,
+		F32 far_z,
+		U32 resolution) noexcept {
+
+		Assert(near_z <= far_z);
+		Assert(2u < resolution);
+
+		const XMMATRIX projection_to_view
+			= XMMatrixInverse(nullptr, view_to_projection);
+
+		// Unproject the frustum corners to view-space rays and obtain the
+		// corners of the frustum slice.
+		XMVECTOR corners[8];
+		XMVECTOR centroid = XMVectorZero();
+		for (size_t i = 0; i < 4; ++i) {
+			const F32 x = (i & 1) ? 1.0f : -1.0f;
+			const F32 y = (i & 2) ? 1.0f : -1.0f;
+			const XMVECTOR a = XMVector3TransformCoord(
+				XMVectorSet(x, y, 0.0f, 1.0f), projection_to_view);
+			const XMVECTOR b = XMVector3TransformCoord(
+				XMVectorSet(x, y, 1.0f, 1.0f), projection_to_view);
+			const XMVECTOR d = b - a;
+			const F32 d_z = XMVectorGetZ(d);
+			const F32 a_z = XMVectorGetZ(a);
+
+			corners[2 * i]     = a + d * ((near_z - a_z) / d_z);
+			corners[2 * i + 1] = a + d * ((far_z  - a_z) / d_z);
+			centroid += corners[2 * i] + corners[2 * i + 1];
+		}
+		centroid /= 8.0f;
+
+		// Compute the bounding sphere of the frustum slice. The radius is
+		// rounded up to obtain a constant texel size while the camera moves.
+		F32 r = 0.0f;
+		for (const auto &corner : corners) {
+			r = std::max(r, XMVectorGetX(XMVector3Length(corner - centroid)));
+		}
+		r = std::ceil(r * g_shadow_cascade_radius_granularity)
+			/ g_shadow_cascade_radius_granularity;
+
+		// Snap the light-view-space centroid to the shadow map texels. The
+		// xy-extent is enlarged by one texel on each side, since snapping
+		// moves the centroid by less than one texel.
+		XMFLOAT3 c;
+		XMStoreFloat3(&c, XMVector3TransformCoord(centroid, cview_to_lview));
+		const F32 texel_size = 2.0f * r / static_cast< F32 >(resolution - 2u);
+		c.x = std::floor(c.x / texel_size) * texel_size;
+		c.y = std::floor(c.y / texel_size) * texel_size;
+		const F32 r_xy = r + texel_size;
+
+		return AABB(Point3(c.x - r_xy, c.y - r_xy, c.z - r),
+			        Point3(c.x + r_xy, c.y + r_xy, c.z + r));
+	}
+
+	const XMMATRIX XM_CALLCONV GetShadowCascadeViewToProjectionMatrix(
+		const AABB &bounds) noexcept {
+
+#ifdef DISSABLE_INVERTED_Z_BUFFER
+		const F32 near_z = bounds.m_p_min.m_z;
+		const F32 far_z  = bounds.m_p_max.m_z;
+#else  // DISSABLE_INVERTED_Z_BUFFER
+		const F32 near_z = bounds.m_p_max.m_z;
+		const F32 far_z  = bounds.m_p_min.m_z;
+#endif // DISSABLE_INVERTED_Z_BUFFER
+
+		return XMMatrixOrthographicOffCenterLH(
+			bounds.m_p_min.m_x, bounds.m_p_max.m_x,
+			bounds.m_p_min.m_y, bounds.m_p_max.m_y,
+			near_z, far_z);
+	}
+}
\ No newline at end of file
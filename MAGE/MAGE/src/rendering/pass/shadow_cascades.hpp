@@ -0,0 +1,104 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "math\geometry\bounding_volume.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+#define MAGE_DEFAULT_SHADOW_CASCADE_LAMBDA   0.75f
+#define MAGE_DEFAULT_SHADOW_DISTANCE         100.0f
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The number of shadow cascades of a directional light.
+	 */
+	constexpr size_t g_nb_shadow_cascades = 4;
+
+	/**
+	 Computes the view-space depths of the far planes of the shadow cascades
+	 of the given camera using the practical split scheme (i.e. a blend of
+	 the logarithmic and uniform split schemes).
+
+	 @param[in]		view_to_projection
+					The view-to-projection transformation matrix of the
+					camera.
+	 @param[in]		max_distance
+					The maximum view-space depth of the last shadow cascade.
+	 @param[in]		lambda
+					The blend factor between the uniform (0) and the
+					logarithmic (1) split scheme.
+	 @param[out]	near_z
+					The view-space depth of the near plane of the first
+					shadow cascade.
+	 @param[out]	ends
+					A reference to an array which will contain the
+					view-space depths of the far planes of the shadow
+					cascades.
+	 */
+	void XM_CALLCONV ComputeShadowCascadeSplits(
+		FXMMATRIX view_to_projection,
+		F32 max_distance,
+		F32 lambda,
+		F32 &near_z,
+		F32 (&ends)[g_nb_shadow_cascades]) noexcept;
+
+	/**
+	 Fits a stable light-view-space volume to the given slice of the view
+	 frustum of the given camera.
+
+	 The volume encloses the bounding sphere of the slice, which makes its
+	 extent independent of the camera orientation. Its xy-coordinates are
+	 snapped to the texels of the shadow map to avoid shimmering edges while
+	 the camera moves. The xy-extent of the volume spans exactly
+	 @a resolution texels and contains the slice despite the snapping.
+
+	 @param[in]		view_to_projection
+					The view-to-projection transformation matrix of the
+					camera.
+	 @param[in]		cview_to_lview
+					The camera-view-to-light-view transformation matrix
+					(without scaling components).
+	 @param[in]		near_z
+					The view-space depth of the near plane of the slice.
+	 @param[in]		far_z
+					The view-space depth of the far plane of the slice.
+	 @pre			@a resolution is larger than 2.
+	 @param[in]		resolution
+					The resolution of the shadow map.
+	 @return		The light-view-space AABB of the shadow cascade.
+	 */
+	const AABB XM_CALLCONV FitShadowCascade(
+		FXMMATRIX view_to_projection,
+		CXMMATRIX cview_to_lview,
+		F32 near_z,
+		F32 far_z,
+		U32 resolution) noexcept;
+
+	/**
+	 Returns the orthographic light-view-to-light-projection transformation
+	 matrix of the given light-view-space volume of a shadow cascade.
+
+	 @param[in]		bounds
+					A reference to the light-view-space AABB of the shadow
+					cascade.
+	 @return		The light-view-to-light-projection transformation matrix
+					of the given shadow cascade.
+	 */
+	const XMMATRIX XM_CALLCONV GetShadowCascadeViewToProjectionMatrix(
+		const AABB &bounds) noexcept;
+}
\ No newline at end of file
@@ -0,0 +1,405 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering\pass\shadow_caster_cache.hpp"
+#include "utils\logging\error.hpp"
+
+// Include HLSL bindings.
+#include "..\..\..\shaders\hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 Checks whether the given AABB overlaps the given BS.
+
+	 @param[in]		aabb
+					A reference to the AABB.
+	 @param[in]		p
+					The centroid of the BS.
+	 @param[in]		r
+					The radius of the BS.
+	 @return		@c true if the given AABB overlaps the given BS. @c false
+					otherwise.
+	 */
+	inline bool XM_CALLCONV Overlaps(const AABB &aabb,
+		FXMVECTOR p, F32 r) noexcept {
+
+		const XMVECTOR p_min = XMLoadFloat3(&aabb.m_p_min);
+		const XMVECTOR p_max = XMLoadFloat3(&aabb.m_p_max);
+
+		// The distance from the centroid of the BS to the AABB.
+		const XMVECTOR d = XMVectorMax(p_min - p, XMVectorZero())
+			             + XMVectorMax(p - p_max, XMVectorZero());
+
+		return XMVectorGetX(XMVector3LengthSq(d)) <= r * r;
+	}
+
+	/**
+	 Classifies the given light-view-space AABB against the faces of a shadow
+	 cube map.
+
+	 The face looking along the +x-axis covers all points with
+	 x >= max(|y|, |z|) (and analogous for the other faces). The AABB
+	 overlaps that face if and only if its maximum x-coordinate is at least
+	 the minimum of max(|y|, |z|) over the AABB.
+
+	 @param[in]		aabb
+					A reference to the AABB expressed in light view space.
+	 @return		The mask of the faces (+x, -x, +y, -y, +z, -z)
+					overlapped by the given AABB.
+	 */
+	inline U32 ClassifyCubeFaces(const AABB &aabb) noexcept {
+		const XMVECTOR p_min = XMLoadFloat3(&aabb.m_p_min);
+		const XMVECTOR p_max = XMLoadFloat3(&aabb.m_p_max);
+
+		// The minimum absolute coordinates over the AABB.
+		XMFLOAT3 d;
+		XMStoreFloat3(&d, XMVectorMax(XMVectorMax(p_min, -p_max),
+			                          XMVectorZero()));
+		// The maximum positive and negative coordinates over the AABB.
+		XMFLOAT3 pos, neg;
+		XMStoreFloat3(&pos,  p_max);
+		XMStoreFloat3(&neg, -p_min);
+
+		const F32 d_yz = std::max(d.y, d.z);
+		const F32 d_xz = std::max(d.x, d.z);
+		const F32 d_xy = std::max(d.x, d.y);
+
+		U32 faces = 0u;
+		faces |= (0.0f < pos.x && d_yz <= pos.x) ? 0x01u : 0u;
+		faces |= (0.0f < neg.x && d_yz <= neg.x) ? 0x02u : 0u;
+		faces |= (0.0f < pos.y && d_xz <= pos.y) ? 0x04u : 0u;
+		faces |= (0.0f < neg.y && d_xz <= neg.y) ? 0x08u : 0u;
+		faces |= (0.0f < pos.z && d_xy <= pos.z) ? 0x10u : 0u;
+		faces |= (0.0f < neg.z && d_xy <= neg.z) ? 0x20u : 0u;
+		return faces;
+	}
+
+	ShadowCasterCache::ShadowCasterCache()
+		: m_frame(0u),
+		m_states(),
+		m_buffer(),
+		m_nb_opaque_casters(0),
+		m_aabbs(),
+		m_aabb_buffer(),
+		m_changed_aabbs(),
+		m_sorted_states(),
+		m_sorted_buffer(),
+		m_aabb_batch(),
+		m_indices(),
+		m_entries() {}
+
+	ShadowCasterCache::ShadowCasterCache(
+		ShadowCasterCache &&cache) = default;
+
+	ShadowCasterCache::~ShadowCasterCache() = default;
+
+	ShadowCasterCache &ShadowCasterCache::operator=(
+		ShadowCasterCache &&cache) = default;
+
+	void ShadowCasterCache::AddCasterStates(
+		const ArenaVector< const ModelNode * > &models, bool transparent,
+		vector< CasterState > &states) {
+
+		for (const auto node : models) {
+			const Model * const model = node->GetModel();
+
+			// Skip non-occluder models and "too" transparent models.
+			if (!model->OccludesLight()
+				|| (transparent && model->GetMaterial()->GetBaseColor().m_w
+				                   < TRANSPARENCY_SHADOW_THRESHOLD)) {
+				continue;
+			}
+
+			CasterState state;
+			state.m_node = node;
+			XMStoreFloat4x4(&state.m_object_to_world,
+				node->GetTransform()->GetObjectToWorldMatrix());
+			if (transparent) {
+				// Resolve the lazily updated texture transform before the 
+				// shadow maps are recorded on multiple threads.
+				node->GetTextureTransform()->GetTransformMatrix();
+			}
+			states.push_back(state);
+		}
+	}
+
+	void ShadowCasterCache::Update(const PassBuffer *scene) {
+		Assert(scene);
+
+		++m_frame;
+
+		// Release the cache entries which were not used during the previous
+		// frame.
+		for (auto it = m_entries.begin(); it != m_entries.end();) {
+			if (it->second.m_frame + 1u < m_frame) {
+				it = m_entries.erase(it);
+			}
+			else {
+				++it;
+			}
+		}
+
+		// Collect the current shadow caster states.
+		m_buffer.clear();
+		AddCasterStates(scene->GetOpaqueEmissiveModels(),      false, m_buffer);
+		AddCasterStates(scene->GetOpaqueBRDFModels(),          false, m_buffer);
+		const size_t nb_opaque_casters = m_buffer.size();
+		AddCasterStates(scene->GetTransparentEmissiveModels(), true,  m_buffer);
+		AddCasterStates(scene->GetTransparentBRDFModels(),     true,  m_buffer);
+
+		// Check whether any shadow caster has changed.
+		if (nb_opaque_casters == m_nb_opaque_casters
+			&& m_buffer.size() == m_states.size()
+			&& (m_states.empty() || 0 == std::memcmp(m_buffer.data(),
+				m_states.data(), m_states.size() * sizeof(CasterState)))) {
+			return;
+		}
+
+		// Compute the world-space AABBs of the shadow casters.
+		m_aabb_buffer.clear();
+		for (const auto &state : m_buffer) {
+			m_aabb_buffer.push_back(TransformAABB(
+				state.m_node->GetModel()->GetAABB(),
+				XMLoadFloat4x4(&state.m_object_to_world)));
+		}
+
+		// Invalidate the cache entries affected by the changed shadow 
+		// casters only.
+		CollectChangedCasters(nb_opaque_casters);
+		InvalidateEntries();
+
+		m_states.swap(m_buffer);
+		m_aabbs.swap(m_aabb_buffer);
+		m_nb_opaque_casters = nb_opaque_casters;
+
+		m_aabb_batch.clear();
+		for (const auto &aabb : m_aabbs) {
+			m_aabb_batch.push_back(aabb);
+		}
+	}
+
+	void ShadowCasterCache::CollectChangedCasters(size_t nb_opaque_casters) {
+		m_changed_aabbs.clear();
+
+		// Sort the current and scratch shadow caster states by model node.
+		const auto sort = [](const vector< CasterState > &states,
+			                 vector< pair< const ModelNode *, size_t > > &sorted) {
+			sorted.clear();
+			for (size_t i = 0; i < states.size(); ++i) {
+				sorted.emplace_back(states[i].m_node, i);
+			}
+			std::sort(sorted.begin(), sorted.end());
+		};
+		sort(m_states, m_sorted_states);
+		sort(m_buffer, m_sorted_buffer);
+
+		// Merge both sorted sequences: shadow casters present in only one
+		// of them are added or removed, shadow casters present in both are
+		// changed if their transformation matrix or opacity differs.
+		auto it1 = m_sorted_states.cbegin();
+		auto it2 = m_sorted_buffer.cbegin();
+		while (it1 != m_sorted_states.cend() || it2 != m_sorted_buffer.cend()) {
+			if (it2 == m_sorted_buffer.cend()
+				|| (it1 != m_sorted_states.cend() && it1->first < it2->first)) {
+
+				// Removed shadow caster.
+				m_changed_aabbs.push_back(m_aabbs[it1->second]);
+				++it1;
+			}
+			else if (it1 == m_sorted_states.cend() || it2->first < it1->first) {
+				// Added shadow caster.
+				m_changed_aabbs.push_back(m_aabb_buffer[it2->second]);
+				++it2;
+			}
+			else {
+				const size_t i1 = it1->second;
+				const size_t i2 = it2->second;
+				const bool opaque1 = i1 < m_nb_opaque_casters;
+				const bool opaque2 = i2 < nb_opaque_casters;
+
+				if (opaque1 != opaque2
+					|| 0 != std::memcmp(&m_states[i1].m_object_to_world,
+						                &m_buffer[i2].m_object_to_world,
+						                sizeof(XMFLOAT4X4))) {
+
+					// Changed shadow caster.
+					m_changed_aabbs.push_back(m_aabbs[i1]);
+					m_changed_aabbs.push_back(m_aabb_buffer[i2]);
+				}
+				++it1;
+				++it2;
+			}
+		}
+	}
+
+	void ShadowCasterCache::InvalidateEntries() {
+		if (m_changed_aabbs.empty()) {
+			return;
+		}
+
+		for (auto &[light, entry] : m_entries) {
+			if (!entry.m_valid) {
+				continue;
+			}
+
+			const XMMATRIX transform = XMLoadFloat4x4(&entry.m_transform);
+
+			if (0.0f < entry.m_range) {
+				// Omni light: cull against the light sphere.
+				const XMVECTOR p
+					= XMMatrixInverse(nullptr, transform).r[3];
+				for (const auto &aabb : m_changed_aabbs) {
+					if (Overlaps(aabb, p, entry.m_range)) {
+						entry.m_valid = false;
+						break;
+					}
+				}
+			}
+			else {
+				// Spotlight: cull against the light frustum.
+				const ViewFrustum light_frustum(transform);
+				for (const auto &aabb : m_changed_aabbs) {
+					if (light_frustum.Overlaps(aabb)) {
+						entry.m_valid = false;
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	ShadowCasterCache::Entry &XM_CALLCONV ShadowCasterCache::GetEntry(
+		const Node *light, FXMMATRIX transform, F32 range, bool &valid) {
+
+		XMFLOAT4X4 light_transform;
+		XMStoreFloat4x4(&light_transform, transform);
+
+		Entry &entry = m_entries[light];
+
+		valid = entry.m_valid
+			&& (range == entry.m_range)
+			&& (0 == std::memcmp(&light_transform, &entry.m_transform,
+				                 sizeof(light_transform)));
+
+		entry.m_frame = m_frame;
+		if (!valid) {
+			entry.m_transform = light_transform;
+			entry.m_range     = range;
+			entry.m_valid     = true;
+			entry.m_casters.m_opaque_casters.clear();
+			entry.m_casters.m_transparent_casters.clear();
+		}
+
+		return entry;
+	}
+
+	void ShadowCasterCache::AddShadowCaster(ShadowCasterList &casters,
+		size_t index, U32 faces) const {
+
+		const ShadowCaster caster = { m_states[index].m_node, faces };
+		if (index < m_nb_opaque_casters) {
+			casters.m_opaque_casters.push_back(caster);
+		}
+		else {
+			casters.m_transparent_casters.push_back(caster);
+		}
+	}
+
+	const ShadowCasterList &XM_CALLCONV ShadowCasterCache::GetShadowCasters(
+		const OmniLightNode *light,
+		FXMMATRIX world_to_lview,
+		F32 range) {
+
+		bool valid;
+		Entry &entry = GetEntry(light, world_to_lview, range, valid);
+		if (valid) {
+			return entry.m_casters;
+		}
+
+		const XMVECTOR p = light->GetTransform()->GetWorldEye();
+
+		for (size_t i = 0; i < m_aabbs.size(); ++i) {
+			// Cull the shadow caster against the light volume.
+			if (!Overlaps(m_aabbs[i], p, range)) {
+				continue;
+			}
+
+			// Classify the shadow caster against the shadow cube map faces.
+			const U32 faces
+				= ClassifyCubeFaces(TransformAABB(m_aabbs[i], world_to_lview));
+			if (0u != faces) {
+				AddShadowCaster(entry.m_casters, i, faces);
+			}
+		}
+
+		return entry.m_casters;
+	}
+
+	const ShadowCasterList &XM_CALLCONV ShadowCasterCache::GetShadowCasters(
+		const SpotLightNode *light,
+		FXMMATRIX world_to_lprojection) {
+
+		bool valid;
+		Entry &entry = GetEntry(light, world_to_lprojection, 0.0f, valid);
+		if (valid) {
+			return entry.m_casters;
+		}
+
+		// Cull the shadow casters against the light frustum.
+		const ViewFrustum light_frustum(world_to_lprojection);
+		light_frustum.Overlaps(m_aabb_batch, m_indices);
+
+		for (const auto index : m_indices) {
+			AddShadowCaster(entry.m_casters, index, g_shadow_map_face_mask);
+		}
+
+		return entry.m_casters;
+	}
+	F32 XM_CALLCONV ShadowCasterCache::GetShadowCasters(
+		FXMMATRIX world_to_lview,
+		const AABB &volume,
+		ShadowCasterList &casters) const {
+
+		casters.m_opaque_casters.clear();
+		casters.m_transparent_casters.clear();
+
+		F32 min_z = volume.m_p_min.m_z;
+
+		for (size_t i = 0; i < m_aabbs.size(); ++i) {
+			const AABB aabb = TransformAABB(m_aabbs[i], world_to_lview);
+
+			// Cull the shadow caster against the shadow cascade volume 
+			// extruded towards the light.
+			if (aabb.m_p_max.m_x < volume.m_p_min.m_x
+				|| volume.m_p_max.m_x < aabb.m_p_min.m_x
+				|| aabb.m_p_max.m_y < volume.m_p_min.m_y
+				|| volume.m_p_max.m_y < aabb.m_p_min.m_y
+				|| volume.m_p_max.m_z < aabb.m_p_min.m_z) {
+				continue;
+			}
+
+			min_z = std::min(min_z, aabb.m_p_min.m_z);
+			AddShadowCaster(casters, i, g_shadow_map_face_mask);
+		}
+
+		return min_z;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,414 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering\pass\pass_buffer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <unordered_map>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The face mask of shadow casters of lights with a single shadow map.
+	 */
+	constexpr U32 g_shadow_map_face_mask = 1u;
+
+	//-------------------------------------------------------------------------
+	// ShadowCaster
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of shadow casters.
+	 */
+	struct ShadowCaster final {
+
+		/**
+		 A pointer to the model node of this shadow caster.
+		 */
+		const ModelNode *m_node;
+
+		/**
+		 The mask of the shadow map faces overlapped by this shadow caster.
+		 The i-th bit corresponds to the i-th face of a shadow cube map (+x,
+		 -x, +y, -y, +z, -z).
+		 */
+		U32 m_faces;
+	};
+
+	//-------------------------------------------------------------------------
+	// ShadowCasterList
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of shadow caster lists.
+	 */
+	struct ShadowCasterList final {
+
+		/**
+		 A vector containing the opaque shadow casters of this shadow caster
+		 list.
+		 */
+		vector< ShadowCaster > m_opaque_casters;
+
+		/**
+		 A vector containing the transparent shadow casters of this shadow
+		 caster list.
+		 */
+		vector< ShadowCaster > m_transparent_casters;
+	};
+
+	//-------------------------------------------------------------------------
+	// ShadowCasterCache
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of shadow caster caches.
+
+	 A shadow caster cache culls the shadow casters of the scene once per
+	 light and keeps the resulting shadow caster lists across frames. The
+	 shadow caster list of a light is reused as long as neither the light
+	 nor any shadow caster overlapping the light volume has changed.
+	 */
+	class ShadowCasterCache final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a shadow caster cache.
+		 */
+		ShadowCasterCache();
+
+		/**
+		 Constructs a shadow caster cache from the given shadow caster cache.
+
+		 @param[in]		cache
+						A reference to the shadow caster cache to copy.
+		 */
+		ShadowCasterCache(const ShadowCasterCache &cache) = delete;
+
+		/**
+		 Constructs a shadow caster cache by moving the given shadow caster
+		 cache.
+
+		 @param[in]		cache
+						A reference to the shadow caster cache to move.
+		 */
+		ShadowCasterCache(ShadowCasterCache &&cache);
+
+		/**
+		 Destructs this shadow caster cache.
+		 */
+		~ShadowCasterCache();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given shadow caster cache to this shadow caster cache.
+
+		 @param[in]		cache
+						A reference to the shadow caster cache to copy.
+		 @return		A reference to the copy of the given shadow caster
+						cache (i.e. this shadow caster cache).
+		 */
+		ShadowCasterCache &operator=(const ShadowCasterCache &cache) = delete;
+
+		/**
+		 Moves the given shadow caster cache to this shadow caster cache.
+
+		 @param[in]		cache
+						A reference to the shadow caster cache to move.
+		 @return		A reference to the moved shadow caster cache (i.e.
+						this shadow caster cache).
+		 */
+		ShadowCasterCache &operator=(ShadowCasterCache &&cache);
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Updates the shadow casters of this shadow caster cache. The cached
+		 shadow caster lists of the lights whose volume overlaps a changed
+		 (i.e. added, removed or transformed) shadow caster of the given
+		 scene are invalidated, and the shadow caster lists of lights which
+		 were not used during the previous frame are released.
+
+		 @pre			@a scene is not equal to @c nullptr.
+		 @param[in]		scene
+						A pointer to the scene.
+		 */
+		void Update(const PassBuffer *scene);
+
+		/**
+		 Returns the shadow caster list of the given omni light.
+
+		 @param[in]		light
+						A pointer to the omni light node.
+		 @param[in]		world_to_lview
+						The world-to-light-view transformation matrix.
+		 @param[in]		range
+						The range of the omni light.
+		 @return		A reference to the shadow caster list of the given
+						omni light. The face masks of the shadow casters
+						refer to the faces of the shadow cube map.
+		 */
+		const ShadowCasterList &XM_CALLCONV GetShadowCasters(
+			const OmniLightNode *light,
+			FXMMATRIX world_to_lview,
+			F32 range);
+
+		/**
+		 Returns the shadow caster list of the given spotlight.
+
+		 @param[in]		light
+						A pointer to the spotlight node.
+		 @param[in]		world_to_lprojection
+						The world-to-light-projection transformation matrix.
+		 @return		A reference to the shadow caster list of the given
+						spotlight.
+		 */
+		const ShadowCasterList &XM_CALLCONV GetShadowCasters(
+			const SpotLightNode *light,
+			FXMMATRIX world_to_lprojection);
+
+		/**
+		 Collects the shadow casters of the given shadow cascade of a 
+		 directional light. Shadow cascades follow the camera, and thus their
+		 shadow caster lists are not cached.
+
+		 A shadow caster is collected if it overlaps the light-view-space 
+		 volume of the shadow cascade extruded towards the light.
+
+		 @param[in]		world_to_lview
+						The world-to-light-view transformation matrix.
+		 @param[in]		volume
+						A reference to the light-view-space AABB of the 
+						shadow cascade.
+		 @param[out]	casters
+						A reference to the shadow caster list.
+		 @return		The minimum light-view-space z-coordinate of the 
+						given volume and the collected shadow casters.
+		 */
+		F32 XM_CALLCONV GetShadowCasters(
+			FXMMATRIX world_to_lview,
+			const AABB &volume,
+			ShadowCasterList &casters) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of shadow caster states.
+		 */
+		struct CasterState final {
+
+			/**
+			 A pointer to the model node of this shadow caster state.
+			 */
+			const ModelNode *m_node;
+
+			/**
+			 The object-to-world transformation matrix of this shadow caster
+			 state.
+			 */
+			XMFLOAT4X4 m_object_to_world;
+		};
+
+		/**
+		 A struct of cache entries.
+		 */
+		struct Entry final {
+
+			/**
+			 The light transformation matrix of this cache entry.
+			 */
+			XMFLOAT4X4 m_transform;
+
+			/**
+			 The light range of this cache entry.
+			 */
+			F32 m_range;
+
+			/**
+			 A flag indicating whether the shadow caster list of this cache
+			 entry is valid.
+			 */
+			bool m_valid;
+
+			/**
+			 The last frame this cache entry was used.
+			 */
+			U64 m_frame;
+
+			/**
+			 The shadow caster list of this cache entry.
+			 */
+			ShadowCasterList m_casters;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the cache entry of the given light. The shadow caster list
+		 of the returned cache entry is cleared if the cache entry is new or
+		 stale.
+
+		 @param[in]		light
+						A pointer to the light node.
+		 @param[in]		transform
+						The light transformation matrix.
+		 @param[in]		range
+						The light range.
+		 @param[out]	valid
+						@c true if the shadow caster list of the returned
+						cache entry is valid. @c false otherwise.
+		 @return		A reference to the cache entry of the given light.
+		 */
+		Entry &XM_CALLCONV GetEntry(const Node *light,
+			FXMMATRIX transform, F32 range, bool &valid);
+
+		/**
+		 Collects the world-space AABBs of the shadow casters which differ
+		 between the current and the scratch shadow caster states.
+
+		 @param[in]		nb_opaque_casters
+						The number of opaque shadow casters of the scratch 
+						shadow caster states.
+		 */
+		void CollectChangedCasters(size_t nb_opaque_casters);
+
+		/**
+		 Invalidates the cache entries whose light volume overlaps a changed
+		 shadow caster.
+		 */
+		void InvalidateEntries();
+
+		/**
+		 Adds the given shadow caster to the given shadow caster list.
+
+		 @param[in]		casters
+						A reference to the shadow caster list.
+		 @param[in]		index
+						The index of the shadow caster in this shadow caster
+						cache.
+		 @param[in]		faces
+						The face mask of the shadow caster.
+		 */
+		void AddShadowCaster(ShadowCasterList &casters,
+			size_t index, U32 faces) const;
+
+		/**
+		 Adds the given models to the given shadow caster states.
+
+		 @param[in]		models
+						A reference to a vector containing the model nodes.
+		 @param[in]		transparent
+						@c true if the models are transparent. @c false
+						otherwise.
+		 @param[out]	states
+						A reference to the vector of shadow caster states.
+		 */
+		static void AddCasterStates(
+			const ArenaVector< const ModelNode * > &models, bool transparent,
+			vector< CasterState > &states);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The current frame of this shadow caster cache.
+		 */
+		U64 m_frame;
+
+		/**
+		 A vector containing the states of the shadow casters of this shadow
+		 caster cache (opaque shadow casters first).
+		 */
+		vector< CasterState > m_states;
+
+		/**
+		 A vector containing the scratch states of the shadow casters of this
+		 shadow caster cache.
+		 */
+		vector< CasterState > m_buffer;
+
+		/**
+		 The number of opaque shadow casters of this shadow caster cache.
+		 */
+		size_t m_nb_opaque_casters;
+
+		/**
+		 A vector containing the world-space AABBs of the shadow casters of
+		 this shadow caster cache.
+		 */
+		vector< AABB > m_aabbs;
+
+		/**
+		 A vector containing the scratch world-space AABBs of the shadow 
+		 casters of this shadow caster cache.
+		 */
+		vector< AABB > m_aabb_buffer;
+
+		/**
+		 A vector containing the world-space AABBs (before and after the 
+		 change) of the changed shadow casters of this shadow caster cache.
+		 */
+		vector< AABB > m_changed_aabbs;
+
+		/**
+		 A vector containing the model nodes and indices of the shadow 
+		 casters of this shadow caster cache sorted by model node.
+		 */
+		vector< pair< const ModelNode *, size_t > > m_sorted_states;
+
+		/**
+		 A vector containing the model nodes and indices of the scratch 
+		 shadow casters of this shadow caster cache sorted by model node.
+		 */
+		vector< pair< const ModelNode *, size_t > > m_sorted_buffer;
+
+		/**
+		 The batch of world-space AABBs of the shadow casters of this shadow
+		 caster cache.
+		 */
+		AABBBatch m_aabb_batch;
+
+		/**
+		 A vector containing the scratch shadow caster indices of this shadow
+		 caster cache.
+		 */
+		ArenaVector< size_t > m_indices;
+
+		/**
+		 The cache entries of this shadow caster cache.
+		 */
+		std::unordered_map< const Node *, Entry > m_entries;
+	};
+}
\ No newline at end of file
@@ -23,10 +23,13 @@ namespace mage {
 		return Renderer::Get()->GetSkyPass();
 	}
 
-	SkyPass::SkyPass()
-		: m_device_context(Pipeline::GetImmediateDeviceContext()),
+	SkyPass::SkyPass(ID3D11DeviceContext4 *device_context)
+		: m_device_context(device_context),
 		m_sky_vs(CreateSkyVS()), 
-		m_sky_ps(CreateSkyPS()){}
+		m_sky_ps(CreateSkyPS()) {
+
+		Assert(m_device_context);
+	}
 
 	SkyPass::SkyPass(SkyPass &&render_pass) = default;
 
@@ -23,11 +23,15 @@ namespace mage {
 		return Renderer::Get()->GetSpritePass();
 	}
 
-	SpritePass::SpritePass()
-		: m_device_context(Pipeline::GetImmediateDeviceContext()),
+	SpritePass::SpritePass(ID3D11DeviceContext4 *device_context)
+		: m_device_context(device_context),
 		m_vs(CreateSpriteVS()), 
 		m_ps(CreateSpritePS()),
-		m_sprite_batch(MakeUnique< SpriteBatch >()) {}
+		m_sprite_batch(MakeUnique< SpriteBatch >(
+			Pipeline::GetDevice(), m_device_context)) {
+
+		Assert(m_device_context);
+	}
 
 	SpritePass::SpritePass(SpritePass &&render_pass) = default;
 
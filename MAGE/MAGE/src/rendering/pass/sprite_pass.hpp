@@ -48,8 +48,11 @@ namespace mage {
 						loaded.
 		 @pre			The resource manager associated with the current engine 
 						must be loaded.
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @param[in]		device_context
+						A pointer to the device context.
 		 */
-		SpritePass();
+		explicit SpritePass(ID3D11DeviceContext4 *device_context);
 
 		/**
 		 Constructs a sprite pass from the given sprite pass.
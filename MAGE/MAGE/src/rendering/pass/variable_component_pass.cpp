@@ -5,7 +5,6 @@
 
 #include "rendering\rendering_manager.hpp"
 #include "resource\resource_factory.hpp"
-#include "math\geometry\view_frustum.hpp"
 #include "utils\logging\error.hpp"
 
 // Include HLSL bindings.
@@ -24,13 +23,16 @@ namespace mage {
 		return Renderer::Get()->GetVariableComponentPass();
 	}
 
-	VariableComponentPass::VariableComponentPass()
-		: m_device_context(Pipeline::GetImmediateDeviceContext()), 
+	VariableComponentPass::VariableComponentPass(ID3D11DeviceContext4 *device_context)
+		: m_device_context(device_context), 
 		m_vs(CreateMinimalTransformVS()),
 		m_ps(CreateConstantColorTexturePS()),
 		m_color_buffer(), 
 		m_model_buffer(),
-		m_white(CreateWhiteTexture()) {}
+		m_white(CreateWhiteTexture()) {
+
+		Assert(m_device_context);
+	}
 
 	VariableComponentPass::VariableComponentPass(
 		VariableComponentPass &&render_pass) = default;
@@ -209,53 +211,31 @@ namespace mage {
 		RenderingStateManager::Get()->BindOpaqueBlendState(m_device_context);
 	}
 
-	void XM_CALLCONV VariableComponentPass::Render(
-		const PassBuffer *scene,
-		FXMMATRIX world_to_projection,
-		CXMMATRIX world_to_view,
-		CXMMATRIX view_to_world) {
+	void VariableComponentPass::Render(const PassBuffer *scene) {
 
 		Assert(scene);
 
 		// Process the models.
-		ProcessModels(scene->GetOpaqueEmissiveModels(), 
-			world_to_projection, world_to_view, view_to_world);
-		ProcessModels(scene->GetTransparentEmissiveModels(),
-			world_to_projection, world_to_view, view_to_world);
-		ProcessModels(scene->GetOpaqueBRDFModels(), 
-			world_to_projection, world_to_view, view_to_world);
-		ProcessModels(scene->GetTransparentBRDFModels(), 
-			world_to_projection, world_to_view, view_to_world);
+		ProcessModels(scene->GetVisibleOpaqueEmissiveModels());
+		ProcessModels(scene->GetVisibleTransparentEmissiveModels());
+		ProcessModels(scene->GetVisibleOpaqueBRDFModels());
+		ProcessModels(scene->GetVisibleTransparentBRDFModels());
 	}
 
-	void XM_CALLCONV VariableComponentPass::ProcessModels(
-		const vector< const ModelNode * > &models,
-		FXMMATRIX world_to_projection, 
-		CXMMATRIX world_to_view, 
-		CXMMATRIX view_to_world) {
+	void VariableComponentPass::ProcessModels(
+		const ArenaVector< VisibleModel > &models) {
 
-		for (const auto node : models) {
+		for (const auto &visible_model : models) {
 
-			// Obtain node components (1/2).
-			const TransformNode * const transform = node->GetTransform();
+			// Obtain node components.
+			const ModelNode     * const node      = visible_model.m_node;
 			const Model         * const model     = node->GetModel();
-			const XMMATRIX object_to_world        = transform->GetObjectToWorldMatrix();
-			const XMMATRIX object_to_projection   = object_to_world * world_to_projection;
-
-			// Apply view frustum culling.
-			if (ViewFrustum::Cull(object_to_projection, model->GetAABB())) {
-				continue;
-			}
-
-			// Obtain node components (2/2).
-			const XMMATRIX object_to_view         = object_to_world * world_to_view;
-			const XMMATRIX world_to_object        = transform->GetWorldToObjectMatrix();
-			const XMMATRIX view_to_object         = view_to_world * world_to_object;
 			const XMMATRIX texture_transform      = node->GetTextureTransform()->GetTransformMatrix();
 			const Material * const material       = model->GetMaterial();
 
 			// Bind the model data (inc. PS).
-			BindModelData(object_to_view, view_to_object, texture_transform, material);
+			BindModelData(visible_model.m_object_to_view, 
+				visible_model.m_view_to_object, texture_transform, material);
 			// Bind the model mesh.
 			model->BindMesh(m_device_context);
 			// Draw the model.
@@ -4,8 +4,8 @@
 #pragma region
 
 #include "rendering\rendering_manager.hpp"
+#include "core\engine_statistics.hpp"
 #include "resource\resource_factory.hpp"
-#include "math\geometry\view_frustum.hpp"
 #include "utils\logging\error.hpp"
 
 // Include HLSL bindings.
@@ -24,9 +24,11 @@ namespace mage {
 		return Renderer::Get()->GetVariableShadingPass();
 	}
 
-	VariableShadingPass::VariableShadingPass()
-		: m_device_context(Pipeline::GetImmediateDeviceContext()),
-		m_vs(CreateTransformVS()),
+	VariableShadingPass::VariableShadingPass(ID3D11DeviceContext4 *device_context,
+		ConstantBufferRing *constant_buffer_ring)
+		: m_device_context(device_context),
+		m_constant_buffer_ring(constant_buffer_ring),
+		m_vs(CreateTransformInstancedVS()),
 		m_ps{ 
 			CreateForwardEmissivePS(false), 
 			CreateForwardPS(BRDFType::Unknown, false, false), 
@@ -36,8 +38,14 @@ namespace mage {
 			CreateForwardPS(BRDFType::Unknown, true, true),
 		},
 		m_bound_ps(PSIndex::Count), 
+		m_bound_mesh(nullptr),
+		m_bound_srvs {
+
+		Assert(m_device_context);
+		Assert(m_constant_buffer_ring);
+	},
 		m_brdf(BRDFType::Unknown),
-		m_model_buffer() {}
+		m_model_bindings() {}
 
 	VariableShadingPass::VariableShadingPass(VariableShadingPass &&render_pass) = default;
 
@@ -61,6 +69,7 @@ namespace mage {
 		if (m_bound_ps != index) {
 			m_ps[static_cast< size_t >(index)]->BindShader(m_device_context);
 			m_bound_ps = index;
+			EngineStatistics::Get()->IncrementNumberOfShaderBinds();
 		}
 	}
 
@@ -95,50 +104,85 @@ namespace mage {
 		}
 	}
 
-	void XM_CALLCONV VariableShadingPass::BindModelData(
-		FXMMATRIX object_to_view, 
-		CXMMATRIX view_to_object,
-		CXMMATRIX texture_transform,
-		const Material *material) {
-
-		ModelBuffer buffer;
-		// Transforms
-		buffer.m_transform.m_object_to_view    = XMMatrixTranspose(object_to_view);
-		buffer.m_transform.m_normal_to_view    = view_to_object;
-		buffer.m_transform.m_texture_transform = XMMatrixTranspose(texture_transform);
-		// Material
-		buffer.m_base_color = RGBA(material->GetBaseColor());
-		buffer.m_roughness  = material->GetRoughness();
-		buffer.m_metalness  = material->GetMetalness();
-		
-		// Update the model buffer.
-		m_model_buffer.UpdateData(m_device_context, 
-			buffer);
+	void VariableShadingPass::WriteModelData(
+		const ArenaVector< ModelInstanceGroup > &groups) {
+
+		ConstantBufferRing &ring = *m_constant_buffer_ring;
+
+		m_model_bindings.clear();
+		ring.Map(m_device_context, groups.size() 
+			* ConstantBufferRing::GetAllocationSize< ModelBuffer >());
+
+		for (const auto &group : groups) {
+			const Material * const material 
+				= group.m_node->GetModel()->GetMaterial();
+
+			ModelBuffer buffer;
+			// Instancing
+			buffer.m_instance_start = group.m_instance_start;
+			// Material
+			buffer.m_base_color = RGBA(material->GetBaseColor());
+			buffer.m_roughness  = material->GetRoughness();
+			buffer.m_metalness  = material->GetMetalness();
+
+			m_model_bindings.push_back(ring.Write(buffer));
+		}
+
+		ring.Unmap(m_device_context);
+	}
+
+	void VariableShadingPass::BindModelData(
+		const ConstantBufferBinding &model_binding, 
+		const Material *material) noexcept {
+
 		// Bind the model buffer.
-		m_model_buffer.Bind< Pipeline::VS >(
-			m_device_context, SLOT_CBUFFER_MODEL);
-		m_model_buffer.Bind< Pipeline::PS >(
-			m_device_context, SLOT_CBUFFER_MODEL);
-
-		// Bind the base color SRV.
-		Pipeline::PS::BindSRV(m_device_context,
-			SLOT_SRV_BASE_COLOR, material->GetBaseColorSRV());
-		// Bind the material SRV.
-		Pipeline::PS::BindSRV(m_device_context,
-			SLOT_SRV_MATERIAL, material->GetMaterialSRV());
-		// Bind the normal SRV.
-		Pipeline::PS::BindSRV(m_device_context,
-			SLOT_SRV_NORMAL, material->GetNormalSRV());
+		ConstantBufferRing::Bind< Pipeline::VS >(
+			m_device_context, SLOT_CBUFFER_MODEL, model_binding);
+		ConstantBufferRing::Bind< Pipeline::PS >(
+			m_device_context, SLOT_CBUFFER_MODEL, model_binding);
+
+		const array< ID3D11ShaderResourceView *, 3 > srvs = {
+			material->GetBaseColorSRV(),
+			material->GetMaterialSRV(),
+			material->GetNormalSRV()
+		};
+		const U32 slots[] = {
+			SLOT_SRV_BASE_COLOR,
+			SLOT_SRV_MATERIAL,
+			SLOT_SRV_NORMAL
+		};
+
+		// Bind the base color, material and normal SRV.
+		for (size_t i = 0; i < srvs.size(); ++i) {
+			if (m_bound_srvs[i] == srvs[i]) {
+				continue;
+			}
+
+			Pipeline::PS::BindSRV(m_device_context, slots[i], srvs[i]);
+			m_bound_srvs[i] = srvs[i];
+			EngineStatistics::Get()->IncrementNumberOfSRVBinds();
+		}
+	}
+
+	void VariableShadingPass::BindMesh(const Model *model) noexcept {
+		if (m_bound_mesh != model->GetMesh()) {
+			model->BindMesh(m_device_context);
+			m_bound_mesh = model->GetMesh();
+			EngineStatistics::Get()->IncrementNumberOfMeshBinds();
+		}
 	}
 
 	void VariableShadingPass::BindFixedState(BRDFType brdf) {
-		// Reset the bound pixel shader index.
-		m_bound_ps = PSIndex::Count;
+		// Reset the bound pixel shader index, mesh and SRVs.
+		m_bound_ps   = PSIndex::Count;
+		m_bound_mesh = nullptr;
+		m_bound_srvs.fill(nullptr);
 		// Update the pixel shaders.
 		UpdatePSs(brdf);
 
 		// VS: Bind the vertex shader.
 		m_vs->BindShader(m_device_context);
+		EngineStatistics::Get()->IncrementNumberOfShaderBinds();
 		// HS: Bind the hull shader.
 		Pipeline::HS::BindShader(m_device_context, nullptr);
 		// DS: Bind the domain shader.
@@ -149,11 +193,7 @@ namespace mage {
 		RenderingStateManager::Get()->BindCullCounterClockwiseRasterizerState(m_device_context);
 	}
 
-	void XM_CALLCONV VariableShadingPass::Render(
-		const PassBuffer *scene,
-		FXMMATRIX world_to_projection,
-		CXMMATRIX world_to_view,
-		CXMMATRIX view_to_world) {
+	void VariableShadingPass::Render(const PassBuffer *scene) {
 
 		Assert(scene);
 
@@ -167,21 +207,17 @@ namespace mage {
 		RenderingStateManager::Get()->BindOpaqueBlendState(m_device_context);
 		
 		// Process the models.
-		ProcessModels(scene->GetOpaqueEmissiveModels(), 
-			world_to_projection, world_to_view, view_to_world);
-		ProcessModels(scene->GetTransparentEmissiveModels(),
-			world_to_projection, world_to_view, view_to_world);
-		ProcessModels(scene->GetOpaqueBRDFModels(), 
-			world_to_projection, world_to_view, view_to_world);
-		ProcessModels(scene->GetTransparentBRDFModels(),
-			world_to_projection, world_to_view, view_to_world);
+		ProcessModels(scene->GetVisibleOpaqueEmissiveInstanceGroups(), 
+			scene->GetIndexRanges());
+		ProcessModels(scene->GetVisibleTransparentEmissiveInstanceGroups(), 
+			scene->GetIndexRanges());
+		ProcessModels(scene->GetVisibleOpaqueBRDFInstanceGroups(), 
+			scene->GetIndexRanges());
+		ProcessModels(scene->GetVisibleTransparentBRDFInstanceGroups(), 
+			scene->GetIndexRanges());
 	}
 
-	void XM_CALLCONV VariableShadingPass::RenderEmissive(
-		const PassBuffer *scene,
-		FXMMATRIX world_to_projection,
-		CXMMATRIX world_to_view,
-		CXMMATRIX view_to_world) {
+	void VariableShadingPass::RenderEmissive(const PassBuffer *scene) {
 
 		Assert(scene);
 
@@ -195,17 +231,13 @@ namespace mage {
 		RenderingStateManager::Get()->BindOpaqueBlendState(m_device_context);
 		
 		// Process the emissive models.
-		ProcessModels(scene->GetOpaqueEmissiveModels(),
-			world_to_projection, world_to_view, view_to_world);
-		ProcessModels(scene->GetTransparentEmissiveModels(),
-			world_to_projection, world_to_view, view_to_world);
+		ProcessModels(scene->GetVisibleOpaqueEmissiveInstanceGroups(), 
+			scene->GetIndexRanges());
+		ProcessModels(scene->GetVisibleTransparentEmissiveInstanceGroups(), 
+			scene->GetIndexRanges());
 	}
 
-	void XM_CALLCONV VariableShadingPass::RenderTransparent(
-		const PassBuffer *scene,
-		FXMMATRIX world_to_projection,
-		CXMMATRIX world_to_view,
-		CXMMATRIX view_to_world) {
+	void VariableShadingPass::RenderTransparent(const PassBuffer *scene) {
 
 		Assert(scene);
 
@@ -218,48 +250,41 @@ namespace mage {
 		// OM: Bind the blend state.
 		RenderingStateManager::Get()->BindTransparencyBlendState(m_device_context);
 
-		// Process the transparent models.
-		ProcessModels(scene->GetTransparentEmissiveModels(), 
-			world_to_projection, world_to_view, view_to_world, true);
-		ProcessModels(scene->GetTransparentBRDFModels(),
-			world_to_projection, world_to_view, view_to_world, true);
+		// Process the transparent models (back-to-front).
+		ProcessModels(scene->GetVisibleTransparentInstanceGroups(), 
+			scene->GetIndexRanges(), true);
 	}
 
-	void XM_CALLCONV VariableShadingPass::ProcessModels(
-		const vector< const ModelNode * > &models,
-		FXMMATRIX world_to_projection, 
-		CXMMATRIX world_to_view, 
-		CXMMATRIX view_to_world,
+	void VariableShadingPass::ProcessModels(
+		const ArenaVector< ModelInstanceGroup > &groups,
+		const ArenaVector< IndexRange > &ranges,
 		bool transparency) {
 
-		for (const auto node : models) {
-			
-			// Obtain node components (1/2).
-			const TransformNode * const transform = node->GetTransform();
-			const Model         * const model     = node->GetModel();
-			const XMMATRIX object_to_world        = transform->GetObjectToWorldMatrix();
-			const XMMATRIX object_to_projection   = object_to_world * world_to_projection;
+		if (groups.empty()) {
+			return;
+		}
 
-			// Cull the model against the view frustum.
-			if (ViewFrustum::Cull(object_to_projection, model->GetAABB())) {
-				continue;
-			}
+		// Write the model data of all model instance groups at once.
+		WriteModelData(groups);
 
-			// Obtain node components (2/2).
-			const XMMATRIX object_to_view         = object_to_world * world_to_view;
-			const XMMATRIX world_to_object        = transform->GetWorldToObjectMatrix();
-			const XMMATRIX view_to_object         = view_to_world * world_to_object;
-			const XMMATRIX texture_transform      = node->GetTextureTransform()->GetTransformMatrix();
-			const Material * const material       = model->GetMaterial();
+		for (size_t g = 0; g < groups.size(); ++g) {
+			const auto &group = groups[g];
+
+			// Obtain node components.
+			const Model    * const model    = group.m_node->GetModel();
+			const Material * const material = model->GetMaterial();
 
 			// Bind the model data.
-			BindModelData(object_to_view, view_to_object, texture_transform, material);
+			BindModelData(m_model_bindings[g], material);
 			// Bind the pixel shader.
 			BindPS(material, transparency);
 			// Bind the model mesh.
-			model->BindMesh(m_device_context);
-			// Draw the model.
-			model->Draw(m_device_context);
+			BindMesh(model);
+			// Draw the visible mesh clusters of the model instances.
+			for (U32 i = 0u; i < group.m_nb_ranges; ++i) {
+				model->DrawInstanced(m_device_context, 
+					ranges[group.m_range_start + i], group.m_nb_instances);
+			}
 		}
 	}
 }
\ No newline at end of file
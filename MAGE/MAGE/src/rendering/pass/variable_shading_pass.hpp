@@ -6,7 +6,7 @@
 #pragma region
 
 #include "rendering\pass\pass_buffer.hpp"
-#include "rendering\buffer\constant_buffer.hpp"
+#include "rendering\buffer\constant_buffer_ring.hpp"
 #include "rendering\buffer\model_buffer.hpp"
 #include "shader\shader.hpp"
 
@@ -50,8 +50,15 @@ namespace mage {
 						loaded.
 		 @pre			The resource manager associated with the current engine 
 						must be loaded.
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			@a constant_buffer_ring is not equal to @c nullptr.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		constant_buffer_ring
+						A pointer to the constant buffer ring.
 		 */
-		VariableShadingPass();
+		VariableShadingPass(ID3D11DeviceContext4 *device_context,
+			ConstantBufferRing *constant_buffer_ring);
 
 		/**
 		 Constructs a variable shading pass from the given variable shading 
@@ -123,20 +130,10 @@ namespace mage {
 		 @pre			@a scene is not equal to @c nullptr.
 		 @param[in]		scene
 						A pointer to the scene.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
-		 @param[in]		world_to_view
-						The world-to-view transformation matrix.
-		 @param[in]		view_to_world
-						The view-to-world transformation matrix.
 		 @throws		FormattedException
 						Failed to render the scene.
 		 */
-		void XM_CALLCONV Render(
-			const PassBuffer *scene,
-			FXMMATRIX world_to_projection,
-			CXMMATRIX world_to_view,
-			CXMMATRIX view_to_world);
+		void Render(const PassBuffer *scene);
 
 		/**
 		 Renders the scene (only the emissive models).
@@ -144,20 +141,10 @@ namespace mage {
 		 @pre			@a scene is not equal to @c nullptr.
 		 @param[in]		scene
 						A pointer to the scene.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
-		 @param[in]		world_to_view
-						The world-to-view transformation matrix.
-		 @param[in]		view_to_world
-						The view-to-world transformation matrix.
 		 @throws		FormattedException
 						Failed to render the scene.
 		 */
-		void XM_CALLCONV RenderEmissive(
-			const PassBuffer *scene,
-			FXMMATRIX world_to_projection,
-			CXMMATRIX world_to_view,
-			CXMMATRIX view_to_world);
+		void RenderEmissive(const PassBuffer *scene);
 
 		/**
 		 Renders the scene (only the transparent models).
@@ -165,20 +152,10 @@ namespace mage {
 		 @pre			@a scene is not equal to @c nullptr.
 		 @param[in]		scene
 						A pointer to the scene.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
-		 @param[in]		world_to_view
-						The world-to-view transformation matrix.
-		 @param[in]		view_to_world
-						The view-to-world transformation matrix.
 		 @throws		FormattedException
 						Failed to render the scene.
 		 */
-		void XM_CALLCONV RenderTransparent(
-			const PassBuffer *scene,
-			FXMMATRIX world_to_projection,
-			CXMMATRIX world_to_view,
-			CXMMATRIX view_to_world);
+		void RenderTransparent(const PassBuffer *scene);
 
 	private:
 
@@ -241,62 +218,59 @@ namespace mage {
 		 */
 		void BindPS(const Material *material, bool transparency) noexcept;
 		
+		/**
+		 Writes the model data of the given model instance groups to the 
+		 constant buffer ring of the renderer.
+
+		 @param[in]		groups
+						A reference to a vector containing the model instance 
+						groups.
+		 @throws		FormattedException
+						Failed to write the model data of this variable shading 
+						pass.
+		 */
+		void WriteModelData(const ArenaVector< ModelInstanceGroup > &groups);
+
 		/**
 		 Binds the model data of this variable shading pass.
 
 		 @pre			@a material is not equal to @c nullptr.
-		 @param[in]		object_to_view
-						The object-to-view transformation matrix used for
-						transforming vertices.
-		 @param[in]		view_to_object
-						The view-to-object transformation matrix used for 
-						transforming normals.
-		 @param[in]		texture_transform
-						The texture transformation matrix used for transforming 
-						texture coordinates.
+		 @param[in]		model_binding
+						A reference to the range of the model data in the 
+						constant buffer ring of the renderer.
 		 @param[in]		material
 						A pointer to the material.
-		 @throws		FormattedException
-						Failed to bind the model data of this variable shading 
-						pass.
 		 */
-		void XM_CALLCONV BindModelData(
-			FXMMATRIX object_to_view, 
-			CXMMATRIX view_to_object,
-			CXMMATRIX texture_transform,
-			const Material *material);
+		void BindModelData(const ConstantBufferBinding &model_binding, 
+			const Material *material) noexcept;
 		
 		/**
-		 Process the given models.
-
-		 @param[in]		models
-						A reference to a vector containing the model pointers 
-						to process.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix. This 
-						transformation matrix will be used for culling.
-		 @param[in]		world_to_view
-						The world-to-view transformation matrix. This 
-						transformation matrix will be chained with the 
-						object-to-view transformation matrix for transforming 
-						vertices.
-		 @param[in]		view_to_world
-						The view-to-world transformation matrix. This 
-						transformation matrix will be chained with the 
-						world-to-object transformation matrix for transforming 
-						normals.
+		 Binds the mesh of the given model of this variable shading pass, if not already 
+		 bound.
+
+		 @pre			@a model is not equal to @c nullptr.
+		 @param[in]		model
+						A pointer to the model.
+		 */
+		void BindMesh(const Model *model) noexcept;
+
+		/**
+		 Process the given model instance groups.
+
+		 @param[in]		groups
+						A reference to a vector containing the model instance 
+						groups to process.
+		 @param[in]		ranges
+						A reference to a vector containing the index ranges 
+						of the model instance groups.
 		 @param[in]		transparency
 						@c true if transparency should be enabled. @c false 
 						otherwise.
 		 @throws		FormattedException
-						Failed to process the models.
+						Failed to process the model instance groups.
 		 */
-		void XM_CALLCONV ProcessModels(
-			const vector< const ModelNode * > &models,
-			FXMMATRIX world_to_projection, 
-			CXMMATRIX world_to_view, 
-			CXMMATRIX view_to_world,
-			bool transparency = false);
+		void ProcessModels(const ArenaVector< ModelInstanceGroup > &groups, 
+			const ArenaVector< IndexRange > &ranges, bool transparency = false);
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -307,6 +281,11 @@ namespace mage {
 		 */
 		ID3D11DeviceContext4 * const m_device_context;
 
+		/**
+		 A pointer to the constant buffer ring of this variable shading pass.
+		 */
+		ConstantBufferRing * const m_constant_buffer_ring;
+
 		/**
 		 A pointer to the vertex shader of this variable shading pass.
 		 */
@@ -323,6 +302,17 @@ namespace mage {
 		 shading pass.
 		 */
 		PSIndex m_bound_ps;
+
+		/**
+		 A pointer to the bound mesh of this variable shading pass.
+		 */
+		const Mesh *m_bound_mesh;
+
+		/**
+		 An array containing pointers to the bound material shader resource 
+		 views (i.e. base color, material and normal SRV) of this variable shading pass.
+		 */
+		array< ID3D11ShaderResourceView *, 3 > m_bound_srvs;
 		
 		/**
 		 The current BRDF of this variable shading pass.
@@ -330,8 +320,9 @@ namespace mage {
 		BRDFType m_brdf;
 
 		/**
-		 The model buffer of this variable shading pass.
+		 A vector containing the ranges of the model data of the processed 
+		 model instance groups of this variable shading pass.
 		 */
-		ConstantBuffer< ModelBuffer > m_model_buffer;
+		vector< ConstantBufferBinding > m_model_bindings;
 	};
 }
\ No newline at end of file
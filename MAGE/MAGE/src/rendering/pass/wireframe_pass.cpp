@@ -5,7 +5,6 @@
 
 #include "rendering\rendering_manager.hpp"
 #include "resource\resource_factory.hpp"
-#include "math\geometry\view_frustum.hpp"
 #include "utils\logging\error.hpp"
 
 // Include HLSL bindings.
@@ -24,12 +23,15 @@ namespace mage {
 		return Renderer::Get()->GetWireframePass();
 	}
 
-	WireframePass::WireframePass()
-		: m_device_context(Pipeline::GetImmediateDeviceContext()),
+	WireframePass::WireframePass(ID3D11DeviceContext4 *device_context)
+		: m_device_context(device_context),
 		m_vs(CreateMinimalTransformVS()), 
 		m_ps(CreateConstantColorPS()), 
 		m_color_buffer(), 
-		m_model_buffer() {}
+		m_model_buffer() {
+
+		Assert(m_device_context);
+	}
 
 	WireframePass::WireframePass(WireframePass &&render_pass) = default;
 
@@ -86,47 +88,28 @@ namespace mage {
 		RenderingStateManager::Get()->BindOpaqueBlendState(m_device_context);
 	}
 
-	void XM_CALLCONV WireframePass::Render(
-		const PassBuffer *scene,
-		FXMMATRIX world_to_projection,
-		CXMMATRIX world_to_view) {
+	void WireframePass::Render(const PassBuffer *scene) {
 		
 		Assert(scene);
 
 		// Process the models.
-		ProcessModels(scene->GetOpaqueEmissiveModels(), 
-			world_to_projection, world_to_view);
-		ProcessModels(scene->GetOpaqueBRDFModels(), 
-			world_to_projection, world_to_view);
-		ProcessModels(scene->GetTransparentEmissiveModels(), 
-			world_to_projection, world_to_view);
-		ProcessModels(scene->GetTransparentBRDFModels(), 
-			world_to_projection, world_to_view);
+		ProcessModels(scene->GetVisibleOpaqueEmissiveModels());
+		ProcessModels(scene->GetVisibleOpaqueBRDFModels());
+		ProcessModels(scene->GetVisibleTransparentEmissiveModels());
+		ProcessModels(scene->GetVisibleTransparentBRDFModels());
 	}
 
-	void XM_CALLCONV WireframePass::ProcessModels(
-		const vector< const ModelNode * > &models,
-		FXMMATRIX world_to_projection, 
-		CXMMATRIX world_to_view) {
+	void WireframePass::ProcessModels(
+		const ArenaVector< VisibleModel > &models) {
 
-		for (const auto node : models) {
+		for (const auto &visible_model : models) {
 
-			// Obtain node components (1/2).
-			const TransformNode * const transform = node->GetTransform();
+			// Obtain node components.
+			const ModelNode     * const node      = visible_model.m_node;
 			const Model         * const model     = node->GetModel();
-			const XMMATRIX object_to_world        = transform->GetObjectToWorldMatrix();
-			const XMMATRIX object_to_projection   = object_to_world * world_to_projection;
-
-			// Apply view frustum culling.
-			if (ViewFrustum::Cull(object_to_projection, model->GetAABB())) {
-				continue;
-			}
-
-			// Obtain node components (2/2).
-			const XMMATRIX object_to_view         = object_to_world * world_to_view;
 
 			// Bind the model data.
-			BindModelData(object_to_view);
+			BindModelData(visible_model.m_object_to_view);
 			// Bind the model mesh.
 			model->BindMesh(m_device_context);
 			// Draw the model.
@@ -9,6 +9,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -19,6 +28,8 @@ namespace mage {
 		D3D_FEATURE_LEVEL_11_0
 	};
 
+	PipelineRecorder *Pipeline::s_recorder = nullptr;
+
 	ID3D11Device5 *Pipeline::GetDevice() noexcept {
 		Assert(RenderingManager::Get());
 
@@ -34,4 +45,753 @@ namespace mage {
 	void Pipeline::OnDraw() noexcept {
 		EngineStatistics::Get()->IncrementNumberOfDrawCalls();
 	}
+
+	//-------------------------------------------------------------------------
+	// Pipeline: Recording
+	//-------------------------------------------------------------------------
+
+	void Pipeline::SetRecorder(PipelineRecorder *recorder) noexcept {
+		s_recorder = recorder;
+
+		// Reissue all subsequently bound state to the new recorder.
+		for (const auto &[device_context, state] : s_states) {
+			state->Invalidate();
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// Pipeline: State Filtering
+	//-------------------------------------------------------------------------
+
+	vector< pair< ID3D11DeviceContext4 *, UniquePtr< PipelineState > > >
+		Pipeline::s_states;
+
+	namespace {
+
+		/**
+		 Notifies the engine statistics of a requested state bind.
+		 */
+		inline void OnStateBind() noexcept {
+			EngineStatistics::Get()->IncrementNumberOfStateBinds();
+		}
+
+		/**
+		 Notifies the engine statistics of an issued state bind.
+		 */
+		inline void OnStateBindIssued() noexcept {
+			EngineStatistics::Get()->IncrementNumberOfIssuedStateBinds();
+		}
+
+		/**
+		 Adds the resources of the given render target and depth-stencil
+		 views to the outputs of the given pipeline state.
+
+		 @param[in]		state
+						A reference to the pipeline state.
+		 @param[in]		nb_views
+						The number of render target views.
+		 @param[in]		rtvs
+						A pointer to an array of render target views.
+		 @param[in]		dsv
+						A pointer to the depth-stencil view.
+		 */
+		void SetOutputs(PipelineState &state, U32 nb_views,
+			ID3D11RenderTargetView * const *rtvs,
+			ID3D11DepthStencilView *dsv) {
+
+			state.m_om_outputs.clear();
+			for (U32 i = 0u; i < nb_views; ++i) {
+				if (rtvs[i]) {
+					state.m_om_outputs.push_back(GetResource(rtvs[i]));
+				}
+			}
+			if (dsv) {
+				state.m_om_outputs.push_back(GetResource(dsv));
+			}
+		}
+	}
+
+	void Pipeline::RegisterDeviceContext(
+		ID3D11DeviceContext4 *device_context) {
+
+		Assert(device_context);
+		Assert(!GetState(device_context));
+
+		s_states.emplace_back(device_context, MakeUnique< PipelineState >());
+	}
+
+	void Pipeline::UnregisterDeviceContext(
+		ID3D11DeviceContext4 *device_context) noexcept {
+
+		const auto it = std::find_if(s_states.begin(), s_states.end(),
+			[device_context](const auto &entry) noexcept {
+				return entry.first == device_context;
+			});
+
+		if (s_states.end() != it) {
+			s_states.erase(it);
+		}
+	}
+
+	void Pipeline::InvalidateState(
+		ID3D11DeviceContext4 *device_context) noexcept {
+
+		PipelineState * const state = GetState(device_context);
+		if (state) {
+			state->Invalidate();
+		}
+	}
+
+	PipelineState *Pipeline::GetState(
+		ID3D11DeviceContext4 *device_context) noexcept {
+
+		// Only a handful of device contexts are registered.
+		for (const auto &[context, state] : s_states) {
+			if (context == device_context) {
+				return state.get();
+			}
+		}
+
+		return nullptr;
+	}
+
+	void Pipeline::FlushState(ID3D11DeviceContext4 *device_context) noexcept {
+		PipelineState * const state = GetState(device_context);
+		if (!state) {
+			return;
+		}
+
+		for (size_t i = 0; i < state->m_stages.size(); ++i) {
+			const auto stage = static_cast< PipelineStage >(i);
+			auto &stage_state = state->m_stages[i];
+
+			stage_state.m_cbs.Flush(
+				[device_context, stage](U32 slot, U32 nb_buffers,
+					const ConstantBufferBinding *bindings) noexcept {
+
+				IssueConstantBuffers(device_context, stage,
+					                 slot, nb_buffers, bindings);
+			});
+
+			auto &srvs      = stage_state.m_srvs;
+			auto &resources = stage_state.m_srv_resources;
+			srvs.Flush(
+				[device_context, stage, state, &srvs, &resources](U32 slot, 
+					U32 nb_srvs, ID3D11ShaderResourceView * const *views) noexcept {
+
+				IssueSRVs(device_context, stage, slot, nb_srvs, views);
+
+				for (U32 j = slot; j < slot + nb_srvs; ++j) {
+					resources[j] = GetResource(srvs.m_bound[j]);
+
+					// The device context binds no SRVs of resources which 
+					// are bound as output.
+					if (state->IsOutput(resources[j])) {
+						srvs.m_bound[j]   = nullptr;
+						srvs.m_pending[j] = nullptr;
+						resources[j]      = nullptr;
+					}
+				}
+			});
+
+			stage_state.m_samplers.Flush(
+				[device_context, stage](U32 slot, U32 nb_samplers,
+					ID3D11SamplerState * const *samplers) noexcept {
+
+				IssueSamplers(device_context, stage,
+					          slot, nb_samplers, samplers);
+			});
+		}
+	}
+
+	void Pipeline::SetShader(ID3D11DeviceContext4 *device_context,
+		PipelineStage stage, ID3D11DeviceChild *shader,
+		ID3D11ClassInstance * const *class_instances,
+		U32 nb_class_instances) noexcept {
+
+		OnStateBind();
+
+		PipelineState * const state = GetState(device_context);
+		if (state) {
+			auto &bound_shader = state->GetStageState(stage).m_shader;
+
+			// Class instances are not shadowed.
+			if (!class_instances && bound_shader == shader) {
+				return;
+			}
+
+			bound_shader = (class_instances)
+				? GetUnknownObject< ID3D11DeviceChild >() : shader;
+		}
+
+		Record(device_context, PipelineCommandType::BindShader, stage,
+			0u, shader);
+
+		switch (stage) {
+
+		case PipelineStage::VS: {
+			device_context->VSSetShader(
+				static_cast< ID3D11VertexShader * >(shader),
+				class_instances, nb_class_instances);
+			break;
+		}
+		case PipelineStage::HS: {
+			device_context->HSSetShader(
+				static_cast< ID3D11HullShader * >(shader),
+				class_instances, nb_class_instances);
+			break;
+		}
+		case PipelineStage::DS: {
+			device_context->DSSetShader(
+				static_cast< ID3D11DomainShader * >(shader),
+				class_instances, nb_class_instances);
+			break;
+		}
+		case PipelineStage::GS: {
+			device_context->GSSetShader(
+				static_cast< ID3D11GeometryShader * >(shader),
+				class_instances, nb_class_instances);
+			break;
+		}
+		case PipelineStage::PS: {
+			device_context->PSSetShader(
+				static_cast< ID3D11PixelShader * >(shader),
+				class_instances, nb_class_instances);
+			break;
+		}
+		case PipelineStage::CS: {
+			device_context->CSSetShader(
+				static_cast< ID3D11ComputeShader * >(shader),
+				class_instances, nb_class_instances);
+			break;
+		}
+		default: {
+			Assert(false);
+			break;
+		}
+
+		}
+
+		OnStateBindIssued();
+	}
+
+	void Pipeline::SetConstantBuffers(ID3D11DeviceContext4 *device_context,
+		PipelineStage stage, U32 slot, U32 nb_buffers,
+		ID3D11Buffer * const *buffers) noexcept {
+
+		OnStateBind();
+
+		PipelineState * const state = GetState(device_context);
+		if (!state) {
+			IssueConstantBuffers(device_context, stage, slot, nb_buffers, 
+				                 buffers, nullptr, nullptr);
+			return;
+		}
+
+		Assert(nb_buffers <= D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT);
+
+		ConstantBufferBinding 
+			bindings[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];
+		for (U32 i = 0u; i < nb_buffers; ++i) {
+			bindings[i] = { buffers[i], 0u, 0u };
+		}
+
+		state->GetStageState(stage).m_cbs.Set(slot, nb_buffers, bindings);
+	}
+
+	void Pipeline::SetConstantBufferRange(
+		ID3D11DeviceContext4 *device_context, PipelineStage stage, 
+		U32 slot, ID3D11Buffer *buffer, 
+		U32 first_constant, U32 nb_constants) noexcept {
+
+		Assert(0u == first_constant % 16u);
+		Assert(0u == nb_constants   % 16u);
+		Assert(0u != nb_constants);
+		Assert(nb_constants <= D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT);
+
+		OnStateBind();
+
+		const ConstantBufferBinding binding = { 
+			buffer, first_constant, nb_constants 
+		};
+
+		PipelineState * const state = GetState(device_context);
+		if (!state) {
+			IssueConstantBuffers(device_context, stage, slot, 1u, &binding);
+			return;
+		}
+
+		state->GetStageState(stage).m_cbs.Set(slot, 1u, &binding);
+	}
+
+	void Pipeline::SetSRVs(ID3D11DeviceContext4 *device_context,
+		PipelineStage stage, U32 slot, U32 nb_srvs,
+		ID3D11ShaderResourceView * const *srvs) noexcept {
+
+		OnStateBind();
+
+		PipelineState * const state = GetState(device_context);
+		if (state) {
+			state->GetStageState(stage).m_srvs.Set(slot, nb_srvs, srvs);
+			return;
+		}
+
+		IssueSRVs(device_context, stage, slot, nb_srvs, srvs);
+	}
+
+	void Pipeline::SetSamplers(ID3D11DeviceContext4 *device_context,
+		PipelineStage stage, U32 slot, U32 nb_samplers,
+		ID3D11SamplerState * const *samplers) noexcept {
+
+		OnStateBind();
+
+		PipelineState * const state = GetState(device_context);
+		if (state) {
+			state->GetStageState(stage).m_samplers.Set(
+				slot, nb_samplers, samplers);
+			return;
+		}
+
+		IssueSamplers(device_context, stage, slot, nb_samplers, samplers);
+	}
+
+	void Pipeline::SetUAVs(ID3D11DeviceContext4 *device_context,
+		U32 slot, U32 nb_uavs, ID3D11UnorderedAccessView * const *uavs,
+		const U32 *initial_counts) noexcept {
+
+		// Issue the deferred binds before binding the outputs.
+		FlushState(device_context);
+
+		RecordArray(device_context, PipelineCommandType::BindUAVs,
+			PipelineStage::CS, slot, nb_uavs, uavs);
+		device_context->CSSetUnorderedAccessViews(
+			slot, nb_uavs, uavs, initial_counts);
+
+		PipelineState * const state = GetState(device_context);
+		if (state) {
+			for (U32 i = 0u; i < nb_uavs; ++i) {
+				state->m_cs_outputs[slot + i]
+					= (uavs) ? GetResource(uavs[i]) : nullptr;
+			}
+			state->m_nb_cs_outputs
+				= std::max(state->m_nb_cs_outputs, slot + nb_uavs);
+
+			state->UnbindOutputSRVs();
+		}
+	}
+
+	void Pipeline::SetIndexBuffer(ID3D11DeviceContext4 *device_context,
+		ID3D11Buffer *buffer, DXGI_FORMAT format, U32 offset) noexcept {
+
+		OnStateBind();
+
+		PipelineState * const state = GetState(device_context);
+		if (state) {
+			if (state->m_index_buffer    == buffer
+				&& state->m_index_format == format
+				&& state->m_index_offset == offset) {
+				return;
+			}
+
+			state->m_index_buffer = buffer;
+			state->m_index_format = format;
+			state->m_index_offset = offset;
+		}
+
+		Record(device_context, PipelineCommandType::BindIndexBuffer,
+			PipelineStage::IA, 0u, buffer, static_cast< U32 >(format),
+			offset);
+		device_context->IASetIndexBuffer(buffer, format, offset);
+
+		OnStateBindIssued();
+	}
+
+	void Pipeline::SetVertexBuffers(ID3D11DeviceContext4 *device_context,
+		U32 slot, U32 nb_buffers, ID3D11Buffer * const *buffers,
+		const U32 *strides, const U32 *offsets) noexcept {
+
+		OnStateBind();
+
+		PipelineState * const state = GetState(device_context);
+		if (state) {
+			Assert(slot + nb_buffers <= state->m_vertex_buffers.size());
+
+			// Determine the range of changed slots.
+			U32 first = nb_buffers;
+			U32 last  = 0u;
+			for (U32 i = 0u; i < nb_buffers; ++i) {
+				const U32 j = slot + i;
+				if (state->m_vertex_buffers[j] != buffers[i]
+					|| state->m_strides[j]     != strides[i]
+					|| state->m_offsets[j]     != offsets[i]) {
+
+					first = std::min(first, i);
+					last  = i;
+				}
+			}
+
+			if (nb_buffers == first) {
+				return;
+			}
+
+			for (U32 i = first; i <= last; ++i) {
+				const U32 j = slot + i;
+				state->m_vertex_buffers[j] = buffers[i];
+				state->m_strides[j]        = strides[i];
+				state->m_offsets[j]        = offsets[i];
+			}
+
+			slot      += first;
+			nb_buffers = last + 1u - first;
+			buffers   += first;
+			strides   += first;
+			offsets   += first;
+		}
+
+		RecordArray(device_context, PipelineCommandType::BindVertexBuffers,
+			PipelineStage::IA, slot, nb_buffers, buffers);
+		device_context->IASetVertexBuffers(
+			slot, nb_buffers, buffers, strides, offsets);
+
+		OnStateBindIssued();
+	}
+
+	void Pipeline::SetPrimitiveTopology(ID3D11DeviceContext4 *device_context,
+		D3D11_PRIMITIVE_TOPOLOGY topology) noexcept {
+
+		OnStateBind();
+
+		PipelineState * const state = GetState(device_context);
+		if (state) {
+			if (state->m_primitive_topology == topology) {
+				return;
+			}
+
+			state->m_primitive_topology = topology;
+		}
+
+		Record(device_context, PipelineCommandType::BindPrimitiveTopology,
+			PipelineStage::IA, 0u, nullptr, static_cast< U32 >(topology));
+		device_context->IASetPrimitiveTopology(topology);
+
+		OnStateBindIssued();
+	}
+
+	void Pipeline::SetInputLayout(ID3D11DeviceContext4 *device_context,
+		ID3D11InputLayout *input_layout) noexcept {
+
+		OnStateBind();
+
+		PipelineState * const state = GetState(device_context);
+		if (state) {
+			if (state->m_input_layout == input_layout) {
+				return;
+			}
+
+			state->m_input_layout = input_layout;
+		}
+
+		Record(device_context, PipelineCommandType::BindInputLayout,
+			PipelineStage::IA, 0u, input_layout);
+		device_context->IASetInputLayout(input_layout);
+
+		OnStateBindIssued();
+	}
+
+	void Pipeline::SetRasterizerState(ID3D11DeviceContext4 *device_context,
+		ID3D11RasterizerState *state) noexcept {
+
+		OnStateBind();
+
+		PipelineState * const pipeline_state = GetState(device_context);
+		if (pipeline_state) {
+			if (pipeline_state->m_rasterizer_state == state) {
+				return;
+			}
+
+			pipeline_state->m_rasterizer_state = state;
+		}
+
+		Record(device_context, PipelineCommandType::BindRasterizerState,
+			PipelineStage::RS, 0u, state);
+		device_context->RSSetState(state);
+
+		OnStateBindIssued();
+	}
+
+	void Pipeline::SetBlendState(ID3D11DeviceContext4 *device_context,
+		ID3D11BlendState *state, const F32 blend_factor[4],
+		U32 sample_mask) noexcept {
+
+		OnStateBind();
+
+		PipelineState * const pipeline_state = GetState(device_context);
+		if (pipeline_state) {
+			// A blend factor equal to nullptr denotes a blend factor of one.
+			static constexpr F32 s_default_blend_factor[4] = {
+				1.0f, 1.0f, 1.0f, 1.0f
+			};
+			const F32 * const factor
+				= (blend_factor) ? blend_factor : s_default_blend_factor;
+
+			if (pipeline_state->m_blend_state    == state
+				&& pipeline_state->m_sample_mask == sample_mask
+				&& std::equal(factor, factor + 4,
+					          pipeline_state->m_blend_factor)) {
+				return;
+			}
+
+			pipeline_state->m_blend_state = state;
+			pipeline_state->m_sample_mask = sample_mask;
+			std::copy(factor, factor + 4, pipeline_state->m_blend_factor);
+		}
+
+		Record(device_context, PipelineCommandType::BindBlendState,
+			PipelineStage::OM, 0u, state, sample_mask);
+		device_context->OMSetBlendState(state, blend_factor, sample_mask);
+
+		OnStateBindIssued();
+	}
+
+	void Pipeline::SetDepthStencilState(ID3D11DeviceContext4 *device_context,
+		ID3D11DepthStencilState *state, U32 stencil_ref) noexcept {
+
+		OnStateBind();
+
+		PipelineState * const pipeline_state = GetState(device_context);
+		if (pipeline_state) {
+			if (pipeline_state->m_depth_stencil_state == state
+				&& pipeline_state->m_stencil_ref      == stencil_ref) {
+				return;
+			}
+
+			pipeline_state->m_depth_stencil_state = state;
+			pipeline_state->m_stencil_ref         = stencil_ref;
+		}
+
+		Record(device_context, PipelineCommandType::BindDepthStencilState,
+			PipelineStage::OM, 0u, state, stencil_ref);
+		device_context->OMSetDepthStencilState(state, stencil_ref);
+
+		OnStateBindIssued();
+	}
+
+	void Pipeline::SetRTVsAndDSV(ID3D11DeviceContext4 *device_context,
+		U32 nb_views, ID3D11RenderTargetView * const *rtvs,
+		ID3D11DepthStencilView *dsv) noexcept {
+
+		// Issue the deferred binds before binding the outputs.
+		FlushState(device_context);
+
+		RecordArray(device_context, PipelineCommandType::BindRTVsAndDSV,
+			PipelineStage::OM, 0u, nb_views, rtvs, dsv);
+		device_context->OMSetRenderTargets(nb_views, rtvs, dsv);
+
+		PipelineState * const state = GetState(device_context);
+		if (state) {
+			SetOutputs(*state, nb_views, rtvs, dsv);
+			state->UnbindOutputSRVs();
+		}
+	}
+
+	void Pipeline::SetRTVsAndDSVAndUAVs(ID3D11DeviceContext4 *device_context,
+		U32 nb_views, ID3D11RenderTargetView * const *rtvs,
+		ID3D11DepthStencilView *dsv, U32 uav_slot, U32 nb_uavs,
+		ID3D11UnorderedAccessView * const *uavs,
+		const U32 *initial_counts) noexcept {
+
+		// Issue the deferred binds before binding the outputs.
+		FlushState(device_context);
+
+		RecordArray(device_context,
+			PipelineCommandType::BindRTVsAndDSVAndUAVs,
+			PipelineStage::OM, 0u, nb_views, rtvs, dsv, uav_slot,
+			nb_uavs);
+		device_context->OMSetRenderTargetsAndUnorderedAccessViews(
+			nb_views, rtvs, dsv, uav_slot, nb_uavs, uavs, initial_counts);
+
+		PipelineState * const state = GetState(device_context);
+		if (state) {
+			if (D3D11_KEEP_RENDER_TARGETS_AND_DEPTH_STENCIL != nb_views) {
+				SetOutputs(*state, nb_views, rtvs, dsv);
+			}
+			if (D3D11_KEEP_UNORDERED_ACCESS_VIEWS != nb_uavs) {
+				// Conservatively keep the resources of the replaced UAVs.
+				for (U32 i = 0u; i < nb_uavs; ++i) {
+					if (uavs[i]) {
+						state->m_om_outputs.push_back(GetResource(uavs[i]));
+					}
+				}
+			}
+
+			state->UnbindOutputSRVs();
+		}
+	}
+
+	void Pipeline::IssueConstantBuffers(ID3D11DeviceContext4 *device_context,
+		PipelineStage stage, U32 slot, U32 nb_buffers,
+		const ConstantBufferBinding *bindings) noexcept {
+
+		ID3D11Buffer *buffers[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];
+		U32 first_constants[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];
+		U32 nb_constants[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];
+
+		// Split the bindings in runs of complete buffers and runs of ranges.
+		for (U32 first = 0u; first < nb_buffers;) {
+			const bool range = bindings[first].IsRange();
+
+			U32 end = first;
+			for (; end < nb_buffers && bindings[end].IsRange() == range; ++end) {
+				buffers[end]         = bindings[end].m_buffer;
+				first_constants[end] = bindings[end].m_first_constant;
+				nb_constants[end]    = bindings[end].m_nb_constants;
+			}
+
+			IssueConstantBuffers(device_context, stage, slot + first, 
+				end - first, &buffers[first], 
+				range ? &first_constants[first] : nullptr,
+				range ? &nb_constants[first]    : nullptr);
+
+			first = end;
+		}
+	}
+
+	void Pipeline::IssueConstantBuffers(ID3D11DeviceContext4 *device_context,
+		PipelineStage stage, U32 slot, U32 nb_buffers,
+		ID3D11Buffer * const *buffers, const U32 *first_constants, 
+		const U32 *nb_constants) noexcept {
+
+		// The range of the first buffer is recorded as arguments.
+		RecordArray(device_context, PipelineCommandType::BindConstantBuffers,
+			stage, slot, nb_buffers, buffers, nullptr,
+			(first_constants) ? first_constants[0] : 0u,
+			(nb_constants)    ? nb_constants[0]    : 0u);
+
+		switch (stage) {
+
+		case PipelineStage::VS: {
+			device_context->VSSetConstantBuffers1(slot, nb_buffers, buffers,
+				first_constants, nb_constants);
+			break;
+		}
+		case PipelineStage::HS: {
+			device_context->HSSetConstantBuffers1(slot, nb_buffers, buffers,
+				first_constants, nb_constants);
+			break;
+		}
+		case PipelineStage::DS: {
+			device_context->DSSetConstantBuffers1(slot, nb_buffers, buffers,
+				first_constants, nb_constants);
+			break;
+		}
+		case PipelineStage::GS: {
+			device_context->GSSetConstantBuffers1(slot, nb_buffers, buffers,
+				first_constants, nb_constants);
+			break;
+		}
+		case PipelineStage::PS: {
+			device_context->PSSetConstantBuffers1(slot, nb_buffers, buffers,
+				first_constants, nb_constants);
+			break;
+		}
+		case PipelineStage::CS: {
+			device_context->CSSetConstantBuffers1(slot, nb_buffers, buffers,
+				first_constants, nb_constants);
+			break;
+		}
+		default: {
+			Assert(false);
+			break;
+		}
+
+		}
+
+		OnStateBindIssued();
+	}
+
+	void Pipeline::IssueSRVs(ID3D11DeviceContext4 *device_context,
+		PipelineStage stage, U32 slot, U32 nb_srvs,
+		ID3D11ShaderResourceView * const *srvs) noexcept {
+
+		RecordArray(device_context, PipelineCommandType::BindSRVs,
+			stage, slot, nb_srvs, srvs);
+
+		switch (stage) {
+
+		case PipelineStage::VS: {
+			device_context->VSSetShaderResources(slot, nb_srvs, srvs);
+			break;
+		}
+		case PipelineStage::HS: {
+			device_context->HSSetShaderResources(slot, nb_srvs, srvs);
+			break;
+		}
+		case PipelineStage::DS: {
+			device_context->DSSetShaderResources(slot, nb_srvs, srvs);
+			break;
+		}
+		case PipelineStage::GS: {
+			device_context->GSSetShaderResources(slot, nb_srvs, srvs);
+			break;
+		}
+		case PipelineStage::PS: {
+			device_context->PSSetShaderResources(slot, nb_srvs, srvs);
+			break;
+		}
+		case PipelineStage::CS: {
+			device_context->CSSetShaderResources(slot, nb_srvs, srvs);
+			break;
+		}
+		default: {
+			Assert(false);
+			break;
+		}
+
+		}
+
+		OnStateBindIssued();
+	}
+
+	void Pipeline::IssueSamplers(ID3D11DeviceContext4 *device_context,
+		PipelineStage stage, U32 slot, U32 nb_samplers,
+		ID3D11SamplerState * const *samplers) noexcept {
+
+		RecordArray(device_context, PipelineCommandType::BindSamplers,
+			stage, slot, nb_samplers, samplers);
+
+		switch (stage) {
+
+		case PipelineStage::VS: {
+			device_context->VSSetSamplers(slot, nb_samplers, samplers);
+			break;
+		}
+		case PipelineStage::HS: {
+			device_context->HSSetSamplers(slot, nb_samplers, samplers);
+			break;
+		}
+		case PipelineStage::DS: {
+			device_context->DSSetSamplers(slot, nb_samplers, samplers);
+			break;
+		}
+		case PipelineStage::GS: {
+			device_context->GSSetSamplers(slot, nb_samplers, samplers);
+			break;
+		}
+		case PipelineStage::PS: {
+			device_context->PSSetSamplers(slot, nb_samplers, samplers);
+			break;
+		}
+		case PipelineStage::CS: {
+			device_context->CSSetSamplers(slot, nb_samplers, samplers);
+			break;
+		}
+		default: {
+			Assert(false);
+			break;
+		}
+
+		}
+
+		OnStateBindIssued();
+	}
 }
@@ -7,6 +7,8 @@
 
 #include "utils\type\types.hpp"
 #include "rendering\rendering.hpp"
+#include "rendering\pipeline_state.hpp"
+#include "utils\memory\memory.hpp"
 
 #pragma endregion
 
@@ -57,11 +59,85 @@ namespace mage {
 		 */
 		static ID3D11DeviceContext4 *GetImmediateDeviceContext() noexcept;
 
+		//---------------------------------------------------------------------
+		// Class Member Methods: Recording
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the pipeline recorder.
+
+		 @return		A pointer to the pipeline recorder.
+		 @return		@c nullptr if no pipeline commands are recorded.
+		 */
+		static PipelineRecorder *GetRecorder() noexcept {
+			return s_recorder;
+		}
+
+		/**
+		 Sets the pipeline recorder. Each pipeline command is passed to the
+		 given pipeline recorder before it is executed.
+
+		 The pipeline states of all registered device contexts are
+		 invalidated, so that the given pipeline recorder observes all state
+		 that is bound afterwards.
+
+		 @param[in]		recorder
+						A pointer to the pipeline recorder. Pass @c nullptr to
+						stop recording pipeline commands.
+		 */
+		static void SetRecorder(PipelineRecorder *recorder) noexcept;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods: State Filtering
+		//---------------------------------------------------------------------
+
+		/**
+		 Registers the given device context.
+
+		 The state bound through the pipeline to a registered device context
+		 is shadowed: redundant binds are dropped, and shader constant
+		 buffer, shader resource view and sampler binds are deferred until
+		 the next draw, dispatch or output bind to batch contiguous slots.
+		 The state bound to unregistered device contexts is not filtered.
+
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			@a device_context is not registered.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 */
+		static void RegisterDeviceContext(
+			ID3D11DeviceContext4 *device_context);
+
+		/**
+		 Unregisters the given device context.
+
+		 @param[in]		device_context
+						A pointer to the device context.
+		 */
+		static void UnregisterDeviceContext(
+			ID3D11DeviceContext4 *device_context) noexcept;
+
+		/**
+		 Invalidates the pipeline state of the given device context.
+
+		 Call this method after the state of the given device context is
+		 modified without using the pipeline (e.g. @c ClearState, executing
+		 or finishing command lists).
+
+		 @param[in]		device_context
+						A pointer to the device context.
+		 */
+		static void InvalidateState(
+			ID3D11DeviceContext4 *device_context) noexcept;
+
 		//---------------------------------------------------------------------
 		// Class Member Methods: Drawing and Dispatching
 		//---------------------------------------------------------------------
 
 		static void DrawAuto(ID3D11DeviceContext4 *device_context) noexcept {
+			FlushState(device_context);
+			Record(device_context, PipelineCommandType::DrawAuto,
+				PipelineStage::None, 0u, nullptr);
 			device_context->DrawAuto();
 			OnDraw();
 		}
@@ -69,6 +145,9 @@ namespace mage {
 		static void Draw(ID3D11DeviceContext4 *device_context,
 			U32 nb_vertices, U32 vertex_start) noexcept {
 
+			FlushState(device_context);
+			Record(device_context, PipelineCommandType::Draw,
+				PipelineStage::None, 0u, nullptr, nb_vertices, vertex_start);
 			device_context->Draw(nb_vertices, vertex_start);
 			OnDraw();
 		}
@@ -77,6 +156,10 @@ namespace mage {
 			U32 nb_indices_per_instance, U32 nb_instances,
 			U32 vertex_start, U32 instance_start = 0u) noexcept {
 
+			FlushState(device_context);
+			Record(device_context, PipelineCommandType::DrawInstanced,
+				PipelineStage::None, 0u, nullptr, nb_indices_per_instance,
+				nb_instances, vertex_start, instance_start);
 			device_context->DrawInstanced(nb_indices_per_instance,
 				nb_instances, vertex_start, instance_start);
 			OnDraw();
@@ -85,6 +168,10 @@ namespace mage {
 		static void DrawIndexed(ID3D11DeviceContext4 *device_context,
 			U32 nb_indices, U32 index_start, U32 index_offset = 0u) noexcept {
 
+			FlushState(device_context);
+			Record(device_context, PipelineCommandType::DrawIndexed,
+				PipelineStage::None, 0u, nullptr, nb_indices, index_start,
+				index_offset);
 			device_context->DrawIndexed(nb_indices, index_start, index_offset);
 			OnDraw();
 		}
@@ -93,6 +180,10 @@ namespace mage {
 			U32 nb_indices_per_instance, U32 nb_instances, U32 index_start, 
 			U32 index_offset = 0u, U32 instance_start = 0u) noexcept {
 
+			FlushState(device_context);
+			Record(device_context, PipelineCommandType::DrawIndexedInstanced,
+				PipelineStage::None, 0u, nullptr, nb_indices_per_instance,
+				nb_instances, index_start, index_offset, instance_start);
 			device_context->DrawIndexedInstanced(nb_indices_per_instance,
 				nb_instances, index_start, index_offset, instance_start);
 			OnDraw();
@@ -102,6 +193,10 @@ namespace mage {
 			U32 nb_thread_groups_x, U32 nb_thread_groups_y, 
 			U32 nb_thread_groups_z) noexcept {
 
+			FlushState(device_context);
+			Record(device_context, PipelineCommandType::Dispatch,
+				PipelineStage::CS, 0u, nullptr, nb_thread_groups_x,
+				nb_thread_groups_y, nb_thread_groups_z);
 			device_context->Dispatch(
 				nb_thread_groups_x, nb_thread_groups_y, nb_thread_groups_z);
 		}
@@ -110,6 +205,9 @@ namespace mage {
 			ID3D11DeviceContext4 *device_context, ID3D11Buffer *buffer, 
 			U32 byte_offset) noexcept {
 
+			FlushState(device_context);
+			Record(device_context, PipelineCommandType::DrawInstancedIndirect,
+				PipelineStage::None, 0u, buffer, byte_offset);
 			device_context->DrawInstancedIndirect(buffer, byte_offset);
 			OnDraw();
 		}
@@ -118,6 +216,10 @@ namespace mage {
 			ID3D11DeviceContext4 *device_context, ID3D11Buffer *buffer, 
 			U32 byte_offset) noexcept {
 
+			FlushState(device_context);
+			Record(device_context,
+				PipelineCommandType::DrawIndexedInstancedIndirect,
+				PipelineStage::None, 0u, buffer, byte_offset);
 			device_context->DrawIndexedInstancedIndirect(buffer, byte_offset);
 			OnDraw();
 		}
@@ -126,6 +228,9 @@ namespace mage {
 			ID3D11DeviceContext4 *device_context, ID3D11Buffer *buffer, 
 			U32 byte_offset) noexcept {
 
+			FlushState(device_context);
+			Record(device_context, PipelineCommandType::DispatchIndirect,
+				PipelineStage::CS, 0u, buffer, byte_offset);
 			device_context->DispatchIndirect(buffer, byte_offset);
 		}
 
@@ -134,6 +239,9 @@ namespace mage {
 			D3D11_MAP map_type, U32 map_flags,
 			D3D11_MAPPED_SUBRESOURCE *mapped_resource) noexcept {
 
+			Record(device_context, PipelineCommandType::Map,
+				PipelineStage::None, subresource, resource,
+				static_cast< U32 >(map_type), map_flags);
 			return device_context->Map(resource, subresource, 
 				map_type, map_flags, mapped_resource);
 		}
@@ -141,6 +249,8 @@ namespace mage {
 		static void Unmap(ID3D11DeviceContext4 *device_context,
 			ID3D11Resource *resource, U32 subresource) noexcept {
 
+			Record(device_context, PipelineCommandType::Unmap,
+				PipelineStage::None, subresource, resource);
 			device_context->Unmap(resource, subresource);
 		}
 		
@@ -149,10 +259,73 @@ namespace mage {
 			const void *src_data, U32 src_row_pitch, U32 src_depth_pitch,
 			const D3D11_BOX *dst_box = nullptr) noexcept {
 
+			Record(device_context, PipelineCommandType::UpdateSubresource,
+				PipelineStage::None, dst_subresource, dst_resource,
+				src_row_pitch, src_depth_pitch);
 			device_context->UpdateSubresource(dst_resource, dst_subresource,
 				dst_box, src_data, src_row_pitch, src_depth_pitch);
 		}
 
+		//---------------------------------------------------------------------
+		// Class Member Methods: Command Lists
+		//---------------------------------------------------------------------
+
+		/**
+		 Finishes the commands recorded on the given deferred device context
+		 into a command list.
+
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @param[in]		device_context
+						A pointer to the deferred device context.
+		 @param[in]		restore
+						Flag indicating whether the state of the given device
+						context is restored. If @c false, the state of the
+						given device context is reset to its default state.
+		 @param[out]	command_list
+						A pointer to a pointer to the command list.
+		 @return		A success/error value.
+		 */
+		static HRESULT FinishCommandList(ID3D11DeviceContext4 *device_context,
+			bool restore, ID3D11CommandList **command_list) noexcept {
+
+			Record(device_context, PipelineCommandType::FinishCommandList,
+				PipelineStage::None, 0u, nullptr, restore ? 1u : 0u);
+			const HRESULT result = device_context->FinishCommandList(
+				restore ? TRUE : FALSE, command_list);
+			if (!restore) {
+				InvalidateState(device_context);
+			}
+			return result;
+		}
+
+		/**
+		 Executes the given command list on the given device context.
+
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			@a command_list is not equal to @c nullptr.
+		 @param[in]		device_context
+						A pointer to the (immediate) device context.
+		 @param[in]		command_list
+						A pointer to the command list.
+		 @param[in]		restore
+						Flag indicating whether the state of the given device
+						context is restored after executing the given command
+						list. If @c false, the state of the given device
+						context is reset to its default state.
+		 */
+		static void ExecuteCommandList(ID3D11DeviceContext4 *device_context,
+			ID3D11CommandList *command_list, bool restore) noexcept {
+
+			FlushState(device_context);
+			Record(device_context, PipelineCommandType::ExecuteCommandList,
+				PipelineStage::None, 0u, command_list, restore ? 1u : 0u);
+			device_context->ExecuteCommandList(command_list, 
+				restore ? TRUE : FALSE);
+			if (!restore) {
+				InvalidateState(device_context);
+			}
+		}
+
 		//---------------------------------------------------------------------
 		// Class Member Methods: Shaders
 		//---------------------------------------------------------------------
@@ -354,7 +527,7 @@ namespace mage {
 				ID3D11Buffer *buffer, DXGI_FORMAT format, 
 				U32 offset = 0u) noexcept {
 
-				device_context->IASetIndexBuffer(buffer, format, offset);
+				SetIndexBuffer(device_context, buffer, format, offset);
 			}
 
 			static void BindVertexBuffer(ID3D11DeviceContext4 *device_context,
@@ -371,20 +544,20 @@ namespace mage {
 				U32 slot, U32 nb_buffers, ID3D11Buffer * const *buffers,
 				const U32 *strides, const U32 *offsets) noexcept {
 
-				device_context->IASetVertexBuffers(
+				SetVertexBuffers(device_context,
 					slot, nb_buffers, buffers, strides, offsets);
 			}
 
 			static void BindPrimitiveTopology(ID3D11DeviceContext4 *device_context,
 				D3D11_PRIMITIVE_TOPOLOGY topology) noexcept {
 
-				device_context->IASetPrimitiveTopology(topology);
+				SetPrimitiveTopology(device_context, topology);
 			}
 
 			static void BindInputLayout(ID3D11DeviceContext4 *device_context,
 				ID3D11InputLayout *input_layout) noexcept {
 
-				device_context->IASetInputLayout(input_layout);
+				SetInputLayout(device_context, input_layout);
 			}
 
 			//-----------------------------------------------------------------
@@ -454,7 +627,7 @@ namespace mage {
 				ID3D11ClassInstance * const *class_instances, 
 				U32 nb_class_instances) noexcept {
 				
-				device_context->VSSetShader(shader, 
+				SetShader(device_context, PipelineStage::VS, shader,
 					class_instances, nb_class_instances);
 			}
 			
@@ -478,6 +651,37 @@ namespace mage {
 				ID3D11Buffer * const buffers[1] = { buffer };
 				BindConstantBuffers(device_context, slot, 1u, buffers);
 			}
+
+			/**
+			 Binds a range of shader constants of a constant buffer to the 
+			 vertex shader stage.
+			 
+			 @pre			@a device_context is not equal to @c nullptr.
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples 
+							of 16.
+			 @pre			@a nb_constants is not equal to zero and not 
+							greater than @c D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT.
+			 @param[in]		device_context
+							A pointer to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set 
+							the constant buffer to (ranges from 0 to 
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The first shader constant (of 16 bytes) of the range.
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext4 *device_context,
+				U32 slot, ID3D11Buffer *buffer, 
+				U32 first_constant, U32 nb_constants) noexcept {
+					
+				SetConstantBufferRange(device_context, PipelineStage::VS,
+					slot, buffer, first_constant, nb_constants);
+			}
 			
 			/**
 			 Binds an array of constant buffers to the vertex shader stage.
@@ -505,7 +709,8 @@ namespace mage {
 				U32 slot, U32 nb_buffers, 
 				ID3D11Buffer * const *buffers) noexcept {
 					
-				device_context->VSSetConstantBuffers(slot, nb_buffers, buffers);
+				SetConstantBuffers(device_context, PipelineStage::VS,
+					slot, nb_buffers, buffers);
 			}
 			
 			/**
@@ -556,7 +761,8 @@ namespace mage {
 				U32 slot, U32 nb_srvs, 
 				ID3D11ShaderResourceView * const *srvs) noexcept {
 					
-				device_context->VSSetShaderResources(slot, nb_srvs, srvs);
+				SetSRVs(device_context, PipelineStage::VS,
+					slot, nb_srvs, srvs);
 			}
 			
 			/**
@@ -606,7 +812,8 @@ namespace mage {
 				U32 slot, U32 nb_samplers, 
 				ID3D11SamplerState * const *samplers) noexcept {
 					
-				device_context->VSSetSamplers(slot, nb_samplers, samplers);
+				SetSamplers(device_context, PipelineStage::VS,
+					slot, nb_samplers, samplers);
 			}
 
 			//-----------------------------------------------------------------
@@ -676,7 +883,7 @@ namespace mage {
 				ID3D11ClassInstance * const *class_instances, 
 				U32 nb_class_instances) noexcept {
 				
-				device_context->DSSetShader(shader, 
+				SetShader(device_context, PipelineStage::DS, shader,
 					class_instances, nb_class_instances);
 			}
 			
@@ -700,6 +907,37 @@ namespace mage {
 				ID3D11Buffer * const buffers[1] = { buffer };
 				BindConstantBuffers(device_context, slot, 1u, buffers);
 			}
+
+			/**
+			 Binds a range of shader constants of a constant buffer to the 
+			 domain shader stage.
+			 
+			 @pre			@a device_context is not equal to @c nullptr.
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples 
+							of 16.
+			 @pre			@a nb_constants is not equal to zero and not 
+							greater than @c D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT.
+			 @param[in]		device_context
+							A pointer to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set 
+							the constant buffer to (ranges from 0 to 
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The first shader constant (of 16 bytes) of the range.
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext4 *device_context,
+				U32 slot, ID3D11Buffer *buffer, 
+				U32 first_constant, U32 nb_constants) noexcept {
+					
+				SetConstantBufferRange(device_context, PipelineStage::DS,
+					slot, buffer, first_constant, nb_constants);
+			}
 			
 			/**
 			 Binds an array of constant buffers to the domain shader stage.
@@ -727,7 +965,8 @@ namespace mage {
 				U32 slot, U32 nb_buffers, 
 				ID3D11Buffer * const *buffers) noexcept {
 					
-				device_context->DSSetConstantBuffers(slot, nb_buffers, buffers);
+				SetConstantBuffers(device_context, PipelineStage::DS,
+					slot, nb_buffers, buffers);
 			}
 			
 			/**
@@ -778,7 +1017,8 @@ namespace mage {
 				U32 slot, U32 nb_srvs, 
 				ID3D11ShaderResourceView * const *srvs) noexcept {
 					
-				device_context->DSSetShaderResources(slot, nb_srvs, srvs);
+				SetSRVs(device_context, PipelineStage::DS,
+					slot, nb_srvs, srvs);
 			}
 
 			/**
@@ -828,7 +1068,8 @@ namespace mage {
 				U32 slot, U32 nb_samplers, 
 				ID3D11SamplerState * const *samplers) noexcept {
 					
-				device_context->DSSetSamplers(slot, nb_samplers, samplers);
+				SetSamplers(device_context, PipelineStage::DS,
+					slot, nb_samplers, samplers);
 			}
 
 			//-----------------------------------------------------------------
@@ -932,7 +1173,7 @@ namespace mage {
 				ID3D11ClassInstance * const *class_instances, 
 				U32 nb_class_instances) noexcept {
 				
-				device_context->HSSetShader(shader, 
+				SetShader(device_context, PipelineStage::HS, shader,
 					class_instances, nb_class_instances);
 			}
 			
@@ -956,6 +1197,37 @@ namespace mage {
 				ID3D11Buffer * const buffers[1] = { buffer };
 				BindConstantBuffers(device_context, slot, 1u, buffers);
 			}
+
+			/**
+			 Binds a range of shader constants of a constant buffer to the 
+			 hull shader stage.
+			 
+			 @pre			@a device_context is not equal to @c nullptr.
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples 
+							of 16.
+			 @pre			@a nb_constants is not equal to zero and not 
+							greater than @c D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT.
+			 @param[in]		device_context
+							A pointer to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set 
+							the constant buffer to (ranges from 0 to 
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The first shader constant (of 16 bytes) of the range.
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext4 *device_context,
+				U32 slot, ID3D11Buffer *buffer, 
+				U32 first_constant, U32 nb_constants) noexcept {
+					
+				SetConstantBufferRange(device_context, PipelineStage::HS,
+					slot, buffer, first_constant, nb_constants);
+			}
 			
 			/**
 			 Binds an array of constant buffers to the hull shader stage.
@@ -983,7 +1255,8 @@ namespace mage {
 				U32 slot, U32 nb_buffers, 
 				ID3D11Buffer * const *buffers) noexcept {
 					
-				device_context->HSSetConstantBuffers(slot, nb_buffers, buffers);
+				SetConstantBuffers(device_context, PipelineStage::HS,
+					slot, nb_buffers, buffers);
 			}
 			
 			/**
@@ -1034,7 +1307,8 @@ namespace mage {
 				U32 slot, U32 nb_srvs, 
 				ID3D11ShaderResourceView * const *srvs) noexcept {
 					
-				device_context->HSSetShaderResources(slot, nb_srvs, srvs);
+				SetSRVs(device_context, PipelineStage::HS,
+					slot, nb_srvs, srvs);
 			}
 
 			/**
@@ -1084,7 +1358,8 @@ namespace mage {
 				U32 slot, U32 nb_samplers, 
 				ID3D11SamplerState * const *samplers) noexcept {
 					
-				device_context->HSSetSamplers(slot, nb_samplers, samplers);
+				SetSamplers(device_context, PipelineStage::HS,
+					slot, nb_samplers, samplers);
 			}
 
 			//-----------------------------------------------------------------
@@ -1154,7 +1429,7 @@ namespace mage {
 				ID3D11ClassInstance * const *class_instances, 
 				U32 nb_class_instances) noexcept {
 				
-				device_context->GSSetShader(shader, 
+				SetShader(device_context, PipelineStage::GS, shader,
 					class_instances, nb_class_instances);
 			}
 			
@@ -1178,6 +1453,37 @@ namespace mage {
 				ID3D11Buffer * const buffers[1] = { buffer };
 				BindConstantBuffers(device_context, slot, 1u, buffers);
 			}
+
+			/**
+			 Binds a range of shader constants of a constant buffer to the 
+			 geometry shader stage.
+			 
+			 @pre			@a device_context is not equal to @c nullptr.
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples 
+							of 16.
+			 @pre			@a nb_constants is not equal to zero and not 
+							greater than @c D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT.
+			 @param[in]		device_context
+							A pointer to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set 
+							the constant buffer to (ranges from 0 to 
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The first shader constant (of 16 bytes) of the range.
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext4 *device_context,
+				U32 slot, ID3D11Buffer *buffer, 
+				U32 first_constant, U32 nb_constants) noexcept {
+					
+				SetConstantBufferRange(device_context, PipelineStage::GS,
+					slot, buffer, first_constant, nb_constants);
+			}
 			
 			/**
 			 Binds an array of constant buffers to the geometry shader stage.
@@ -1205,7 +1511,8 @@ namespace mage {
 				U32 slot, U32 nb_buffers, 
 				ID3D11Buffer * const *buffers) noexcept {
 					
-				device_context->GSSetConstantBuffers(slot, nb_buffers, buffers);
+				SetConstantBuffers(device_context, PipelineStage::GS,
+					slot, nb_buffers, buffers);
 			}
 			
 			/**
@@ -1256,7 +1563,8 @@ namespace mage {
 				U32 slot, U32 nb_srvs, 
 				ID3D11ShaderResourceView * const *srvs) noexcept {
 					
-				device_context->GSSetShaderResources(slot, nb_srvs, srvs);
+				SetSRVs(device_context, PipelineStage::GS,
+					slot, nb_srvs, srvs);
 			}
 			
 			/**
@@ -1306,7 +1614,8 @@ namespace mage {
 				U32 slot, U32 nb_samplers, 
 				ID3D11SamplerState * const *samplers) noexcept {
 					
-				device_context->GSSetSamplers(slot, nb_samplers, samplers);
+				SetSamplers(device_context, PipelineStage::GS,
+					slot, nb_samplers, samplers);
 			}
 
 			//-----------------------------------------------------------------
@@ -1386,13 +1695,15 @@ namespace mage {
 			static void BindScissorRectangles(ID3D11DeviceContext4 *device_context,
 				U32 nb_rectangles, const D3D11_RECT *rectangles) noexcept {
 
+				RecordScissorRectangles(device_context, nb_rectangles,
+					rectangles);
 				device_context->RSSetScissorRects(nb_rectangles, rectangles);
 			}
 			
 			static void BindState(ID3D11DeviceContext4 *device_context,
 				ID3D11RasterizerState *state) noexcept {
 
-				device_context->RSSetState(state);
+				SetRasterizerState(device_context, state);
 			}
 			
 			static void GetBoundViewports(ID3D11DeviceContext4 *device_context,
@@ -1410,6 +1721,7 @@ namespace mage {
 			static void BindViewports(ID3D11DeviceContext4 *device_context,
 				U32 nb_viewports, const D3D11_VIEWPORT *viewports) noexcept {
 
+				RecordViewports(device_context, nb_viewports, viewports);
 				device_context->RSSetViewports(nb_viewports, viewports);
 			}
 
@@ -1480,7 +1792,7 @@ namespace mage {
 				ID3D11ClassInstance * const *class_instances, 
 				U32 nb_class_instances) noexcept {
 				
-				device_context->PSSetShader(shader, 
+				SetShader(device_context, PipelineStage::PS, shader,
 					class_instances, nb_class_instances);
 			}
 			
@@ -1504,6 +1816,37 @@ namespace mage {
 				ID3D11Buffer * const buffers[1] = { buffer };
 				BindConstantBuffers(device_context, slot, 1u, buffers);
 			}
+
+			/**
+			 Binds a range of shader constants of a constant buffer to the 
+			 pixel shader stage.
+			 
+			 @pre			@a device_context is not equal to @c nullptr.
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples 
+							of 16.
+			 @pre			@a nb_constants is not equal to zero and not 
+							greater than @c D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT.
+			 @param[in]		device_context
+							A pointer to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set 
+							the constant buffer to (ranges from 0 to 
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The first shader constant (of 16 bytes) of the range.
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext4 *device_context,
+				U32 slot, ID3D11Buffer *buffer, 
+				U32 first_constant, U32 nb_constants) noexcept {
+					
+				SetConstantBufferRange(device_context, PipelineStage::PS,
+					slot, buffer, first_constant, nb_constants);
+			}
 			
 			/**
 			 Binds an array of constant buffers to the pixel shader stage.
@@ -1531,7 +1874,8 @@ namespace mage {
 				U32 slot, U32 nb_buffers, 
 				ID3D11Buffer * const *buffers) noexcept {
 					
-				device_context->PSSetConstantBuffers(slot, nb_buffers, buffers);
+				SetConstantBuffers(device_context, PipelineStage::PS,
+					slot, nb_buffers, buffers);
 			}
 			
 			/**
@@ -1582,7 +1926,8 @@ namespace mage {
 				U32 slot, U32 nb_srvs, 
 				ID3D11ShaderResourceView * const *srvs) noexcept {
 					
-				device_context->PSSetShaderResources(slot, nb_srvs, srvs);
+				SetSRVs(device_context, PipelineStage::PS,
+					slot, nb_srvs, srvs);
 			}
 			
 			/**
@@ -1632,7 +1977,8 @@ namespace mage {
 				U32 slot, U32 nb_samplers, 
 				ID3D11SamplerState * const *samplers) noexcept {
 					
-				device_context->PSSetSamplers(slot, nb_samplers, samplers);
+				SetSamplers(device_context, PipelineStage::PS,
+					slot, nb_samplers, samplers);
 			}
 
 			//-----------------------------------------------------------------
@@ -1672,7 +2018,7 @@ namespace mage {
 			static void BindDepthStencilState(ID3D11DeviceContext4 *device_context,
 				ID3D11DepthStencilState *state, U32 stencil_ref = 0u) noexcept {
 				
-				device_context->OMSetDepthStencilState(state, stencil_ref);
+				SetDepthStencilState(device_context, state, stencil_ref);
 			}
 
 			static void BindBlendState(ID3D11DeviceContext4 *device_context,
@@ -1686,7 +2032,7 @@ namespace mage {
 				ID3D11BlendState *state, const F32 blend_factor[4], 
 				U32 sample_mask = 0xffffffff) noexcept {
 				
-				device_context->OMSetBlendState(state, blend_factor, sample_mask);
+				SetBlendState(device_context, state, blend_factor, sample_mask);
 			}
 
 			static void BindRTVAndDSV(ID3D11DeviceContext4 *device_context,
@@ -1705,7 +2051,7 @@ namespace mage {
 				U32 nb_views, ID3D11RenderTargetView * const *rtvs, 
 				ID3D11DepthStencilView *dsv) noexcept {
 				
-				device_context->OMSetRenderTargets(nb_views, rtvs, dsv);
+				SetRTVsAndDSV(device_context, nb_views, rtvs, dsv);
 			}
 			
 			static void BindRTVAndDSVAndUAV(ID3D11DeviceContext4 *device_context,
@@ -1768,20 +2114,24 @@ namespace mage {
 				ID3D11UnorderedAccessView * const *uavs,
 				const U32 *initial_counts = nullptr) noexcept {
 				
-				device_context->OMSetRenderTargetsAndUnorderedAccessViews(
-					nb_views, rtvs, dsv, uav_slot, nb_uavs, uavs, initial_counts);
+				SetRTVsAndDSVAndUAVs(device_context, nb_views, rtvs, dsv,
+					uav_slot, nb_uavs, uavs, initial_counts);
 			}
 
 			static void ClearRTV(ID3D11DeviceContext4 *device_context,
 				ID3D11RenderTargetView *rtv) noexcept {
 				
 				static const F32 rgba[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+				Record(device_context, PipelineCommandType::ClearRTV,
+					PipelineStage::OM, 0u, rtv);
 				device_context->ClearRenderTargetView(rtv, rgba);
 			}
 
 			static void ClearRTV(ID3D11DeviceContext4 *device_context,
 				ID3D11RenderTargetView *rtv, const F32 rgba[4]) noexcept {
 
+				Record(device_context, PipelineCommandType::ClearRTV,
+					PipelineStage::OM, 0u, rtv);
 				device_context->ClearRenderTargetView(rtv, rgba);
 			}
 			
@@ -1791,6 +2141,10 @@ namespace mage {
 				ID3D11DepthStencilView *dsv, 
 				F32 depth = 1.0f, U8 stencil = 0u) noexcept {
 
+				Record(device_context, PipelineCommandType::ClearDSV,
+					PipelineStage::OM, 0u, dsv,
+					static_cast< U32 >(D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL),
+					stencil);
 				device_context->ClearDepthStencilView(
 				dsv, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, depth, stencil);
 			}
@@ -1798,6 +2152,9 @@ namespace mage {
 			static void ClearDepthOfDSV(ID3D11DeviceContext4 *device_context,
 				ID3D11DepthStencilView *dsv, F32 depth = 1.0f) noexcept {
 
+				Record(device_context, PipelineCommandType::ClearDSV,
+					PipelineStage::OM, 0u, dsv,
+					static_cast< U32 >(D3D11_CLEAR_DEPTH), 0u);
 				device_context->ClearDepthStencilView(
 				dsv, D3D11_CLEAR_DEPTH, depth, 0u);
 			}
@@ -1808,6 +2165,10 @@ namespace mage {
 				ID3D11DepthStencilView *dsv,
 				F32 depth = 0.0f, U8 stencil = 0u) noexcept {
 
+				Record(device_context, PipelineCommandType::ClearDSV,
+					PipelineStage::OM, 0u, dsv,
+					static_cast< U32 >(D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL),
+					stencil);
 				device_context->ClearDepthStencilView(
 					dsv, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, depth, stencil);
 			}
@@ -1815,6 +2176,9 @@ namespace mage {
 			static void ClearDepthOfDSV(ID3D11DeviceContext4 *device_context,
 				ID3D11DepthStencilView *dsv, F32 depth = 0.0f) noexcept {
 
+				Record(device_context, PipelineCommandType::ClearDSV,
+					PipelineStage::OM, 0u, dsv,
+					static_cast< U32 >(D3D11_CLEAR_DEPTH), 0u);
 				device_context->ClearDepthStencilView(
 					dsv, D3D11_CLEAR_DEPTH, depth, 0u);
 			}
@@ -1824,6 +2188,9 @@ namespace mage {
 			static void ClearStencilOfDSV(ID3D11DeviceContext4 *device_context, 
 				ID3D11DepthStencilView *dsv, U8 stencil = 0u) noexcept {
 
+				Record(device_context, PipelineCommandType::ClearDSV,
+					PipelineStage::OM, 0u, dsv,
+					static_cast< U32 >(D3D11_CLEAR_STENCIL), stencil);
 				device_context->ClearDepthStencilView(
 				dsv, D3D11_CLEAR_STENCIL, 0.0f, stencil);
 			}
@@ -1895,7 +2262,7 @@ namespace mage {
 				ID3D11ClassInstance * const *class_instances, 
 				U32 nb_class_instances) noexcept {
 				
-				device_context->CSSetShader(shader, 
+				SetShader(device_context, PipelineStage::CS, shader,
 					class_instances, nb_class_instances);
 			}
 			
@@ -1919,6 +2286,37 @@ namespace mage {
 				ID3D11Buffer * const buffers[1] = { buffer };
 				BindConstantBuffers(device_context, slot, 1u, buffers);
 			}
+
+			/**
+			 Binds a range of shader constants of a constant buffer to the 
+			 compute shader stage.
+			 
+			 @pre			@a device_context is not equal to @c nullptr.
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples 
+							of 16.
+			 @pre			@a nb_constants is not equal to zero and not 
+							greater than @c D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT.
+			 @param[in]		device_context
+							A pointer to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set 
+							the constant buffer to (ranges from 0 to 
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The first shader constant (of 16 bytes) of the range.
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext4 *device_context,
+				U32 slot, ID3D11Buffer *buffer, 
+				U32 first_constant, U32 nb_constants) noexcept {
+					
+				SetConstantBufferRange(device_context, PipelineStage::CS,
+					slot, buffer, first_constant, nb_constants);
+			}
 			
 			/**
 			 Binds an array of constant buffers to the compute shader stage.
@@ -1945,7 +2343,8 @@ namespace mage {
 			static void BindConstantBuffers(ID3D11DeviceContext4 *device_context,
 				U32 slot, U32 nb_buffers, ID3D11Buffer * const *buffers) noexcept {
 					
-				device_context->CSSetConstantBuffers(slot, nb_buffers, buffers);
+				SetConstantBuffers(device_context, PipelineStage::CS,
+					slot, nb_buffers, buffers);
 			}
 			
 			/**
@@ -1996,7 +2395,8 @@ namespace mage {
 				U32 slot, U32 nb_srvs, 
 				ID3D11ShaderResourceView * const *srvs) noexcept {
 					
-				device_context->CSSetShaderResources(slot, nb_srvs, srvs);
+				SetSRVs(device_context, PipelineStage::CS,
+					slot, nb_srvs, srvs);
 			}
 			
 			/**
@@ -2056,7 +2456,7 @@ namespace mage {
 				ID3D11UnorderedAccessView * const *uavs, 
 				const U32 *initial_counts = nullptr) noexcept {
 					
-				device_context->CSSetUnorderedAccessViews(slot, nb_uavs, uavs, initial_counts);
+				SetUAVs(device_context, slot, nb_uavs, uavs, initial_counts);
 			}
 			
 			/**
@@ -2106,7 +2506,8 @@ namespace mage {
 				U32 slot, U32 nb_samplers, 
 				ID3D11SamplerState * const *samplers) noexcept {
 					
-				device_context->CSSetSamplers(slot, nb_samplers, samplers);
+				SetSamplers(device_context, PipelineStage::CS,
+					slot, nb_samplers, samplers);
 			}
 
 			//-----------------------------------------------------------------
@@ -2139,6 +2540,273 @@ namespace mage {
 
 		static void OnDraw() noexcept;
 
+		//---------------------------------------------------------------------
+		// Class Member Methods: State Filtering
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the pipeline state of the given device context.
+
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @return		@c nullptr if the given device context is not
+						registered.
+		 @return		A pointer to the pipeline state of the given device
+						context.
+		 */
+		static PipelineState *GetState(
+			ID3D11DeviceContext4 *device_context) noexcept;
+
+		/**
+		 Issues the deferred binds of the pipeline state of the given device
+		 context.
+
+		 @param[in]		device_context
+						A pointer to the device context.
+		 */
+		static void FlushState(ID3D11DeviceContext4 *device_context) noexcept;
+
+		static void SetShader(ID3D11DeviceContext4 *device_context,
+			PipelineStage stage, ID3D11DeviceChild *shader,
+			ID3D11ClassInstance * const *class_instances,
+			U32 nb_class_instances) noexcept;
+
+		static void SetConstantBuffers(ID3D11DeviceContext4 *device_context,
+			PipelineStage stage, U32 slot, U32 nb_buffers,
+			ID3D11Buffer * const *buffers) noexcept;
+
+		static void SetConstantBufferRange(
+			ID3D11DeviceContext4 *device_context, PipelineStage stage, 
+			U32 slot, ID3D11Buffer *buffer, 
+			U32 first_constant, U32 nb_constants) noexcept;
+
+		static void SetSRVs(ID3D11DeviceContext4 *device_context,
+			PipelineStage stage, U32 slot, U32 nb_srvs,
+			ID3D11ShaderResourceView * const *srvs) noexcept;
+
+		static void SetSamplers(ID3D11DeviceContext4 *device_context,
+			PipelineStage stage, U32 slot, U32 nb_samplers,
+			ID3D11SamplerState * const *samplers) noexcept;
+
+		static void SetUAVs(ID3D11DeviceContext4 *device_context,
+			U32 slot, U32 nb_uavs, ID3D11UnorderedAccessView * const *uavs,
+			const U32 *initial_counts) noexcept;
+
+		static void SetIndexBuffer(ID3D11DeviceContext4 *device_context,
+			ID3D11Buffer *buffer, DXGI_FORMAT format, U32 offset) noexcept;
+
+		static void SetVertexBuffers(ID3D11DeviceContext4 *device_context,
+			U32 slot, U32 nb_buffers, ID3D11Buffer * const *buffers,
+			const U32 *strides, const U32 *offsets) noexcept;
+
+		static void SetPrimitiveTopology(ID3D11DeviceContext4 *device_context,
+			D3D11_PRIMITIVE_TOPOLOGY topology) noexcept;
+
+		static void SetInputLayout(ID3D11DeviceContext4 *device_context,
+			ID3D11InputLayout *input_layout) noexcept;
+
+		static void SetRasterizerState(ID3D11DeviceContext4 *device_context,
+			ID3D11RasterizerState *state) noexcept;
+
+		static void SetBlendState(ID3D11DeviceContext4 *device_context,
+			ID3D11BlendState *state, const F32 blend_factor[4],
+			U32 sample_mask) noexcept;
+
+		static void SetDepthStencilState(ID3D11DeviceContext4 *device_context,
+			ID3D11DepthStencilState *state, U32 stencil_ref) noexcept;
+
+		static void SetRTVsAndDSV(ID3D11DeviceContext4 *device_context,
+			U32 nb_views, ID3D11RenderTargetView * const *rtvs,
+			ID3D11DepthStencilView *dsv) noexcept;
+
+		static void SetRTVsAndDSVAndUAVs(ID3D11DeviceContext4 *device_context,
+			U32 nb_views, ID3D11RenderTargetView * const *rtvs,
+			ID3D11DepthStencilView *dsv, U32 uav_slot, U32 nb_uavs,
+			ID3D11UnorderedAccessView * const *uavs,
+			const U32 *initial_counts) noexcept;
+
+		static void IssueConstantBuffers(ID3D11DeviceContext4 *device_context,
+			PipelineStage stage, U32 slot, U32 nb_buffers,
+			const ConstantBufferBinding *bindings) noexcept;
+
+		static void IssueConstantBuffers(ID3D11DeviceContext4 *device_context,
+			PipelineStage stage, U32 slot, U32 nb_buffers,
+			ID3D11Buffer * const *buffers, const U32 *first_constants,
+			const U32 *nb_constants) noexcept;
+
+		static void IssueSRVs(ID3D11DeviceContext4 *device_context,
+			PipelineStage stage, U32 slot, U32 nb_srvs,
+			ID3D11ShaderResourceView * const *srvs) noexcept;
+
+		static void IssueSamplers(ID3D11DeviceContext4 *device_context,
+			PipelineStage stage, U32 slot, U32 nb_samplers,
+			ID3D11SamplerState * const *samplers) noexcept;
+
+		/**
+		 The pipeline states of the registered device contexts.
+		 */
+		static vector< pair< ID3D11DeviceContext4 *, 
+			UniquePtr< PipelineState > > > s_states;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods: Recording
+		//---------------------------------------------------------------------
+
+		/**
+		 Records the given pipeline command if a pipeline recorder is set.
+
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		type
+						The pipeline command type.
+		 @param[in]		stage
+						The pipeline stage.
+		 @param[in]		slot
+						The (first) slot.
+		 @param[in]		object
+						A pointer to the object.
+		 @param[in]		arg0
+						The first argument.
+		 @param[in]		arg1
+						The second argument.
+		 @param[in]		arg2
+						The third argument.
+		 @param[in]		arg3
+						The fourth argument.
+		 @param[in]		arg4
+						The fifth argument.
+		 */
+		static void Record(ID3D11DeviceContext4 *device_context,
+			PipelineCommandType type, PipelineStage stage, U32 slot,
+			const void *object, U32 arg0 = 0u, U32 arg1 = 0u, U32 arg2 = 0u,
+			U32 arg3 = 0u, U32 arg4 = 0u) noexcept {
+
+			if (!s_recorder) {
+				return;
+			}
+
+			const PipelineCommand command = {
+				type, stage, slot, 0u, nullptr, object,
+				{ arg0, arg1, arg2, arg3, arg4 }
+			};
+			s_recorder->Record(device_context, command);
+		}
+
+		/**
+		 Records the given pipeline command with an object array if a
+		 pipeline recorder is set.
+
+		 @tparam		ObjectT
+						The object type.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		type
+						The pipeline command type.
+		 @param[in]		stage
+						The pipeline stage.
+		 @param[in]		slot
+						The first slot.
+		 @param[in]		nb_objects
+						The number of objects.
+		 @param[in]		objects
+						A pointer to the object array.
+		 @param[in]		object
+						A pointer to the object.
+		 @param[in]		arg0
+						The first argument.
+		 @param[in]		arg1
+						The second argument.
+		 */
+		template< typename ObjectT >
+		static void RecordArray(ID3D11DeviceContext4 *device_context,
+			PipelineCommandType type, PipelineStage stage, U32 slot,
+			U32 nb_objects, ObjectT * const *objects,
+			const void *object = nullptr,
+			U32 arg0 = 0u, U32 arg1 = 0u) noexcept {
+
+			if (!s_recorder) {
+				return;
+			}
+
+			const PipelineCommand command = {
+				type, stage, slot, nb_objects,
+				reinterpret_cast< const void * const * >(objects), object,
+				{ arg0, arg1, 0u, 0u, 0u }
+			};
+			s_recorder->Record(device_context, command);
+		}
+
+		/**
+		 Records the binding of the given viewports if a pipeline recorder is
+		 set. The first viewport is recorded by value.
+
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		nb_viewports
+						The number of viewports.
+		 @param[in]		viewports
+						A pointer to the viewports.
+		 */
+		static void RecordViewports(ID3D11DeviceContext4 *device_context,
+			U32 nb_viewports, const D3D11_VIEWPORT *viewports) noexcept {
+
+			if (!s_recorder) {
+				return;
+			}
+
+			if (0u == nb_viewports || !viewports) {
+				Record(device_context, PipelineCommandType::BindViewports,
+					PipelineStage::RS, 0u, nullptr, nb_viewports);
+				return;
+			}
+
+			Record(device_context, PipelineCommandType::BindViewports,
+				PipelineStage::RS, 0u, nullptr, nb_viewports,
+				static_cast< U32 >(viewports->TopLeftX),
+				static_cast< U32 >(viewports->TopLeftY),
+				static_cast< U32 >(viewports->Width),
+				static_cast< U32 >(viewports->Height));
+		}
+
+		/**
+		 Records the binding of the given scissor rectangles if a pipeline
+		 recorder is set. The first scissor rectangle is recorded by value.
+
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		nb_rectangles
+						The number of scissor rectangles.
+		 @param[in]		rectangles
+						A pointer to the scissor rectangles.
+		 */
+		static void RecordScissorRectangles(
+			ID3D11DeviceContext4 *device_context,
+			U32 nb_rectangles, const D3D11_RECT *rectangles) noexcept {
+
+			if (!s_recorder) {
+				return;
+			}
+
+			if (0u == nb_rectangles || !rectangles) {
+				Record(device_context,
+					PipelineCommandType::BindScissorRectangles,
+					PipelineStage::RS, 0u, nullptr, nb_rectangles);
+				return;
+			}
+
+			Record(device_context, PipelineCommandType::BindScissorRectangles,
+				PipelineStage::RS, 0u, nullptr, nb_rectangles,
+				static_cast< U32 >(rectangles->left),
+				static_cast< U32 >(rectangles->top),
+				static_cast< U32 >(rectangles->right),
+				static_cast< U32 >(rectangles->bottom));
+		}
+
+		/**
+		 A pointer to the pipeline recorder.
+		 */
+		static PipelineRecorder *s_recorder;
+
 		//---------------------------------------------------------------------
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
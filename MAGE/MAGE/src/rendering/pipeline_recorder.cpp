@@ -0,0 +1,540 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering\pipeline_recorder.hpp"
+#include "utils\io\writer.hpp"
+#include "utils\logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// PipelineCommand
+	//-------------------------------------------------------------------------
+
+	const char *GetName(PipelineCommandType type) noexcept {
+		static const char *s_names[] = {
+			"Draw",
+			"DrawAuto",
+			"DrawInstanced",
+			"DrawIndexed",
+			"DrawIndexedInstanced",
+			"DrawInstancedIndirect",
+			"DrawIndexedInstancedIndirect",
+			"Dispatch",
+			"DispatchIndirect",
+			"Map",
+			"Unmap",
+			"UpdateSubresource",
+			"BindShader",
+			"BindConstantBuffers",
+			"BindSRVs",
+			"BindSamplers",
+			"BindUAVs",
+			"BindIndexBuffer",
+			"BindVertexBuffers",
+			"BindPrimitiveTopology",
+			"BindInputLayout",
+			"BindViewports",
+			"BindScissorRectangles",
+			"BindRasterizerState",
+			"BindBlendState",
+			"BindDepthStencilState",
+			"BindRTVsAndDSV",
+			"BindRTVsAndDSVAndUAVs",
+			"ClearRTV",
+			"ClearDSV",
+			"FinishCommandList",
+			"ExecuteCommandList"
+		};
+		static_assert(_countof(s_names)
+			== static_cast< size_t >(PipelineCommandType::Count),
+			"Pipeline command type name mismatch");
+
+		const auto index = static_cast< size_t >(type);
+		return (index < _countof(s_names)) ? s_names[index] : "Unknown";
+	}
+
+	const char *GetName(PipelineStage stage) noexcept {
+		static const char *s_names[] = {
+			"-", "IA", "VS", "HS", "DS", "GS", "RS", "PS", "OM", "CS"
+		};
+		static_assert(_countof(s_names)
+			== static_cast< size_t >(PipelineStage::Count),
+			"Pipeline stage name mismatch");
+
+		const auto index = static_cast< size_t >(stage);
+		return (index < _countof(s_names)) ? s_names[index] : "Unknown";
+	}
+
+	//-------------------------------------------------------------------------
+	// PipelineRecorder
+	//-------------------------------------------------------------------------
+
+	PipelineRecorder::PipelineRecorder() noexcept = default;
+
+	PipelineRecorder::PipelineRecorder(
+		const PipelineRecorder &recorder) noexcept = default;
+
+	PipelineRecorder::PipelineRecorder(
+		PipelineRecorder &&recorder) noexcept = default;
+
+	PipelineRecorder::~PipelineRecorder() = default;
+
+	//-------------------------------------------------------------------------
+	// NullPipelineRecorder
+	//-------------------------------------------------------------------------
+
+	NullPipelineRecorder::NullPipelineRecorder()
+		: PipelineRecorder(),
+		m_nb_commands{},
+		m_nb_errors(0),
+		m_reported{},
+		m_shaders(),
+		m_mapped_subresources() {}
+
+	NullPipelineRecorder::NullPipelineRecorder(
+		const NullPipelineRecorder &recorder) = default;
+
+	NullPipelineRecorder::NullPipelineRecorder(
+		NullPipelineRecorder &&recorder) = default;
+
+	NullPipelineRecorder::~NullPipelineRecorder() = default;
+
+	void NullPipelineRecorder::Record(ID3D11DeviceContext4 *device_context,
+		const PipelineCommand &command) noexcept {
+
+		const auto index = static_cast< size_t >(command.m_type);
+		++m_nb_commands[index];
+
+		const char * const error = Validate(device_context, command);
+		if (!error) {
+			return;
+		}
+
+		++m_nb_errors;
+
+		// Report each type of invalid pipeline command only once.
+		if (!m_reported[index]) {
+			m_reported[index] = true;
+			Warning("Invalid pipeline command %s (%s): %s.",
+				GetName(command.m_type), GetName(command.m_stage), error);
+		}
+	}
+
+	size_t NullPipelineRecorder::GetNumberOfCommands() const noexcept {
+		size_t nb_commands = 0;
+		for (const auto nb : m_nb_commands) {
+			nb_commands += nb;
+		}
+		return nb_commands;
+	}
+
+	void NullPipelineRecorder::Reset() noexcept {
+		m_nb_commands.fill(0);
+		m_nb_errors = 0;
+		m_reported.fill(false);
+		m_shaders.clear();
+		m_mapped_subresources.clear();
+	}
+
+	NullPipelineRecorder::ShaderArray &NullPipelineRecorder::GetShaders(
+		const ID3D11DeviceContext4 *device_context) {
+
+		for (auto &[context, shaders] : m_shaders) {
+			if (context == device_context) {
+				return shaders;
+			}
+		}
+
+		m_shaders.emplace_back(device_context, ShaderArray{});
+		return m_shaders.back().second;
+	}
+
+	const char *NullPipelineRecorder::Validate(
+		const ID3D11DeviceContext4 *device_context,
+		const PipelineCommand &command) noexcept {
+
+		if (0 != command.m_nb_objects && !command.m_objects) {
+			return "no objects for a non-zero number of objects";
+		}
+
+		const auto within = [&command](U32 nb_slots) noexcept {
+			return command.m_slot <= nb_slots
+				&& command.m_nb_objects <= nb_slots - command.m_slot;
+		};
+
+		switch (command.m_type) {
+
+		case PipelineCommandType::Draw:
+		case PipelineCommandType::DrawAuto:
+		case PipelineCommandType::DrawInstanced:
+		case PipelineCommandType::DrawIndexed:
+		case PipelineCommandType::DrawIndexedInstanced:
+		case PipelineCommandType::DrawInstancedIndirect:
+		case PipelineCommandType::DrawIndexedInstancedIndirect: {
+			if (!GetShaders(device_context)[
+				static_cast< size_t >(PipelineStage::VS)]) {
+				return "no vertex shader bound";
+			}
+			return nullptr;
+		}
+
+		case PipelineCommandType::Dispatch:
+		case PipelineCommandType::DispatchIndirect: {
+			if (!GetShaders(device_context)[
+				static_cast< size_t >(PipelineStage::CS)]) {
+				return "no compute shader bound";
+			}
+			return nullptr;
+		}
+
+		case PipelineCommandType::Map: {
+			if (!command.m_object) {
+				return "no resource";
+			}
+
+			const pair< const void *, U32 > subresource(
+				command.m_object, command.m_slot);
+			if (std::find(m_mapped_subresources.cbegin(),
+				          m_mapped_subresources.cend(), subresource)
+				!= m_mapped_subresources.cend()) {
+				return "subresource is already mapped";
+			}
+
+			m_mapped_subresources.push_back(subresource);
+			return nullptr;
+		}
+
+		case PipelineCommandType::Unmap: {
+			if (!command.m_object) {
+				return "no resource";
+			}
+
+			const pair< const void *, U32 > subresource(
+				command.m_object, command.m_slot);
+			const auto it = std::find(m_mapped_subresources.cbegin(),
+				                      m_mapped_subresources.cend(), subresource);
+			if (m_mapped_subresources.cend() == it) {
+				return "subresource is not mapped";
+			}
+
+			m_mapped_subresources.erase(it);
+			return nullptr;
+		}
+
+		case PipelineCommandType::UpdateSubresource: {
+			return (command.m_object) ? nullptr : "no resource";
+		}
+
+		case PipelineCommandType::BindShader: {
+			GetShaders(device_context)[static_cast< size_t >(command.m_stage)]
+				= command.m_object;
+			return nullptr;
+		}
+
+		case PipelineCommandType::BindConstantBuffers: {
+			return within(D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT)
+				? nullptr : "constant buffer slots out of range";
+		}
+
+		case PipelineCommandType::BindSRVs: {
+			return within(D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT)
+				? nullptr : "shader resource view slots out of range";
+		}
+
+		case PipelineCommandType::BindSamplers: {
+			return within(D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT)
+				? nullptr : "sampler slots out of range";
+		}
+
+		case PipelineCommandType::BindUAVs: {
+			return within(D3D11_1_UAV_SLOT_COUNT)
+				? nullptr : "unordered access view slots out of range";
+		}
+
+		case PipelineCommandType::BindVertexBuffers: {
+			return within(D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT)
+				? nullptr : "vertex buffer slots out of range";
+		}
+
+		case PipelineCommandType::BindViewports:
+		case PipelineCommandType::BindScissorRectangles: {
+			// m_args[0]: the number of viewports or scissor rectangles.
+			return (command.m_args[0]
+				    <= D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE)
+				? nullptr : "too many viewports or scissor rectangles";
+		}
+
+		case PipelineCommandType::BindRTVsAndDSV: {
+			return within(D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT)
+				? nullptr : "render target view slots out of range";
+		}
+
+		case PipelineCommandType::BindRTVsAndDSVAndUAVs: {
+			if (!within(D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT)) {
+				return "render target view slots out of range";
+			}
+			// m_args[0]: the start slot of the unordered access views.
+			// m_args[1]: the number of unordered access views.
+			if (0u != command.m_args[1]
+				&& D3D11_KEEP_UNORDERED_ACCESS_VIEWS != command.m_args[1]
+				&& (command.m_args[0] < command.m_nb_objects
+				    || D3D11_1_UAV_SLOT_COUNT
+				       < command.m_args[0] + command.m_args[1])) {
+				return "unordered access view slots out of range";
+			}
+			return nullptr;
+		}
+
+		case PipelineCommandType::ClearRTV:
+		case PipelineCommandType::ClearDSV: {
+			return (command.m_object) ? nullptr : "no view";
+		}
+
+		case PipelineCommandType::FinishCommandList: {
+			// m_args[0]: whether the state of the device context is restored.
+			if (!command.m_args[0]) {
+				GetShaders(device_context).fill(nullptr);
+			}
+			return nullptr;
+		}
+
+		case PipelineCommandType::ExecuteCommandList: {
+			if (!command.m_object) {
+				return "no command list";
+			}
+			// m_args[0]: whether the state of the device context is restored.
+			if (!command.m_args[0]) {
+				GetShaders(device_context).fill(nullptr);
+			}
+			return nullptr;
+		}
+
+		default: {
+			return nullptr;
+		}
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// StreamPipelineRecorder
+	//-------------------------------------------------------------------------
+
+	namespace {
+
+		/**
+		 A class of writers for writing recorded pipeline commands.
+		 */
+		class PipelineCommandWriter final : private Writer {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			/**
+			 Constructs a pipeline command writer.
+
+			 @param[in]		commands
+							A reference to the recorded pipeline commands.
+			 @param[in]		objects
+							A reference to the object identifiers.
+			 */
+			explicit PipelineCommandWriter(
+				const vector< RecordedPipelineCommand > &commands,
+				const vector< U32 > &objects)
+				: Writer(),
+				m_commands(commands),
+				m_objects(objects) {}
+
+			/**
+			 Constructs a pipeline command writer from the given pipeline
+			 command writer.
+
+			 @param[in]		writer
+							A reference to the pipeline command writer to
+							copy.
+			 */
+			PipelineCommandWriter(
+				const PipelineCommandWriter &writer) = delete;
+
+			/**
+			 Constructs a pipeline command writer by moving the given
+			 pipeline command writer.
+
+			 @param[in]		writer
+							A reference to the pipeline command writer to
+							move.
+			 */
+			PipelineCommandWriter(PipelineCommandWriter &&writer) = delete;
+
+			/**
+			 Destructs this pipeline command writer.
+			 */
+			virtual ~PipelineCommandWriter() = default;
+
+			//-----------------------------------------------------------------
+			// Assignment Operators
+			//-----------------------------------------------------------------
+
+			/**
+			 Copies the given pipeline command writer to this pipeline
+			 command writer.
+
+			 @param[in]		writer
+							A reference to the pipeline command writer to
+							copy.
+			 @return		A reference to the copy of the given pipeline
+							command writer (i.e. this pipeline command
+							writer).
+			 */
+			PipelineCommandWriter &operator=(
+				const PipelineCommandWriter &writer) = delete;
+
+			/**
+			 Moves the given pipeline command writer to this pipeline command
+			 writer.
+
+			 @param[in]		writer
+							A reference to the pipeline command writer to
+							move.
+			 @return		A reference to the moved pipeline command writer
+							(i.e. this pipeline command writer).
+			 */
+			PipelineCommandWriter &operator=(
+				PipelineCommandWriter &&writer) = delete;
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			using Writer::WriteToFile;
+
+		private:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Starts writing.
+
+			 @throws		FormattedException
+							Failed to write.
+			 */
+			virtual void Write() override {
+				char output[MAX_PATH];
+
+				for (const auto &command : m_commands) {
+					const U32 * const ids = &m_objects[command.m_first_object];
+
+					// Type, stage, slot, object and arguments.
+					sprintf_s(output, _countof(output),
+						"%s %s %u #%u %u %u %u %u %u",
+						GetName(command.m_type), GetName(command.m_stage),
+						command.m_slot, ids[0],
+						command.m_args[0], command.m_args[1],
+						command.m_args[2], command.m_args[3],
+						command.m_args[4]);
+					WriteString(output);
+
+					// Object array.
+					for (U16 i = 1; i <= command.m_nb_objects; ++i) {
+						sprintf_s(output, _countof(output), " #%u", ids[i]);
+						WriteString(output);
+					}
+
+					WriteStringLine("");
+				}
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 A reference to the recorded pipeline commands of this pipeline
+			 command writer.
+			 */
+			const vector< RecordedPipelineCommand > &m_commands;
+
+			/**
+			 A reference to the object identifiers of this pipeline command
+			 writer.
+			 */
+			const vector< U32 > &m_objects;
+		};
+	}
+
+	StreamPipelineRecorder::StreamPipelineRecorder()
+		: PipelineRecorder(),
+		m_commands(),
+		m_objects(),
+		m_object_ids() {}
+
+	StreamPipelineRecorder::StreamPipelineRecorder(
+		const StreamPipelineRecorder &recorder) = default;
+
+	StreamPipelineRecorder::StreamPipelineRecorder(
+		StreamPipelineRecorder &&recorder) = default;
+
+	StreamPipelineRecorder::~StreamPipelineRecorder() = default;
+
+	void StreamPipelineRecorder::Record(
+		[[maybe_unused]] ID3D11DeviceContext4 *device_context,
+		const PipelineCommand &command) noexcept {
+
+		RecordedPipelineCommand recorded;
+		recorded.m_type         = command.m_type;
+		recorded.m_stage        = command.m_stage;
+		recorded.m_nb_objects   = static_cast< U16 >(command.m_nb_objects);
+		recorded.m_slot         = command.m_slot;
+		recorded.m_first_object = static_cast< U32 >(m_objects.size());
+		std::copy(std::cbegin(command.m_args), std::cend(command.m_args),
+			      std::begin(recorded.m_args));
+
+		m_objects.push_back(GetObjectId(command.m_object));
+		for (U16 i = 0; i < recorded.m_nb_objects; ++i) {
+			m_objects.push_back(GetObjectId(command.m_objects[i]));
+		}
+
+		m_commands.push_back(recorded);
+	}
+
+	void StreamPipelineRecorder::Clear() noexcept {
+		m_commands.clear();
+		m_objects.clear();
+	}
+
+	void StreamPipelineRecorder::ExportToFile(const wstring &fname) const {
+		PipelineCommandWriter writer(m_commands, m_objects);
+		writer.WriteToFile(fname);
+	}
+
+	U32 StreamPipelineRecorder::GetObjectId(const void *object) {
+		if (!object) {
+			return 0u;
+		}
+
+		// Identifiers are assigned in order of first reference.
+		const auto next_id = static_cast< U32 >(m_object_ids.size() + 1);
+		return m_object_ids.try_emplace(object, next_id).first->second;
+	}
+}
\ No newline at end of file
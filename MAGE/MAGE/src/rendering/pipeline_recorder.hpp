@@ -0,0 +1,654 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "utils\type\types.hpp"
+#include "utils\collection\collection.hpp"
+#include "rendering\rendering.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// PipelineCommand
+	//-------------------------------------------------------------------------
+
+	/**
+	 An enumeration of the different pipeline command types.
+	 */
+	enum struct PipelineCommandType : U8 {
+		Draw = 0,
+		DrawAuto,
+		DrawInstanced,
+		DrawIndexed,
+		DrawIndexedInstanced,
+		DrawInstancedIndirect,
+		DrawIndexedInstancedIndirect,
+		Dispatch,
+		DispatchIndirect,
+		Map,
+		Unmap,
+		UpdateSubresource,
+		BindShader,
+		BindConstantBuffers,
+		BindSRVs,
+		BindSamplers,
+		BindUAVs,
+		BindIndexBuffer,
+		BindVertexBuffers,
+		BindPrimitiveTopology,
+		BindInputLayout,
+		BindViewports,
+		BindScissorRectangles,
+		BindRasterizerState,
+		BindBlendState,
+		BindDepthStencilState,
+		BindRTVsAndDSV,
+		BindRTVsAndDSVAndUAVs,
+		ClearRTV,
+		ClearDSV,
+		FinishCommandList,
+		ExecuteCommandList,
+		Count
+	};
+
+	/**
+	 An enumeration of the different pipeline stages of pipeline commands.
+	 */
+	enum struct PipelineStage : U8 {
+		None = 0,
+		IA,
+		VS,
+		HS,
+		DS,
+		GS,
+		RS,
+		PS,
+		OM,
+		CS,
+		Count
+	};
+
+	/**
+	 Returns the name of the given pipeline command type.
+
+	 @param[in]		type
+					The pipeline command type.
+	 @return		The name of the given pipeline command type.
+	 */
+	const char *GetName(PipelineCommandType type) noexcept;
+
+	/**
+	 Returns the name of the given pipeline stage.
+
+	 @param[in]		stage
+					The pipeline stage.
+	 @return		The name of the given pipeline stage.
+	 */
+	const char *GetName(PipelineStage stage) noexcept;
+
+	/**
+	 A struct of pipeline commands (i.e. calls to the device context issued
+	 through the pipeline).
+	 */
+	struct PipelineCommand final {
+
+	public:
+
+		/**
+		 The type of this pipeline command.
+		 */
+		PipelineCommandType m_type;
+
+		/**
+		 The pipeline stage of this pipeline command.
+		 */
+		PipelineStage m_stage;
+
+		/**
+		 The (first) slot of this pipeline command.
+		 */
+		U32 m_slot;
+
+		/**
+		 The number of objects in the object array of this pipeline command.
+		 */
+		U32 m_nb_objects;
+
+		/**
+		 A pointer to the object array (e.g. buffers, shader resource views,
+		 samplers or render target views) of this pipeline command. This
+		 array is only valid while recording this pipeline command.
+		 */
+		const void * const *m_objects;
+
+		/**
+		 A pointer to the object (e.g. shader, state, resource or depth
+		 stencil view) of this pipeline command.
+		 */
+		const void *m_object;
+
+		/**
+		 The (type-dependent) arguments of this pipeline command.
+		 */
+		U32 m_args[5];
+	};
+
+	//-------------------------------------------------------------------------
+	// PipelineRecorder
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of pipeline recorders.
+
+	 A pipeline recorder is notified of each pipeline command before that
+	 pipeline command is executed on its device context. Combined with a
+	 device without rendering capabilities (see @c EngineSetup), pipeline
+	 recorders allow the CPU side of the rendering to run headless.
+	 */
+	class PipelineRecorder {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Destructs this pipeline recorder.
+		 */
+		virtual ~PipelineRecorder();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given pipeline recorder to this pipeline recorder.
+
+		 @param[in]		recorder
+						A reference to the pipeline recorder to copy.
+		 @return		A reference to the copy of the given pipeline recorder
+						(i.e. this pipeline recorder).
+		 */
+		PipelineRecorder &operator=(const PipelineRecorder &recorder) = delete;
+
+		/**
+		 Moves the given pipeline recorder to this pipeline recorder.
+
+		 @param[in]		recorder
+						A reference to the pipeline recorder to move.
+		 @return		A reference to the moved pipeline recorder (i.e. this
+						pipeline recorder).
+		 */
+		PipelineRecorder &operator=(PipelineRecorder &&recorder) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Records the given pipeline command.
+
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		command
+						A reference to the pipeline command.
+		 */
+		virtual void Record(ID3D11DeviceContext4 *device_context,
+			const PipelineCommand &command) noexcept = 0;
+
+	protected:
+
+		//---------------------------------------------------------------------
+		// Constructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a pipeline recorder.
+		 */
+		PipelineRecorder() noexcept;
+
+		/**
+		 Constructs a pipeline recorder from the given pipeline recorder.
+
+		 @param[in]		recorder
+						A reference to the pipeline recorder to copy.
+		 */
+		PipelineRecorder(const PipelineRecorder &recorder) noexcept;
+
+		/**
+		 Constructs a pipeline recorder by moving the given pipeline recorder.
+
+		 @param[in]		recorder
+						A reference to the pipeline recorder to move.
+		 */
+		PipelineRecorder(PipelineRecorder &&recorder) noexcept;
+	};
+
+	//-------------------------------------------------------------------------
+	// NullPipelineRecorder
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of null pipeline recorders which count and validate pipeline
+	 commands without storing them.
+	 */
+	class NullPipelineRecorder final : public PipelineRecorder {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Type Declarations and Definitions
+		//---------------------------------------------------------------------
+
+		/**
+		 The type of the bound shaders per pipeline stage of null pipeline 
+		 recorders.
+		 */
+		using ShaderArray 
+			= array< const void *, static_cast< size_t >(PipelineStage::Count) >;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a null pipeline recorder.
+		 */
+		NullPipelineRecorder();
+
+		/**
+		 Constructs a null pipeline recorder from the given null pipeline
+		 recorder.
+
+		 @param[in]		recorder
+						A reference to the null pipeline recorder to copy.
+		 */
+		NullPipelineRecorder(const NullPipelineRecorder &recorder);
+
+		/**
+		 Constructs a null pipeline recorder by moving the given null pipeline
+		 recorder.
+
+		 @param[in]		recorder
+						A reference to the null pipeline recorder to move.
+		 */
+		NullPipelineRecorder(NullPipelineRecorder &&recorder);
+
+		/**
+		 Destructs this null pipeline recorder.
+		 */
+		virtual ~NullPipelineRecorder();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given null pipeline recorder to this null pipeline
+		 recorder.
+
+		 @param[in]		recorder
+						A reference to the null pipeline recorder to copy.
+		 @return		A reference to the copy of the given null pipeline
+						recorder (i.e. this null pipeline recorder).
+		 */
+		NullPipelineRecorder &operator=(
+			const NullPipelineRecorder &recorder) = delete;
+
+		/**
+		 Moves the given null pipeline recorder to this null pipeline
+		 recorder.
+
+		 @param[in]		recorder
+						A reference to the null pipeline recorder to move.
+		 @return		A reference to the moved null pipeline recorder (i.e.
+						this null pipeline recorder).
+		 */
+		NullPipelineRecorder &operator=(
+			NullPipelineRecorder &&recorder) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Records the given pipeline command.
+
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		command
+						A reference to the pipeline command.
+		 */
+		virtual void Record(ID3D11DeviceContext4 *device_context,
+			const PipelineCommand &command) noexcept override;
+
+		/**
+		 Returns the number of recorded pipeline commands of this null
+		 pipeline recorder.
+
+		 @return		The number of recorded pipeline commands of this null
+						pipeline recorder.
+		 */
+		size_t GetNumberOfCommands() const noexcept;
+
+		/**
+		 Returns the number of recorded pipeline commands of the given type of
+		 this null pipeline recorder.
+
+		 @param[in]		type
+						The pipeline command type.
+		 @return		The number of recorded pipeline commands of the given
+						type of this null pipeline recorder.
+		 */
+		size_t GetNumberOfCommands(PipelineCommandType type) const noexcept {
+			return m_nb_commands[static_cast< size_t >(type)];
+		}
+
+		/**
+		 Returns the number of invalid pipeline commands of this null pipeline
+		 recorder.
+
+		 @return		The number of invalid pipeline commands of this null
+						pipeline recorder.
+		 */
+		size_t GetNumberOfErrors() const noexcept {
+			return m_nb_errors;
+		}
+
+		/**
+		 Resets the counters and the tracked state of this null pipeline
+		 recorder.
+		 */
+		void Reset() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the bound shaders per pipeline stage of the given device 
+		 context of this null pipeline recorder.
+
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @return		A reference to the bound shaders per pipeline stage of 
+						the given device context of this null pipeline 
+						recorder.
+		 */
+		ShaderArray &GetShaders(const ID3D11DeviceContext4 *device_context);
+
+		/**
+		 Validates the given pipeline command against the limits of the
+		 device context and the tracked state of this null pipeline recorder.
+
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		command
+						A reference to the pipeline command.
+		 @return		@c nullptr if the given pipeline command is valid.
+		 @return		A description of the error otherwise.
+		 */
+		const char *Validate(const ID3D11DeviceContext4 *device_context,
+			const PipelineCommand &command) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of recorded pipeline commands per pipeline command type
+		 of this null pipeline recorder.
+		 */
+		array< size_t, static_cast< size_t >(PipelineCommandType::Count) >
+			m_nb_commands;
+
+		/**
+		 The number of invalid pipeline commands of this null pipeline
+		 recorder.
+		 */
+		size_t m_nb_errors;
+
+		/**
+		 Flags indicating per pipeline command type whether an invalid
+		 pipeline command of that type has already been reported by this null
+		 pipeline recorder.
+		 */
+		array< bool, static_cast< size_t >(PipelineCommandType::Count) >
+			m_reported;
+
+		/**
+		 The bound shaders per pipeline stage of each device context of this 
+		 null pipeline recorder.
+		 */
+		vector< pair< const ID3D11DeviceContext4 *, ShaderArray > > 
+			m_shaders;
+
+		/**
+		 The mapped subresources (resource and subresource index) of this null
+		 pipeline recorder.
+		 */
+		vector< pair< const void *, U32 > > m_mapped_subresources;
+	};
+
+	//-------------------------------------------------------------------------
+	// StreamPipelineRecorder
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of recorded pipeline commands.
+	 */
+	struct RecordedPipelineCommand final {
+
+	public:
+
+		/**
+		 The type of this recorded pipeline command.
+		 */
+		PipelineCommandType m_type;
+
+		/**
+		 The pipeline stage of this recorded pipeline command.
+		 */
+		PipelineStage m_stage;
+
+		/**
+		 The number of objects in the object array of this recorded pipeline
+		 command.
+		 */
+		U16 m_nb_objects;
+
+		/**
+		 The (first) slot of this recorded pipeline command.
+		 */
+		U32 m_slot;
+
+		/**
+		 The index of the object identifier of this recorded pipeline command
+		 in the object identifiers of the stream pipeline recorder. The object
+		 identifiers of the object array immediately follow.
+		 */
+		U32 m_first_object;
+
+		/**
+		 The (type-dependent) arguments of this recorded pipeline command.
+		 */
+		U32 m_args[5];
+	};
+
+	static_assert(32 == sizeof(RecordedPipelineCommand),
+		"Recorded pipeline command layout mismatch");
+
+	/**
+	 A class of stream pipeline recorders which capture a compact stream of
+	 pipeline commands.
+
+	 Objects are identified by the order in which they are first referenced
+	 (@c 0 denotes @c nullptr), so that the streams of different runs can be
+	 compared.
+	 */
+	class StreamPipelineRecorder final : public PipelineRecorder {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a stream pipeline recorder.
+		 */
+		StreamPipelineRecorder();
+
+		/**
+		 Constructs a stream pipeline recorder from the given stream pipeline
+		 recorder.
+
+		 @param[in]		recorder
+						A reference to the stream pipeline recorder to copy.
+		 */
+		StreamPipelineRecorder(const StreamPipelineRecorder &recorder);
+
+		/**
+		 Constructs a stream pipeline recorder by moving the given stream
+		 pipeline recorder.
+
+		 @param[in]		recorder
+						A reference to the stream pipeline recorder to move.
+		 */
+		StreamPipelineRecorder(StreamPipelineRecorder &&recorder);
+
+		/**
+		 Destructs this stream pipeline recorder.
+		 */
+		virtual ~StreamPipelineRecorder();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given stream pipeline recorder to this stream pipeline
+		 recorder.
+
+		 @param[in]		recorder
+						A reference to the stream pipeline recorder to copy.
+		 @return		A reference to the copy of the given stream pipeline
+						recorder (i.e. this stream pipeline recorder).
+		 */
+		StreamPipelineRecorder &operator=(
+			const StreamPipelineRecorder &recorder) = delete;
+
+		/**
+		 Moves the given stream pipeline recorder to this stream pipeline
+		 recorder.
+
+		 @param[in]		recorder
+						A reference to the stream pipeline recorder to move.
+		 @return		A reference to the moved stream pipeline recorder (i.e.
+						this stream pipeline recorder).
+		 */
+		StreamPipelineRecorder &operator=(
+			StreamPipelineRecorder &&recorder) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Records the given pipeline command.
+
+		 @param[in]		device_context
+						A pointer to the device context.
+		 @param[in]		command
+						A reference to the pipeline command.
+		 */
+		virtual void Record(ID3D11DeviceContext4 *device_context,
+			const PipelineCommand &command) noexcept override;
+
+		/**
+		 Returns the recorded pipeline commands of this stream pipeline
+		 recorder.
+
+		 @return		A reference to the recorded pipeline commands of this
+						stream pipeline recorder.
+		 */
+		const vector< RecordedPipelineCommand > &GetCommands() const noexcept {
+			return m_commands;
+		}
+
+		/**
+		 Returns the object identifiers of this stream pipeline recorder.
+
+		 @return		A reference to the object identifiers of this stream
+						pipeline recorder.
+		 */
+		const vector< U32 > &GetObjects() const noexcept {
+			return m_objects;
+		}
+
+		/**
+		 Removes all recorded pipeline commands from this stream pipeline
+		 recorder. The object identifiers are preserved.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Exports the recorded pipeline commands of this stream pipeline
+		 recorder to the given file (one pipeline command per line).
+
+		 @param[in]		fname
+						A reference to the filename.
+		 @throws		FormattedException
+						Failed to export the recorded pipeline commands.
+		 */
+		void ExportToFile(const wstring &fname) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the identifier of the given object of this stream pipeline
+		 recorder.
+
+		 @param[in]		object
+						A pointer to the object.
+		 @return		The identifier of the given object of this stream
+						pipeline recorder.
+		 */
+		U32 GetObjectId(const void *object);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The recorded pipeline commands of this stream pipeline recorder.
+		 */
+		vector< RecordedPipelineCommand > m_commands;
+
+		/**
+		 The object identifiers referenced by the recorded pipeline commands
+		 of this stream pipeline recorder.
+		 */
+		vector< U32 > m_objects;
+
+		/**
+		 The object identifier map of this stream pipeline recorder.
+		 */
+		unordered_map< const void *, U32 > m_object_ids;
+	};
+}
\ No newline at end of file
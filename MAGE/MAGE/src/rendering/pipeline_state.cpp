@@ -0,0 +1,105 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering\pipeline_state.hpp"
+#include "utils\memory\memory.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	PipelineState::PipelineState()
+		: m_om_outputs(),
+		m_cs_outputs{},
+		m_nb_cs_outputs(0u) {
+
+		Invalidate();
+	}
+
+	void PipelineState::Invalidate() noexcept {
+		for (auto &stage : m_stages) {
+			stage.m_shader = GetUnknownObject< ID3D11DeviceChild >();
+			stage.m_cbs.Invalidate();
+			stage.m_srvs.Invalidate();
+			stage.m_srv_resources.fill(nullptr);
+			stage.m_samplers.Invalidate();
+		}
+
+		m_input_layout       = GetUnknownObject< ID3D11InputLayout >();
+		m_primitive_topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+		m_index_buffer       = GetUnknownObject< ID3D11Buffer >();
+		m_index_format       = DXGI_FORMAT_UNKNOWN;
+		m_index_offset       = 0u;
+		m_vertex_buffers.fill(GetUnknownObject< ID3D11Buffer >());
+		m_strides.fill(0u);
+		m_offsets.fill(0u);
+
+		m_rasterizer_state    = GetUnknownObject< ID3D11RasterizerState >();
+
+		m_blend_state         = GetUnknownObject< ID3D11BlendState >();
+		m_blend_factor[0]     = 1.0f;
+		m_blend_factor[1]     = 1.0f;
+		m_blend_factor[2]     = 1.0f;
+		m_blend_factor[3]     = 1.0f;
+		m_sample_mask         = 0xFFFFFFFF;
+		m_depth_stencil_state = GetUnknownObject< ID3D11DepthStencilState >();
+		m_stencil_ref         = 0u;
+
+		// The outputs are preserved: they are only used to conservatively 
+		// unbind shader resource views.
+	}
+
+	bool PipelineState::IsOutput(
+		const ID3D11Resource *resource) const noexcept {
+
+		if (!resource) {
+			return false;
+		}
+
+		const auto cs_outputs_end = m_cs_outputs.cbegin() + m_nb_cs_outputs;
+		return std::find(m_om_outputs.cbegin(), m_om_outputs.cend(),
+			             resource) != m_om_outputs.cend()
+			|| std::find(m_cs_outputs.cbegin(), cs_outputs_end,
+				         resource) != cs_outputs_end;
+	}
+
+	void PipelineState::UnbindOutputSRVs() noexcept {
+		if (!HasOutputs()) {
+			return;
+		}
+
+		for (auto &stage : m_stages) {
+			auto &srvs      = stage.m_srvs;
+			auto &resources = stage.m_srv_resources;
+
+			for (U32 i = 0u; i < srvs.m_nb_used; ++i) {
+				ID3D11ShaderResourceView * const srv = srvs.m_bound[i];
+				if (!srv || GetUnknownObject< ID3D11ShaderResourceView >() == srv) {
+					continue;
+				}
+
+				// The device context unbinds the SRV as well.
+				if (IsOutput(resources[i])) {
+					srvs.m_bound[i]   = nullptr;
+					srvs.m_pending[i] = nullptr;
+					resources[i]      = nullptr;
+				}
+			}
+		}
+	}
+
+	const ID3D11Resource *GetResource(ID3D11View *view) noexcept {
+		if (!view) {
+			return nullptr;
+		}
+
+		ComPtr< ID3D11Resource > resource;
+		view->GetResource(resource.GetAddressOf());
+		return resource.Get();
+	}
+}
\ No newline at end of file
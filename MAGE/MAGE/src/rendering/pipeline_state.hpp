@@ -0,0 +1,542 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering\pipeline_recorder.hpp"
+#include "utils\logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <type_traits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 Returns the placeholder object denoting an unknown bound object (e.g.
+	 after the state of a device context is modified outside the pipeline).
+
+	 @tparam		ObjectT
+					The object type.
+	 @return		A pointer to the placeholder object denoting an unknown
+					bound object. This pointer may not be dereferenced.
+	 */
+	template< typename ObjectT >
+	inline ObjectT *GetUnknownObject() noexcept {
+		return reinterpret_cast< ObjectT * >(~static_cast< uintptr_t >(0u));
+	}
+
+	//-------------------------------------------------------------------------
+	// ConstantBufferBinding
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of constant buffer bindings (i.e. a constant buffer and the
+	 range of shader constants to bind).
+	 */
+	struct ConstantBufferBinding final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the constant buffer binding denoting an unknown bound
+		 constant buffer.
+
+		 @return		The constant buffer binding denoting an unknown bound
+						constant buffer.
+		 */
+		static ConstantBufferBinding GetUnknown() noexcept {
+			return { GetUnknownObject< ID3D11Buffer >(), 0u, 0u };
+		}
+
+		//---------------------------------------------------------------------
+		// Operators
+		//---------------------------------------------------------------------
+
+		bool operator==(const ConstantBufferBinding &binding) const noexcept {
+			return m_buffer         == binding.m_buffer
+				&& m_first_constant == binding.m_first_constant
+				&& m_nb_constants   == binding.m_nb_constants;
+		}
+
+		bool operator!=(const ConstantBufferBinding &binding) const noexcept {
+			return !(*this == binding);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this constant buffer binding binds a range of shader
+		 constants instead of the complete constant buffer.
+
+		 @return		@c true if this constant buffer binding binds a range
+						of shader constants. @c false otherwise.
+		 */
+		bool IsRange() const noexcept {
+			return 0u != m_nb_constants;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the constant buffer of this constant buffer binding.
+		 */
+		ID3D11Buffer *m_buffer;
+
+		/**
+		 The first shader constant (of 16 bytes) of this constant buffer
+		 binding.
+		 */
+		U32 m_first_constant;
+
+		/**
+		 The number of shader constants of this constant buffer binding.
+		 Zero denotes the complete constant buffer.
+		 */
+		U32 m_nb_constants;
+	};
+
+	/**
+	 Returns the value denoting an unknown bound value (e.g. after the state
+	 of a device context is modified outside the pipeline).
+
+	 @tparam		ValueT
+					The value type (i.e. an object pointer type or a type
+					providing a static @c GetUnknown method).
+	 @return		The value denoting an unknown bound value.
+	 */
+	template< typename ValueT >
+	inline ValueT GetUnknownValue() noexcept {
+		if constexpr (std::is_pointer_v< ValueT >) {
+			return GetUnknownObject< std::remove_pointer_t< ValueT > >();
+		}
+		else {
+			return ValueT::GetUnknown();
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// PipelineSlotState
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of pipeline slot states (i.e. shadow copies of an array of
+	 slots of some pipeline stage).
+
+	 Slot updates are deferred until the pipeline slot state is flushed, so
+	 that redundant updates are dropped and contiguous updates are batched.
+
+	 @tparam		ValueT
+					The value type (e.g. an object pointer type).
+	 @tparam		NbSlotsV
+					The number of slots.
+	 */
+	template< typename ValueT, size_t NbSlotsV >
+	struct PipelineSlotState final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Invalidates this pipeline slot state. All bound objects become
+		 unknown and all pending updates are dropped.
+		 */
+		void Invalidate() noexcept {
+			m_bound.fill(GetUnknownValue< ValueT >());
+			m_pending.fill(GetUnknownValue< ValueT >());
+			m_dirty_begin = static_cast< U32 >(NbSlotsV);
+			m_dirty_end   = 0u;
+			m_nb_used     = 0u;
+		}
+
+		/**
+		 Sets the given values as pending values of this pipeline slot state.
+
+		 @pre			@a slot + @a nb_objects is not greater than
+						@a NbSlotsV.
+		 @param[in]		slot
+						The first slot.
+		 @param[in]		nb_objects
+						The number of values.
+		 @param[in]		objects
+						A pointer to the values.
+		 */
+		void Set(U32 slot, U32 nb_objects,
+			const ValueT *objects) noexcept {
+
+			Assert(slot + nb_objects <= NbSlotsV);
+
+			if (0u == nb_objects) {
+				return;
+			}
+
+			const U32 end = slot + nb_objects;
+			std::copy(objects, objects + nb_objects, &m_pending[slot]);
+			m_dirty_begin = std::min(m_dirty_begin, slot);
+			m_dirty_end   = std::max(m_dirty_end,   end);
+			m_nb_used     = std::max(m_nb_used,     end);
+		}
+
+		/**
+		 Flushes the pending values of this pipeline slot state.
+
+		 Each maximal run of changed slots results in one call of the given
+		 function. Unchanged slots in between changed slots are included in a
+		 run as long as the values bound to these slots are known.
+
+		 @tparam		IssueT
+						The function type.
+		 @param[in]		issue
+						The function issuing the given values to the given
+						slots of the device context (i.e.
+						<tt>void(U32 slot, U32 nb_objects,
+						const ValueT *objects)</tt>).
+		 @return		The number of issued calls.
+		 */
+		template< typename IssueT >
+		U32 Flush(IssueT issue) noexcept {
+			U32 nb_calls = 0u;
+
+			U32 i = m_dirty_begin;
+			while (i < m_dirty_end) {
+				// Find the first changed slot of the next run.
+				if (m_pending[i] == m_bound[i]) {
+					++i;
+					continue;
+				}
+
+				// Find the last changed slot of the next run.
+				const U32 first = i;
+				U32 last = i;
+				for (++i; i < m_dirty_end
+					      && GetUnknownValue< ValueT >() != m_pending[i]; ++i) {
+
+					if (m_pending[i] != m_bound[i]) {
+						last = i;
+					}
+				}
+
+				// The bound values are updated before issuing, so that the
+				// given function can still adjust them afterwards.
+				const U32 nb_objects = last + 1u - first;
+				std::copy(&m_pending[first], &m_pending[first] + nb_objects,
+					      &m_bound[first]);
+				issue(first, nb_objects, &m_pending[first]);
+				++nb_calls;
+
+				i = last + 1u;
+			}
+
+			m_dirty_begin = static_cast< U32 >(NbSlotsV);
+			m_dirty_end   = 0u;
+
+			return nb_calls;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The values bound to the device context of this pipeline slot state.
+		 */
+		array< ValueT, NbSlotsV > m_bound;
+
+		/**
+		 The pending values of this pipeline slot state.
+		 */
+		array< ValueT, NbSlotsV > m_pending;
+
+		/**
+		 The first slot with pending updates of this pipeline slot state.
+		 */
+		U32 m_dirty_begin;
+
+		/**
+		 The end slot (exclusive) with pending updates of this pipeline slot
+		 state.
+		 */
+		U32 m_dirty_end;
+
+		/**
+		 The end slot (exclusive) of all slots ever updated since the last
+		 invalidation of this pipeline slot state.
+		 */
+		U32 m_nb_used;
+	};
+
+	//-------------------------------------------------------------------------
+	// PipelineState
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of pipeline states (i.e. shadow copies of the state bound to a
+	 device context).
+
+	 A pipeline state mirrors the hazard tracking of the device context:
+	 binding a resource as output unbinds all shader resource views of that
+	 resource, and binding a shader resource view of a resource which is
+	 bound as output binds no shader resource view. Resources are compared
+	 conservatively (i.e. ignoring subresources and read-only views).
+	 */
+	struct PipelineState final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Type Declarations and Definitions
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of shader stage states.
+		 */
+		struct StageState final {
+
+		public:
+
+			/**
+			 A pointer to the shader of this shader stage state.
+			 */
+			ID3D11DeviceChild *m_shader;
+
+			/**
+			 The constant buffers of this shader stage state.
+			 */
+			PipelineSlotState< ConstantBufferBinding,
+				D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT > m_cbs;
+
+			/**
+			 The shader resource views of this shader stage state.
+			 */
+			PipelineSlotState< ID3D11ShaderResourceView *,
+				D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT > m_srvs;
+
+			/**
+			 The resources of the bound shader resource views of this shader 
+			 stage state. The resources are obtained once when the shader 
+			 resource views are bound, instead of each time the outputs 
+			 change.
+			 */
+			array< const ID3D11Resource *,
+				D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT > m_srv_resources;
+
+			/**
+			 The samplers of this shader stage state.
+			 */
+			PipelineSlotState< ID3D11SamplerState *,
+				D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT > m_samplers;
+		};
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a pipeline state.
+		 */
+		PipelineState();
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Invalidates this pipeline state. All bound state becomes unknown and
+		 all pending updates are dropped. The tracked outputs are preserved.
+		 */
+		void Invalidate() noexcept;
+
+		/**
+		 Returns the shader stage state of the given pipeline stage of this
+		 pipeline state.
+
+		 @param[in]		stage
+						The pipeline stage.
+		 @return		A reference to the shader stage state of the given
+						pipeline stage of this pipeline state.
+		 */
+		StageState &GetStageState(PipelineStage stage) noexcept {
+			return m_stages[static_cast< size_t >(stage)];
+		}
+
+		/**
+		 Checks whether resources are bound as output to the device context
+		 of this pipeline state.
+
+		 @return		@c true if resources are bound as output to the device
+						context of this pipeline state. @c false otherwise.
+		 */
+		bool HasOutputs() const noexcept {
+			return !m_om_outputs.empty() || 0u != m_nb_cs_outputs;
+		}
+
+		/**
+		 Checks whether the given resource is bound as output to the device
+		 context of this pipeline state.
+
+		 @param[in]		resource
+						A pointer to the resource.
+		 @return		@c true if the given resource is bound as output to
+						the device context of this pipeline state. @c false
+						otherwise.
+		 */
+		bool IsOutput(const ID3D11Resource *resource) const noexcept;
+
+		/**
+		 Unbinds all shader resource views of the resources which are bound
+		 as output to the device context of this pipeline state.
+		 */
+		void UnbindOutputSRVs() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Shader Stages
+		//---------------------------------------------------------------------
+
+		/**
+		 The shader stage states of this pipeline state.
+		 */
+		array< StageState, static_cast< size_t >(PipelineStage::Count) >
+			m_stages;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Input Assembler Stage
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the input layout of this pipeline state.
+		 */
+		ID3D11InputLayout *m_input_layout;
+
+		/**
+		 The primitive topology of this pipeline state.
+		 */
+		D3D11_PRIMITIVE_TOPOLOGY m_primitive_topology;
+
+		/**
+		 A pointer to the index buffer of this pipeline state.
+		 */
+		ID3D11Buffer *m_index_buffer;
+
+		/**
+		 The format of the index buffer of this pipeline state.
+		 */
+		DXGI_FORMAT m_index_format;
+
+		/**
+		 The offset of the index buffer of this pipeline state.
+		 */
+		U32 m_index_offset;
+
+		/**
+		 The vertex buffers of this pipeline state.
+		 */
+		array< ID3D11Buffer *,
+			D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT > m_vertex_buffers;
+
+		/**
+		 The strides of the vertex buffers of this pipeline state.
+		 */
+		array< U32, D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT > m_strides;
+
+		/**
+		 The offsets of the vertex buffers of this pipeline state.
+		 */
+		array< U32, D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT > m_offsets;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Rasterizer Stage
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the rasterizer state of this pipeline state.
+		 */
+		ID3D11RasterizerState *m_rasterizer_state;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Output Merger Stage
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the blend state of this pipeline state.
+		 */
+		ID3D11BlendState *m_blend_state;
+
+		/**
+		 The blend factor of this pipeline state.
+		 */
+		F32 m_blend_factor[4];
+
+		/**
+		 The sample mask of this pipeline state.
+		 */
+		U32 m_sample_mask;
+
+		/**
+		 A pointer to the depth-stencil state of this pipeline state.
+		 */
+		ID3D11DepthStencilState *m_depth_stencil_state;
+
+		/**
+		 The stencil reference value of this pipeline state.
+		 */
+		U32 m_stencil_ref;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Outputs
+		//---------------------------------------------------------------------
+
+		/**
+		 The resources bound as output to the output merger stage (i.e. as
+		 render target, depth-stencil or unordered access views) of this
+		 pipeline state.
+		 */
+		vector< const ID3D11Resource * > m_om_outputs;
+
+		/**
+		 The resources bound as output to the compute shader stage (i.e. as
+		 unordered access views) of this pipeline state.
+		 */
+		array< const ID3D11Resource *, D3D11_1_UAV_SLOT_COUNT > m_cs_outputs;
+
+		/**
+		 The end slot (exclusive) of all slots ever bound as output to the
+		 compute shader stage of this pipeline state.
+		 */
+		U32 m_nb_cs_outputs;
+	};
+
+	/**
+	 Returns the resource of the given view.
+
+	 @param[in]		view
+					A pointer to the view.
+	 @return		@c nullptr if @a view is equal to @c nullptr.
+	 @return		A pointer to the resource of the given view. No reference
+					is held to the returned resource.
+	 */
+	const ID3D11Resource *GetResource(ID3D11View *view) noexcept;
+}
\ No newline at end of file
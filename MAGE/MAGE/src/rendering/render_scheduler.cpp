@@ -0,0 +1,282 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering\rendering_manager.hpp"
+#include "utils\logging\error.hpp"
+#include "utils\exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// RenderWorker
+	//-------------------------------------------------------------------------
+
+	/**
+	 Creates a deferred device context.
+
+	 @pre			@a device is not equal to @c nullptr.
+	 @param[in]		device
+					A pointer to the device.
+	 @return		A pointer to the deferred device context.
+	 @throws		FormattedException
+					Failed to create the deferred device context.
+	 */
+	[[nodiscard]] inline ComPtr< ID3D11DeviceContext4 >
+		CreateDeferredDeviceContext(ID3D11Device5 *device) {
+
+		Assert(device);
+
+		ComPtr< ID3D11DeviceContext3 > device_context3;
+		{
+			const HRESULT result = device->CreateDeferredContext3(0u,
+				device_context3.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result,
+				"Deferred device context creation failed: %08X.", result);
+		}
+
+		ComPtr< ID3D11DeviceContext4 > device_context;
+		{
+			const HRESULT result = device_context3.As(&device_context);
+			ThrowIfFailed(result,
+				"ID3D11DeviceContext4 creation failed: %08X.", result);
+		}
+
+		return device_context;
+	}
+
+	RenderWorker::RenderWorker(ID3D11Device5 *device)
+		: m_device_context(CreateDeferredDeviceContext(device)),
+		m_deferred(true),
+		m_constant_buffer_ring(device,
+			g_render_worker_constant_buffer_ring_size),
+		m_depth_pass(MakeUnique< DepthPass >(
+			m_device_context.Get(), &m_constant_buffer_ring)),
+		m_gbuffer_pass(MakeUnique< GBufferPass >(
+			m_device_context.Get(), &m_constant_buffer_ring)) {
+
+		// Shadow the state bound to the deferred device context.
+		Pipeline::RegisterDeviceContext(m_device_context.Get());
+	}
+
+	RenderWorker::RenderWorker(ID3D11Device5 *device,
+		ID3D11DeviceContext4 *device_context)
+		: m_device_context(device_context),
+		m_deferred(false),
+		m_constant_buffer_ring(device,
+			g_render_worker_constant_buffer_ring_size),
+		m_depth_pass(MakeUnique< DepthPass >(
+			m_device_context.Get(), &m_constant_buffer_ring)),
+		m_gbuffer_pass(MakeUnique< GBufferPass >(
+			m_device_context.Get(), &m_constant_buffer_ring)) {
+
+		Assert(m_device_context);
+	}
+
+	RenderWorker::~RenderWorker() {
+		if (m_deferred) {
+			Pipeline::UnregisterDeviceContext(m_device_context.Get());
+		}
+	}
+
+	void RenderWorker::Begin() noexcept {
+		if (!m_deferred) {
+			return;
+		}
+
+		// The first map of each command list discards the buffer resource.
+		m_constant_buffer_ring.Discard();
+		// Bind the persistent samplers.
+		RenderingStateManager::Get()->BindPersistentState(
+			m_device_context.Get());
+	}
+
+	HRESULT RenderWorker::Finish(ID3D11CommandList **command_list) noexcept {
+		Assert(m_deferred);
+
+		// Reset the deferred device context to its default state.
+		return Pipeline::FinishCommandList(m_device_context.Get(),
+			false, command_list);
+	}
+
+	void RenderWorker::EndFrame(
+		ID3D11DeviceContext4 *device_context) noexcept {
+
+		// The constant buffer rings of deferred render workers are discarded
+		// at the beginning of each command list instead.
+		if (!m_deferred) {
+			m_constant_buffer_ring.EndFrame(device_context);
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// RenderScheduler
+	//-------------------------------------------------------------------------
+
+	void RenderScheduler::Partition(size_t nb_items, size_t nb_workers,
+		size_t min_batch_size, vector< RenderBatch > &batches) {
+
+		batches.clear();
+
+		if (0u == nb_items || 0u == nb_workers) {
+			return;
+		}
+
+		const size_t batch_size = std::max< size_t >(min_batch_size, 1u);
+		const size_t nb_batches 
+			= std::clamp< size_t >(nb_items / batch_size, 1u, nb_workers);
+
+		for (size_t i = 0u; i < nb_batches; ++i) {
+			batches.push_back({
+				 i       * nb_items / nb_batches,
+				(i + 1u) * nb_items / nb_batches
+			});
+		}
+	}
+
+	RenderScheduler::RenderScheduler(ID3D11Device5 *device,
+		ID3D11DeviceContext4 *device_context, size_t nb_workers)
+		: m_device_context(device_context),
+		m_immediate_worker(MakeUnique< RenderWorker >(device, device_context)),
+		m_workers(),
+		m_thread_pool(),
+		m_batches(),
+		m_command_lists(),
+		m_exceptions() {
+
+		Assert(m_device_context);
+
+		for (size_t i = 0u; i < nb_workers; ++i) {
+			try {
+				m_workers.push_back(MakeUnique< RenderWorker >(device));
+			}
+			catch (const FormattedException &e) {
+				Warning("Render worker creation failed: %s", e.what());
+				break;
+			}
+		}
+
+		if (1u < m_workers.size()) {
+			m_thread_pool = MakeUnique< ThreadPool >(m_workers.size() - 1u);
+		}
+	}
+
+	RenderScheduler::~RenderScheduler() = default;
+
+	void RenderScheduler::RecordBatch(size_t index,
+		const RecordFunction &record,
+		std::exception_ptr &exception) noexcept {
+
+		RenderWorker &worker = *m_workers[index];
+		const RenderBatch &batch = m_batches[index];
+
+		try {
+			worker.Begin();
+			record(worker, batch.m_begin, batch.m_end);
+		}
+		catch (...) {
+			exception = std::current_exception();
+		}
+
+		// Always finish the command list to reset the deferred device
+		// context.
+		const HRESULT result
+			= worker.Finish(m_command_lists[index].ReleaseAndGetAddressOf());
+		if (FAILED(result) && !exception) {
+			exception = std::make_exception_ptr(FormattedException(
+				"Command list finishing failed: %08X.", result));
+		}
+	}
+
+	void RenderScheduler::Record(size_t nb_items, size_t min_batch_size,
+		const RecordFunction &record) {
+
+		// Without deferred render workers, all items are recorded as a 
+		// single render batch on the immediate device context.
+		Partition(nb_items, std::max< size_t >(m_workers.size(), 1u),
+			min_batch_size, m_batches);
+
+		if (m_batches.size() <= 1u) {
+			// Record directly on the immediate device context.
+			if (!m_batches.empty()) {
+				record(*m_immediate_worker,
+					m_batches[0].m_begin, m_batches[0].m_end);
+			}
+			return;
+		}
+
+		const size_t nb_batches = m_batches.size();
+		m_command_lists.resize(nb_batches);
+		m_exceptions.assign(nb_batches, nullptr);
+
+		if (Pipeline::GetRecorder()) {
+			// Pipeline recorders are not thread-safe.
+			for (size_t i = 0u; i < nb_batches; ++i) {
+				RecordBatch(i, record, m_exceptions[i]);
+			}
+		}
+		else {
+			std::mutex mutex;
+			std::condition_variable condition;
+			size_t nb_pending = nb_batches - 1u;
+
+			for (size_t i = 1u; i < nb_batches; ++i) {
+				m_thread_pool->Enqueue(
+					[this, i, &record,
+					 &mutex, &condition, &nb_pending]() noexcept {
+
+					RecordBatch(i, record, m_exceptions[i]);
+
+					// Notify while holding the lock, since the condition
+					// variable is destructed once all batches are recorded.
+					const std::lock_guard< std::mutex > lock(mutex);
+					--nb_pending;
+					condition.notify_one();
+				});
+			}
+
+			// Record the first render batch on the calling thread.
+			RecordBatch(0u, record, m_exceptions[0]);
+
+			std::unique_lock< std::mutex > lock(mutex);
+			condition.wait(lock, [&nb_pending]() noexcept {
+				return 0u == nb_pending;
+			});
+		}
+
+		for (const auto &exception : m_exceptions) {
+			if (exception) {
+				std::rethrow_exception(exception);
+			}
+		}
+
+		// Execute the command lists in the order of the render batches. The
+		// state of the immediate device context is restored afterwards.
+		for (auto &command_list : m_command_lists) {
+			Pipeline::ExecuteCommandList(m_device_context,
+				command_list.Get(), true);
+			command_list.Reset();
+		}
+	}
+
+	void RenderScheduler::EndFrame() noexcept {
+		m_immediate_worker->EndFrame(m_device_context);
+	}
+}
\ No newline at end of file
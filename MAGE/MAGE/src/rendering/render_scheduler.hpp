@@ -0,0 +1,492 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering\pass\depth_pass.hpp"
+#include "rendering\pass\gbuffer_pass.hpp"
+#include "rendering\buffer\constant_buffer_ring.hpp"
+#include "utils\parallel\thread_pool.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <exception>
+#include <functional>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The maximum number of render workers of render schedulers.
+	 */
+	constexpr size_t g_render_scheduler_max_nb_workers = 8;
+
+	/**
+	 The initial size in bytes of the constant buffer rings of render
+	 workers.
+	 */
+	constexpr size_t g_render_worker_constant_buffer_ring_size = 1u << 20u;
+
+	//-------------------------------------------------------------------------
+	// RenderBatch
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of render batches (i.e. ranges of independent items which are
+	 recorded by a single render worker).
+	 */
+	struct RenderBatch final {
+
+	public:
+
+		/**
+		 The index of the first item of this render batch.
+		 */
+		size_t m_begin;
+
+		/**
+		 The index past the last item of this render batch.
+		 */
+		size_t m_end;
+	};
+
+	//-------------------------------------------------------------------------
+	// RenderWorker
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of render workers (for recording commands on their own device
+	 context).
+
+	 A deferred render worker records on its own deferred device context
+	 which is registered with the pipeline, and finishes the recorded
+	 commands into a command list. An immediate render worker records
+	 directly on the immediate device context. Each render worker has its
+	 own constant buffer ring and render passes, so that render workers can
+	 record concurrently.
+	 */
+	class RenderWorker final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a deferred render worker.
+
+		 @pre			@a device is not equal to @c nullptr.
+		 @pre			The renderer associated with the current engine must be
+						loaded.
+		 @pre			The resource manager associated with the current engine
+						must be loaded.
+		 @param[in]		device
+						A pointer to the device.
+		 @throws		FormattedException
+						Failed to setup this render worker.
+		 */
+		explicit RenderWorker(ID3D11Device5 *device);
+
+		/**
+		 Constructs an immediate render worker.
+
+		 @pre			@a device is not equal to @c nullptr.
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			The renderer associated with the current engine must be
+						loaded.
+		 @pre			The resource manager associated with the current engine
+						must be loaded.
+		 @param[in]		device
+						A pointer to the device.
+		 @param[in]		device_context
+						A pointer to the immediate device context.
+		 @throws		FormattedException
+						Failed to setup this render worker.
+		 */
+		explicit RenderWorker(ID3D11Device5 *device,
+			ID3D11DeviceContext4 *device_context);
+
+		/**
+		 Constructs a render worker from the given render worker.
+
+		 @param[in]		worker
+						A reference to the render worker to copy.
+		 */
+		RenderWorker(const RenderWorker &worker) = delete;
+
+		/**
+		 Constructs a render worker by moving the given render worker.
+
+		 @param[in]		worker
+						A reference to the render worker to move.
+		 */
+		RenderWorker(RenderWorker &&worker) = delete;
+
+		/**
+		 Destructs this render worker.
+		 */
+		~RenderWorker();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given render worker to this render worker.
+
+		 @param[in]		worker
+						A reference to the render worker to copy.
+		 @return		A reference to the copy of the given render worker
+						(i.e. this render worker).
+		 */
+		RenderWorker &operator=(const RenderWorker &worker) = delete;
+
+		/**
+		 Moves the given render worker to this render worker.
+
+		 @param[in]		worker
+						A reference to the render worker to move.
+		 @return		A reference to the moved render worker (i.e. this
+						render worker).
+		 */
+		RenderWorker &operator=(RenderWorker &&worker) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this render worker records on a deferred device
+		 context.
+
+		 @return		@c true if this render worker records on a deferred
+						device context. @c false otherwise.
+		 */
+		bool IsDeferred() const noexcept {
+			return m_deferred;
+		}
+
+		/**
+		 Returns the device context of this render worker.
+
+		 @return		A pointer to the device context of this render worker.
+		 */
+		ID3D11DeviceContext4 *GetDeviceContext() const noexcept {
+			return m_device_context.Get();
+		}
+
+		/**
+		 Returns the depth pass of this render worker.
+
+		 @return		A pointer to the depth pass of this render worker.
+		 */
+		DepthPass *GetDepthPass() const noexcept {
+			return m_depth_pass.get();
+		}
+
+		/**
+		 Returns the GBuffer pass of this render worker.
+
+		 @return		A pointer to the GBuffer pass of this render worker.
+		 */
+		GBufferPass *GetGBufferPass() const noexcept {
+			return m_gbuffer_pass.get();
+		}
+
+		/**
+		 Begins recording a command list on this render worker.
+
+		 The state of a deferred device context is not inherited from the
+		 immediate device context: the constant buffer ring is discarded and
+		 the persistent state is bound again.
+		 */
+		void Begin() noexcept;
+
+		/**
+		 Finishes the command list recorded on this render worker.
+
+		 @pre			This render worker is deferred.
+		 @param[out]	command_list
+						A pointer to a pointer to the command list.
+		 @return		A success/error value.
+		 */
+		HRESULT Finish(ID3D11CommandList **command_list) noexcept;
+
+		/**
+		 Ends the current frame of this render worker.
+
+		 @param[in]		device_context
+						A pointer to the immediate device context.
+		 */
+		void EndFrame(ID3D11DeviceContext4 *device_context) noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the device context of this render worker.
+		 */
+		ComPtr< ID3D11DeviceContext4 > m_device_context;
+
+		/**
+		 A flag indicating whether this render worker records on a deferred
+		 device context.
+		 */
+		bool m_deferred;
+
+		/**
+		 The constant buffer ring of this render worker.
+		 */
+		ConstantBufferRing m_constant_buffer_ring;
+
+		/**
+		 A pointer to the depth pass of this render worker.
+		 */
+		UniquePtr< DepthPass > m_depth_pass;
+
+		/**
+		 A pointer to the GBuffer pass of this render worker.
+		 */
+		UniquePtr< GBufferPass > m_gbuffer_pass;
+	};
+
+	//-------------------------------------------------------------------------
+	// RenderScheduler
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of render schedulers (for recording independent items of a
+	 render pass on multiple threads).
+
+	 The items are partitioned into contiguous render batches. Each render
+	 batch is recorded into a command list by its own deferred render worker,
+	 and the command lists are executed on the immediate device context in
+	 the order of the render batches. If a pipeline recorder is set, the
+	 render batches are recorded sequentially, so that the recorded pipeline
+	 commands are deterministic.
+	 */
+	class RenderScheduler final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Type Declarations and Definitions
+		//---------------------------------------------------------------------
+
+		/**
+		 The record function type of render schedulers (i.e. a function
+		 recording the items in the range [begin, end) on a given render
+		 worker).
+		 */
+		using RecordFunction
+			= std::function< void(RenderWorker &, size_t, size_t) >;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Partitions the given number of items into contiguous render batches.
+
+		 @param[in]		nb_items
+						The number of items.
+		 @param[in]		nb_workers
+						The maximum number of render batches.
+		 @param[in]		min_batch_size
+						The minimum number of items per render batch.
+		 @param[out]	batches
+						A reference to a vector containing the render batches.
+		 */
+		static void Partition(size_t nb_items, size_t nb_workers,
+			size_t min_batch_size, vector< RenderBatch > &batches);
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a render scheduler.
+
+		 If not all deferred device contexts can be created, the render
+		 scheduler continues with fewer render workers.
+
+		 @pre			@a device is not equal to @c nullptr.
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @pre			The renderer associated with the current engine must be
+						loaded.
+		 @pre			The resource manager associated with the current engine
+						must be loaded.
+		 @param[in]		device
+						A pointer to the device.
+		 @param[in]		device_context
+						A pointer to the immediate device context.
+		 @param[in]		nb_workers
+						The maximum number of deferred render workers.
+		 @throws		FormattedException
+						Failed to setup this render scheduler.
+		 */
+		explicit RenderScheduler(ID3D11Device5 *device,
+			ID3D11DeviceContext4 *device_context, size_t nb_workers);
+
+		/**
+		 Constructs a render scheduler from the given render scheduler.
+
+		 @param[in]		scheduler
+						A reference to the render scheduler to copy.
+		 */
+		RenderScheduler(const RenderScheduler &scheduler) = delete;
+
+		/**
+		 Constructs a render scheduler by moving the given render scheduler.
+
+		 @param[in]		scheduler
+						A reference to the render scheduler to move.
+		 */
+		RenderScheduler(RenderScheduler &&scheduler) = delete;
+
+		/**
+		 Destructs this render scheduler.
+		 */
+		~RenderScheduler();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given render scheduler to this render scheduler.
+
+		 @param[in]		scheduler
+						A reference to the render scheduler to copy.
+		 @return		A reference to the copy of the given render scheduler
+						(i.e. this render scheduler).
+		 */
+		RenderScheduler &operator=(const RenderScheduler &scheduler) = delete;
+
+		/**
+		 Moves the given render scheduler to this render scheduler.
+
+		 @param[in]		scheduler
+						A reference to the render scheduler to move.
+		 @return		A reference to the moved render scheduler (i.e. this
+						render scheduler).
+		 */
+		RenderScheduler &operator=(RenderScheduler &&scheduler) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of deferred render workers of this render
+		 scheduler.
+
+		 @return		The number of deferred render workers of this render
+						scheduler.
+		 */
+		size_t GetNumberOfWorkers() const noexcept {
+			return m_workers.size();
+		}
+
+		/**
+		 Records the given number of items.
+
+		 If the items fit in a single render batch or this render scheduler 
+		 has no deferred render workers, the items are recorded directly on 
+		 the immediate device context.
+
+		 @param[in]		nb_items
+						The number of items.
+		 @param[in]		min_batch_size
+						The minimum number of items per render batch.
+		 @param[in]		record
+						A reference to the record function.
+		 @throws		FormattedException
+						Failed to record the items.
+		 */
+		void Record(size_t nb_items, size_t min_batch_size,
+			const RecordFunction &record);
+
+		/**
+		 Ends the current frame of this render scheduler.
+		 */
+		void EndFrame() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Records the given render batch on its deferred render worker.
+
+		 @param[in]		index
+						The index of the render batch.
+		 @param[in]		record
+						A reference to the record function.
+		 @param[out]	exception
+						A reference to the exception thrown while recording
+						the render batch.
+		 */
+		void RecordBatch(size_t index, const RecordFunction &record,
+			std::exception_ptr &exception) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the immediate device context of this render scheduler.
+		 */
+		ID3D11DeviceContext4 * const m_device_context;
+
+		/**
+		 A pointer to the immediate render worker of this render scheduler.
+		 */
+		UniquePtr< RenderWorker > m_immediate_worker;
+
+		/**
+		 A vector containing the deferred render workers of this render
+		 scheduler.
+		 */
+		vector< UniquePtr< RenderWorker > > m_workers;
+
+		/**
+		 A pointer to the thread pool of this render scheduler. The calling
+		 thread records the first render batch itself.
+		 */
+		UniquePtr< ThreadPool > m_thread_pool;
+
+		/**
+		 A vector containing the render batches of this render scheduler.
+		 */
+		vector< RenderBatch > m_batches;
+
+		/**
+		 A vector containing the command lists of this render scheduler.
+		 */
+		vector< ComPtr< ID3D11CommandList > > m_command_lists;
+
+		/**
+		 A vector containing the exceptions thrown while recording the render 
+		 batches of this render scheduler.
+		 */
+		vector< std::exception_ptr > m_exceptions;
+	};
+}
\ No newline at end of file
@@ -5,12 +5,22 @@
 
 #include "rendering\rendering_manager.hpp"
 #include "utils\logging\error.hpp"
+#include "utils\parallel\parallel.hpp"
 
 // Include HLSL bindings.
 #include "..\..\shaders\hlsl.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -30,6 +40,9 @@ namespace mage {
 		m_pass_buffer(MakeUnique< PassBuffer >()),
 		m_game_buffer(device),
 		m_camera_buffer(device),
+		m_model_instance_buffer(device, 64),
+		m_constant_buffer_ring(device),
+		m_render_scheduler(),
 		m_aa_pass(),
 		m_back_buffer_pass(),
 		m_bounding_volume_pass(),
@@ -75,6 +88,16 @@ namespace mage {
 			m_device_context, SLOT_CBUFFER_GAME);
 	}
 
+	RenderScheduler *Renderer::GetRenderScheduler() {
+		if (!m_render_scheduler) {
+			const size_t nb_workers = std::min(NumberOfSystemCores(),
+				g_render_scheduler_max_nb_workers);
+			m_render_scheduler = MakeUnique< RenderScheduler >(
+				Pipeline::GetDevice(), m_device_context, nb_workers);
+		}
+		return m_render_scheduler.get();
+	}
+
 	void Renderer::BindCameraBuffer(
 		const Camera *camera,
 		const Viewport &viewport,
@@ -115,6 +138,28 @@ namespace mage {
 			m_device_context, SLOT_CBUFFER_PRIMARY_CAMERA);
 	}
 
+	void Renderer::BindCameraState(
+		ID3D11DeviceContext4 *device_context) const noexcept {
+
+		// Bind the game buffer.
+		m_game_buffer.Bind< Pipeline >(
+			device_context, SLOT_CBUFFER_GAME);
+		// Bind the camera buffer.
+		m_camera_buffer.Bind< Pipeline >(
+			device_context, SLOT_CBUFFER_PRIMARY_CAMERA);
+		// Bind the model instance buffer.
+		m_model_instance_buffer.Bind< Pipeline::VS >(
+			device_context, SLOT_SRV_MODEL_INSTANCES);
+	}
+
+	void Renderer::BeginFrame(MemoryArena *memory_arena) {
+		m_pass_buffer->Rebind(memory_arena);
+
+		if (m_lbuffer_pass) {
+			m_lbuffer_pass->Rebind(memory_arena);
+		}
+	}
+
 	void Renderer::Render(const Scene *scene) {
 
 		const RenderingOutputManager * const output_manager
@@ -144,6 +189,16 @@ namespace mage {
 			BindCameraBuffer(camera, viewport, ss_viewport, 
 				view_to_projection, projection_to_view, 
 				world_to_view, view_to_world);
+
+			// Cull the models once for all passes of the camera.
+			m_pass_buffer->UpdateVisibleModels(
+				world_to_projection, world_to_view, view_to_world);
+
+			// Bind the model instance buffer.
+			m_model_instance_buffer.UpdateData(m_device_context, 
+				m_pass_buffer->GetModelInstances());
+			m_model_instance_buffer.Bind< Pipeline::VS >(
+				m_device_context, SLOT_SRV_MODEL_INSTANCES);
 			
 			// RenderMode
 			switch (render_mode) {
@@ -183,9 +238,7 @@ namespace mage {
 
 				VariableComponentPass * const pass = GetVariableComponentPass();
 				pass->BindFixedState(render_mode);
-				pass->Render(
-					m_pass_buffer.get(), world_to_projection, 
-					world_to_view, view_to_world);
+				pass->Render(m_pass_buffer.get());
 				
 				break;
 			}
@@ -199,9 +252,7 @@ namespace mage {
 
 				ConstantComponentPass * const pass = GetConstantComponentPass();
 				pass->BindFixedState(render_mode);
-				pass->Render(
-					m_pass_buffer.get(), world_to_projection, 
-					world_to_view, view_to_world);
+				pass->Render(m_pass_buffer.get());
 				
 				break;
 			}
@@ -215,9 +266,7 @@ namespace mage {
 
 				ShadingNormalPass * const pass = GetShadingNormalPass();
 				pass->BindFixedState(render_mode);
-				pass->Render(
-					m_pass_buffer.get(), world_to_projection, 
-					world_to_view);
+				pass->Render(m_pass_buffer.get());
 				
 				break;
 			}
@@ -236,9 +285,7 @@ namespace mage {
 			if (settings->HasRenderLayer(RenderLayer::Wireframe)) {
 				WireframePass * const pass = GetWireframePass();
 				pass->BindFixedState();
-				pass->Render(
-					m_pass_buffer.get(), world_to_projection, 
-					world_to_view);
+				pass->Render(m_pass_buffer.get());
 			}
 			if (settings->HasRenderLayer(RenderLayer::AABB)) {
 				BoundingVolumePass * const pass = GetBoundingVolumePass();
@@ -277,6 +324,12 @@ namespace mage {
 		SpritePass * const sprite_pass = GetSpritePass();
 		sprite_pass->BindFixedState();
 		sprite_pass->Render(m_pass_buffer.get());
+
+		// Release the constant buffer ranges once the GPU completed them.
+		m_constant_buffer_ring.EndFrame(m_device_context);
+		if (m_render_scheduler) {
+			m_render_scheduler->EndFrame();
+		}
 	}
 
 	void Renderer::ExecuteSolidForwardPipeline(
@@ -301,9 +354,7 @@ namespace mage {
 		// Perform a forward pass.
 		ConstantShadingPass * const forward_pass = GetConstantShadingPass();
 		forward_pass->BindFixedState();
-		forward_pass->Render(
-			m_pass_buffer.get(), world_to_projection,
-			world_to_view, view_to_world);
+		forward_pass->Render(m_pass_buffer.get());
 	}
 
 	void Renderer::ExecuteForwardPipeline(
@@ -329,9 +380,7 @@ namespace mage {
 		// Perform a forward pass.
 		VariableShadingPass * const forward_pass = GetVariableShadingPass();
 		forward_pass->BindFixedState(brdf);
-		forward_pass->Render(
-			m_pass_buffer.get(), world_to_projection,
-			world_to_view, view_to_world);
+		forward_pass->Render(m_pass_buffer.get());
 
 		// Perform a sky pass.
 		SkyPass * const sky_pass = GetSkyPass();
@@ -341,9 +390,7 @@ namespace mage {
 
 		// Perform a forward pass: transparent models.
 		forward_pass->BindFixedState(brdf);
-		forward_pass->RenderTransparent(
-			m_pass_buffer.get(), world_to_projection,
-			world_to_view, view_to_world);
+		forward_pass->RenderTransparent(m_pass_buffer.get());
 	}
 
 	void Renderer::ExecuteDeferredPipeline(
@@ -366,12 +413,32 @@ namespace mage {
 
 		output_manager->BindBeginGBuffer(m_device_context);
 
-		// Perform a GBuffer pass.
-		GBufferPass * const gbuffer_pass = GetGBufferPass();
-		gbuffer_pass->BindFixedState();
-		gbuffer_pass->Render(
-			m_pass_buffer.get(), world_to_projection,
-			world_to_view, view_to_world);
+		// Perform a GBuffer pass. The opaque draw list is partitioned into 
+		// render batches.
+		const size_t nb_groups 
+			= m_pass_buffer->GetVisibleOpaqueBRDFInstanceGroups().size()
+			+ m_pass_buffer->GetVisibleTransparentBRDFInstanceGroups().size();
+		
+		GetRenderScheduler()->Record(nb_groups, 
+			MAGE_DEFAULT_GBUFFER_BATCH_SIZE,
+			[this, &viewport, output_manager](
+				RenderWorker &worker, size_t begin, size_t end) {
+
+			ID3D11DeviceContext4 * const device_context 
+				= worker.GetDeviceContext();
+			
+			if (worker.IsDeferred()) {
+				// Bind the state bound earlier to the immediate device 
+				// context.
+				BindCameraState(device_context);
+				viewport.BindViewport(device_context);
+				output_manager->BindBeginGBuffer(device_context);
+			}
+
+			GBufferPass * const pass = worker.GetGBufferPass();
+			pass->BindFixedState();
+			pass->Render(m_pass_buffer.get(), begin, end);
+		});
 
 		output_manager->BindEndGBuffer(m_device_context);
 		output_manager->BindBeginDeferred(m_device_context);
@@ -393,9 +460,7 @@ namespace mage {
 		// Perform a forward pass: emissive models.
 		VariableShadingPass * const forward_pass = GetVariableShadingPass();
 		forward_pass->BindFixedState(brdf);
-		forward_pass->RenderEmissive(
-			m_pass_buffer.get(), world_to_projection,
-			world_to_view, view_to_world);
+		forward_pass->RenderEmissive(m_pass_buffer.get());
 
 		// Perform a sky pass.
 		SkyPass * const sky_pass = GetSkyPass();
@@ -405,9 +470,7 @@ namespace mage {
 
 		// Perform a forward pass: transparent models.
 		forward_pass->BindFixedState(brdf);
-		forward_pass->RenderTransparent(
-			m_pass_buffer.get(), world_to_projection,
-			world_to_view, view_to_world);
+		forward_pass->RenderTransparent(m_pass_buffer.get());
 	}
 
 	void Renderer::ExecuteAAPipeline(
@@ -24,6 +24,9 @@
 
 #include "rendering\buffer\game_buffer.hpp"
 #include "rendering\buffer\camera_buffer.hpp"
+#include "rendering\buffer\structured_buffer.hpp"
+#include "rendering\buffer\constant_buffer_ring.hpp"
+#include "rendering\render_scheduler.hpp"
 
 #pragma endregion
 
@@ -132,6 +135,17 @@ namespace mage {
 		 */
 		void BindPersistentState();
 
+		/**
+		 Begins a frame of this renderer. The per-frame data of this renderer 
+		 is rebound to the given memory arena.
+
+		 @param[in]		memory_arena
+						A pointer to the memory arena of the current frame.
+		 @throws		std::bad_alloc
+						Failed to allocate the memory block.
+		 */
+		void BeginFrame(MemoryArena *memory_arena);
+
 		/**
 		 Renders the given scene.
 
@@ -143,6 +157,32 @@ namespace mage {
 		 */
 		void Render(const Scene *scene);
 
+		/**
+		 Returns the constant buffer ring of this renderer.
+
+		 The constant buffer ring contains the per-draw data of the render 
+		 passes of this renderer.
+
+		 @return		A reference to the constant buffer ring of this 
+						renderer.
+		 */
+		ConstantBufferRing &GetConstantBufferRing() noexcept {
+			return m_constant_buffer_ring;
+		}
+
+		/**
+		 Returns the render scheduler of this renderer.
+
+		 @pre			The rendering manager associated with the current 
+						engine must be loaded.
+		 @pre			The resource manager associated with the current engine 
+						must be loaded.
+		 @return		A pointer to the render scheduler of this renderer.
+		 @throws		FormattedException
+						Failed to setup the render scheduler.
+		 */
+		RenderScheduler *GetRenderScheduler();
+
 		//---------------------------------------------------------------------
 		// Member Methods: Render Passes
 		//---------------------------------------------------------------------
@@ -158,7 +198,7 @@ namespace mage {
 		 */
 		AAPass *GetAAPass() {
 			if (!m_aa_pass) {
-				m_aa_pass = MakeUnique< AAPass >();
+				m_aa_pass = MakeUnique< AAPass >(m_device_context);
 			}
 			return m_aa_pass.get();
 		}
@@ -174,7 +214,8 @@ namespace mage {
 		 */
 		BackBufferPass *GetBackBufferPass() {
 			if (!m_back_buffer_pass) {
-				m_back_buffer_pass = MakeUnique< BackBufferPass >();
+				m_back_buffer_pass = MakeUnique< BackBufferPass >(
+					m_device_context);
 			}
 			return m_back_buffer_pass.get();
 		}
@@ -191,7 +232,8 @@ namespace mage {
 		 */
 		BoundingVolumePass *GetBoundingVolumePass() {
 			if (!m_bounding_volume_pass) {
-				m_bounding_volume_pass = MakeUnique< BoundingVolumePass >();
+				m_bounding_volume_pass = MakeUnique< BoundingVolumePass >(
+					m_device_context, &m_constant_buffer_ring);
 			}
 			return m_bounding_volume_pass.get();
 		}
@@ -208,7 +250,8 @@ namespace mage {
 		 */
 		ConstantComponentPass *GetConstantComponentPass() {
 			if (!m_constant_component_pass) {
-				m_constant_component_pass = MakeUnique< ConstantComponentPass >();
+				m_constant_component_pass = MakeUnique< ConstantComponentPass >(
+					m_device_context);
 			}
 			return m_constant_component_pass.get();
 		}
@@ -225,7 +268,8 @@ namespace mage {
 		 */
 		ConstantShadingPass *GetConstantShadingPass() {
 			if (!m_constant_shading_pass) {
-				m_constant_shading_pass = MakeUnique< ConstantShadingPass >();
+				m_constant_shading_pass = MakeUnique< ConstantShadingPass >(
+					m_device_context);
 			}
 			return m_constant_shading_pass.get();
 		}
@@ -242,7 +286,8 @@ namespace mage {
 		 */
 		DeferredShadingPass *GetDeferredShadingPass() {
 			if (!m_deferred_shading_pass) {
-				m_deferred_shading_pass = MakeUnique< DeferredShadingPass >();
+				m_deferred_shading_pass = MakeUnique< DeferredShadingPass >(
+					m_device_context);
 			}
 			return m_deferred_shading_pass.get();
 		}
@@ -258,7 +303,8 @@ namespace mage {
 		 */
 		DepthPass *GetDepthPass() {
 			if (!m_depth_pass) {
-				m_depth_pass = MakeUnique< DepthPass >();
+				m_depth_pass = MakeUnique< DepthPass >(
+					m_device_context, &m_constant_buffer_ring);
 			}
 			return m_depth_pass.get();
 		}
@@ -274,7 +320,7 @@ namespace mage {
 		 */
 		DOFPass *GetDOFPass() {
 			if (!m_dof_pass) {
-				m_dof_pass = MakeUnique< DOFPass >();
+				m_dof_pass = MakeUnique< DOFPass >(m_device_context);
 			}
 			return m_dof_pass.get();
 		}
@@ -290,7 +336,8 @@ namespace mage {
 		 */
 		GBufferPass *GetGBufferPass() {
 			if (!m_gbuffer_pass) {
-				m_gbuffer_pass = MakeUnique< GBufferPass >();
+				m_gbuffer_pass = MakeUnique< GBufferPass >(
+					m_device_context, &m_constant_buffer_ring);
 			}
 			return m_gbuffer_pass.get();
 		}
@@ -306,7 +353,7 @@ namespace mage {
 		 */
 		LBufferPass *GetLBufferPass() {
 			if (!m_lbuffer_pass) {
-				m_lbuffer_pass = MakeUnique< LBufferPass >();
+				m_lbuffer_pass = MakeUnique< LBufferPass >(m_device_context);
 			}
 			return m_lbuffer_pass.get();
 		}
@@ -323,7 +370,8 @@ namespace mage {
 		 */
 		ShadingNormalPass *GetShadingNormalPass() {
 			if (!m_shading_normal_pass) {
-				m_shading_normal_pass = MakeUnique< ShadingNormalPass >();
+				m_shading_normal_pass = MakeUnique< ShadingNormalPass >(
+					m_device_context);
 			}
 			return m_shading_normal_pass.get();
 		}
@@ -339,7 +387,7 @@ namespace mage {
 		 */
 		SkyPass *GetSkyPass() {
 			if (!m_sky_pass) {
-				m_sky_pass = MakeUnique< SkyPass >();
+				m_sky_pass = MakeUnique< SkyPass >(m_device_context);
 			}
 			return m_sky_pass.get();
 		}
@@ -355,7 +403,7 @@ namespace mage {
 		 */
 		SpritePass *GetSpritePass() {
 			if (!m_sprite_pass) {
-				m_sprite_pass = MakeUnique< SpritePass >();
+				m_sprite_pass = MakeUnique< SpritePass >(m_device_context);
 			}
 			return m_sprite_pass.get();
 		}
@@ -372,7 +420,8 @@ namespace mage {
 		 */
 		VariableComponentPass *GetVariableComponentPass() {
 			if (!m_variable_component_pass) {
-				m_variable_component_pass = MakeUnique< VariableComponentPass >();
+				m_variable_component_pass = MakeUnique< VariableComponentPass >(
+					m_device_context);
 			}
 			return m_variable_component_pass.get();
 		}
@@ -389,7 +438,8 @@ namespace mage {
 		 */
 		VariableShadingPass *GetVariableShadingPass() {
 			if (!m_variable_shading_pass) {
-				m_variable_shading_pass = MakeUnique< VariableShadingPass >();
+				m_variable_shading_pass = MakeUnique< VariableShadingPass >(
+					m_device_context, &m_constant_buffer_ring);
 			}
 			return m_variable_shading_pass.get();
 		}
@@ -405,7 +455,8 @@ namespace mage {
 		 */
 		WireframePass *GetWireframePass() {
 			if (!m_wireframe_pass) {
-				m_wireframe_pass = MakeUnique< WireframePass >();
+				m_wireframe_pass = MakeUnique< WireframePass >(
+					m_device_context);
 			}
 			return m_wireframe_pass.get();
 		}
@@ -446,6 +497,20 @@ namespace mage {
 			CXMMATRIX world_to_view,
 			CXMMATRIX view_to_world);
 
+		/**
+		 Binds the game buffer, camera buffer and model instance buffer of 
+		 this renderer to the given device context.
+
+		 A deferred device context does not inherit this state from the 
+		 immediate device context.
+
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @param[in]		device_context
+						A pointer to the device context.
+		 */
+		void BindCameraState(
+			ID3D11DeviceContext4 *device_context) const noexcept;
+
 		void ExecuteSolidForwardPipeline(
 			const Viewport &viewport,
 			FXMMATRIX world_to_projection,
@@ -497,6 +562,21 @@ namespace mage {
 		 A pointer to the camera buffer of this renderer.
 		 */
 		ConstantBuffer< CameraBuffer > m_camera_buffer;
+
+		/**
+		 A pointer to the model instance buffer of this renderer.
+		 */
+		StructuredBuffer< ModelInstance > m_model_instance_buffer;
+
+		/**
+		 The constant buffer ring of this renderer.
+		 */
+		ConstantBufferRing m_constant_buffer_ring;
+
+		/**
+		 A pointer to the render scheduler of this renderer.
+		 */
+		UniquePtr< RenderScheduler > m_render_scheduler;
 		
 		//---------------------------------------------------------------------
 		// Member Variables: Render Passes
@@ -10,11 +10,30 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	/**
+	 The block size in bytes of the frame arenas.
+	 */
+	constexpr size_t g_frame_arena_block_size = 1u << 20u;
+
+	/**
+	 The alignment in bytes of the frame arenas.
+	 */
+	constexpr size_t g_frame_arena_alignment = 16u;
+
 	const RenderingManager *RenderingManager::Get() noexcept {
 		Assert(Engine::Get());
 
@@ -26,6 +45,14 @@ namespace mage {
 		: m_hwindow(hwindow),
 		m_display_configuration(
 			MakeUnique< DisplayConfiguration >(*display_configuration)),
+		m_frame_arenas{
+			MakeUnique< MemoryArena >(g_frame_arena_block_size, 
+			                          g_frame_arena_alignment),
+			MakeUnique< MemoryArena >(g_frame_arena_block_size, 
+			                          g_frame_arena_alignment) },
+		m_frame_arena_index(0), 
+		m_frame_arena_usage(0), 
+		m_frame_arena_high_water_mark(0), 
 		m_feature_level(),
 		m_device(), 
 		m_device_context(), 
@@ -52,9 +79,11 @@ namespace mage {
 		SetupDevice();
 		
 		// Setup the swap chain.
-		m_swap_chain = MakeUnique< SwapChain >(
-			           m_device.Get(), m_hwindow, 
-			           m_display_configuration.get());
+		if (!IsHeadless()) {
+			m_swap_chain = MakeUnique< SwapChain >(
+				           m_device.Get(), m_hwindow, 
+				           m_display_configuration.get());
+		}
 
 		// Setup the rendering output manager.
 		m_rendering_output_manager = MakeUnique< RenderingOutputManager >(
@@ -87,6 +116,7 @@ namespace mage {
 		// Reset any device context to the default settings. 
 		if (m_device_context) {
 			m_device_context->ClearState();
+			Pipeline::UnregisterDeviceContext(m_device_context.Get());
 		}
 	}
 
@@ -104,10 +134,11 @@ namespace mage {
 		ComPtr< ID3D11Device > device;
 		ComPtr< ID3D11DeviceContext > device_context;
 		{
-			// Get the ID3D11Device and ID3D11DeviceContext.
+			// Get the ID3D11Device and ID3D11DeviceContext. Without an 
+			// adapter, a device without rendering capabilities is used.
 			const HRESULT result = D3D11CreateDevice(
 				m_display_configuration->GetAdapter(),
-				D3D_DRIVER_TYPE_UNKNOWN,
+				IsHeadless() ? D3D_DRIVER_TYPE_NULL : D3D_DRIVER_TYPE_UNKNOWN,
 				nullptr,
 				create_device_flags,
 				Pipeline::s_feature_levels,
@@ -132,14 +163,31 @@ namespace mage {
 			ThrowIfFailed(result,
 				"ID3D11DeviceContext4 creation failed: %08X.", result);
 		}
+
+		// Shadow the state bound to the immediate device context.
+		Pipeline::RegisterDeviceContext(m_device_context.Get());
 	}
 
 	//-------------------------------------------------------------------------
 	// RenderingManager: Rendering
 	//-------------------------------------------------------------------------
 
-	void RenderingManager::BeginFrame() const {
-		m_swap_chain->Clear();
+	void RenderingManager::BeginFrame() {
+		// Update the frame arena statistics.
+		m_frame_arena_usage = GetFrameArena()->GetAllocatedSize();
+		m_frame_arena_high_water_mark 
+			= std::max(m_frame_arena_high_water_mark, m_frame_arena_usage);
+
+		// Swap and reset the frame arenas. The frame arena of the previous 
+		// frame remains valid during this frame.
+		m_frame_arena_index = 1 - m_frame_arena_index;
+		GetFrameArena()->Reset();
+		// Rebind the per-frame data of the renderer to the frame arena.
+		m_renderer->BeginFrame(GetFrameArena());
+
+		if (m_swap_chain) {
+			m_swap_chain->Clear();
+		}
 		
 		ImGui_ImplDX11_NewFrame();
 	}
@@ -147,11 +195,13 @@ namespace mage {
 	void RenderingManager::EndFrame() const {
 		ImGui::Render();
 		
-		m_swap_chain->Present();
+		if (m_swap_chain) {
+			m_swap_chain->Present();
+		}
 	}
 
 	void RenderingManager::BindPersistentState() {
-		m_rendering_state_manager->BindPersistentState();
+		m_rendering_state_manager->BindPersistentState(m_device_context.Get());
 		m_renderer->BindPersistentState();
 	}
 }
\ No newline at end of file
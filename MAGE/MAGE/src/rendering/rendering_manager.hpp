@@ -9,6 +9,7 @@
 #include "rendering\rendering_output_manager.hpp"
 #include "rendering\rendering_state_manager.hpp"
 #include "rendering\swap_chain.hpp"
+#include "utils\memory\memory_arena.hpp"
 
 #pragma endregion
 
@@ -115,6 +116,20 @@ namespace mage {
 			return m_display_configuration.get();
 		}
 
+		/**
+		 Checks whether this rendering manager renders without a display.
+
+		 A rendering manager renders without a display if its display
+		 configuration has no adapter. Such rendering manager uses a device
+		 without rendering capabilities and has no swap chain.
+
+		 @return		@c true if this rendering manager renders without a
+						display. @c false otherwise.
+		 */
+		bool IsHeadless() const noexcept {
+			return nullptr == m_display_configuration->GetAdapter();
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Rendering
 		//---------------------------------------------------------------------
@@ -141,6 +156,8 @@ namespace mage {
 		/**
 		 Returns the swap chain of this rendering manager.
 
+		 @return		@c nullptr if this rendering manager renders without a
+						display.
 		 @return		A pointer to the swap chain of this rendering manager.
 		 */
 		SwapChain *GetSwapChain() const noexcept {
@@ -178,9 +195,47 @@ namespace mage {
 		}
 
 		/**
-		 Begins a frame.
+		 Returns the frame arena of this rendering manager.
+
+		 The frame arenas are double-buffered: memory allocated on the frame 
+		 arena remains valid during the current and the next frame.
+
+		 @return		A pointer to the frame arena of this rendering 
+						manager.
+		 */
+		MemoryArena *GetFrameArena() const noexcept {
+			return m_frame_arenas[m_frame_arena_index].get();
+		}
+
+		/**
+		 Returns the size (in bytes) of the memory allocated on the frame 
+		 arena during the previous frame.
+
+		 @return		The size (in bytes) of the memory allocated on the 
+						frame arena during the previous frame.
+		 */
+		size_t GetFrameArenaUsage() const noexcept {
+			return m_frame_arena_usage;
+		}
+
+		/**
+		 Returns the maximum size (in bytes) of the memory allocated on the 
+		 frame arena during a single frame.
+
+		 @return		The high-water mark (in bytes) of the frame arena.
+		 */
+		size_t GetFrameArenaHighWaterMark() const noexcept {
+			return m_frame_arena_high_water_mark;
+		}
+
+		/**
+		 Begins a frame. The frame arenas are swapped, and the per-frame data 
+		 of the renderer is rebound to the reset frame arena.
+
+		 @throws		std::bad_alloc
+						Failed to allocate the memory block.
 		 */
-		void BeginFrame() const;
+		void BeginFrame();
 		
 		/**
 		 Ends a frame.
@@ -247,6 +302,35 @@ namespace mage {
 		 */
 		UniquePtr< DisplayConfiguration > m_display_configuration;
 
+		//---------------------------------------------------------------------
+		// Member Variables: Memory
+		//---------------------------------------------------------------------
+
+		/**
+		 The (double-buffered) frame arenas of this rendering manager. The 
+		 frame arenas are declared before the renderer, so that they outlive 
+		 the per-frame data of the renderer.
+		 */
+		UniquePtr< MemoryArena > m_frame_arenas[2];
+
+		/**
+		 The index of the frame arena of the current frame of this rendering 
+		 manager.
+		 */
+		size_t m_frame_arena_index;
+
+		/**
+		 The size (in bytes) of the memory allocated on the frame arena 
+		 during the previous frame of this rendering manager.
+		 */
+		size_t m_frame_arena_usage;
+
+		/**
+		 The maximum size (in bytes) of the memory allocated on the frame 
+		 arena during a single frame of this rendering manager.
+		 */
+		size_t m_frame_arena_high_water_mark;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Rendering
 		//---------------------------------------------------------------------
@@ -533,9 +533,10 @@ namespace mage {
 	void RenderingOutputManager::BindEnd(
 		ID3D11DeviceContext4 *device_context) const noexcept {
 
-		// Bind the back buffer RTV and no DSV.
+		// Bind the back buffer RTV (if any) and no DSV.
+		SwapChain * const swap_chain = SwapChain::Get();
 		Pipeline::OM::BindRTVAndDSV(device_context,
-			SwapChain::Get()->GetRTV(), nullptr);
+			swap_chain ? swap_chain->GetRTV() : nullptr, nullptr);
 		
 		// Bind no HDR UAV.
 		Pipeline::CS::BindUAV(device_context,
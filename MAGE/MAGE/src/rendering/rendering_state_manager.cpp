@@ -313,7 +313,8 @@ namespace mage {
 		}
 	}
 
-	void RenderingStateManager::BindPersistentState() const noexcept {
+	void RenderingStateManager::BindPersistentState(
+		ID3D11DeviceContext4 *device_context) const noexcept {
 		
 		// Collect the samplers.
 		ID3D11SamplerState * const samplers[SLOT_SAMPLER_PERSISTENT_COUNT] = {
@@ -331,7 +332,7 @@ namespace mage {
 
 		// Bind the samplers.
 		Pipeline::BindSamplers(
-			Pipeline::GetImmediateDeviceContext(),
+			device_context,
 			SLOT_SAMPLER_PERSISTENT_START,
 			SLOT_SAMPLER_PERSISTENT_COUNT,
 			samplers);
@@ -112,11 +112,12 @@ namespace mage {
 		/**
 		 Binds the persistent state of this rendering state manager.
 
-		 @throws		FormattedException
-						Failed to bind the persistent state of this rendering 
-						state manager.
+		 @pre			@a device_context is not equal to @c nullptr.
+		 @param[in]		device_context
+						A pointer to the device context.
 		 */
-		void BindPersistentState() const noexcept;
+		void BindPersistentState(
+			ID3D11DeviceContext4 *device_context) const noexcept;
 
 		//---------------------------------------------------------------------
 		// Member Methods: Blend States
@@ -5,6 +5,16 @@
 
 #include "core\engine.hpp"
 #include "utils\logging\error.hpp"
+#include "utils\parallel\parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
 
 #pragma endregion
 
@@ -43,7 +53,10 @@ namespace mage {
 		m_texture_resource_pool(
 			MakeUnique< ResourcePool< wstring, const Texture > >()),
 		m_variable_script_resource_pool(
-			MakeUnique< ResourcePool< wstring, VariableScript > >()) {}
+			MakeUnique< ResourcePool< wstring, VariableScript > >()),
+		// Leave one core for the main thread.
+		m_thread_pool(MakeUnique< ThreadPool >(
+			std::max< size_t >(NumberOfSystemCores(), 2) - 1)) {}
 
 	ResourceManager::ResourceManager(
 		ResourceManager &&resource_factory) = default;
@@ -576,6 +576,64 @@ namespace mage {
 		SharedPtr< VariableScript > GetOrCreateVariableScript(
 			const wstring &guid, ConstructorArgsT&&... args);
 
+		//---------------------------------------------------------------------
+		// Member Methods: GetOrCreateAsync
+		//---------------------------------------------------------------------
+
+		/**
+		 Creates a model descriptor (if not existing) on a worker thread of 
+		 this resource manager.
+
+		 Concurrent requests for the same globally unique identifier share a 
+		 single creation. The returned future can be polled (@c wait_for) or 
+		 waited on (@c get).
+
+		 @tparam		ConstructorArgsT
+						The constructor argument types of the model descriptor
+						(excluding the type of the globally unique identifier).
+		 @param[in]		guid
+						A reference to the globally unique identifier of the 
+						model descriptor.
+		 @param[in]		args
+						A reference to the constructor arguments for the model 
+						descriptor (excluding the globally unique identifier). 
+						The arguments are copied.
+		 @return		A future of the model descriptor. Its @c get method 
+						throws a @c FormattedException if the creation of the 
+						model descriptor failed.
+		 */
+		template< typename... ConstructorArgsT >
+		std::shared_future< SharedPtr< const ModelDescriptor > > 
+			GetOrCreateModelDescriptorAsync(
+				const wstring &guid, ConstructorArgsT&&... args);
+
+		/**
+		 Creates a texture (if not existing) on a worker thread of this 
+		 resource manager.
+
+		 Concurrent requests for the same globally unique identifier share a 
+		 single creation. The returned future can be polled (@c wait_for) or 
+		 waited on (@c get).
+
+		 @tparam		ConstructorArgsT
+						The constructor argument types of the texture
+						(excluding the type of the globally unique identifier).
+		 @param[in]		guid
+						A reference to the globally unique identifier of the
+						texture.
+		 @param[in]		args
+						A reference to the constructor arguments for the texture
+						(excluding the globally unique identifier). The 
+						arguments are copied.
+		 @return		A future of the texture. Its @c get method throws a 
+						@c FormattedException if the creation of the texture 
+						failed.
+		 */
+		template< typename... ConstructorArgsT >
+		std::shared_future< SharedPtr< const Texture > > 
+			GetOrCreateTextureAsync(
+				const wstring &guid, ConstructorArgsT&&... args);
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -641,6 +699,13 @@ namespace mage {
 		 */
 		UniquePtr< ResourcePool< wstring, VariableScript > > 
 			m_variable_script_resource_pool;
+
+		/**
+		 A pointer to the thread pool for creating resources asynchronously of 
+		 this resource manager. This thread pool is destructed (i.e. all 
+		 pending creations are finished) before the resource pools.
+		 */
+		UniquePtr< ThreadPool > m_thread_pool;
 	};
 }
 
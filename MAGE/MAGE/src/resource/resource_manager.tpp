@@ -98,4 +98,26 @@ namespace mage {
 			GetOrCreateResource< wstring, ConstructorArgsT... >(
 				guid, wstring(guid), std::forward< ConstructorArgsT >(args)...);
 	}
+
+	template< typename... ConstructorArgsT >
+	inline std::shared_future< SharedPtr< const ModelDescriptor > > 
+		ResourceManager::GetOrCreateModelDescriptorAsync(
+			const wstring &guid, ConstructorArgsT&&... args) {
+
+		return m_model_descriptor_resource_pool->template
+			GetOrCreateResourceAsync< wstring, ConstructorArgsT... >(
+				*m_thread_pool, guid, wstring(guid), 
+				std::forward< ConstructorArgsT >(args)...);
+	}
+
+	template< typename... ConstructorArgsT >
+	inline std::shared_future< SharedPtr< const Texture > > 
+		ResourceManager::GetOrCreateTextureAsync(
+			const wstring &guid, ConstructorArgsT&&... args) {
+
+		return m_texture_resource_pool->template
+			GetOrCreateResourceAsync< wstring, ConstructorArgsT... >(
+				*m_thread_pool, guid, wstring(guid), 
+				std::forward< ConstructorArgsT >(args)...);
+	}
 }
\ No newline at end of file
@@ -7,6 +7,18 @@
 
 #include "utils\collection\collection.hpp"
 #include "utils\parallel\lock.hpp"
+#include "utils\parallel\thread_pool.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
+#include <future>
+#include <tuple>
 
 #pragma endregion
 
@@ -32,6 +44,15 @@ namespace mage {
 
 	public:
 
+		//---------------------------------------------------------------------
+		// Type Declarations and Definitions
+		//---------------------------------------------------------------------
+
+		/**
+		 The future type of resources of resource pools.
+		 */
+		using ResourceFuture = std::shared_future< SharedPtr< ResourceT > >;
+
 		//---------------------------------------------------------------------
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
@@ -149,7 +170,9 @@ namespace mage {
 
 		 If no resource is contained in this resource pool corresponding to the 
 		 given key, a new resource is created from the given arguments, added 
-		 to this resource pool and returned.
+		 to this resource pool and returned. The resource is created without 
+		 holding the lock of this resource pool. If the resource is already 
+		 being created by another thread, that creation is awaited instead.
 
 		 @pre			@c DerivedResourceT is a derived class of @c ResourceT.
 		 @tparam		DerivedResourceT
@@ -168,6 +191,61 @@ namespace mage {
 		template< typename DerivedResourceT, typename... ConstructorArgsT >
 		SharedPtr< ResourceT > GetOrCreateDerivedResource(
 			const KeyT &key, ConstructorArgsT&&... args);
+
+		/**
+		 Returns a future of the resource corresponding to the given key from 
+		 this resource pool.
+		 
+		 If no resource is contained in this resource pool corresponding to the 
+		 given key, a new resource is created from (copies of) the given 
+		 arguments on the given thread pool and added to this resource pool.
+
+		 @tparam		ConstructorArgsT
+						The argument types for creating a new resource of type 
+						@c ResourceT.
+		 @param[in]		thread_pool
+						A reference to the thread pool.
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @param[in]		args
+						The arguments for creating a new resource of type 
+						@c ResourceT.
+		 @return		A future of the resource corresponding to the given 
+						key from this resource pool.
+		 */
+		template< typename... ConstructorArgsT >
+		ResourceFuture GetOrCreateResourceAsync(ThreadPool &thread_pool, 
+			const KeyT &key, ConstructorArgsT&&... args);
+
+		/**
+		 Returns a future of the resource corresponding to the given key from 
+		 this resource pool.
+
+		 If no resource is contained in this resource pool corresponding to the 
+		 given key, a new resource is created from (copies of) the given 
+		 arguments on the given thread pool and added to this resource pool. 
+		 Concurrent requests for the same key share a single creation.
+
+		 @pre			@c DerivedResourceT is a derived class of @c ResourceT.
+		 @pre			The given thread pool outlives this resource pool.
+		 @tparam		DerivedResourceT
+						The derived resource type.
+		 @tparam		ConstructorArgsT
+						The argument types for creating a new resource of type 
+						@c DerivedResourceT.
+		 @param[in]		thread_pool
+						A reference to the thread pool.
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @param[in]		args
+						The arguments for creating a new resource of type 
+						@c DerivedResourceT.
+		 @return		A future of the resource corresponding to the given 
+						key from this resource pool.
+		 */
+		template< typename DerivedResourceT, typename... ConstructorArgsT >
+		ResourceFuture GetOrCreateDerivedResourceAsync(ThreadPool &thread_pool, 
+			const KeyT &key, ConstructorArgsT&&... args);
 		
 		/**
 		 Removes the resource corresponding to the given key from this resource 
@@ -194,6 +272,86 @@ namespace mage {
 		 */
 		using ResourceMap = map< KeyT, WeakPtr< ResourceT > >;
 
+		/**
+		 A struct of resources being created.
+		 */
+		struct PendingResource final {
+
+		public:
+
+			/**
+			 The key of this pending resource.
+			 */
+			KeyT m_key;
+
+			/**
+			 The function creating the resource of this pending resource.
+			 */
+			std::function< SharedPtr< ResourceT >() > m_create;
+
+			/**
+			 A flag indicating whether the creation of this pending resource 
+			 is claimed by some thread.
+			 */
+			std::atomic< bool > m_claimed;
+
+			/**
+			 The promise of this pending resource.
+			 */
+			std::promise< SharedPtr< ResourceT > > m_promise;
+
+			/**
+			 The future of this pending resource.
+			 */
+			ResourceFuture m_future;
+		};
+
+		/**
+		 A pending resource map used by a resource pool.
+		 */
+		using PendingResourceMap = map< KeyT, SharedPtr< PendingResource > >;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the pending resource corresponding to the given key from this 
+		 resource pool.
+
+		 If no pending resource is contained in this resource pool 
+		 corresponding to the given key, a new pending resource is created 
+		 from (copies of) the given arguments and added to this resource 
+		 pool.
+
+		 @pre			The calling thread holds the lock of this resource 
+						pool.
+		 @tparam		DerivedResourceT
+						The derived resource type.
+		 @tparam		ConstructorArgsT
+						The argument types for creating a new resource of type 
+						@c DerivedResourceT.
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @param[in]		args
+						The arguments for creating a new resource of type 
+						@c DerivedResourceT.
+		 @return		A pointer to the pending resource corresponding to the 
+						given key from this resource pool.
+		 */
+		template< typename DerivedResourceT, typename... ConstructorArgsT >
+		SharedPtr< PendingResource > GetOrCreatePendingResource(
+			const KeyT &key, ConstructorArgsT&&... args);
+
+		/**
+		 Creates the resource of the given pending resource, unless its 
+		 creation is already claimed by some other thread.
+
+		 @param[in]		pending_resource
+						A reference to the pending resource.
+		 */
+		void CreatePendingResource(PendingResource &pending_resource) noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -204,7 +362,13 @@ namespace mage {
 		ResourceMap m_resource_map;
 
 		/**
-		 The mutex for accessing the resource map of this resource pool.
+		 The pending resource map of this resource pool.
+		 */
+		PendingResourceMap m_pending_resource_map;
+
+		/**
+		 The mutex for accessing the resource map and pending resource map of 
+		 this resource pool.
 		 */
 		Mutex m_resource_map_mutex;
 
@@ -82,26 +82,81 @@ namespace mage {
 	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
 		::GetOrCreateDerivedResource(const KeyT &key, ConstructorArgsT&&... args) {
 		
-		MutexLock lock(m_resource_map_mutex);
+		SharedPtr< PendingResource > pending_resource;
+		
+		{
+			MutexLock lock(m_resource_map_mutex);
+
+			if (const auto it = m_resource_map.find(key); 
+				it != m_resource_map.end()) {
+
+				const auto resource = it->second.lock();
+				if (resource) {
+					return resource;
+				}
+				else {
+					m_resource_map.erase(it);
+				}
+			}
 
-		if (const auto it = m_resource_map.find(key); 
-			it != m_resource_map.end()) {
+			pending_resource = GetOrCreatePendingResource< DerivedResourceT >(
+				key, std::forward< ConstructorArgsT >(args)...);
+		}
 
-			const auto resource = it->second.lock();
-			if (resource) {
-				return resource;
-			}
-			else {
-				m_resource_map.erase(it);
+		// Create the resource on this thread, unless some other thread 
+		// already started creating it. This also avoids waiting for pending 
+		// resources which are still enqueued in some thread pool.
+		CreatePendingResource(*pending_resource);
+
+		return pending_resource->m_future.get();
+	}
+
+	template< typename KeyT, typename ResourceT >
+	template< typename... ConstructorArgsT >
+	inline typename ResourcePool< KeyT, ResourceT >::ResourceFuture 
+		ResourcePool< KeyT, ResourceT >::GetOrCreateResourceAsync(
+			ThreadPool &thread_pool, const KeyT &key, ConstructorArgsT&&... args) {
+
+		return GetOrCreateDerivedResourceAsync< ResourceT, ConstructorArgsT... >(
+			thread_pool, key, std::forward< ConstructorArgsT >(args)...);
+	}
+
+	template< typename KeyT, typename ResourceT >
+	template< typename DerivedResourceT, typename... ConstructorArgsT >
+	typename ResourcePool< KeyT, ResourceT >::ResourceFuture 
+		ResourcePool< KeyT, ResourceT >::GetOrCreateDerivedResourceAsync(
+			ThreadPool &thread_pool, const KeyT &key, ConstructorArgsT&&... args) {
+
+		SharedPtr< PendingResource > pending_resource;
+
+		{
+			MutexLock lock(m_resource_map_mutex);
+
+			if (const auto it = m_resource_map.find(key); 
+				it != m_resource_map.end()) {
+
+				const auto resource = it->second.lock();
+				if (resource) {
+					std::promise< SharedPtr< ResourceT > > promise;
+					promise.set_value(resource);
+					return promise.get_future().share();
+				}
+				else {
+					m_resource_map.erase(it);
+				}
 			}
+
+			pending_resource = GetOrCreatePendingResource< DerivedResourceT >(
+				key, std::forward< ConstructorArgsT >(args)...);
 		}
 
-		const auto new_resource = MakeAllocatedShared< Resource< DerivedResourceT > >
-			                      (*this, key, std::forward< ConstructorArgsT >(args)...);
-		
-		m_resource_map.emplace(key, new_resource);
-		
-		return new_resource;
+		if (!pending_resource->m_claimed) {
+			thread_pool.Enqueue([this, pending_resource]() {
+				CreatePendingResource(*pending_resource);
+			});
+		}
+
+		return pending_resource->m_future;
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -124,6 +179,81 @@ namespace mage {
 		m_resource_map.clear();
 	}
 
+	template< typename KeyT, typename ResourceT >
+	template< typename DerivedResourceT, typename... ConstructorArgsT >
+	SharedPtr< typename ResourcePool< KeyT, ResourceT >::PendingResource > 
+		ResourcePool< KeyT, ResourceT >::GetOrCreatePendingResource(
+			const KeyT &key, ConstructorArgsT&&... args) {
+
+		if (const auto it = m_pending_resource_map.find(key); 
+			it != m_pending_resource_map.end()) {
+
+			return it->second;
+		}
+
+		const auto pending_resource = MakeShared< PendingResource >();
+		pending_resource->m_key     = key;
+		pending_resource->m_claimed = false;
+		pending_resource->m_future  = pending_resource->m_promise.get_future().share();
+		
+		// The arguments are copied, since the resource may be created after 
+		// the lifetime of the given arguments.
+		pending_resource->m_create  = [this, key, 
+			args_tuple = std::make_tuple(std::forward< ConstructorArgsT >(args)...)]() {
+			
+			return std::apply([this, &key](const auto &... resource_args) {
+				return SharedPtr< ResourceT >(
+					MakeAllocatedShared< Resource< DerivedResourceT > >(
+						*this, key, resource_args...));
+			}, args_tuple);
+		};
+
+		m_pending_resource_map.emplace(key, pending_resource);
+
+		return pending_resource;
+	}
+
+	template< typename KeyT, typename ResourceT >
+	void ResourcePool< KeyT, ResourceT >::CreatePendingResource(
+		PendingResource &pending_resource) noexcept {
+
+		if (pending_resource.m_claimed.exchange(true)) {
+			return;
+		}
+
+		const auto remove_pending_resource = [this, &pending_resource]() {
+			if (const auto it = m_pending_resource_map.find(pending_resource.m_key); 
+				it != m_pending_resource_map.end() 
+				&& it->second.get() == &pending_resource) {
+
+				m_pending_resource_map.erase(it);
+			}
+		};
+
+		try {
+			const auto resource = pending_resource.m_create();
+			
+			{
+				MutexLock lock(m_resource_map_mutex);
+				m_resource_map[pending_resource.m_key] = resource;
+				remove_pending_resource();
+			}
+			
+			pending_resource.m_promise.set_value(resource);
+		}
+		catch (...) {
+			{
+				MutexLock lock(m_resource_map_mutex);
+				remove_pending_resource();
+			}
+
+			pending_resource.m_promise.set_exception(std::current_exception());
+		}
+
+		// Release the copies of the constructor arguments.
+		pending_resource.m_create = nullptr;
+	}
+
 	//-------------------------------------------------------------------------
 	// Resource
 	//-------------------------------------------------------------------------
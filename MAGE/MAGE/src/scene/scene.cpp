@@ -7,6 +7,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -14,6 +23,7 @@ namespace mage {
 
 	Scene::Scene(string name)
 		: m_name(std::move(name)), 
+		m_transform_system(),
 		m_scripts(), 
 		m_cameras(), 
 		m_models(), 
@@ -35,6 +45,10 @@ namespace mage {
 		m_scene_fog = MakeUnique< SceneFog >();
 		m_sky       = MakeUnique< Sky >();
 
+		// Update the world matrices of all nodes in a single batched pass per
+		// frame.
+		EnableTransformSystem();
+
 		// Loads this scene.
 		Load();
 	}
@@ -47,6 +61,86 @@ namespace mage {
 		Clear();
 	}
 
+	/**
+	 Removes (in-place) all terminated elements from the given vector. The 
+	 relative order of the remaining elements is preserved.
+
+	 @tparam		ElementT
+					The element type.
+	 @param[in]		elements
+					A reference to the vector.
+	 */
+	template< typename ElementT >
+	inline void RemoveTerminated(vector< UniquePtr< ElementT > > &elements) noexcept {
+		const auto it = std::remove_if(elements.begin(), elements.end(),
+			[](const UniquePtr< ElementT > &element) noexcept {
+				return element->IsTerminated();
+			});
+
+		elements.erase(it, elements.end());
+	}
+
+	void Scene::Compact() noexcept {
+		RemoveTerminated(m_scripts);
+		RemoveTerminated(m_cameras);
+		RemoveTerminated(m_models);
+		RemoveTerminated(m_directional_lights);
+		RemoveTerminated(m_omni_lights);
+		RemoveTerminated(m_spot_lights);
+		RemoveTerminated(m_sprites);
+
+		if (m_ambient_light && m_ambient_light->IsTerminated()) {
+			m_ambient_light.reset();
+		}
+	}
+
+	/**
+	 Registers all non-terminated elements of the given vector with the given 
+	 transform system.
+
+	 @tparam		ElementT
+					The element type.
+	 @param[in]		system
+					A reference to the transform system.
+	 @param[in]		elements
+					A reference to the vector.
+	 */
+	template< typename ElementT >
+	inline void RegisterTransforms(TransformSystem &system, 
+		const vector< UniquePtr< ElementT > > &elements) {
+
+		for (const auto &element : elements) {
+			if (!element->IsTerminated()) {
+				system.Register(element->GetTransform());
+			}
+		}
+	}
+
+	void Scene::EnableTransformSystem() {
+		if (m_transform_system) {
+			return;
+		}
+
+		m_transform_system = MakeUnique< TransformSystem >();
+
+		RegisterTransforms(*m_transform_system, m_cameras);
+		RegisterTransforms(*m_transform_system, m_models);
+		RegisterTransforms(*m_transform_system, m_directional_lights);
+		RegisterTransforms(*m_transform_system, m_omni_lights);
+		RegisterTransforms(*m_transform_system, m_spot_lights);
+		RegisterTransforms(*m_transform_system, m_sprites);
+		
+		if (m_ambient_light && !m_ambient_light->IsTerminated()) {
+			m_transform_system->Register(m_ambient_light->GetTransform());
+		}
+	}
+
+	void Scene::UpdateTransforms() {
+		if (m_transform_system) {
+			m_transform_system->Update();
+		}
+	}
+
 	void Scene::Clear() noexcept {
 		m_scripts.clear();
 		m_cameras.clear();
@@ -58,6 +152,7 @@ namespace mage {
 		m_ambient_light.reset();
 		m_scene_fog.reset();
 		m_sky.reset();
+		m_transform_system.reset();
 	}
 
 	//-------------------------------------------------------------------------
@@ -87,8 +182,12 @@ namespace mage {
 				                              desc.GetMesh(),
 										      model_part->m_start_index, 
 										      model_part->m_nb_indices,
+										      model_part->m_base_vertex,
+										      model_part->m_first_cluster,
+										      model_part->m_nb_clusters,
 										      model_part->m_aabb, 
-					                          model_part->m_bs);
+					                          model_part->m_bs,
+					                          model_part->m_lods);
 			
 			TransformNode * const transform = node->GetTransform();
 			transform->SetTranslation(model_part->m_translation);
@@ -108,6 +207,7 @@ namespace mage {
 			ModelNode * const ptr = node.get();
 			models.push_back(ptr);
 			m_models.push_back(std::move(node));
+			RegisterTransform(ptr);
 
 			if (model_part->HasDefaultParent()) {
 				root = ptr;
@@ -125,12 +225,13 @@ namespace mage {
 		if (create_root_model_node) {
 			// Create root model node.
 			UniquePtr< ModelNode > node = MakeUnique< ModelNode >(
-				"model", desc.GetMesh(), 0, 0, AABB(), BS());
+				"model", desc.GetMesh(), 0, 0, 0, 0, 0, AABB(), BS());
 			
 			// Add the root model node to this scene.
 			root = node.get();
 			models.push_back(root);
 			m_models.push_back(std::move(node));
+			RegisterTransform(root);
 		}
 
 		// Connect model nodes.
@@ -69,6 +69,41 @@ namespace mage {
 		 */
 		void Uninitialize();
 
+		/**
+		 Removes all terminated scripts and nodes from this scene.
+
+		 The iteration methods of this scene only skip terminated scripts and 
+		 nodes. This scene must be compacted once per frame at a point where 
+		 no pointers to terminated scripts and nodes are in use.
+		 */
+		void Compact() noexcept;
+
+		/**
+		 Enables the transform system of this scene.
+
+		 All current and future nodes of this scene are registered with the 
+		 transform system, which updates their world matrices in a single 
+		 batched pass per frame. The transform system is enabled by default 
+		 when this scene is initialized.
+		 */
+		void EnableTransformSystem();
+
+		/**
+		 Checks whether the transform system of this scene is enabled.
+
+		 @return		@c true if the transform system of this scene is 
+						enabled. @c false otherwise.
+		 */
+		bool HasTransformSystem() const noexcept {
+			return nullptr != m_transform_system;
+		}
+
+		/**
+		 Updates the world matrices of the nodes of this scene if the 
+		 transform system of this scene is enabled.
+		 */
+		void UpdateTransforms();
+
 		//-------------------------------------------------------------------------
 		// Member Methods
 		//-------------------------------------------------------------------------
@@ -197,19 +232,35 @@ namespace mage {
 
 		void Clear() noexcept;
 
+		/**
+		 Registers the given node with the transform system of this scene if 
+		 enabled.
+
+		 @param[in]		node
+						A pointer to the node.
+		 */
+		void RegisterTransform(Node *node) {
+			if (m_transform_system) {
+				m_transform_system->Register(node->GetTransform());
+			}
+		}
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
 
 		string m_name;
+
+		// The transform system must outlive the nodes registered with it.
+		UniquePtr< TransformSystem > m_transform_system;
 		
-		mutable vector< UniquePtr< BehaviorScript > > m_scripts;
-		mutable vector< UniquePtr< CameraNode > > m_cameras;
-		mutable vector< UniquePtr< ModelNode > > m_models;
-		mutable vector< UniquePtr< DirectionalLightNode > > m_directional_lights;
-		mutable vector< UniquePtr< OmniLightNode > > m_omni_lights;
-		mutable vector< UniquePtr< SpotLightNode > > m_spot_lights;
-		mutable vector< UniquePtr< SpriteNode > > m_sprites;
+		vector< UniquePtr< BehaviorScript > > m_scripts;
+		vector< UniquePtr< CameraNode > > m_cameras;
+		vector< UniquePtr< ModelNode > > m_models;
+		vector< UniquePtr< DirectionalLightNode > > m_directional_lights;
+		vector< UniquePtr< OmniLightNode > > m_omni_lights;
+		vector< UniquePtr< SpotLightNode > > m_spot_lights;
+		vector< UniquePtr< SpriteNode > > m_sprites;
 
 		UniquePtr< AmbientLightNode > m_ambient_light;
 		UniquePtr< SceneFog > m_scene_fog;
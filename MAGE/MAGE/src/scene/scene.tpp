@@ -27,6 +27,7 @@ namespace mage {
 		UniquePtr< T > uptr = MakeUnique< T >();
 		T * const ptr = uptr.get();
 		m_cameras.push_back(std::move(uptr));
+		RegisterTransform(ptr);
 		return ptr;
 	}
 
@@ -35,6 +36,7 @@ namespace mage {
 		Scene::Create() {
 
 		m_ambient_light = MakeUnique< T >();
+		RegisterTransform(m_ambient_light.get());
 		return m_ambient_light.get();
 	}
 
@@ -45,6 +47,7 @@ namespace mage {
 		UniquePtr< T > uptr = MakeUnique< T >();
 		T * const ptr = uptr.get();
 		m_directional_lights.push_back(std::move(uptr));
+		RegisterTransform(ptr);
 		return ptr;
 	}
 
@@ -55,6 +58,7 @@ namespace mage {
 		UniquePtr< T > uptr = MakeUnique< T >();
 		T * const ptr = uptr.get();
 		m_omni_lights.push_back(std::move(uptr));
+		RegisterTransform(ptr);
 		return ptr;
 	}
 
@@ -65,6 +69,7 @@ namespace mage {
 		UniquePtr< T > uptr = MakeUnique< T >();
 		T * const ptr = uptr.get();
 		m_spot_lights.push_back(std::move(uptr));
+		RegisterTransform(ptr);
 		return ptr;
 	}
 
@@ -75,6 +80,7 @@ namespace mage {
 		UniquePtr< T > uptr = MakeUnique< T >();
 		T * const ptr = uptr.get();
 		m_sprites.push_back(std::move(uptr));
+		RegisterTransform(ptr);
 		return ptr;
 	}
 
@@ -86,57 +92,41 @@ namespace mage {
 	inline void Scene::ForEachScript(
 		ActionT action, bool include_passive) const {
 
-		vector< UniquePtr< BehaviorScript > > scripts;
-		scripts.reserve(m_scripts.size());
-
-		for (auto &script : m_scripts) {
-
+		// Scripts may create other scripts while being iterated.
+		for (size_t i = 0; i < m_scripts.size(); ++i) {
+			BehaviorScript * const script = m_scripts[i].get();
+			
 			if (script->IsTerminated()) {
 				continue;
 			}
 
 			if (include_passive || script->IsActive()) {
-				action(script.get());
+				action(script);
 			}
-
-			scripts.push_back(std::move(script));
 		}
-
-		m_scripts = std::move(scripts);
 	}
 
 	template< typename ActionT >
 	inline void Scene::ForEachCamera(
 		ActionT action, bool include_passive) const {
-		
-		vector< UniquePtr< CameraNode > > cameras;
-		cameras.reserve(m_cameras.size());
-		
-		for (auto &camera : m_cameras) {
+
+		for (const auto &camera : m_cameras) {
 			
 			if (camera->IsTerminated()) {
 				continue;
 			}
-			
+
 			if (include_passive || camera->IsActive()) {
 				action(camera.get());
 			}
-
-			cameras.push_back(std::move(camera));
 		}
-
-		m_cameras = std::move(cameras);
-		
 	}
 
 	template< typename ActionT >
 	inline void Scene::ForEachModel(
 		ActionT action, bool include_passive) const {
-		
-		vector< UniquePtr< ModelNode > > models;
-		models.reserve(m_models.size());
-		
-		for (auto &model : m_models) {
+
+		for (const auto &model : m_models) {
 			
 			if (model->IsTerminated()) {
 				continue;
@@ -145,11 +135,7 @@ namespace mage {
 			if (include_passive || model->IsActive()) {
 				action(model.get());
 			}
-
-			models.push_back(std::move(model));
 		}
-		
-		m_models = std::move(models);
 	}
 
 	template< typename ActionT >
@@ -169,10 +155,7 @@ namespace mage {
 	inline void Scene::ForEachDirectionalLight(
 		ActionT action, bool include_passive) const {
 
-		vector< UniquePtr< DirectionalLightNode > > lights;
-		lights.reserve(m_directional_lights.size());
-		
-		for (auto &light : m_directional_lights) {
+		for (const auto &light : m_directional_lights) {
 			
 			if (light->IsTerminated()) {
 				continue;
@@ -181,21 +164,14 @@ namespace mage {
 			if (include_passive || light->IsActive()) {
 				action(light.get());
 			}
-
-			lights.push_back(std::move(light));
 		}
-		
-		m_directional_lights = std::move(lights);
 	}
 
 	template< typename ActionT >
 	inline void Scene::ForEachOmniLight(
 		ActionT action, bool include_passive) const {
-		
-		vector< UniquePtr< OmniLightNode > > lights;
-		lights.reserve(m_omni_lights.size());
-		
-		for (auto &light : m_omni_lights) {
+
+		for (const auto &light : m_omni_lights) {
 			
 			if (light->IsTerminated()) {
 				continue;
@@ -204,21 +180,14 @@ namespace mage {
 			if (include_passive || light->IsActive()) {
 				action(light.get());
 			}
-
-			lights.push_back(std::move(light));
 		}
-		
-		m_omni_lights = std::move(lights);
 	}
 
 	template< typename ActionT >
 	inline void Scene::ForEachSpotLight(
 		ActionT action, bool include_passive) const {
 
-		vector< UniquePtr< SpotLightNode > > lights;
-		lights.reserve(m_spot_lights.size());
-		
-		for (auto &light : m_spot_lights) {
+		for (const auto &light : m_spot_lights) {
 			
 			if (light->IsTerminated()) {
 				continue;
@@ -227,11 +196,7 @@ namespace mage {
 			if (include_passive || light->IsActive()) {
 				action(light.get());
 			}
-
-			lights.push_back(std::move(light));
 		}
-		
-		m_spot_lights = std::move(lights);
 	}
 
 	template< typename ActionT >
@@ -248,22 +213,15 @@ namespace mage {
 	inline void Scene::ForEachSprite(
 		ActionT action, bool include_passive) const {
 
-		vector< UniquePtr< SpriteNode > > sprites;
-		sprites.reserve(m_sprites.size());
-		
-		for (auto &sprite : m_sprites) {
+		for (const auto &sprite : m_sprites) {
 			
 			if (sprite->IsTerminated()) {
 				continue;
 			}
-			
+
 			if (include_passive || sprite->IsActive()) {
 				action(sprite.get());
 			}
-
-			sprites.push_back(std::move(sprite));
 		}
-		
-		m_sprites = std::move(sprites);
 	}
 }
\ No newline at end of file
@@ -71,6 +71,12 @@ namespace mage {
 		if (m_has_requested_scene) {
 			ApplyRequestedScene();
 		}
+		else {
+			// Remove the terminated scripts and nodes once per frame.
+			m_scene->Compact();
+			// Update the world matrices once per frame.
+			m_scene->UpdateTransforms();
+		}
 	}
 
 	void SceneManager::Render() const {
@@ -6,6 +6,7 @@
 #include "script\stats_script.hpp"
 #include "utils\system\system_usage.hpp"
 #include "core\engine_statistics.hpp"
+#include "rendering\rendering_manager.hpp"
 #include "utils\logging\error.hpp"
 
 #pragma endregion
@@ -61,11 +62,26 @@ namespace mage::script {
 		m_text->SetText(L"FPS: ");
 		m_text->AppendText(ColorString(std::to_wstring(m_last_frames_per_second), color));
 		
-		wchar_t buffer[64];
+		EngineStatistics * const stats = EngineStatistics::Get();
+		const RenderingManager * const rendering_manager 
+			= RenderingManager::Get();
+		const U32 arena_usage = static_cast< U32 >(
+			rendering_manager->GetFrameArenaUsage() >> 10);
+		const U32 arena_peak  = static_cast< U32 >(
+			rendering_manager->GetFrameArenaHighWaterMark() >> 10);
+
+		wchar_t buffer[256];
 		_snwprintf_s(buffer, _countof(buffer), 
-			L"\nSPF: %.2lfms\nCPU: %.1lf%%\nRAM: %uMB\nDCs: %u", 
+			L"\nSPF: %.2lfms\nCPU: %.1lf%%\nRAM: %uMB\nDCs: %u"
+			L"\nBinds: %u SH %u SRV %u IA\nState: %u issued %u filtered"
+			L"\nFrame Arena: %uKB (peak %uKB)\nDropped Cluster Lights: %u", 
 			m_last_milliseconds_per_frame, m_last_cpu_usage, m_last_ram_usage, 
-			EngineStatistics::Get()->GetNumberOfDrawCalls());
+			stats->GetNumberOfDrawCalls(), stats->GetNumberOfShaderBinds(),
+			stats->GetNumberOfSRVBinds(), stats->GetNumberOfMeshBinds(),
+			stats->GetNumberOfIssuedStateBinds(), 
+			stats->GetNumberOfFilteredStateBinds(),
+			arena_usage, arena_peak, 
+			stats->GetNumberOfDroppedClusterLights());
 		m_text->AppendText(buffer);
 	}
 }
\ No newline at end of file
@@ -29,6 +29,7 @@
 
 // Depth
 #include "shader\cso\depth\depth_VS.hpp"
+#include "shader\cso\depth\depth_instanced_VS.hpp"
 #include "shader\cso\depth\depth_transparent_VS.hpp"
 #include "shader\cso\depth\depth_transparent_PS.hpp"
 
@@ -93,6 +94,7 @@
 // Transform
 #include "shader\cso\transform\minimal_transform_VS.hpp"
 #include "shader\cso\transform\transform_VS.hpp"
+#include "shader\cso\transform\transform_instanced_VS.hpp"
 
 // Voxelization
 #include "shader\cso\voxelization\voxelization_GS.hpp"
@@ -258,6 +260,13 @@ namespace mage {
 			VertexPositionNormalTexture::s_nb_input_elements);
 	}
 
+	SharedPtr< const VertexShader > CreateDepthInstancedVS() {
+		return ResourceManager::Get()->GetOrCreateVS(
+			MAGE_SHADER_ARGS(g_depth_instanced_VS),
+			VertexPositionNormalTexture::s_input_element_desc,
+			VertexPositionNormalTexture::s_nb_input_elements);
+	}
+
 	SharedPtr< const VertexShader > CreateDepthTransparentVS() {
 		return ResourceManager::Get()->GetOrCreateVS(
 			MAGE_SHADER_ARGS(g_depth_transparent_VS),
@@ -556,6 +565,33 @@ namespace mage {
 			VertexPositionNormalTexture::s_nb_input_elements);
 	}
 
+	SharedPtr< const VertexShader > CreateTransformInstancedVS() {
+		return ResourceManager::Get()->GetOrCreateVS(
+			MAGE_SHADER_ARGS(g_transform_instanced_VS),
+			VertexPositionNormalTexture::s_input_element_desc,
+			VertexPositionNormalTexture::s_nb_input_elements);
+	}
+
+	ComPtr< ID3D11InputLayout > CreateModelInputLayout(ID3D11Device5 *device,
+		const D3D11_INPUT_ELEMENT_DESC *input_element_desc, 
+		size_t nb_input_elements) {
+
+		Assert(device);
+		Assert(input_element_desc);
+
+		ComPtr< ID3D11InputLayout > input_layout;
+		const HRESULT result = device->CreateInputLayout(
+										input_element_desc, 
+										static_cast< U32 >(nb_input_elements),
+										g_transform_VS, 
+										sizeof(g_transform_VS),
+										input_layout.ReleaseAndGetAddressOf());
+		ThrowIfFailed(result,
+			"Vertex input layout creation failed: %08X.", result);
+
+		return input_layout;
+	}
+
 #pragma endregion
 
 	//-------------------------------------------------------------------------
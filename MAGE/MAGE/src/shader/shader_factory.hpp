@@ -287,6 +287,19 @@ namespace mage {
 	 */
 	SharedPtr< const VertexShader > CreateDepthVS();
 
+	/**
+	 Creates a depth instanced vertex shader.
+
+	 @pre			The resource manager associated with the current engine 
+					must be loaded.
+	 @pre			The rendering manager associated with the current engine 
+					must be loaded.
+	 @return		A pointer to the depth instanced vertex shader.
+	 @throws		FormattedException
+					Failed to create the vertex shader.
+	 */
+	SharedPtr< const VertexShader > CreateDepthInstancedVS();
+
 	/**
 	 Creates a depth transparent vertex shader.
 
@@ -737,6 +750,19 @@ namespace mage {
 	 */
 	SharedPtr< const VertexShader > CreateTransformVS();
 
+	/**
+	 Creates a transform instanced vertex shader.
+
+	 @pre			The resource manager associated with the current engine 
+					must be loaded.
+	 @pre			The rendering manager associated with the current engine 
+					must be loaded.
+	 @return		A pointer to the transform instanced vertex shader.
+	 @throws		FormattedException
+					Failed to create the vertex shader.
+	 */
+	SharedPtr< const VertexShader > CreateTransformInstancedVS();
+
 	/**
 	 Creates a minimal transform vertex shader.
 
@@ -750,6 +776,32 @@ namespace mage {
 	 */
 	SharedPtr< const VertexShader > CreateMinimalTransformVS();
 
+	/**
+	 Creates a vertex input layout for models.
+
+	 The vertex input layout is validated against the input signature of the 
+	 transform vertex shader which is shared by all vertex shaders for 
+	 models.
+
+	 @pre			@a device is not equal to @c nullptr.
+	 @pre			@a input_element_desc is not equal to @c nullptr.
+	 @pre			The array pointed to by @a input_element_desc contains 
+					@a nb_input_elements elements.
+	 @param[in]		device
+					A pointer to the device.
+	 @param[in]		input_element_desc
+					A pointer to an array of input element descriptors.
+	 @param[in]		nb_input_elements
+					The number of elements contained in the 
+					@a input_element_desc array.
+	 @return		A pointer to the vertex input layout.
+	 @throws		FormattedException
+					Failed to create the vertex input layout.
+	 */
+	ComPtr< ID3D11InputLayout > CreateModelInputLayout(ID3D11Device5 *device,
+		const D3D11_INPUT_ELEMENT_DESC *input_element_desc, 
+		size_t nb_input_elements);
+
 #pragma endregion
 
 	//-------------------------------------------------------------------------
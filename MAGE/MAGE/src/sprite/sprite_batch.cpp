@@ -19,11 +19,6 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
-	SpriteBatch::SpriteBatch()
-		: SpriteBatch(
-			Pipeline::GetDevice(), 
-			Pipeline::GetImmediateDeviceContext()) {}
-
 	SpriteBatch::SpriteBatch(
 		ID3D11Device5 *device, ID3D11DeviceContext4 *device_context)
 		: m_device_context(device_context), 
@@ -168,18 +168,6 @@ namespace mage {
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
 
-		/**
-		 Constructs a sprite batch.
-
-		 @pre			The device associated of the rendering manager 
-						associated with the current engine must be loaded.
-		 @pre			The device context associated of the rendering manager 
-						associated with the current engine must be loaded.
-		 @pre			The renderer associated with the current engine must be 
-						loaded.
-		 */
-		SpriteBatch();
-
 		/**
 		 Constructs a sprite batch.
 
@@ -192,7 +180,8 @@ namespace mage {
 		 @param[in]		device_context
 						A pointer to the device context.
 		 */
-		SpriteBatch(ID3D11Device5 *device, ID3D11DeviceContext4 *device_context);
+		explicit SpriteBatch(ID3D11Device5 *device, 
+			ID3D11DeviceContext4 *device_context);
 
 		/**
 		 Constructs a sprite batch from the given sprite batch.
@@ -42,6 +42,10 @@ namespace mage {
 			L"assets/textures/reference.dds");
 	}
 
+	SharedPtr< const Texture > CreateTextureFromFile(const wstring &fname) {
+		return ResourceManager::Get()->GetOrCreateTexture(fname);
+	}
+
 	SharedPtr< const Texture > CreateBlackTexture() {
 		const D3D11_TEXTURE2D_DESC texture_desc 
 			= CreateSingleColorTexture2DDesc();
@@ -41,6 +41,21 @@ namespace mage {
 	 */
 	SharedPtr< const Texture > CreateReferenceTexture();
 
+	/**
+	 Creates a texture from the given file.
+
+	 @pre			The resource manager associated with the current engine 
+					must be loaded.
+	 @pre			The rendering manager associated with the current engine 
+					must be loaded.
+	 @param[in]		fname
+					A reference to the filename of the texture.
+	 @return		A pointer to the texture.
+	 @throws		FormattedException
+					Failed to create the texture.
+	 */
+	SharedPtr< const Texture > CreateTextureFromFile(const wstring &fname);
+
 	/**
 	 Creates a black texture.
 
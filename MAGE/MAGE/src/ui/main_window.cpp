@@ -71,7 +71,10 @@ namespace mage {
 
 			case static_cast< int >(HotKey::PrintScreen) :
 			case static_cast< int >(HotKey::AltPrintScreen): {
-				SwapChain::Get()->TakeScreenShot();
+				SwapChain * const swap_chain = SwapChain::Get();
+				if (swap_chain) {
+					swap_chain->TakeScreenShot();
+				}
 				[[fallthrough]];
 			}
 
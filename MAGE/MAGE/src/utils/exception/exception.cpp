@@ -71,7 +71,7 @@ namespace mage {
 			// Retrieve the additional arguments after format.
 			va_start(args, format);
 
-			const FormattedException exception = FormattedException(format);
+			const FormattedException exception = FormattedException(format, args);
 
 			// End using variable argument list.
 			va_end(args);
@@ -93,7 +93,7 @@ namespace mage {
 			// Retrieve the additional arguments after format.
 			va_start(args, format);
 
-			const FormattedException exception = FormattedException(format);
+			const FormattedException exception = FormattedException(format, args);
 
 			// End using variable argument list.
 			va_end(args);
@@ -115,7 +115,7 @@ namespace mage {
 			// Retrieve the additional arguments after format.
 			va_start(args, format);
 
-			const FormattedException exception = FormattedException(format);
+			const FormattedException exception = FormattedException(format, args);
 
 			// End using variable argument list.
 			va_end(args);
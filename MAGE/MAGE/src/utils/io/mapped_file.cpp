@@ -0,0 +1,80 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "utils\io\mapped_file.hpp"
+#include "utils\exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	MappedFile::MappedFile(wstring fname)
+		: m_fname(std::move(fname)),
+		m_file_mapping(),
+		m_data(nullptr),
+		m_size(0) {
+
+		UniqueHandle file_handle(SafeHandle(CreateFile2(
+			m_fname.c_str(), GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, nullptr)));
+		ThrowIfFailed((nullptr != file_handle),
+			"%ls: could not open file.", m_fname.c_str());
+
+		FILE_STANDARD_INFO file_info;
+		{
+			const BOOL result = GetFileInformationByHandleEx(
+				file_handle.get(), FileStandardInfo, &file_info, sizeof(file_info));
+			ThrowIfFailed(result,
+				"%ls: could not retrieve file information.", m_fname.c_str());
+		}
+
+		// Empty files cannot be mapped.
+		m_size = static_cast< size_t >(file_info.EndOfFile.QuadPart);
+		ThrowIfFailed((0 != m_size),
+			"%ls: empty file.", m_fname.c_str());
+
+		// The file mapping object keeps the file open.
+		m_file_mapping.reset(CreateFileMapping(
+			file_handle.get(), nullptr, PAGE_READONLY, 0u, 0u, nullptr));
+		ThrowIfFailed((nullptr != m_file_mapping),
+			"%ls: could not create file mapping.", m_fname.c_str());
+
+		m_data = static_cast< const U8 * >(MapViewOfFile(
+			m_file_mapping.get(), FILE_MAP_READ, 0u, 0u, 0u));
+		ThrowIfFailed((nullptr != m_data),
+			"%ls: could not map file.", m_fname.c_str());
+	}
+
+	MappedFile::MappedFile(MappedFile &&file) noexcept
+		: m_fname(std::move(file.m_fname)),
+		m_file_mapping(std::move(file.m_file_mapping)),
+		m_data(std::exchange(file.m_data, nullptr)),
+		m_size(std::exchange(file.m_size, 0)) {}
+
+	MappedFile::~MappedFile() {
+		if (m_data) {
+			UnmapViewOfFile(m_data);
+		}
+	}
+
+	void MappedFile::Prefetch() const noexcept {
+		WIN32_MEMORY_RANGE_ENTRY range;
+		range.VirtualAddress = const_cast< U8 * >(m_data);
+		range.NumberOfBytes  = m_size;
+
+		PrefetchVirtualMemory(GetCurrentProcess(), 1u, &range, 0u);
+	}
+}
\ No newline at end of file
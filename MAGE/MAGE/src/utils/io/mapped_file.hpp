@@ -0,0 +1,153 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "utils\type\types.hpp"
+#include "utils\memory\memory.hpp"
+#include "utils\string\string.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of read-only memory-mapped files.
+	 */
+	class MappedFile final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a memory-mapped file.
+
+		 @param[in]		fname
+						The filename.
+		 @throws		FormattedException
+						Failed to map the given file.
+		 */
+		explicit MappedFile(wstring fname);
+
+		/**
+		 Constructs a memory-mapped file from the given memory-mapped file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file to copy.
+		 */
+		MappedFile(const MappedFile &file) = delete;
+
+		/**
+		 Constructs a memory-mapped file by moving the given memory-mapped
+		 file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file to move.
+		 */
+		MappedFile(MappedFile &&file) noexcept;
+
+		/**
+		 Destructs this memory-mapped file.
+		 */
+		~MappedFile();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given memory-mapped file to this memory-mapped file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file to copy.
+		 @return		A reference to the copy of the given memory-mapped
+						file (i.e. this memory-mapped file).
+		 */
+		MappedFile &operator=(const MappedFile &file) = delete;
+
+		/**
+		 Moves the given memory-mapped file to this memory-mapped file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file to move.
+		 @return		A reference to the moved memory-mapped file (i.e. this
+						memory-mapped file).
+		 */
+		MappedFile &operator=(MappedFile &&file) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the filename of this memory-mapped file.
+
+		 @return		A reference to the filename of this memory-mapped file.
+		 */
+		const wstring &GetFilename() const noexcept {
+			return m_fname;
+		}
+
+		/**
+		 Returns the mapped bytes of this memory-mapped file.
+
+		 @return		A pointer to the mapped bytes of this memory-mapped
+						file.
+		 */
+		const U8 *GetData() const noexcept {
+			return m_data;
+		}
+
+		/**
+		 Returns the size of this memory-mapped file.
+
+		 @return		The size in bytes of this memory-mapped file.
+		 */
+		size_t GetSize() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Prefetches all mapped bytes of this memory-mapped file.
+
+		 The whole view is brought into memory with a single sequential read 
+		 instead of one page fault per accessed page. Failures are ignored, 
+		 since the pages are still faulted in on demand.
+		 */
+		void Prefetch() const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The filename of this memory-mapped file.
+		 */
+		wstring m_fname;
+
+		/**
+		 A handle to the file mapping object of this memory-mapped file.
+		 */
+		UniqueHandle m_file_mapping;
+
+		/**
+		 A pointer to the mapped bytes of this memory-mapped file.
+		 */
+		const U8 *m_data;
+
+		/**
+		 The size in bytes of this memory-mapped file.
+		 */
+		size_t m_size;
+	};
+}
\ No newline at end of file
@@ -14,6 +14,7 @@
 #pragma region
 
 #include <algorithm>
+#include <utility>
 
 #pragma endregion
 
@@ -25,9 +26,17 @@ namespace mage {
 	MemoryArena::MemoryArena(size_t maximum_block_size, size_t alignment)
 		: m_alignment(alignment), m_maximum_block_size(maximum_block_size),
 		m_current_block(MemoryBlock(0, nullptr)), m_current_block_pos(0),
-		m_used_blocks(), m_available_blocks() {}
-
-	MemoryArena::MemoryArena(MemoryArena &&arena) = default;
+		m_allocated_size(0), m_used_blocks(), m_available_blocks() {}
+
+	MemoryArena::MemoryArena(MemoryArena &&arena)
+		: m_alignment(arena.m_alignment), 
+		m_maximum_block_size(arena.m_maximum_block_size),
+		m_current_block(std::exchange(arena.m_current_block, 
+			                          MemoryBlock(0, nullptr))), 
+		m_current_block_pos(std::exchange(arena.m_current_block_pos, 0)),
+		m_allocated_size(std::exchange(arena.m_allocated_size, 0)), 
+		m_used_blocks(std::move(arena.m_used_blocks)), 
+		m_available_blocks(std::move(arena.m_available_blocks)) {}
 
 	MemoryArena::~MemoryArena() {
 		FreeAligned(GetCurrentBlockPtr());
@@ -56,9 +65,19 @@ namespace mage {
 	}
 
 	void MemoryArena::Reset() {
+		// Keep all blocks (including the current block) for reuse. The 
+		// vectors of blocks retain their capacity, so that resetting and 
+		// refilling this memory arena does not allocate in steady state.
+		if (GetCurrentBlockPtr()) {
+			m_available_blocks.push_back(m_current_block);
+		}
+		m_available_blocks.insert(m_available_blocks.end(), 
+			m_used_blocks.begin(), m_used_blocks.end());
+		m_used_blocks.clear();
+
 		m_current_block_pos = 0;
 		m_current_block     = MemoryBlock(0, nullptr);
-		m_available_blocks.splice(m_available_blocks.begin(), m_used_blocks);
+		m_allocated_size    = 0;
 	}
 
 	void *MemoryArena::Alloc(size_t size) {
@@ -70,6 +89,7 @@ namespace mage {
 			// Store current block (if existing) as used block.
 			if (GetCurrentBlockPtr()) {
 				m_used_blocks.push_back(m_current_block);
+				m_current_block = MemoryBlock(0, nullptr);
 			}
 
 			// Fetch new block from available blocks.
@@ -105,6 +125,7 @@ namespace mage {
 			(void *)(m_current_block.second + m_current_block_pos);
 		
 		m_current_block_pos += size;
+		m_allocated_size    += size;
 		
 		return ptr;
 	}
@@ -11,6 +11,16 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <memory>
+#include <type_traits>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -123,6 +133,17 @@ namespace mage {
 		 */
 		size_t GetTotalBlockSize() const noexcept;
 
+		/**
+		 Returns the size (in bytes) of the memory allocated on this memory 
+		 arena since the last reset.
+
+		 @return		The size (in bytes) of the memory allocated on this 
+						memory arena since the last reset.
+		 */
+		size_t GetAllocatedSize() const noexcept {
+			return m_allocated_size;
+		}
+
 		/**
 		 Returns a pointer to the current block of this memory arena.
 
@@ -133,7 +154,7 @@ namespace mage {
 		}
 
 		/**
-		 Resets this memory arena.
+		 Resets this memory arena. All blocks are kept for reuse.
 		 */
 		void Reset();
 
@@ -286,10 +307,34 @@ namespace mage {
 				~rebind() = delete;
 			};
 
+			/**
+			 Allocators are propagated on container copy assignment, so 
+			 containers can be rebound to another memory arena.
+			 */
+			using propagate_on_container_copy_assignment = std::true_type;
+
+			/**
+			 Allocators are propagated on container move assignment, so 
+			 containers can be rebound to another memory arena.
+			 */
+			using propagate_on_container_move_assignment = std::true_type;
+
+			/**
+			 Allocators are propagated on container swap.
+			 */
+			using propagate_on_container_swap = std::true_type;
+
 			//-----------------------------------------------------------------
 			// Constructors and Destructors
 			//-----------------------------------------------------------------
 
+			/**
+			 Constructs an allocator which is not bound to a memory arena and 
+			 allocates from the general heap instead.
+			 */
+			Allocator() noexcept
+				: m_memory_arena(nullptr) {}
+
 			/**
 			 Constructs an allocator from the given allocator.
 
@@ -335,7 +380,7 @@ namespace mage {
 			 @return		A reference to the copy of the given allocator 
 							(i.e. this allocator).
 			 */
-			Allocator &operator=(const Allocator &allocator) noexcept = delete;
+			Allocator &operator=(const Allocator &allocator) noexcept = default;
 
 			/**
 			 Moves the given allocator to this allocator.
@@ -345,7 +390,7 @@ namespace mage {
 			 @return		A reference to the moved allocator (i.e. this 
 							allocator).
 			 */
-			Allocator &operator=(Allocator &&allocator) noexcept = delete;
+			Allocator &operator=(Allocator &&allocator) noexcept = default;
 
 			//-----------------------------------------------------------------
 			// Member Methods
@@ -396,7 +441,11 @@ namespace mage {
 							Failed to allocate the memory block.
 			 */
 			DataT *allocate(size_t count) const {
-				DataT * const data = m_memory_stack->AllocData(count);
+				if (!m_memory_arena) {
+					return std::allocator< DataT >().allocate(count);
+				}
+
+				DataT * const data = m_memory_arena->AllocData< DataT >(count);
 				if (!data) {
 					throw std::bad_alloc();
 				}
@@ -450,9 +499,14 @@ namespace mage {
 							The number of element objects allocated on the call 
 							to allocate for this block of storage.
 			 @note			The elements in the array are not destroyed.
+			 @note			Storage allocated on a memory arena is only 
+							released when the memory arena is reset.
 			 */
-			void deallocate([[maybe_unused]] DataT *data, 
-				[[maybe_unused]] size_t count) const {}
+			void deallocate(DataT *data, size_t count) const {
+				if (!m_memory_arena) {
+					std::allocator< DataT >().deallocate(data, count);
+				}
+			}
 		
 			/**
 			 Constructs an element object of type @c DataU on the location 
@@ -501,7 +555,7 @@ namespace mage {
 							allocator, and vice versa. @c false otherwise.
 			 */
 			bool operator==(const Allocator &rhs) const noexcept {
-				return m_memory_arena = rhs.m_memory_arena;
+				return m_memory_arena == rhs.m_memory_arena;
 			}
 
 			/**
@@ -525,6 +579,9 @@ namespace mage {
 
 			friend class MemoryArena;
 
+			template< typename DataU >
+			friend struct Allocator;
+
 			//-----------------------------------------------------------------
 			// Constructors
 			//-----------------------------------------------------------------
@@ -548,7 +605,7 @@ namespace mage {
 			/**
 			 A pointer to the memory arena of this allocator.
 			 */
-			MemoryArena * const m_memory_arena;
+			MemoryArena *m_memory_arena;
 		};
 
 		/**
@@ -559,7 +616,7 @@ namespace mage {
 		 @return		An allocator for this memory arena.
 		 */
 		template< typename DataT >
-		Allocator< DataT > GetAllocator() const noexcept{
+		Allocator< DataT > GetAllocator() noexcept {
 			return Allocator< DataT >(this);
 		}
 
@@ -597,17 +654,52 @@ namespace mage {
 		 The current block position of this memory arena.
 		 */
 		size_t m_current_block_pos;
+
+		/**
+		 The size in bytes of the memory allocated on this memory arena since 
+		 the last reset.
+		 */
+		size_t m_allocated_size;
 		
 		/**
 		 A collection containing the used blocks of this memory arena.
 		 */
-		list< MemoryBlock > m_used_blocks;
+		vector< MemoryBlock > m_used_blocks;
 
 		/**
 		 A collection containing the available blocks of this memory arena.
 		 */
-		list< MemoryBlock > m_available_blocks;
+		vector< MemoryBlock > m_available_blocks;
 	};
+
+	/**
+	 A vector type allocating its elements on a memory arena.
+
+	 @tparam		DataT
+					The data type.
+	 */
+	template< typename DataT >
+	using ArenaVector = vector< DataT, MemoryArena::Allocator< DataT > >;
+
+	/**
+	 Clears the given vector and rebinds it to the given memory arena. The 
+	 capacity of the vector is reserved on the memory arena, so that refilling 
+	 the vector up to its previous capacity does not allocate again.
+
+	 @pre			The storage of the vector is not allocated on a memory 
+					arena which has been reset since.
+	 @tparam		DataT
+					The data type.
+	 @param[in,out]	v
+					A reference to the vector.
+	 @param[in]		memory_arena
+					A pointer to the memory arena. If @c nullptr, the vector 
+					allocates from the general heap.
+	 @throws		std::bad_alloc
+					Failed to allocate the memory block.
+	 */
+	template< typename DataT >
+	void RebindArenaVector(ArenaVector< DataT > &v, MemoryArena *memory_arena);
 }
 
 //-----------------------------------------------------------------------------
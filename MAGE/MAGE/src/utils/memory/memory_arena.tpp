@@ -24,4 +24,16 @@ namespace mage {
 
 		return ptr;
 	}
+
+	template< typename DataT >
+	void RebindArenaVector(ArenaVector< DataT > &v, MemoryArena *memory_arena) {
+		// Memory arenas never destruct their data.
+		static_assert(std::is_trivially_destructible_v< DataT >);
+
+		const size_t capacity = v.capacity();
+		v = memory_arena 
+			? ArenaVector< DataT >(memory_arena->GetAllocator< DataT >())
+			: ArenaVector< DataT >();
+		v.reserve(capacity);
+	}
 }
\ No newline at end of file
@@ -427,7 +427,7 @@ namespace mage {
 							Failed to allocate the memory block.
 			 */
 			DataT *allocate(size_t count) const {
-				DataT * const data = m_memory_stack->AllocData(count);
+				DataT * const data = m_memory_stack->AllocData< DataT >(count);
 				if (!data) {
 					throw std::bad_alloc();
 				}
@@ -532,7 +532,7 @@ namespace mage {
 							allocator, and vice versa. @c false otherwise.
 			 */
 			bool operator==(const Allocator &rhs) const noexcept {
-				return m_memory_stack = rhs.m_memory_stack;
+				return m_memory_stack == rhs.m_memory_stack;
 			}
 
 			/**
@@ -556,6 +556,9 @@ namespace mage {
 
 			friend class SingleEndedMemoryStack;
 
+			template< typename DataU >
+			friend struct Allocator;
+
 			//-----------------------------------------------------------------
 			// Constructors
 			//-----------------------------------------------------------------
@@ -590,7 +593,7 @@ namespace mage {
 		 @return		An allocator for this single-ended memory stack.
 		 */
 		template< typename DataT >
-		Allocator< DataT > GetAllocator() const noexcept{
+		Allocator< DataT > GetAllocator() noexcept {
 			return Allocator< DataT >(this);
 		}
 
@@ -1116,7 +1119,7 @@ namespace mage {
 							Failed to allocate the memory block.
 			 */
 			DataT *allocate(size_t count) const {
-				DataT * const data = m_memory_stack->AllocDataLow(count);
+				DataT * const data = m_memory_stack->AllocDataLow< DataT >(count);
 				if (!data) {
 					throw std::bad_alloc();
 				}
@@ -1222,7 +1225,7 @@ namespace mage {
 							low allocator, and vice versa. @c false otherwise.
 			 */
 			bool operator==(const LowAllocator &rhs) const noexcept {
-				return m_memory_stack = rhs.m_memory_stack;
+				return m_memory_stack == rhs.m_memory_stack;
 			}
 
 			/**
@@ -1247,6 +1250,9 @@ namespace mage {
 
 			friend class DoubleEndedMemoryStack;
 
+			template< typename DataU >
+			friend struct LowAllocator;
+
 			//-----------------------------------------------------------------
 			// Constructors
 			//-----------------------------------------------------------------
@@ -1501,7 +1507,7 @@ namespace mage {
 							Failed to allocate the memory block.
 			 */
 			DataT *allocate(size_t count) const {
-				DataT * const data = m_memory_stack->AllocDataHigh(count);
+				DataT * const data = m_memory_stack->AllocDataHigh< DataT >(count);
 				if (!data) {
 					throw std::bad_alloc();
 				}
@@ -1607,7 +1613,7 @@ namespace mage {
 							high allocator, and vice versa. @c false otherwise.
 			 */
 			bool operator==(const HighAllocator &rhs) const noexcept {
-				return m_memory_stack = rhs.m_memory_stack;
+				return m_memory_stack == rhs.m_memory_stack;
 			}
 
 			/**
@@ -1632,6 +1638,9 @@ namespace mage {
 
 			friend class DoubleEndedMemoryStack;
 
+			template< typename DataU >
+			friend struct HighAllocator;
+
 			//-----------------------------------------------------------------
 			// Constructors
 			//-----------------------------------------------------------------
@@ -1666,7 +1675,7 @@ namespace mage {
 		 @return		A low allocator for this single-ended memory stack.
 		 */
 		template< typename DataT >
-		LowAllocator< DataT > GetLowAllocator() const noexcept{
+		LowAllocator< DataT > GetLowAllocator() noexcept {
 			return LowAllocator< DataT >(this);
 		}
 
@@ -1678,7 +1687,7 @@ namespace mage {
 		 @return		A high allocator for this single-ended memory stack.
 		 */
 		template< typename DataT >
-		HighAllocator< DataT > GetHighAllocator() const noexcept{
+		HighAllocator< DataT > GetHighAllocator() noexcept {
 			return HighAllocator< DataT >(this);
 		}
 
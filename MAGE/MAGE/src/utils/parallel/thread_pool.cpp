@@ -0,0 +1,93 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "utils\parallel\thread_pool.hpp"
+#include "utils\logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <objbase.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	ThreadPool::ThreadPool(size_t nb_threads)
+		: m_threads(),
+		m_tasks(),
+		m_mutex(),
+		m_condition(),
+		m_terminate(false) {
+
+		Assert(0 != nb_threads);
+
+		m_threads.reserve(nb_threads);
+		for (size_t i = 0; i < nb_threads; ++i) {
+			m_threads.emplace_back(&ThreadPool::Run, this);
+		}
+	}
+
+	ThreadPool::~ThreadPool() {
+		{
+			std::lock_guard< std::mutex > lock(m_mutex);
+			m_terminate = true;
+		}
+		m_condition.notify_all();
+
+		for (auto &thread : m_threads) {
+			thread.join();
+		}
+	}
+
+	void ThreadPool::Enqueue(Task task) {
+		{
+			std::lock_guard< std::mutex > lock(m_mutex);
+			Assert(!m_terminate);
+			m_tasks.push(std::move(task));
+		}
+		m_condition.notify_one();
+	}
+
+	void ThreadPool::Run() {
+		// Tasks may create COM objects (e.g. WIC decoders for textures).
+		const HRESULT result = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+		if (FAILED(result)) {
+			Warning("COM initialization of worker thread failed: %08X.", result);
+		}
+
+		while (true) {
+			Task task;
+
+			{
+				std::unique_lock< std::mutex > lock(m_mutex);
+				m_condition.wait(lock, [this]() {
+					return m_terminate || !m_tasks.empty();
+				});
+
+				// Terminate only after all enqueued tasks are executed.
+				if (m_tasks.empty()) {
+					break;
+				}
+
+				task = std::move(m_tasks.front());
+				m_tasks.pop();
+			}
+
+			task();
+		}
+
+		if (SUCCEEDED(result)) {
+			CoUninitialize();
+		}
+	}
+}
\ No newline at end of file
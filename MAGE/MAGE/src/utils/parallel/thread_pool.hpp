@@ -0,0 +1,175 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "utils\type\types.hpp"
+#include "utils\collection\collection.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of thread pools executing tasks in first-in first-out order on a
+	 fixed number of worker threads.
+	 */
+	class ThreadPool final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Type Declarations and Definitions
+		//---------------------------------------------------------------------
+
+		/**
+		 The task type of thread pools.
+		 */
+		using Task = std::function< void() >;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a thread pool.
+
+		 @pre			@a nb_threads is not equal to zero.
+		 @param[in]		nb_threads
+						The number of worker threads.
+		 */
+		explicit ThreadPool(size_t nb_threads);
+
+		/**
+		 Constructs a thread pool from the given thread pool.
+
+		 @param[in]		thread_pool
+						A reference to the thread pool to copy.
+		 */
+		ThreadPool(const ThreadPool &thread_pool) = delete;
+
+		/**
+		 Constructs a thread pool by moving the given thread pool.
+
+		 @param[in]		thread_pool
+						A reference to the thread pool to move.
+		 */
+		ThreadPool(ThreadPool &&thread_pool) = delete;
+
+		/**
+		 Destructs this thread pool.
+
+		 All enqueued tasks are executed before the worker threads are
+		 joined.
+		 */
+		~ThreadPool();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given thread pool to this thread pool.
+
+		 @param[in]		thread_pool
+						A reference to the thread pool to copy.
+		 @return		A reference to the copy of the given thread pool (i.e.
+						this thread pool).
+		 */
+		ThreadPool &operator=(const ThreadPool &thread_pool) = delete;
+
+		/**
+		 Moves the given thread pool to this thread pool.
+
+		 @param[in]		thread_pool
+						A reference to the thread pool to move.
+		 @return		A reference to the moved thread pool (i.e. this thread
+						pool).
+		 */
+		ThreadPool &operator=(ThreadPool &&thread_pool) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of worker threads of this thread pool.
+
+		 @return		The number of worker threads of this thread pool.
+		 */
+		size_t GetNumberOfThreads() const noexcept {
+			return m_threads.size();
+		}
+
+		/**
+		 Enqueues the given task for execution on some worker thread of this
+		 thread pool.
+
+		 @pre			The given task does not throw.
+		 @param[in]		task
+						The task.
+		 */
+		void Enqueue(Task task);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Executes the enqueued tasks of this thread pool until this thread
+		 pool is destructed.
+		 */
+		void Run();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The worker threads of this thread pool.
+		 */
+		vector< std::thread > m_threads;
+
+		/**
+		 The enqueued tasks of this thread pool.
+		 */
+		std::queue< Task > m_tasks;
+
+		/**
+		 The mutex for accessing the enqueued tasks of this thread pool.
+		 */
+		std::mutex m_mutex;
+
+		/**
+		 The condition variable for signaling enqueued tasks and termination
+		 to the worker threads of this thread pool.
+		 */
+		std::condition_variable m_condition;
+
+		/**
+		 A flag indicating whether the worker threads of this thread pool
+		 must terminate.
+		 */
+		bool m_terminate;
+	};
+}
\ No newline at end of file
@@ -8,6 +8,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -449,6 +458,219 @@ namespace mage {
 			TokenResult::Valid : TokenResult::Invalid;
 	}
 
+#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// String Conversion Utilities: Scanning
+	//-------------------------------------------------------------------------
+#pragma region
+
+	namespace {
+
+		/**
+		 Checks whether the given character is a decimal digit.
+
+		 @param[in]		c
+						The character.
+		 @return		@c true if the given character is a decimal digit. 
+						@c false otherwise.
+		 */
+		inline bool IsDigit(char c) noexcept {
+			return static_cast< U32 >(c - '0') < 10u;
+		}
+
+		/**
+		 The powers of ten which are exactly representable as a @c F64.
+		 */
+		constexpr F64 g_exact_powers_of_10[] = {
+			1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 
+			1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 
+			1e22
+		};
+
+		/**
+		 The maximum number of significant decimal digits which fit in an 
+		 @c U64 without overflow.
+		 */
+		constexpr size_t g_max_significant_digits = 19;
+
+		/**
+		 The maximum absolute value of explicit exponents. Larger exponents 
+		 are clamped (which does not change the result, since the value 
+		 cannot be computed exactly anyway) to avoid overflows.
+		 */
+		constexpr S32 g_max_explicit_exponent = 1000000;
+
+		/**
+		 The maximum length of the strings scanned by 
+		 @c ScanF32Fallback.
+		 */
+		constexpr size_t g_max_fallback_length = 63;
+
+		/**
+		 Scans a @c F32 from the prefix of the given string using 
+		 @c strtof.
+
+		 @param[in,out]	str
+						A reference to a pointer to the begin (inclusive) of 
+						the string to scan.
+		 @param[in]		end
+						A pointer to the end (exclusive) of the string to 
+						scan.
+		 @param[out]	result
+						A reference to the @c F32 represented by the prefix of 
+						the given string.
+		 @return		A token result indicating whether the scanning of the 
+						prefix of the given string to a @c F32 succeeded or 
+						not. Tokens longer than 
+						@c g_max_fallback_length characters are invalid.
+		 */
+		TokenResult ScanF32Fallback(const char *&str, const char *end, 
+			F32 &result) noexcept {
+			
+			// Copy the prefix to obtain a null-terminated byte string.
+			char buffer[g_max_fallback_length + 1];
+			size_t length = 0;
+			while (&str[length] != end
+				   && ' ' != str[length] && '\t' != str[length] 
+				   && '\r' != str[length] && '\n' != str[length]) {
+				
+				if (g_max_fallback_length == length) {
+					// Do not scan a truncated token.
+					return TokenResult::Invalid;
+				}
+
+				buffer[length] = str[length];
+				++length;
+			}
+			buffer[length] = '\0';
+
+			char *inner_context = nullptr;
+			result = strtof(buffer, &inner_context);
+			if (buffer == inner_context) {
+				return TokenResult::Invalid;
+			}
+
+			str += inner_context - buffer;
+			return TokenResult::Valid;
+		}
+	}
+
+	TokenResult ScanS32(const char *&str, const char *end, 
+		S32 &result) noexcept {
+		
+		Assert(str);
+		Assert(end);
+
+		const char *it = str;
+		if (it == end) {
+			return TokenResult::None;
+		}
+
+		const bool negative = ('-' == *it);
+		if (negative || '+' == *it) {
+			++it;
+		}
+
+		const char * const digits = it;
+		U64 value = 0;
+		while (it != end && IsDigit(*it)) {
+			value = 10u * value + static_cast< U64 >(*it - '0');
+			// Bail out before the value can overflow.
+			if (value > 2147483648ull) {
+				return TokenResult::Invalid;
+			}
+			++it;
+		}
+
+		if (digits == it || (!negative && value > 2147483647ull)) {
+			return TokenResult::Invalid;
+		}
+
+		result = negative ? static_cast< S32 >(0ll - static_cast< S64 >(value)) 
+			              : static_cast< S32 >(value);
+		str = it;
+		return TokenResult::Valid;
+	}
+
+	TokenResult ScanF32(const char *&str, const char *end, 
+		F32 &result) noexcept {
+		
+		Assert(str);
+		Assert(end);
+
+		const char *it = str;
+		if (it == end) {
+			return TokenResult::None;
+		}
+
+		const bool negative = ('-' == *it);
+		if (negative || '+' == *it) {
+			++it;
+		}
+
+		U64 mantissa = 0;
+		S32 exponent = 0;
+		size_t nb_digits = 0;
+		size_t nb_significant_digits = 0;
+
+		// Integral part
+		for (; it != end && IsDigit(*it); ++it, ++nb_digits) {
+			if (nb_significant_digits < g_max_significant_digits) {
+				mantissa = 10u * mantissa + static_cast< U64 >(*it - '0');
+				nb_significant_digits += (0u != mantissa);
+			}
+			else {
+				++exponent;
+			}
+		}
+
+		// Fractional part
+		if (it != end && '.' == *it) {
+			for (++it; it != end && IsDigit(*it); ++it, ++nb_digits) {
+				if (nb_significant_digits < g_max_significant_digits) {
+					mantissa = 10u * mantissa + static_cast< U64 >(*it - '0');
+					nb_significant_digits += (0u != mantissa);
+					--exponent;
+				}
+			}
+		}
+
+		if (0 == nb_digits) {
+			// e.g. inf, nan
+			return ScanF32Fallback(str, end, result);
+		}
+
+		// Exponent part
+		if (it != end && ('e' == *it || 'E' == *it)) {
+			const char *exponent_it = it + 1;
+			S32 explicit_exponent = 0;
+			if (TokenResult::Valid 
+				== ScanS32(exponent_it, end, explicit_exponent)) {
+				
+				exponent += std::clamp(explicit_exponent, 
+					                   -g_max_explicit_exponent, 
+					                    g_max_explicit_exponent);
+				it = exponent_it;
+			}
+		}
+
+		F64 value = static_cast< F64 >(mantissa);
+		if (0u != mantissa) {
+			if ((1ull << 53) < mantissa || -22 > exponent || 22 < exponent) {
+				// The value cannot be computed exactly.
+				return ScanF32Fallback(str, end, result);
+			}
+
+			value = (0 > exponent) ? value / g_exact_powers_of_10[-exponent] 
+				                   : value * g_exact_powers_of_10[exponent];
+		}
+
+		result = static_cast< F32 >(negative ? -value : value);
+		str = it;
+		return TokenResult::Valid;
+	}
+
 #pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -550,6 +550,64 @@ namespace mage {
 	 */
 	TokenResult StringPrefixToF64(const char *str, F64 &result) noexcept;
 
+#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// String Conversion Utilities: Scanning
+	//-------------------------------------------------------------------------
+#pragma region
+
+	/**
+	 Scans a @c S32 from the prefix of the given string and advances the 
+	 given string past the scanned characters.
+
+	 The string does not need to be null-terminated. No locale, leading 
+	 whitespace or hexadecimal notation is supported.
+
+	 @pre			@a str is not equal to @c nullptr.
+	 @pre			@a end is not equal to @c nullptr.
+	 @param[in,out]	str
+					A reference to a pointer to the begin (inclusive) of the 
+					string to scan.
+	 @param[in]		end
+					A pointer to the end (exclusive) of the string to scan.
+	 @param[out]	result
+					A reference to the @c S32 represented by the prefix of the 
+					given string.
+	 @return		A token result indicating whether the scanning of the 
+					prefix of the given string to a @c S32 succeeded or not.
+					@a str is only advanced on success.
+	 */
+	TokenResult ScanS32(const char *&str, const char *end, 
+		S32 &result) noexcept;
+
+	/**
+	 Scans a @c F32 from the prefix of the given string and advances the 
+	 given string past the scanned characters.
+
+	 The string does not need to be null-terminated. Decimal notation with an 
+	 optional exponent is scanned without calling into the C runtime. Other 
+	 notations (e.g. infinity, NaN and hexadecimal floating point values) 
+	 fall back to @c strtof. Tokens longer than 63 characters falling back 
+	 to @c strtof are invalid.
+
+	 @pre			@a str is not equal to @c nullptr.
+	 @pre			@a end is not equal to @c nullptr.
+	 @param[in,out]	str
+					A reference to a pointer to the begin (inclusive) of the 
+					string to scan.
+	 @param[in]		end
+					A pointer to the end (exclusive) of the string to scan.
+	 @param[out]	result
+					A reference to the @c F32 represented by the prefix of the 
+					given string.
+	 @return		A token result indicating whether the scanning of the 
+					prefix of the given string to a @c F32 succeeded or not.
+					@a str is only advanced on success.
+	 */
+	TokenResult ScanF32(const char *&str, const char *end, 
+		F32 &result) noexcept;
+
 #pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -530,6 +530,13 @@ namespace mage {
 	//-------------------------------------------------------------------------
 #pragma region
 
+	/**
+	 A 2x1 signed 16-bit integer vector.
+	 */
+	using S16x2 = Vector2< S16 >;
+
+	static_assert(4  == sizeof(S16x2));
+
 	/**
 	 A 2x1 signed 32-bit integer vector.
 	 */
@@ -556,6 +563,19 @@ namespace mage {
 	//-------------------------------------------------------------------------
 #pragma region
 
+	/**
+	 An 2x1 unsigned 16-bit integer vector.
+	 */
+	using U16x2 = Vector2< U16 >;
+
+	/**
+	 An 4x1 unsigned 16-bit integer vector.
+	 */
+	using U16x4 = Vector4< U16 >;
+
+	static_assert(4  == sizeof(U16x2));
+	static_assert(8  == sizeof(U16x4));
+
 	/**
 	 An 2x1 unsigned 32-bit integer vector.
 	 */
@@ -0,0 +1,190 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\engine.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+/**
+ Defines and registers a test with the given name.
+
+ @param		name
+			The name of the test.
+ */
+#define MAGE_TEST(name)                                                       \
+	static void name();                                                       \
+	static const mage::test::TestRegistration                                 \
+		name##_registration(#name, &name, false);                             \
+	static void name()
+
+/**
+ Defines and registers a benchmark with the given name. Benchmarks only run
+ if the @c --benchmark command line argument is passed.
+
+ @param		name
+			The name of the benchmark.
+ */
+#define MAGE_BENCHMARK(name)                                                  \
+	static void name();                                                       \
+	static const mage::test::TestRegistration                                 \
+		name##_registration(#name, &name, true);                              \
+	static void name()
+
+/**
+ Checks the given expression.
+
+ @param		expression
+			The expression to check.
+ @throws	FormattedException
+			The given expression evaluates to @c false.
+ */
+#define MAGE_CHECK(expression)                                                \
+	if (!(expression)) {                                                      \
+		mage::test::Fail(__FILE__, __LINE__, #expression);                    \
+	}
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 The test function type (i.e. a function throwing a
+	 @c FormattedException if the test fails).
+	 */
+	using TestFunction = void (*)();
+
+	/**
+	 A struct of tests.
+	 */
+	struct Test final {
+
+	public:
+
+		/**
+		 The name of this test.
+		 */
+		const char *m_name;
+
+		/**
+		 The test function of this test.
+		 */
+		TestFunction m_function;
+
+		/**
+		 A flag indicating whether this test is a benchmark.
+		 */
+		bool m_benchmark;
+	};
+
+	/**
+	 Returns the registered tests.
+
+	 @return		A reference to a vector containing the registered tests.
+	 */
+	vector< Test > &GetTests();
+
+	/**
+	 A struct of test registrations (i.e. registering a test on construction).
+	 */
+	struct TestRegistration final {
+
+	public:
+
+		/**
+		 Constructs a test registration.
+
+		 @param[in]		name
+						The name of the test.
+		 @param[in]		function
+						The test function of the test.
+		 @param[in]		benchmark
+						A flag indicating whether the test is a benchmark.
+		 */
+		explicit TestRegistration(const char *name,
+			TestFunction function, bool benchmark) {
+
+			GetTests().push_back({ name, function, benchmark });
+		}
+	};
+
+	/**
+	 Fails the current test.
+
+	 @param[in]		file
+					The file of the failed check.
+	 @param[in]		line
+					The line of the failed check.
+	 @param[in]		expression
+					The failed expression.
+	 @throws		FormattedException
+					Always.
+	 */
+	[[noreturn]] void Fail(const char *file, U32 line, const char *expression);
+
+	/**
+	 Returns the headless engine of the tests. The engine is constructed on
+	 first use.
+
+	 @return		A pointer to the headless engine of the tests.
+	 @throws		FormattedException
+					Failed to setup the headless engine.
+	 */
+	Engine *GetEngine();
+
+	/**
+	 Returns the number of heap allocations performed so far by the tests.
+
+	 @return		The number of heap allocations performed so far by the
+					tests.
+	 */
+	size_t GetNumberOfAllocations() noexcept;
+
+	/**
+	 Reports the given benchmark measurement.
+
+	 @param[in]		name
+					The name of the measurement.
+	 @param[in]		time
+					The total time in seconds.
+	 @param[in]		nb_iterations
+					The number of measured iterations.
+	 */
+	void Report(const char *name, F64 time, size_t nb_iterations);
+
+	/**
+	 Returns the filename of the temporary file with the given name.
+
+	 @param[in]		name
+					The name of the temporary file.
+	 @return		The filename of the temporary file.
+	 @throws		FormattedException
+					Failed to obtain the temporary path.
+	 */
+	const wstring GetTemporaryFilename(const wchar_t *name);
+
+	/**
+	 Writes the given contents to a temporary file.
+
+	 @param[in]		name
+					The name of the temporary file.
+	 @param[in]		contents
+					A reference to the contents.
+	 @return		The filename of the temporary file.
+	 @throws		FormattedException
+					Failed to write the temporary file.
+	 */
+	const wstring WriteTemporaryFile(const wchar_t *name, 
+		const string &contents);
+}
\ No newline at end of file
@@ -0,0 +1,191 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "utils\exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Heap Allocation Counting
+//-----------------------------------------------------------------------------
+
+namespace {
+
+	/**
+	 The number of heap allocations performed so far.
+	 */
+	std::atomic< size_t > g_nb_allocations = 0;
+}
+
+void *operator new(size_t size) {
+	++g_nb_allocations;
+
+	void * const ptr = std::malloc(size ? size : 1);
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void *operator new[](size_t size) {
+	return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept {
+	std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+	std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+	std::free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+	std::free(ptr);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	vector< Test > &GetTests() {
+		static vector< Test > tests;
+		return tests;
+	}
+
+	void Fail(const char *file, U32 line, const char *expression) {
+		throw FormattedException("%s(%u): check failed: %s",
+			file, line, expression);
+	}
+
+	Engine *GetEngine() {
+		static UniquePtr< Engine > engine;
+
+		if (!engine) {
+			const EngineSetup setup(GetModuleHandle(nullptr),
+				L"MAGE Tests", true);
+			engine = MakeUnique< Engine >(setup);
+			if (!engine->IsLoaded()) {
+				throw FormattedException("Headless engine setup failed.");
+			}
+		}
+
+		return engine.get();
+	}
+
+	size_t GetNumberOfAllocations() noexcept {
+		return g_nb_allocations;
+	}
+
+	void Report(const char *name, F64 time, size_t nb_iterations) {
+		const F64 time_per_iteration
+			= time / std::max< size_t >(nb_iterations, 1u);
+		std::printf("  %-40s %12.3f ms %12.3f us/iteration\n",
+			name, time * 1000.0, time_per_iteration * 1000000.0);
+	}
+
+	const wstring GetTemporaryFilename(const wchar_t *name) {
+		wchar_t path[MAX_PATH];
+		const DWORD length = GetTempPath(_countof(path), path);
+		if (0u == length || _countof(path) < length) {
+			throw FormattedException("Failed to obtain the temporary path.");
+		}
+
+		return wstring(path) + name;
+	}
+
+	const wstring WriteTemporaryFile(const wchar_t *name, 
+		const string &contents) {
+
+		const wstring fname = GetTemporaryFilename(name);
+		std::ofstream file(fname, std::ios::binary);
+		file.write(contents.c_str(), contents.size());
+		if (!file) {
+			throw FormattedException("Failed to write %ls.", fname.c_str());
+		}
+
+		return fname;
+	}
+}
+
+using namespace mage;
+
+/**
+ The entry point of the tests.
+
+ Runs all registered tests, and all registered benchmarks if the
+ @c --benchmark command line argument is passed. If additional command line
+ arguments are passed, only the tests whose name contains one of these
+ arguments are run.
+
+ @param[in]		argc
+				The number of command line arguments.
+ @param[in]		argv
+				The command line arguments.
+ @return		0 if all tests pass. 1 otherwise.
+ */
+int main(int argc, char *argv[]) {
+	bool benchmark = false;
+	vector< const char * > filters;
+	for (int i = 1; i < argc; ++i) {
+		if (0 == std::strcmp(argv[i], "--benchmark")) {
+			benchmark = true;
+		}
+		else {
+			filters.push_back(argv[i]);
+		}
+	}
+
+	size_t nb_passed = 0u;
+	size_t nb_failed = 0u;
+	for (const auto &test : test::GetTests()) {
+		if (test.m_benchmark && !benchmark) {
+			continue;
+		}
+
+		bool selected = filters.empty();
+		for (const auto filter : filters) {
+			selected |= (nullptr != std::strstr(test.m_name, filter));
+		}
+		if (!selected) {
+			continue;
+		}
+
+		std::printf("[ RUN  ] %s\n", test.m_name);
+		try {
+			test.m_function();
+			std::printf("[ PASS ] %s\n", test.m_name);
+			++nb_passed;
+		}
+		catch (const std::exception &e) {
+			std::printf("[ FAIL ] %s: %s\n", test.m_name, e.what());
+			++nb_failed;
+		}
+	}
+
+	std::printf("%zu passed, %zu failed\n", nb_passed, nb_failed);
+
+	return (0u == nb_failed) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,248 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "loaders\msh\msh_loader.hpp"
+#include "mesh\vertex.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 Returns the vertices of the MSH tests.
+
+	 @return		A vector containing the vertices of the MSH tests.
+	 */
+	inline const vector< VertexPositionNormalTexture > GetMSHTestVertices() {
+		vector< VertexPositionNormalTexture > vertices;
+		for (U32 i = 0u; i < 5u; ++i) {
+			const F32 f = static_cast< F32 >(i);
+			vertices.emplace_back(Point3(f, 2.0f * f, -f),
+				                  Normal3(0.0f, 1.0f, 0.0f),
+				                  UV(0.25f * f, 1.0f - 0.25f * f));
+		}
+		return vertices;
+	}
+
+	/**
+	 Returns the indices of the MSH tests.
+
+	 @tparam		IndexT
+					The index type.
+	 @return		A vector containing the indices of the MSH tests.
+	 */
+	template< typename IndexT >
+	inline const vector< IndexT > GetMSHTestIndices() {
+		return { 0, 1, 2, 2, 1, 3, 3, 1, 4 };
+	}
+
+	/**
+	 Reads the contents of the given file.
+
+	 @param[in]		fname
+					A reference to the filename.
+	 @return		The contents of the given file.
+	 */
+	inline const string ReadContents(const wstring &fname) {
+		std::ifstream file(fname, std::ios::binary);
+		return string(std::istreambuf_iterator< char >(file),
+			          std::istreambuf_iterator< char >());
+	}
+
+	/**
+	 Exports the vertices and indices of the MSH tests to an MSH file and
+	 returns the contents of that MSH file.
+
+	 @tparam		IndexT
+					The index type.
+	 @return		The contents of the MSH file.
+	 */
+	template< typename IndexT >
+	const string ExportMSHTestMesh() {
+		const wstring fname = GetTemporaryFilename(L"mage_msh_export.msh");
+		ExportMSHMeshToFile(fname, GetMSHTestVertices(),
+			                GetMSHTestIndices< IndexT >());
+
+		const string contents = ReadContents(fname);
+		DeleteFile(fname.c_str());
+
+		return contents;
+	}
+
+	/**
+	 Imports the mesh of an MSH file with the given contents and checks the
+	 imported mesh against the vertices and indices of the MSH tests.
+
+	 @tparam		IndexT
+					The index type of the given contents.
+	 @param[in]		contents
+					A reference to the contents of the MSH file.
+	 @return		An empty string if the import succeeded. The error
+					message otherwise.
+	 */
+	template< typename IndexT >
+	const string ImportMSHTestMesh(const string &contents) {
+		const wstring fname = WriteTemporaryFile(L"mage_msh_test.msh", contents);
+
+		string error;
+		{
+			MeshView< VertexPositionNormalTexture > mesh;
+			try {
+				ImportMSHMeshFromFile(fname, mesh);
+			}
+			catch (const FormattedException &e) {
+				error = e.what();
+			}
+
+			if (error.empty()) {
+				const auto vertices = GetMSHTestVertices();
+				const auto indices  = GetMSHTestIndices< IndexT >();
+
+				MAGE_CHECK(mesh.IsMapped());
+				MAGE_CHECK(vertices.size() == mesh.m_nb_vertices);
+				MAGE_CHECK(0 == std::memcmp(vertices.data(), mesh.m_vertices,
+					vertices.size() * sizeof(VertexPositionNormalTexture)));
+				MAGE_CHECK(sizeof(IndexT) == mesh.m_index_size);
+				MAGE_CHECK(indices.size() == mesh.m_nb_indices);
+				for (size_t i = 0u; i < indices.size(); ++i) {
+					MAGE_CHECK(indices[i] == mesh.GetIndex(i));
+				}
+			}
+		}
+
+		DeleteFile(fname.c_str());
+
+		return error;
+	}
+
+	/**
+	 Returns the contents of an MSH file with the given modified header.
+
+	 @param[in]		contents
+					A reference to the contents of the MSH file.
+	 @param[in]		modify
+					The function modifying the header.
+	 @return		The contents of the MSH file with the modified header.
+	 */
+	template< typename ModifyT >
+	const string ModifyMSHHeader(const string &contents, ModifyT modify) {
+		MSHHeader header;
+		std::memcpy(&header, contents.data(), sizeof(MSHHeader));
+		modify(header);
+
+		string modified = contents;
+		std::memcpy(modified.data(), &header, sizeof(MSHHeader));
+		return modified;
+	}
+
+	/**
+	 Returns the contents of a legacy MSH file of the vertices and indices of
+	 the MSH tests.
+
+	 @return		The contents of the legacy MSH file.
+	 */
+	inline const string GetLegacyMSHTestMesh() {
+		const auto vertices = GetMSHTestVertices();
+		const auto indices  = GetMSHTestIndices< U32 >();
+		const U32 nb_vertices = static_cast< U32 >(vertices.size());
+		const U32 nb_indices  = static_cast< U32 >(indices.size());
+
+		string contents = MAGE_MSH_LEGACY_MAGIC;
+		contents.append(reinterpret_cast< const char * >(&nb_vertices),
+			            sizeof(U32));
+		contents.append(reinterpret_cast< const char * >(&nb_indices),
+			            sizeof(U32));
+		contents.append(reinterpret_cast< const char * >(vertices.data()),
+			            vertices.size() * sizeof(VertexPositionNormalTexture));
+		contents.append(reinterpret_cast< const char * >(indices.data()),
+			            indices.size() * sizeof(U32));
+		return contents;
+	}
+
+	MAGE_TEST(MSHReaderRoundTripsU16Indices) {
+		MAGE_CHECK(ImportMSHTestMesh< U16 >(ExportMSHTestMesh< U16 >()).empty());
+	}
+
+	MAGE_TEST(MSHReaderRoundTripsU32Indices) {
+		MAGE_CHECK(ImportMSHTestMesh< U32 >(ExportMSHTestMesh< U32 >()).empty());
+	}
+
+	MAGE_TEST(MSHReaderReadsLegacyFiles) {
+		MAGE_CHECK(ImportMSHTestMesh< U32 >(GetLegacyMSHTestMesh()).empty());
+	}
+
+	MAGE_TEST(MSHReaderRejectsTruncatedFiles) {
+		const string contents = ExportMSHTestMesh< U32 >();
+		const size_t vertices_size = GetMSHTestVertices().size()
+			                       * sizeof(VertexPositionNormalTexture);
+
+		// Truncated header, vertex section and index section
+		for (const size_t size : { sizeof(MSHHeader) - 8u,
+			                       sizeof(MSHHeader) + vertices_size / 2u,
+			                       contents.size() - 16u }) {
+			MAGE_CHECK(!ImportMSHTestMesh< U32 >(contents.substr(0u, size)).empty());
+		}
+
+		const string legacy = GetLegacyMSHTestMesh();
+		for (const size_t size : { size_t(12u), legacy.size() - 4u }) {
+			MAGE_CHECK(!ImportMSHTestMesh< U32 >(legacy.substr(0u, size)).empty());
+		}
+	}
+
+	MAGE_TEST(MSHReaderRejectsOutOfRangeSections) {
+		const string contents = ExportMSHTestMesh< U32 >();
+		const U64 size = contents.size();
+
+		const auto check = [&contents](auto modify, const char *expected) {
+			const string error = ImportMSHTestMesh< U32 >(
+				ModifyMSHHeader(contents, modify));
+			MAGE_CHECK(nullptr != std::strstr(error.c_str(), expected));
+		};
+
+		// Offsets past the end of the file, which wrap when added to the
+		// section sizes.
+		check([](MSHHeader &header) {
+			header.m_vertex_offset = ~static_cast< U64 >(MAGE_MSH_SECTION_ALIGNMENT - 1u);
+		}, "vertex section out of bounds");
+		check([size](MSHHeader &header) {
+			header.m_index_offset = size + MAGE_MSH_SECTION_ALIGNMENT;
+		}, "index section out of bounds");
+
+		// Offsets overlapping the header.
+		check([](MSHHeader &header) {
+			header.m_vertex_offset = 0u;
+		}, "vertex section out of bounds");
+
+		// Sections exceeding the end of the file.
+		check([](MSHHeader &header) {
+			header.m_nb_vertices = 0xFFFFFFFFu;
+		}, "vertex section out of bounds");
+		check([](MSHHeader &header) {
+			header.m_nb_indices = 0xFFFFFFFFu;
+		}, "index section out of bounds");
+
+		// Legacy sections exceeding the end of the file.
+		string legacy = GetLegacyMSHTestMesh();
+		const U32 nb_indices = 0xFFFFFFFFu;
+		std::memcpy(legacy.data() + 8u + sizeof(U32), &nb_indices, sizeof(U32));
+		const string error = ImportMSHTestMesh< U32 >(legacy);
+		MAGE_CHECK(nullptr != std::strstr(error.c_str(), "mesh data out of bounds"));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "loaders\obj\obj_loader.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstdio>
+#include <cstring>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 The number of vertices per side of the grid of the OBJ benchmark.
+	 */
+	constexpr size_t g_obj_benchmark_grid_size = 512u;
+
+	/**
+	 Generates the contents of an OBJ file of a triangulated grid.
+
+	 @param[in]		grid_size
+					The number of vertices per side of the grid.
+	 @return		The contents of the OBJ file.
+	 */
+	inline const string GenerateOBJGrid(size_t grid_size) {
+		string contents;
+		char buffer[128];
+
+		for (size_t y = 0u; y < grid_size; ++y) {
+			for (size_t x = 0u; x < grid_size; ++x) {
+				const F32 u = x / static_cast< F32 >(grid_size - 1u);
+				const F32 v = y / static_cast< F32 >(grid_size - 1u);
+				std::snprintf(buffer, _countof(buffer),
+					"v %.6f %.6f %.6f\nvt %.6f %.6f\nvn 0.000000 1.000000 0.000000\n",
+					100.0f * u - 50.0f, 0.5f * u * v, 100.0f * v - 50.0f, u, v);
+				contents += buffer;
+			}
+		}
+
+		for (size_t y = 1u; y < grid_size; ++y) {
+			for (size_t x = 1u; x < grid_size; ++x) {
+				const size_t i0 = (y - 1u) * grid_size + x;
+				const size_t i1 = i0 + 1u;
+				const size_t i2 = i0 + grid_size;
+				const size_t i3 = i1 + grid_size;
+				std::snprintf(buffer, _countof(buffer),
+					"f %zu/%zu/%zu %zu/%zu/%zu %zu/%zu/%zu %zu/%zu/%zu\n",
+					i0, i0, i0, i1, i1, i1, i3, i3, i3, i2, i2, i2);
+				contents += buffer;
+			}
+		}
+
+		return contents;
+	}
+
+	/**
+	 Imports the mesh of an OBJ file with the given contents.
+
+	 @param[in]		contents
+					A reference to the contents of the OBJ file.
+	 @param[out]	model_output
+					A reference to the model output.
+	 @return		An empty string if the import succeeded. The error
+					message otherwise.
+	 */
+	inline const string ImportOBJ(const string &contents,
+		ModelOutput< VertexPositionNormalTexture > &model_output) {
+
+		const wstring fname = WriteTemporaryFile(L"mage_obj_test.obj", contents);
+
+		string error;
+		try {
+			ImportOBJMeshFromFile(fname, model_output);
+		}
+		catch (const FormattedException &e) {
+			error = e.what();
+		}
+
+		DeleteFile(fname.c_str());
+
+		return error;
+	}
+
+	MAGE_TEST(OBJReaderResolvesPrecedingIndices) {
+		ModelOutput< VertexPositionNormalTexture > model_output;
+		const string error = ImportOBJ(
+			"v 0 0 0\nv 1 0 0\nv 0 1 0\nvn 0 0 1\n"
+			"f 1//1 2//1 3//1\n"
+			"v 1 1 0\n"
+			"f -3//-1 -2//-1 -1//-1\n", model_output);
+
+		MAGE_CHECK(error.empty());
+		MAGE_CHECK(4u == model_output.m_vertex_buffer.size());
+		MAGE_CHECK(6u == model_output.m_index_buffer.size());
+	}
+
+	MAGE_TEST(OBJReaderRejectsForwardReferences) {
+		ModelOutput< VertexPositionNormalTexture > model_output;
+		const string error = ImportOBJ(
+			"v 0 0 0\nv 1 0 0\n"
+			"f 1 2 3\n"
+			"v 0 1 0\n", model_output);
+
+		// The face refers to a vertex position defined after the face.
+		MAGE_CHECK(nullptr != std::strstr(error.c_str(),
+			"line 3: vertex index out of range: 3"));
+	}
+
+	MAGE_TEST(OBJReaderReportsInvalidIndexLines) {
+		ModelOutput< VertexPositionNormalTexture > model_output;
+		const string error = ImportOBJ(
+			"v 0 0 0\nv 1 0 0\nv 0 1 0\n"
+			"f 1 2 3\n"
+			"f -4 2 3\n", model_output);
+
+		// The relative index refers to a vertex position before the first.
+		MAGE_CHECK(nullptr != std::strstr(error.c_str(),
+			"line 5: invalid vertex index value found"));
+	}
+
+	MAGE_BENCHMARK(OBJReaderBenchmark) {
+		constexpr size_t nb_iterations = 10u;
+		constexpr size_t grid_size     = g_obj_benchmark_grid_size;
+
+		const string contents = GenerateOBJGrid(grid_size);
+		const wstring fname   = WriteTemporaryFile(L"mage_obj_benchmark.obj",
+			                                       contents);
+
+		Timer timer;
+		timer.Restart();
+		for (size_t j = 0u; j < nb_iterations; ++j) {
+			ModelOutput< VertexPositionNormalTexture > model_output;
+			ImportOBJMeshFromFile(fname, model_output);
+
+			MAGE_CHECK(grid_size * grid_size
+				== model_output.m_vertex_buffer.size());
+			MAGE_CHECK(6u * (grid_size - 1u) * (grid_size - 1u)
+				== model_output.m_index_buffer.size());
+		}
+		timer.Stop();
+
+		const F64 time = timer.GetTotalDeltaTime();
+		Report("Import OBJ grid", time, nb_iterations);
+		std::printf("  %.1f MB/s (%.1f MB)\n",
+			nb_iterations * contents.size() / (1000000.0 * time),
+			contents.size() / 1000000.0);
+
+		DeleteFile(fname.c_str());
+	}
+}
\ No newline at end of file
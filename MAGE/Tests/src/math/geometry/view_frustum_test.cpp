@@ -0,0 +1,232 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "math\geometry\view_frustum.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstdio>
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 The number of AABBs of the view frustum benchmark.
+	 */
+	constexpr size_t g_view_frustum_benchmark_nb_aabbs = 100000u;
+
+	/**
+	 The tolerance used for classifying AABBs as touching a view frustum
+	 plane.
+	 */
+	constexpr F32 g_view_frustum_test_tolerance = 0.001f;
+
+	/**
+	 Returns the world-to-projection transformation matrix of the view
+	 frustum tests.
+
+	 @return		The world-to-projection transformation matrix of the view
+					frustum tests.
+	 */
+	inline const XMMATRIX XM_CALLCONV GetWorldToProjectionMatrix() noexcept {
+		const XMMATRIX world_to_view = XMMatrixLookAtLH(
+			XMVectorSet(10.0f, 20.0f, -30.0f, 1.0f),
+			XMVectorSet( 0.0f,  0.0f,   0.0f, 1.0f),
+			XMVectorSet( 0.0f,  1.0f,   0.0f, 0.0f));
+		const XMMATRIX view_to_projection = XMMatrixPerspectiveFovLH(
+			XM_PIDIV4, 16.0f / 9.0f, 0.1f, 100.0f);
+
+		return world_to_view * view_to_projection;
+	}
+
+	/**
+	 Generates random AABBs.
+
+	 @param[in]		nb_aabbs
+					The number of AABBs.
+	 @return		A vector containing the AABBs.
+	 */
+	inline const vector< AABB > GenerateAABBs(size_t nb_aabbs) {
+		std::mt19937 generator(42u);
+		std::uniform_real_distribution< F32 > position(-150.0f, 150.0f);
+		std::uniform_real_distribution< F32 > extent(0.0f, 5.0f);
+
+		vector< AABB > aabbs;
+		aabbs.reserve(nb_aabbs);
+		for (size_t i = 0u; i < nb_aabbs; ++i) {
+			const Point3 p_min(position(generator),
+				               position(generator),
+				               position(generator));
+			const Point3 p_max(p_min.m_x + extent(generator),
+				               p_min.m_y + extent(generator),
+				               p_min.m_z + extent(generator));
+			aabbs.emplace_back(p_min, p_max);
+		}
+
+		return aabbs;
+	}
+
+	/**
+	 Checks whether the given AABB touches one of the planes of the given
+	 view frustum (i.e. its visibility is not robust against rounding).
+
+	 @param[in]		view_frustum
+					A reference to the view frustum.
+	 @param[in]		aabb
+					A reference to the AABB.
+	 @return		@c true if the given AABB touches one of the planes of the
+					given view frustum. @c false otherwise.
+	 */
+	inline bool TouchesPlane(const ViewFrustum &view_frustum,
+		const AABB &aabb) noexcept {
+
+		const F32 e = g_view_frustum_test_tolerance;
+		const AABB expanded(
+			Point3(aabb.m_p_min.m_x - e, aabb.m_p_min.m_y - e, aabb.m_p_min.m_z - e),
+			Point3(aabb.m_p_max.m_x + e, aabb.m_p_max.m_y + e, aabb.m_p_max.m_z + e));
+		const AABB shrunk(
+			Point3(aabb.m_p_min.m_x + e, aabb.m_p_min.m_y + e, aabb.m_p_min.m_z + e),
+			Point3(aabb.m_p_max.m_x - e, aabb.m_p_max.m_y - e, aabb.m_p_max.m_z - e));
+
+		return view_frustum.Overlaps(expanded) != view_frustum.Overlaps(shrunk);
+	}
+
+	/**
+	 Checks whether the given visibility mask matches the visibility of the
+	 per-object culling path for each of the given AABBs.
+
+	 AABBs whose classification depends on the rounding of the plane
+	 distances are allowed to differ.
+
+	 @param[in]		world_to_projection
+					The world-to-projection transformation matrix.
+	 @param[in]		aabbs
+					A reference to a vector containing the AABBs.
+	 @param[in]		mask
+					A reference to a vector containing the visibility mask.
+	 @throws		FormattedException
+					The visibility of an AABB differs.
+	 */
+	inline void XM_CALLCONV CheckVisibility(FXMMATRIX world_to_projection,
+		const vector< AABB > &aabbs, const vector< U32 > &mask) {
+
+		const ViewFrustum view_frustum(world_to_projection);
+
+		for (size_t i = 0u; i < aabbs.size(); ++i) {
+			const bool visible = 0u != (mask[i / 32u] & (1u << (i % 32u)));
+			const bool culled  = ViewFrustum::Cull(world_to_projection, aabbs[i]);
+			MAGE_CHECK(visible != culled || TouchesPlane(view_frustum, aabbs[i]));
+		}
+	}
+
+	MAGE_TEST(ViewFrustumBatchMatchesCull) {
+		const XMMATRIX world_to_projection = GetWorldToProjectionMatrix();
+		const ViewFrustum view_frustum(world_to_projection);
+		const vector< AABB > aabbs
+			= GenerateAABBs(g_view_frustum_benchmark_nb_aabbs);
+
+		AABBBatch batch;
+		batch.reserve(aabbs.size());
+		for (const auto &aabb : aabbs) {
+			batch.push_back(aabb);
+		}
+
+		vector< U32 > mask((aabbs.size() + 31u) / 32u);
+		const size_t nb_visible = view_frustum.Overlaps(batch, mask.data());
+		ArenaVector< size_t > indices;
+		view_frustum.Overlaps(batch, indices);
+
+		MAGE_CHECK(nb_visible == indices.size());
+		// Both the visible and culled AABBs must be covered.
+		MAGE_CHECK(0u < nb_visible && nb_visible < aabbs.size());
+
+		size_t next_index = 0u;
+		for (size_t i = 0u; i < aabbs.size(); ++i) {
+			const bool visible = 0u != (mask[i / 32u] & (1u << (i % 32u)));
+
+			// The mask and index outputs must agree.
+			const bool indexed = next_index < indices.size()
+				              && i == indices[next_index];
+			MAGE_CHECK(visible == indexed);
+			if (indexed) {
+				++next_index;
+			}
+		}
+
+		CheckVisibility(world_to_projection, aabbs, mask);
+	}
+
+	MAGE_BENCHMARK(ViewFrustumBatchBenchmark) {
+		constexpr size_t nb_iterations = 100u;
+
+		const XMMATRIX world_to_projection = GetWorldToProjectionMatrix();
+		const vector< AABB > aabbs
+			= GenerateAABBs(g_view_frustum_benchmark_nb_aabbs);
+
+		AABBBatch batch;
+		batch.reserve(aabbs.size());
+		for (const auto &aabb : aabbs) {
+			batch.push_back(aabb);
+		}
+		vector< U32 > mask((aabbs.size() + 31u) / 32u);
+		ArenaVector< size_t > indices;
+		indices.reserve(aabbs.size());
+
+		Timer timer;
+		size_t nb_cull_visible  = 0u;
+		size_t nb_mask_visible  = 0u;
+		size_t nb_index_visible = 0u;
+
+		// Per-object path: a view frustum is constructed for each object.
+		timer.Restart();
+		for (size_t j = 0u; j < nb_iterations; ++j) {
+			for (const auto &aabb : aabbs) {
+				nb_cull_visible += ViewFrustum::Cull(world_to_projection, aabb)
+					             ? 0u : 1u;
+			}
+		}
+		timer.Stop();
+		Report("Per-object Cull", timer.GetTotalDeltaTime(),
+			nb_iterations);
+
+		// Batch path: mask output.
+		timer.Restart();
+		for (size_t j = 0u; j < nb_iterations; ++j) {
+			const ViewFrustum view_frustum(world_to_projection);
+			nb_mask_visible += view_frustum.Overlaps(batch, mask.data());
+		}
+		timer.Stop();
+		Report("Batch Overlaps (mask)", timer.GetTotalDeltaTime(),
+			nb_iterations);
+
+		// Batch path: index output.
+		timer.Restart();
+		for (size_t j = 0u; j < nb_iterations; ++j) {
+			const ViewFrustum view_frustum(world_to_projection);
+			nb_index_visible += view_frustum.Overlaps(batch, indices);
+		}
+		timer.Stop();
+		Report("Batch Overlaps (indices)", timer.GetTotalDeltaTime(),
+			nb_iterations);
+
+		// Both paths must produce the same visibility.
+		MAGE_CHECK(nb_mask_visible == nb_index_visible);
+		CheckVisibility(world_to_projection, aabbs, mask);
+		std::printf("  %zu/%zu visible AABBs (per-object: %zu)\n",
+			nb_mask_visible / nb_iterations, aabbs.size(),
+			nb_cull_visible / nb_iterations);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 Checks whether the given matrices are approximately equal.
+
+	 @param[in]		m1
+					The first matrix.
+	 @param[in]		m2
+					The second matrix.
+	 @return		@c true if the given matrices are approximately equal.
+					@c false otherwise.
+	 */
+	inline bool XM_CALLCONV NearEqual(FXMMATRIX m1, CXMMATRIX m2) noexcept {
+		const XMVECTOR epsilon = XMVectorReplicate(0.0001f);
+		return XMVector4NearEqual(m1.r[0], m2.r[0], epsilon)
+			&& XMVector4NearEqual(m1.r[1], m2.r[1], epsilon)
+			&& XMVector4NearEqual(m1.r[2], m2.r[2], epsilon)
+			&& XMVector4NearEqual(m1.r[3], m2.r[3], epsilon);
+	}
+
+	/**
+	 A struct of node chains (i.e. a root node with a child node with a
+	 grandchild node).
+	 */
+	struct NodeChain final {
+
+	public:
+
+		/**
+		 Constructs a node chain.
+		 */
+		NodeChain()
+			: m_root(), m_child(), m_grandchild() {
+
+			m_root.AddChildNode(&m_child);
+			m_child.AddChildNode(&m_grandchild);
+		}
+
+		/**
+		 Sets the translations of the nodes of this node chain.
+
+		 @param[in]		root
+						The translation of the root node.
+		 @param[in]		child
+						The translation of the child node.
+		 */
+		void SetTranslations(F32 root, F32 child) noexcept {
+			m_root.GetTransform()->SetTranslation(root, 0.0f, 0.0f);
+			m_child.GetTransform()->SetTranslation(0.0f, child, 0.0f);
+		}
+
+		/**
+		 The root node of this node chain.
+		 */
+		OmniLightNode m_root;
+
+		/**
+		 The child node of this node chain.
+		 */
+		OmniLightNode m_child;
+
+		/**
+		 The grandchild node of this node chain.
+		 */
+		OmniLightNode m_grandchild;
+	};
+
+	/**
+	 Checks whether the world matrices of the grandchild nodes of the given
+	 node chains are equal.
+
+	 @param[in]		chain
+					A reference to the node chain.
+	 @param[in]		reference
+					A reference to the reference node chain.
+	 @return		@c true if the world matrices of the grandchild nodes
+					are equal. @c false otherwise.
+	 */
+	inline bool HasSameWorldMatrices(const NodeChain &chain,
+		const NodeChain &reference) noexcept {
+
+		const TransformNode * const transform
+			= chain.m_grandchild.GetTransform();
+		const TransformNode * const reference_transform
+			= reference.m_grandchild.GetTransform();
+
+		return NearEqual(transform->GetObjectToWorldMatrix(),
+			             reference_transform->GetObjectToWorldMatrix())
+			&& NearEqual(transform->GetWorldToObjectMatrix(),
+			             reference_transform->GetWorldToObjectMatrix());
+	}
+
+	MAGE_TEST(TransformSystemPendingMatricesFollowAncestors) {
+		NodeChain chain;
+		NodeChain reference;
+
+		TransformSystem system;
+		system.Register(chain.m_root.GetTransform());
+		system.Register(chain.m_child.GetTransform());
+		system.Register(chain.m_grandchild.GetTransform());
+		system.Update();
+		MAGE_CHECK(HasSameWorldMatrices(chain, reference));
+
+		// Pending changes of the root node.
+		chain.SetTranslations(1.0f, 0.0f);
+		reference.SetTranslations(1.0f, 0.0f);
+		MAGE_CHECK(!system.IsUpToDate());
+		MAGE_CHECK(HasSameWorldMatrices(chain, reference));
+		// Cached pending matrices.
+		MAGE_CHECK(HasSameWorldMatrices(chain, reference));
+
+		// Pending changes of the child node after caching the pending
+		// matrices of the grandchild node.
+		chain.SetTranslations(1.0f, 2.0f);
+		reference.SetTranslations(1.0f, 2.0f);
+		MAGE_CHECK(HasSameWorldMatrices(chain, reference));
+
+		system.Update();
+		MAGE_CHECK(system.IsUpToDate());
+		MAGE_CHECK(HasSameWorldMatrices(chain, reference));
+
+		// Pending changes of the root node after an update.
+		chain.SetTranslations(3.0f, 2.0f);
+		reference.SetTranslations(3.0f, 2.0f);
+		MAGE_CHECK(HasSameWorldMatrices(chain, reference));
+
+		system.Update();
+		MAGE_CHECK(HasSameWorldMatrices(chain, reference));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,363 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "mesh\mesh_cluster.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 The clip-space tolerance used for classifying triangles as touching a
+	 view frustum plane.
+	 */
+	constexpr F32 g_mesh_cluster_test_clip_tolerance = 0.0001f;
+
+	/**
+	 The cosine tolerance used for classifying triangles as (almost) edge-on.
+	 */
+	constexpr F32 g_mesh_cluster_test_facing_tolerance = 0.001f;
+
+	/**
+	 A struct of triangle meshes for the mesh cluster tests.
+	 */
+	struct TestMesh final {
+
+	public:
+
+		/**
+		 Adds a triangle to this test mesh. The triangle is oriented to face
+		 away from the given point.
+
+		 @param[in]		p0
+						The first vertex position.
+		 @param[in]		p1
+						The second vertex position.
+		 @param[in]		p2
+						The third vertex position.
+		 @param[in]		inside
+						The point behind the front face of the triangle.
+		 */
+		void AddTriangle(const Point3 &p0, const Point3 &p1, const Point3 &p2,
+			const Point3 &inside) {
+
+			const XMVECTOR v0 = XMLoadFloat3(&p0);
+			const XMVECTOR v1 = XMLoadFloat3(&p1);
+			const XMVECTOR v2 = XMLoadFloat3(&p2);
+			const XMVECTOR n  = XMVector3Cross(v1 - v0, v2 - v0);
+			const bool flip   = 0.0f > XMVectorGetX(
+				XMVector3Dot(n, v0 - XMLoadFloat3(&inside)));
+
+			const U32 index = static_cast< U32 >(m_positions.size());
+			m_positions.push_back(p0);
+			m_positions.push_back(flip ? p2 : p1);
+			m_positions.push_back(flip ? p1 : p2);
+			m_indices.push_back(index);
+			m_indices.push_back(index + 1u);
+			m_indices.push_back(index + 2u);
+		}
+
+		/**
+		 The vertex positions of this test mesh.
+		 */
+		vector< Point3 > m_positions;
+
+		/**
+		 The indices of the triangle list of this test mesh.
+		 */
+		vector< U32 > m_indices;
+	};
+
+	/**
+	 Creates a tessellated unit sphere whose triangles face outwards.
+
+	 @param[in]		nb_slices
+					The number of slices (and stacks) of the sphere.
+	 @return		The sphere mesh.
+	 */
+	inline const TestMesh CreateSphere(size_t nb_slices) {
+		const auto point = [nb_slices](size_t i, size_t j) {
+			const F32 theta = XM_PI  * i / nb_slices;
+			const F32 phi   = XM_2PI * j / nb_slices;
+			return Point3(std::sin(theta) * std::cos(phi),
+				          std::cos(theta),
+				          std::sin(theta) * std::sin(phi));
+		};
+
+		TestMesh mesh;
+		const Point3 inside(0.0f, 0.0f, 0.0f);
+		for (size_t i = 0u; i < nb_slices; ++i) {
+			for (size_t j = 0u; j < nb_slices; ++j) {
+				if (0u != i) {
+					mesh.AddTriangle(point(i, j), point(i + 1u, j),
+						             point(i, j + 1u), inside);
+				}
+				if (nb_slices - 1u != i) {
+					mesh.AddTriangle(point(i, j + 1u), point(i + 1u, j),
+						             point(i + 1u, j + 1u), inside);
+				}
+			}
+		}
+
+		return mesh;
+	}
+
+	/**
+	 Creates a triangle soup of randomly oriented triangles. The triangles are
+	 generated cell by cell to obtain spatially coherent mesh clusters.
+
+	 @param[in]		nb_cells
+					The number of cells per side of the grid of cells.
+	 @param[in]		nb_triangles_per_cell
+					The number of triangles per cell.
+	 @return		The triangle soup mesh.
+	 */
+	inline const TestMesh CreateTriangleSoup(size_t nb_cells,
+		size_t nb_triangles_per_cell) {
+
+		std::mt19937 generator(3u);
+		std::uniform_real_distribution< F32 > position(0.0f, 1.0f);
+		std::uniform_real_distribution< F32 > offset(-0.3f, 0.3f);
+
+		const F32 cell_size = 6.0f / nb_cells;
+		const auto coordinate = [&](size_t cell) {
+			return (cell + position(generator)) * cell_size - 3.0f;
+		};
+
+		TestMesh mesh;
+		for (size_t z = 0u; z < nb_cells; ++z) {
+			for (size_t y = 0u; y < nb_cells; ++y) {
+				for (size_t x = 0u; x < nb_cells; ++x) {
+					for (size_t i = 0u; i < nb_triangles_per_cell; ++i) {
+						const Point3 p(coordinate(x), coordinate(y), coordinate(z));
+						const auto vertex = [&]() {
+							return Point3(p.m_x + offset(generator),
+								          p.m_y + offset(generator),
+								          p.m_z + offset(generator));
+						};
+						const Point3 p0 = vertex();
+						const Point3 p1 = vertex();
+						const Point3 p2 = vertex();
+						mesh.AddTriangle(p0, p1, p2, vertex());
+					}
+				}
+			}
+		}
+
+		return mesh;
+	}
+
+	/**
+	 Checks whether the given triangle robustly overlaps the view frustum
+	 of the given transformation matrix, by clipping the triangle against
+	 the clip-space planes.
+
+	 @param[in]		object_to_projection
+					The object-to-projection transformation matrix.
+	 @param[in]		p0
+					The first vertex position.
+	 @param[in]		p1
+					The second vertex position.
+	 @param[in]		p2
+					The third vertex position.
+	 @return		@c true if the given triangle overlaps the view frustum
+					(shrunk by the clip tolerance). @c false otherwise.
+	 */
+	bool XM_CALLCONV OverlapsTriangle(FXMMATRIX object_to_projection,
+		const Point3 &p0, const Point3 &p1, const Point3 &p2) {
+
+		vector< XMVECTOR > polygon = {
+			XMVector3Transform(XMLoadFloat3(&p0), object_to_projection),
+			XMVector3Transform(XMLoadFloat3(&p1), object_to_projection),
+			XMVector3Transform(XMLoadFloat3(&p2), object_to_projection)
+		};
+
+		// w + x, w - x, w + y, w - y, z, w - z
+		const XMVECTOR planes[] = {
+			XMVectorSet( 1.0f,  0.0f,  0.0f, 1.0f),
+			XMVectorSet(-1.0f,  0.0f,  0.0f, 1.0f),
+			XMVectorSet( 0.0f,  1.0f,  0.0f, 1.0f),
+			XMVectorSet( 0.0f, -1.0f,  0.0f, 1.0f),
+			XMVectorSet( 0.0f,  0.0f,  1.0f, 0.0f),
+			XMVectorSet( 0.0f,  0.0f, -1.0f, 1.0f)
+		};
+
+		// Sutherland-Hodgman clipping
+		for (const auto &plane : planes) {
+			vector< XMVECTOR > clipped;
+			for (size_t i = 0u; i < polygon.size(); ++i) {
+				const XMVECTOR a = polygon[i];
+				const XMVECTOR b = polygon[(i + 1u) % polygon.size()];
+				const F32 da = XMVectorGetX(XMVector4Dot(a, plane))
+					         - g_mesh_cluster_test_clip_tolerance;
+				const F32 db = XMVectorGetX(XMVector4Dot(b, plane))
+					         - g_mesh_cluster_test_clip_tolerance;
+
+				if (0.0f <= da) {
+					clipped.push_back(a);
+				}
+				if ((0.0f <= da) != (0.0f <= db)) {
+					clipped.push_back(a + (b - a) * (da / (da - db)));
+				}
+			}
+
+			polygon = std::move(clipped);
+			if (polygon.empty()) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 Checks whether the given triangle is robustly front facing from the
+	 given eye.
+
+	 @param[in]		eye
+					The homogeneous object-space eye position.
+	 @param[in]		p0
+					The first vertex position.
+	 @param[in]		p1
+					The second vertex position.
+	 @param[in]		p2
+					The third vertex position.
+	 @return		@c true if the given triangle is front facing and not
+					(almost) edge-on. @c false otherwise.
+	 */
+	bool XM_CALLCONV IsFrontFacing(FXMVECTOR eye,
+		const Point3 &p0, const Point3 &p1, const Point3 &p2) {
+
+		const XMVECTOR v0 = XMLoadFloat3(&p0);
+		const XMVECTOR v1 = XMLoadFloat3(&p1);
+		const XMVECTOR v2 = XMLoadFloat3(&p2);
+		const XMVECTOR n  = XMVector3Normalize(XMVector3Cross(v1 - v0, v2 - v0));
+		const XMVECTOR v  = XMVector3Normalize(
+			v0 * XMVectorGetW(eye) - XMVectorSetW(eye, 0.0f));
+
+		return XMVectorGetX(XMVector3Dot(n, v))
+			< -g_mesh_cluster_test_facing_tolerance;
+	}
+
+	/**
+	 Checks that every triangle of the given mesh which is visible according
+	 to a brute-force per-triangle test is contained in the index ranges of
+	 the visible mesh clusters.
+
+	 @param[in]		mesh
+					A reference to the mesh.
+	 @param[in]		object_to_projection
+					The object-to-projection transformation matrix.
+	 @param[in]		eye
+					The homogeneous object-space eye position.
+	 @throws		FormattedException
+					A visible triangle is not contained in the index ranges.
+	 */
+	void XM_CALLCONV CheckVisibleTriangles(const TestMesh &mesh,
+		FXMMATRIX object_to_projection, FXMVECTOR eye) {
+
+		vector< MeshCluster > clusters;
+		BuildMeshClusters(mesh.m_indices.data(), mesh.m_indices.size(),
+			mesh.m_positions.data(), mesh.m_positions.size(), clusters);
+
+		ArenaVector< bool > visible(clusters.size(), false);
+		MarkVisibleMeshClusters(clusters.data(), clusters.size(),
+			object_to_projection, eye, visible);
+
+		ArenaVector< IndexRange > ranges;
+		const size_t nb_ranges = CompactMeshClusters(clusters.data(),
+			clusters.size(), visible, ranges);
+		MAGE_CHECK(nb_ranges == ranges.size());
+
+		// The culling must be effective.
+		const size_t nb_visible
+			= static_cast< size_t >(std::count(visible.cbegin(), visible.cend(), true));
+		MAGE_CHECK(0u < nb_visible && nb_visible < clusters.size());
+
+		size_t nb_visible_triangles = 0u;
+		for (size_t i = 0u; i < mesh.m_indices.size(); i += 3u) {
+			const Point3 &p0 = mesh.m_positions[mesh.m_indices[i]];
+			const Point3 &p1 = mesh.m_positions[mesh.m_indices[i + 1u]];
+			const Point3 &p2 = mesh.m_positions[mesh.m_indices[i + 2u]];
+
+			if (!IsFrontFacing(eye, p0, p1, p2)
+				|| !OverlapsTriangle(object_to_projection, p0, p1, p2)) {
+				continue;
+			}
+
+			++nb_visible_triangles;
+			const bool emitted = std::any_of(ranges.cbegin(), ranges.cend(),
+				[i](const IndexRange &range) {
+					return range.m_start_index <= i
+						&& i + 3u <= range.m_start_index + range.m_nb_indices;
+				});
+			MAGE_CHECK(emitted);
+		}
+
+		MAGE_CHECK(0u < nb_visible_triangles);
+	}
+
+	/**
+	 Checks the visible triangles of the given mesh for a set of
+	 perspective and orthographic cameras.
+
+	 @param[in]		mesh
+					A reference to the mesh.
+	 */
+	void CheckCameras(const TestMesh &mesh) {
+		const XMVECTOR up = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+		const XMMATRIX perspective = XMMatrixPerspectiveFovLH(
+			XM_PIDIV4, 16.0f / 9.0f, 0.1f, 100.0f);
+		const XMMATRIX orthographic = XMMatrixOrthographicLH(
+			3.0f, 2.0f, 0.1f, 100.0f);
+
+		const XMVECTOR eyes[] = {
+			XMVectorSet( 0.0f, 0.0f, -5.0f, 1.0f),
+			XMVectorSet( 3.0f, 1.0f, -3.0f, 1.0f),
+			XMVectorSet(-1.0f, 4.0f,  2.0f, 1.0f)
+		};
+		const XMVECTOR targets[] = {
+			XMVectorSet( 0.0f, 0.0f,  0.0f, 1.0f),
+			XMVectorSet( 0.5f, 0.0f,  0.0f, 1.0f),
+			XMVectorSet( 1.0f, 0.0f,  0.0f, 1.0f)
+		};
+
+		for (size_t i = 0u; i < _countof(eyes); ++i) {
+			const XMMATRIX world_to_view
+				= XMMatrixLookAtLH(eyes[i], targets[i], up);
+
+			// Perspective camera: the eye is a point.
+			CheckVisibleTriangles(mesh, world_to_view * perspective, eyes[i]);
+
+			// Orthographic camera: the eye is the negated view direction.
+			const XMVECTOR d = XMVector3Normalize(targets[i] - eyes[i]);
+			CheckVisibleTriangles(mesh, world_to_view * orthographic,
+				XMVectorSetW(-d, 0.0f));
+		}
+	}
+
+	MAGE_TEST(MeshClusterCullingKeepsVisibleTrianglesOfSphere) {
+		CheckCameras(CreateSphere(64u));
+	}
+
+	MAGE_TEST(MeshClusterCullingKeepsVisibleTrianglesOfTriangleSoup) {
+		CheckCameras(CreateTriangleSoup(10u, 20u));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,219 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "model\model_output.hpp"
+#include "mesh\vertex.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 The tolerance of the bounds of the model LODs as a fraction of the
+	 extent of the full detail model.
+	 */
+	constexpr F32 g_model_lod_test_bounds_tolerance = 0.1f;
+
+	/**
+	 Creates a closed (i.e. watertight) unit sphere whose vertices are shared
+	 by all adjacent triangles.
+
+	 @param[in]		nb_slices
+					The number of slices of the sphere.
+	 @param[in]		nb_stacks
+					The number of stacks of the sphere.
+	 @param[out]	model_output
+					A reference to the model output.
+	 */
+	void CreateClosedSphere(size_t nb_slices, size_t nb_stacks,
+		ModelOutput< VertexPositionNormalTexture > &model_output) {
+
+		auto &vertices = model_output.m_vertex_buffer;
+		auto &indices  = model_output.m_index_buffer;
+
+		const auto add_vertex = [&vertices](F32 theta, F32 phi) {
+			const Point3 p(std::sin(theta) * std::cos(phi),
+				           std::cos(theta),
+				           std::sin(theta) * std::sin(phi));
+			vertices.emplace_back(p, Normal3(p.m_x, p.m_y, p.m_z), UV());
+		};
+
+		// The poles and the rings in between.
+		add_vertex(0.0f,  0.0f);
+		add_vertex(XM_PI, 0.0f);
+		for (size_t i = 1u; i < nb_stacks; ++i) {
+			for (size_t j = 0u; j < nb_slices; ++j) {
+				add_vertex(XM_PI  * i / nb_stacks, XM_2PI * j / nb_slices);
+			}
+		}
+
+		const auto ring = [nb_slices, nb_stacks](size_t i, size_t j) {
+			if (0u == i) {
+				return 0u;
+			}
+			if (nb_stacks == i) {
+				return 1u;
+			}
+			return static_cast< U32 >(2u + (i - 1u) * nb_slices + j % nb_slices);
+		};
+
+		model_output.StartModelPart(ModelPart());
+		for (size_t i = 0u; i < nb_stacks; ++i) {
+			for (size_t j = 0u; j < nb_slices; ++j) {
+				if (0u != i) {
+					indices.push_back(ring(i, j));
+					indices.push_back(ring(i, j + 1u));
+					indices.push_back(ring(i + 1u, j));
+				}
+				if (nb_stacks - 1u != i) {
+					indices.push_back(ring(i, j + 1u));
+					indices.push_back(ring(i + 1u, j + 1u));
+					indices.push_back(ring(i + 1u, j));
+				}
+			}
+		}
+		model_output.EndModelPart();
+	}
+
+	/**
+	 Computes the AABB of the vertices referenced by the given index range.
+
+	 @param[in]		model_output
+					A reference to the model output.
+	 @param[in]		start_index
+					The start index of the index range.
+	 @param[in]		nb_indices
+					The number of indices of the index range.
+	 @return		The AABB of the vertices referenced by the given index
+					range.
+	 */
+	const AABB ComputeAABB(
+		const ModelOutput< VertexPositionNormalTexture > &model_output,
+		size_t start_index, size_t nb_indices) {
+
+		AABB aabb;
+		for (size_t i = start_index; i < start_index + nb_indices; ++i) {
+			const Point3 &p
+				= model_output.m_vertex_buffer[model_output.m_index_buffer[i]].p;
+			aabb.m_p_min.m_x = std::min(aabb.m_p_min.m_x, p.m_x);
+			aabb.m_p_min.m_y = std::min(aabb.m_p_min.m_y, p.m_y);
+			aabb.m_p_min.m_z = std::min(aabb.m_p_min.m_z, p.m_z);
+			aabb.m_p_max.m_x = std::max(aabb.m_p_max.m_x, p.m_x);
+			aabb.m_p_max.m_y = std::max(aabb.m_p_max.m_y, p.m_y);
+			aabb.m_p_max.m_z = std::max(aabb.m_p_max.m_z, p.m_z);
+		}
+		return aabb;
+	}
+
+	MAGE_TEST(ModelLODChainIsMonotonic) {
+		ModelOutput< VertexPositionNormalTexture > model_output;
+		CreateClosedSphere(64u, 32u, model_output);
+		model_output.GenerateLODs(4u, 0.5f);
+
+		MAGE_CHECK(1u == model_output.m_model_parts.size());
+		const ModelPart &model_part = model_output.m_model_parts[0];
+
+		// A closed mesh has no locked borders and can be simplified.
+		MAGE_CHECK(2u <= model_part.m_lods.size());
+
+		U32 nb_indices = model_part.m_nb_indices;
+		F32 error      = 0.0f;
+		for (const auto &lod : model_part.m_lods) {
+			MAGE_CHECK(0u == lod.m_nb_indices % 3u);
+			MAGE_CHECK(0u < lod.m_nb_indices);
+			MAGE_CHECK(lod.m_nb_indices < nb_indices);
+			MAGE_CHECK(error <= lod.m_error);
+			nb_indices = lod.m_nb_indices;
+			error      = lod.m_error;
+		}
+	}
+
+	MAGE_TEST(ModelLODChainPreservesBounds) {
+		ModelOutput< VertexPositionNormalTexture > model_output;
+		CreateClosedSphere(64u, 32u, model_output);
+		model_output.GenerateLODs(4u, 0.5f);
+
+		const ModelPart &model_part = model_output.m_model_parts[0];
+		const AABB aabb = ComputeAABB(model_output,
+			model_part.m_start_index, model_part.m_nb_indices);
+		const F32 tolerance = g_model_lod_test_bounds_tolerance
+			* (aabb.m_p_max.m_x - aabb.m_p_min.m_x);
+
+		for (const auto &lod : model_part.m_lods) {
+			const AABB lod_aabb = ComputeAABB(model_output,
+				lod.m_start_index, lod.m_nb_indices);
+
+			// The model LODs reference a subset of the vertices.
+			MAGE_CHECK(aabb.m_p_min.m_x <= lod_aabb.m_p_min.m_x);
+			MAGE_CHECK(aabb.m_p_min.m_y <= lod_aabb.m_p_min.m_y);
+			MAGE_CHECK(aabb.m_p_min.m_z <= lod_aabb.m_p_min.m_z);
+			MAGE_CHECK(lod_aabb.m_p_max.m_x <= aabb.m_p_max.m_x);
+			MAGE_CHECK(lod_aabb.m_p_max.m_y <= aabb.m_p_max.m_y);
+			MAGE_CHECK(lod_aabb.m_p_max.m_z <= aabb.m_p_max.m_z);
+
+			// The model LODs do not shrink.
+			MAGE_CHECK(lod_aabb.m_p_min.m_x <= aabb.m_p_min.m_x + tolerance);
+			MAGE_CHECK(lod_aabb.m_p_min.m_y <= aabb.m_p_min.m_y + tolerance);
+			MAGE_CHECK(lod_aabb.m_p_min.m_z <= aabb.m_p_min.m_z + tolerance);
+			MAGE_CHECK(aabb.m_p_max.m_x - tolerance <= lod_aabb.m_p_max.m_x);
+			MAGE_CHECK(aabb.m_p_max.m_y - tolerance <= lod_aabb.m_p_max.m_y);
+			MAGE_CHECK(aabb.m_p_max.m_z - tolerance <= lod_aabb.m_p_max.m_z);
+		}
+	}
+
+	MAGE_TEST(ModelLODSelectionDoesNotFlipAtThresholds) {
+		ModelLOD lods[3] = {};
+		lods[0].m_error = 0.0f;
+		lods[1].m_error = 1.0f;
+		lods[2].m_error = 4.0f;
+
+		const F32 epsilon = 0.001f;
+		// The error scales at which the projected error of the second model
+		// LOD reaches the refine and coarsen thresholds.
+		const F32 refine_scale  = g_model_lod_error_threshold;
+		const F32 coarsen_scale = g_model_lod_error_threshold
+			                    * (1.0f - g_model_lod_hysteresis);
+
+		for (const F32 scale : { refine_scale, coarsen_scale }) {
+			for (const size_t initial : { size_t(0u), size_t(1u) }) {
+				size_t current     = initial;
+				size_t nb_switches = 0u;
+
+				for (size_t i = 0u; i < 100u; ++i) {
+					const F32 error_scale
+						= scale * ((0u == i % 2u) ? 1.0f + epsilon : 1.0f - epsilon);
+					const size_t lod
+						= SelectModelLOD(lods, _countof(lods), current, error_scale);
+					nb_switches += (lod != current) ? 1u : 0u;
+					current = lod;
+				}
+
+				// At most one switch into the stable model LOD.
+				MAGE_CHECK(nb_switches <= 1u);
+			}
+		}
+
+		// Far away, the coarsest model LOD is selected.
+		MAGE_CHECK(2u == SelectModelLOD(lods, _countof(lods), 0u,
+			0.5f * coarsen_scale / lods[2].m_error));
+		// Close by, the full detail model LOD is selected.
+		MAGE_CHECK(0u == SelectModelLOD(lods, _countof(lods), 2u,
+			2.0f * refine_scale));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,209 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "rendering\buffer\constant_buffer_ring.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 The size in bytes of the constant buffer ring allocators of the tests
+	 (i.e. four blocks of the allocation alignment).
+	 */
+	constexpr size_t g_ring_test_size = 4u * g_constant_buffer_ring_alignment;
+
+	/**
+	 Reserves a block of the given size of the given constant buffer ring
+	 allocator and allocates the complete block.
+
+	 @param[in]		allocator
+					A reference to the constant buffer ring allocator.
+	 @param[in]		size
+					The size in bytes.
+	 @param[out]	offset
+					The offset in bytes of the reserved block.
+	 @return		@c true if the block is reserved. @c false otherwise.
+	 */
+	bool ReserveBlock(ConstantBufferRingAllocator &allocator,
+		size_t size, size_t &offset) noexcept {
+
+		if (!allocator.Reserve(size, offset)) {
+			return false;
+		}
+
+		allocator.Allocate(size);
+		allocator.ReleaseUnused();
+		return true;
+	}
+
+	MAGE_TEST(ConstantBufferRingWrapsWithPartialTail) {
+		constexpr size_t block = g_constant_buffer_ring_alignment;
+		ConstantBufferRingAllocator allocator(g_ring_test_size);
+		size_t offset = 0u;
+
+		MAGE_CHECK(ReserveBlock(allocator, 2u * block, offset));
+		MAGE_CHECK(0u == offset);
+		allocator.EndFrame(1u);
+		MAGE_CHECK(ReserveBlock(allocator, block, offset));
+		MAGE_CHECK(2u * block == offset);
+		allocator.EndFrame(2u);
+
+		allocator.Release(1u);
+		MAGE_CHECK(block == allocator.GetNumberOfUsedBytes());
+
+		// Only one block remains at the end: the reservation wraps around
+		// and the skipped block is used until the current frame completes.
+		MAGE_CHECK(ReserveBlock(allocator, 2u * block, offset));
+		MAGE_CHECK(0u == offset);
+		MAGE_CHECK(g_ring_test_size == allocator.GetNumberOfUsedBytes());
+		allocator.EndFrame(3u);
+
+		allocator.Release(2u);
+		MAGE_CHECK(3u * block == allocator.GetNumberOfUsedBytes());
+		allocator.Release(3u);
+		MAGE_CHECK(0u == allocator.GetNumberOfUsedBytes());
+		MAGE_CHECK(!allocator.HasPendingFrames());
+	}
+
+	MAGE_TEST(ConstantBufferRingFailsWhileFramesAreInFlight) {
+		constexpr size_t block = g_constant_buffer_ring_alignment;
+		ConstantBufferRingAllocator allocator(g_ring_test_size);
+		size_t offset = 0u;
+
+		MAGE_CHECK(ReserveBlock(allocator, 3u * block, offset));
+		allocator.EndFrame(1u);
+
+		// The ranges of the first frame may still be in flight.
+		MAGE_CHECK(!ReserveBlock(allocator, 2u * block, offset));
+		allocator.Release(0u);
+		MAGE_CHECK(!ReserveBlock(allocator, 2u * block, offset));
+		MAGE_CHECK(3u * block == allocator.GetNumberOfUsedBytes());
+
+		// A full ring reserves nothing.
+		MAGE_CHECK(ReserveBlock(allocator, block, offset));
+		MAGE_CHECK(3u * block == offset);
+		MAGE_CHECK(!ReserveBlock(allocator, block, offset));
+		allocator.EndFrame(2u);
+
+		// Discarding releases all ranges of the previous buffer resource.
+		allocator.Discard(2u * block);
+		MAGE_CHECK(!allocator.HasPendingFrames());
+		MAGE_CHECK(2u * block == allocator.GetNumberOfUsedBytes());
+	}
+
+	MAGE_TEST(ConstantBufferRingReleasesCompletedFrames) {
+		constexpr size_t block = g_constant_buffer_ring_alignment;
+		ConstantBufferRingAllocator allocator(g_ring_test_size);
+		size_t offset = 0u;
+
+		for (U64 fence_value = 1u; fence_value <= 3u; ++fence_value) {
+			MAGE_CHECK(ReserveBlock(allocator, block, offset));
+			allocator.EndFrame(fence_value);
+		}
+		// Empty frames are not tracked.
+		allocator.EndFrame(4u);
+		MAGE_CHECK(3u * block == allocator.GetNumberOfUsedBytes());
+
+		// The frames are released in order up to the completed fence value.
+		allocator.Release(2u);
+		MAGE_CHECK(block == allocator.GetNumberOfUsedBytes());
+		MAGE_CHECK(allocator.HasPendingFrames());
+		allocator.Release(2u);
+		MAGE_CHECK(block == allocator.GetNumberOfUsedBytes());
+		allocator.Release(4u);
+		MAGE_CHECK(0u == allocator.GetNumberOfUsedBytes());
+		MAGE_CHECK(!allocator.HasPendingFrames());
+
+		// Without ranges in use, reservations restart at the beginning.
+		MAGE_CHECK(ReserveBlock(allocator, g_ring_test_size, offset));
+		MAGE_CHECK(0u == offset);
+	}
+
+	MAGE_TEST(ConstantBufferRingReleasesUnusedSpace) {
+		constexpr size_t block = g_constant_buffer_ring_alignment;
+		ConstantBufferRingAllocator allocator(g_ring_test_size);
+		size_t offset = 0u;
+
+		MAGE_CHECK(allocator.Reserve(3u * block, offset));
+		MAGE_CHECK(0u == allocator.Allocate(block));
+		allocator.ReleaseUnused();
+		MAGE_CHECK(block == allocator.GetNumberOfUsedBytes());
+
+		// The next block starts after the allocated part.
+		MAGE_CHECK(allocator.Reserve(3u * block, offset));
+		MAGE_CHECK(block == offset);
+		MAGE_CHECK(block     == allocator.Allocate(block));
+		MAGE_CHECK(2u * block == allocator.Allocate(block));
+		allocator.ReleaseUnused();
+		MAGE_CHECK(3u * block == allocator.GetNumberOfUsedBytes());
+
+		allocator.EndFrame(1u);
+		allocator.Release(1u);
+		MAGE_CHECK(0u == allocator.GetNumberOfUsedBytes());
+	}
+
+	MAGE_TEST(ConstantBufferRingAlignsShaderConstants) {
+		struct Data4    { U8 m_data[4];    };
+		struct Data200  { U8 m_data[200];  };
+		struct Data256  { U8 m_data[256];  };
+		struct Data257  { U8 m_data[257];  };
+		struct Data1000 { U8 m_data[1000]; };
+
+		const size_t sizes[] = {
+			ConstantBufferRing::GetAllocationSize< Data4    >(),
+			ConstantBufferRing::GetAllocationSize< Data200  >(),
+			ConstantBufferRing::GetAllocationSize< Data256  >(),
+			ConstantBufferRing::GetAllocationSize< Data257  >(),
+			ConstantBufferRing::GetAllocationSize< Data1000 >(),
+			ConstantBufferRing::GetAllocationSize< XMMATRIX >()
+		};
+		MAGE_CHECK(256u  == sizes[0]);
+		MAGE_CHECK(256u  == sizes[2]);
+		MAGE_CHECK(512u  == sizes[3]);
+		MAGE_CHECK(1024u == sizes[4]);
+
+		ConstantBufferRingAllocator allocator(16u * g_constant_buffer_ring_alignment);
+
+		// Many frames of varying blocks, wrapping around several times.
+		for (U64 fence_value = 1u; fence_value <= 100u; ++fence_value) {
+			const size_t nb_ranges = 1u + fence_value % 4u;
+			size_t block_size = 0u;
+			for (size_t i = 0u; i < nb_ranges; ++i) {
+				block_size += sizes[(fence_value + i) % _countof(sizes)];
+			}
+
+			size_t offset = 0u;
+			if (!allocator.Reserve(block_size, offset)) {
+				allocator.Discard(block_size);
+			}
+
+			for (size_t i = 0u; i < nb_ranges; ++i) {
+				const size_t size = sizes[(fence_value + i) % _countof(sizes)];
+				const size_t range_offset = allocator.Allocate(size);
+
+				// The first shader constant and number of shader constants
+				// of each binding are multiples of 16 shader constants.
+				const U32 first_constant = static_cast< U32 >(range_offset / 16u);
+				const U32 nb_constants   = static_cast< U32 >(size / 16u);
+				MAGE_CHECK(0u == range_offset % 16u);
+				MAGE_CHECK(0u == first_constant % 16u);
+				MAGE_CHECK(0u == nb_constants   % 16u);
+				MAGE_CHECK(range_offset + size <= allocator.GetSize());
+			}
+
+			allocator.ReleaseUnused();
+			allocator.EndFrame(fence_value);
+			// The GPU lags two frames behind.
+			if (2u < fence_value) {
+				allocator.Release(fence_value - 2u);
+			}
+		}
+	}
+}
\ No newline at end of file
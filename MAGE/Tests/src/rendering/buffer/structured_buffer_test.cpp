@@ -0,0 +1,125 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "rendering\buffer\structured_buffer.hpp"
+#include "rendering\pipeline_recorder.hpp"
+#include "rendering\rendering_manager.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	MAGE_TEST(StructuredBufferGrowsGeometrically) {
+		size_t nb_underused_maps = 3u;
+
+		// Doubles the capacity if that suffices.
+		MAGE_CHECK(128u == GetStructuredBufferCapacity(65u,  64u, 64u,
+		                                               nb_underused_maps));
+		MAGE_CHECK(0u == nb_underused_maps);
+		// Fits the number of data elements otherwise.
+		MAGE_CHECK(300u == GetStructuredBufferCapacity(300u, 64u, 64u,
+		                                               nb_underused_maps));
+		// Starts from an empty structured buffer.
+		MAGE_CHECK(5u == GetStructuredBufferCapacity(5u, 0u, 0u,
+		                                             nb_underused_maps));
+		// Keeps the capacity if that suffices.
+		MAGE_CHECK(64u == GetStructuredBufferCapacity(64u, 64u, 64u,
+		                                              nb_underused_maps));
+	}
+
+	MAGE_TEST(StructuredBufferShrinksAfterDelay) {
+		size_t nb_underused_maps = 0u;
+
+		// Underused (at most a quarter) for one map less than the delay.
+		for (size_t i = 1u; i < g_structured_buffer_shrink_delay; ++i) {
+			MAGE_CHECK(1024u == GetStructuredBufferCapacity(100u, 1024u, 16u,
+			                                                nb_underused_maps));
+			MAGE_CHECK(i == nb_underused_maps);
+		}
+
+		// Shrinks to twice the number of data elements.
+		MAGE_CHECK(200u == GetStructuredBufferCapacity(100u, 1024u, 16u,
+		                                               nb_underused_maps));
+		MAGE_CHECK(0u == nb_underused_maps);
+	}
+
+	MAGE_TEST(StructuredBufferResetsShrinkDelay) {
+		size_t nb_underused_maps = 0u;
+
+		for (size_t i = 1u; i < g_structured_buffer_shrink_delay; ++i) {
+			MAGE_CHECK(1024u == GetStructuredBufferCapacity(256u, 1024u, 16u,
+			                                                nb_underused_maps));
+		}
+		MAGE_CHECK(g_structured_buffer_shrink_delay - 1u == nb_underused_maps);
+
+		// A map using more than a quarter restarts the countdown.
+		MAGE_CHECK(1024u == GetStructuredBufferCapacity(257u, 1024u, 16u,
+		                                                nb_underused_maps));
+		MAGE_CHECK(0u == nb_underused_maps);
+		MAGE_CHECK(1024u == GetStructuredBufferCapacity(0u, 1024u, 16u,
+		                                                nb_underused_maps));
+		MAGE_CHECK(1u == nb_underused_maps);
+
+		// Growing restarts the countdown as well.
+		nb_underused_maps = g_structured_buffer_shrink_delay - 1u;
+		MAGE_CHECK(2048u == GetStructuredBufferCapacity(1025u, 1024u, 16u,
+		                                                nb_underused_maps));
+		MAGE_CHECK(0u == nb_underused_maps);
+	}
+
+	MAGE_TEST(StructuredBufferNeverShrinksBelowMinimum) {
+		size_t nb_underused_maps = 0u;
+
+		// Shrinks to the minimum capacity instead of twice the usage.
+		for (size_t i = 1u; i < g_structured_buffer_shrink_delay; ++i) {
+			MAGE_CHECK(1024u == GetStructuredBufferCapacity(10u, 1024u, 64u,
+			                                                nb_underused_maps));
+		}
+		MAGE_CHECK(64u == GetStructuredBufferCapacity(10u, 1024u, 64u,
+		                                              nb_underused_maps));
+
+		// A structured buffer at its minimum capacity is never underused.
+		for (size_t i = 0u; i < 2u * g_structured_buffer_shrink_delay; ++i) {
+			MAGE_CHECK(64u == GetStructuredBufferCapacity(0u, 64u, 64u,
+			                                              nb_underused_maps));
+			MAGE_CHECK(0u == nb_underused_maps);
+		}
+	}
+
+	MAGE_TEST(StructuredBufferSkipsEmptyMaps) {
+		GetEngine();
+		const RenderingManager * const rendering_manager
+			= RenderingManager::Get();
+		ID3D11DeviceContext4 * const device_context
+			= rendering_manager->GetDeviceContext();
+
+		StructuredBuffer< XMFLOAT4 > buffer(rendering_manager->GetDevice(), 4u);
+
+		NullPipelineRecorder recorder;
+		Pipeline::SetRecorder(&recorder);
+
+		const auto empty = buffer.Map(rendering_manager->GetDevice(),
+		                              device_context, 0u);
+		MAGE_CHECK(empty.empty());
+		buffer.Unmap(device_context, 0u);
+
+		const auto span = buffer.Map(rendering_manager->GetDevice(),
+		                             device_context, 2u);
+		MAGE_CHECK(2u == span.size());
+		buffer.Unmap(device_context, 2u);
+
+		Pipeline::SetRecorder(nullptr);
+
+		// Only the non-empty map issues a map and unmap.
+		MAGE_CHECK(1u == recorder.GetNumberOfCommands(PipelineCommandType::Map));
+		MAGE_CHECK(1u == recorder.GetNumberOfCommands(PipelineCommandType::Unmap));
+		MAGE_CHECK(0u == recorder.GetNumberOfErrors());
+		MAGE_CHECK(2u == buffer.size());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,210 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "rendering\rendering_manager.hpp"
+#include "scripting\behavior_script.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstdio>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 The number of frames of the frame arena test.
+	 */
+	constexpr size_t g_frame_arena_test_nb_frames = 32u;
+
+	/**
+	 The number of warm-up frames of the frame arena test (i.e. the frames
+	 during which the persistent buffers of the renderer may still grow).
+	 */
+	constexpr size_t g_frame_arena_test_nb_warm_up_frames = 8u;
+
+	/**
+	 The contents of the OBJ file of the unit cube of the frame arena test.
+	 */
+	constexpr const char *g_frame_arena_test_cube =
+		"v -0.5 -0.5 -0.5\nv  0.5 -0.5 -0.5\nv  0.5  0.5 -0.5\nv -0.5  0.5 -0.5\n"
+		"v -0.5 -0.5  0.5\nv  0.5 -0.5  0.5\nv  0.5  0.5  0.5\nv -0.5  0.5  0.5\n"
+		"vt 0 0\n"
+		"vn 0 0 -1\nvn 0 0 1\nvn -1 0 0\nvn 1 0 0\nvn 0 -1 0\nvn 0 1 0\n"
+		"o cube\n"
+		"f 1/1/1 4/1/1 3/1/1 2/1/1\n"
+		"f 5/1/2 6/1/2 7/1/2 8/1/2\n"
+		"f 1/1/3 5/1/3 8/1/3 4/1/3\n"
+		"f 2/1/4 3/1/4 7/1/4 6/1/4\n"
+		"f 1/1/5 2/1/5 6/1/5 5/1/5\n"
+		"f 4/1/6 8/1/6 7/1/6 3/1/6\n";
+
+	/**
+	 A class of behavior scripts which record the number of heap allocations
+	 at the update of each frame.
+	 */
+	class AllocationCounterScript final : public BehaviorScript {
+
+	public:
+
+		/**
+		 Constructs an allocation counter script.
+
+		 @pre			@a nb_allocations points to an array of at least
+						@a nb_frames elements.
+		 @param[in]		nb_allocations
+						A pointer to the number of heap allocations per
+						frame.
+		 @param[in]		nb_frames
+						The number of frames to record.
+		 */
+		explicit AllocationCounterScript(size_t *nb_allocations,
+			size_t nb_frames) noexcept
+			: BehaviorScript(),
+			m_nb_allocations(nb_allocations),
+			m_nb_frames(nb_frames),
+			m_frame(0u) {}
+
+		/**
+		 Records the number of heap allocations of the current frame.
+
+		 @param[in]		delta_time
+						The elapsed time since the previous update.
+		 */
+		virtual void Update([[maybe_unused]] F64 delta_time) override {
+			if (m_frame < m_nb_frames) {
+				m_nb_allocations[m_frame++] = GetNumberOfAllocations();
+			}
+		}
+
+	private:
+
+		/**
+		 A pointer to the number of heap allocations per frame of this
+		 allocation counter script.
+		 */
+		size_t * const m_nb_allocations;
+
+		/**
+		 The number of frames to record of this allocation counter script.
+		 */
+		const size_t m_nb_frames;
+
+		/**
+		 The index of the current frame of this allocation counter script.
+		 */
+		size_t m_frame;
+	};
+
+	/**
+	 A class of scenes for the frame arena test: a camera looking at a few
+	 cubes lit by a few omni lights.
+	 */
+	class FrameArenaTestScene final : public Scene {
+
+	public:
+
+		/**
+		 Constructs a frame arena test scene.
+
+		 @param[in]		fname
+						The filename of the OBJ file of the unit cube.
+		 @param[in]		nb_allocations
+						A pointer to the number of heap allocations per
+						frame.
+		 */
+		explicit FrameArenaTestScene(wstring fname, size_t *nb_allocations)
+			: Scene("frame_arena_test"),
+			m_fname(std::move(fname)),
+			m_nb_allocations(nb_allocations) {}
+
+	private:
+
+		/**
+		 Loads this frame arena test scene.
+
+		 @throws		FormattedException
+						Failed to load this frame arena test scene.
+		 */
+		virtual void Load() override {
+			auto camera = Create< PerspectiveCameraNode >();
+			camera->GetTransform()->SetTranslation(0.0f, 2.0f, -6.0f);
+
+			const MeshDescriptor< VertexPositionNormalTexture > mesh_desc;
+			auto model_desc = ResourceManager::Get()
+				->GetOrCreateModelDescriptor(m_fname, mesh_desc);
+
+			for (size_t i = 0u; i < 4u; ++i) {
+				auto model = CreateModel(*model_desc);
+				model->GetTransform()->SetTranslation(
+					2.0f * i - 3.0f, 0.0f, 0.0f);
+			}
+
+			for (size_t i = 0u; i < 2u; ++i) {
+				auto omni_light = Create< OmniLightNode >();
+				omni_light->GetTransform()->SetTranslation(
+					8.0f * i - 4.0f, 3.0f, 0.0f);
+				omni_light->GetLight()->SetRange(10.0f);
+			}
+
+			Create< AllocationCounterScript >(m_nb_allocations,
+				g_frame_arena_test_nb_frames);
+		}
+
+		/**
+		 The filename of the OBJ file of the unit cube.
+		 */
+		const wstring m_fname;
+
+		/**
+		 A pointer to the number of heap allocations per frame.
+		 */
+		size_t * const m_nb_allocations;
+	};
+
+	MAGE_TEST(SteadyStateFrameDoesNotAllocate) {
+		Engine * const engine = GetEngine();
+		const wstring fname = WriteTemporaryFile(L"mage_frame_arena_cube.obj",
+			                                     g_frame_arena_test_cube);
+
+		size_t nb_allocations[g_frame_arena_test_nb_frames] = {};
+		try {
+			engine->RunHeadless(MakeUnique< FrameArenaTestScene >(
+				fname, nb_allocations), g_frame_arena_test_nb_frames,
+				1.0 / 60.0);
+		}
+		catch (...) {
+			DeleteFile(fname.c_str());
+			throw;
+		}
+		DeleteFile(fname.c_str());
+
+		// The per-frame data of the renderer is allocated on the frame arenas.
+		MAGE_CHECK(0u < RenderingManager::Get()->GetFrameArenaHighWaterMark());
+
+		// Each frame between two consecutive updates is a full frame:
+		// rendering, ending, beginning and updating.
+		for (size_t i = g_frame_arena_test_nb_warm_up_frames + 1u;
+			i < g_frame_arena_test_nb_frames; ++i) {
+
+			const size_t nb_frame_allocations
+				= nb_allocations[i] - nb_allocations[i - 1u];
+			if (0u != nb_frame_allocations) {
+				std::printf("  frame %zu: %zu heap allocations\n",
+					i, nb_frame_allocations);
+			}
+			MAGE_CHECK(0u == nb_frame_allocations);
+		}
+	}
+}
\ No newline at end of file
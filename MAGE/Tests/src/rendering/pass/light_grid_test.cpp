@@ -0,0 +1,252 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "rendering\pass\light_grid.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 The distance tolerance used for classifying light volumes as touching a
+	 light cluster.
+	 */
+	constexpr F32 g_light_grid_test_tolerance = 0.01f;
+
+	/**
+	 Returns the view-to-projection transformation matrix of the light grid
+	 tests.
+
+	 @return		The view-to-projection transformation matrix of the light
+					grid tests.
+	 */
+	inline const XMMATRIX XM_CALLCONV GetViewToProjectionMatrix() noexcept {
+		return XMMatrixPerspectiveFovLH(XM_PIDIV4, 16.0f / 9.0f, 0.1f, 100.0f);
+	}
+
+	/**
+	 Computes the view-space AABBs of the light clusters of the given light
+	 grid by unprojecting the corners of each light cluster separately.
+
+	 @param[in]		grid
+					A reference to the light grid.
+	 @param[in]		view_to_projection
+					The view-to-projection transformation matrix.
+	 @return		A vector containing the view-space AABBs of the light
+					clusters of the given light grid.
+	 */
+	const vector< AABB > XM_CALLCONV ComputeClusterAABBs(
+		const LightGrid &grid, FXMMATRIX view_to_projection) {
+
+		const U32x3 size = grid.GetSize();
+		const XMMATRIX projection_to_view
+			= XMMatrixInverse(nullptr, view_to_projection);
+
+		const F32 near_z = XMVectorGetZ(XMVector3TransformCoord(
+			XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), projection_to_view));
+		const F32 far_z  = XMVectorGetZ(XMVector3TransformCoord(
+			XMVectorSet(0.0f, 0.0f, 1.0f, 1.0f), projection_to_view));
+
+		const auto get_depth = [&](U32 z) {
+			if (0u == z) {
+				return near_z;
+			}
+			if (size.m_z == z) {
+				return far_z;
+			}
+			return std::exp((z - grid.GetDepthBias()) / grid.GetDepthScale());
+		};
+
+		vector< AABB > aabbs;
+		for (U32 z = 0u; z < size.m_z; ++z) {
+			for (U32 y = 0u; y < size.m_y; ++y) {
+				for (U32 x = 0u; x < size.m_x; ++x) {
+					AABB aabb;
+					for (U32 corner = 0u; corner < 8u; ++corner) {
+						const F32 p_ndc_x = 2.0f * (x + (corner & 1u)) / size.m_x - 1.0f;
+						const F32 p_ndc_y = 1.0f - 2.0f * (y + ((corner >> 1u) & 1u)) / size.m_y;
+						const F32 p_view_z = get_depth(z + ((corner >> 2u) & 1u));
+
+						// Intersect the ray through the NDC point with the
+						// plane of the view-space depth.
+						const XMVECTOR p0 = XMVector3TransformCoord(
+							XMVectorSet(p_ndc_x, p_ndc_y, 0.0f, 1.0f), projection_to_view);
+						const XMVECTOR p1 = XMVector3TransformCoord(
+							XMVectorSet(p_ndc_x, p_ndc_y, 1.0f, 1.0f), projection_to_view);
+						const F32 t = (p_view_z - XMVectorGetZ(p0))
+							        / (XMVectorGetZ(p1) - XMVectorGetZ(p0));
+						Point3 p;
+						XMStoreFloat3(&p, p0 + t * (p1 - p0));
+
+						aabb.m_p_min.m_x = std::min(aabb.m_p_min.m_x, p.m_x);
+						aabb.m_p_min.m_y = std::min(aabb.m_p_min.m_y, p.m_y);
+						aabb.m_p_min.m_z = std::min(aabb.m_p_min.m_z, p.m_z);
+						aabb.m_p_max.m_x = std::max(aabb.m_p_max.m_x, p.m_x);
+						aabb.m_p_max.m_y = std::max(aabb.m_p_max.m_y, p.m_y);
+						aabb.m_p_max.m_z = std::max(aabb.m_p_max.m_z, p.m_z);
+					}
+					aabbs.push_back(aabb);
+				}
+			}
+		}
+
+		return aabbs;
+	}
+
+	/**
+	 Returns the squared distance between the given AABB and the given point.
+
+	 @param[in]		aabb
+					A reference to the AABB.
+	 @param[in]		p
+					A reference to the point.
+	 @return		The squared distance between the given AABB and the given
+					point.
+	 */
+	inline F32 GetSquaredDistance(const AABB &aabb, const Point3 &p) noexcept {
+		const F32 dx = std::max({ aabb.m_p_min.m_x - p.m_x, 0.0f, p.m_x - aabb.m_p_max.m_x });
+		const F32 dy = std::max({ aabb.m_p_min.m_y - p.m_y, 0.0f, p.m_y - aabb.m_p_max.m_y });
+		const F32 dz = std::max({ aabb.m_p_min.m_z - p.m_z, 0.0f, p.m_z - aabb.m_p_max.m_z });
+		return dx * dx + dy * dy + dz * dz;
+	}
+
+	/**
+	 Checks the light lists of each light cluster of the given light grid
+	 against a brute-force overlap test of each light with each light
+	 cluster.
+
+	 @param[in]		grid
+					A reference to the light grid.
+	 @param[in]		view_to_projection
+					The view-to-projection transformation matrix.
+	 @param[in]		lights
+					A reference to an array containing the view-space
+					bounding spheres of the lights of each light list.
+	 @return		The number of dropped light cluster assignments.
+	 @throws		FormattedException
+					The light lists differ.
+	 */
+	size_t XM_CALLCONV CheckLightLists(const LightGrid &grid,
+		FXMMATRIX view_to_projection,
+		const ArenaVector< BS > (&lights)[g_nb_light_cluster_lists]) {
+
+		const vector< AABB > aabbs
+			= ComputeClusterAABBs(grid, view_to_projection);
+		const vector< LightCluster > &clusters = grid.GetClusters();
+		const vector< U32 > &indices = grid.GetLightIndices();
+		MAGE_CHECK(aabbs.size() == clusters.size());
+
+		size_t nb_dropped = 0u;
+		for (size_t cluster = 0u; cluster < clusters.size(); ++cluster) {
+			size_t offset = clusters[cluster].m_offset;
+
+			for (size_t list = 0u; list < g_nb_light_cluster_lists; ++list) {
+				const U32 count = (clusters[cluster].m_counts >> (8u * list)) & 0xFFu;
+				const U32 * const first = indices.data() + offset;
+				const U32 * const last  = first + count;
+				offset += count;
+
+				// The light indices are sorted.
+				MAGE_CHECK(std::is_sorted(first, last));
+
+				U32 nb_expected = 0u;
+				for (size_t i = 0u; i < lights[list].size(); ++i) {
+					const BS &bs = lights[list][i];
+					const F32 distance_sq = GetSquaredDistance(aabbs[cluster], bs.m_p);
+					const F32 r_min = std::max(bs.m_r - g_light_grid_test_tolerance, 0.0f);
+					const F32 r_max = bs.m_r + g_light_grid_test_tolerance;
+
+					const bool listed = std::binary_search(first, last,
+						static_cast< U32 >(i));
+
+					if (distance_sq > r_max * r_max) {
+						// Not overlapping.
+						MAGE_CHECK(!listed);
+					}
+					else if (distance_sq <= r_min * r_min) {
+						// Overlapping.
+						if (nb_expected < g_max_light_cluster_list_size) {
+							MAGE_CHECK(listed);
+						}
+						else {
+							MAGE_CHECK(!listed);
+							++nb_dropped;
+						}
+						++nb_expected;
+					}
+					else if (listed) {
+						// Touching
+						++nb_expected;
+					}
+				}
+
+				MAGE_CHECK(std::min(nb_expected, g_max_light_cluster_list_size) == count);
+			}
+		}
+
+		return nb_dropped;
+	}
+
+	MAGE_TEST(LightGridMatchesBruteForce) {
+		const XMMATRIX view_to_projection = GetViewToProjectionMatrix();
+
+		std::mt19937 generator(7u);
+		std::uniform_real_distribution< F32 > x(-60.0f, 60.0f);
+		std::uniform_real_distribution< F32 > y(-40.0f, 40.0f);
+		std::uniform_real_distribution< F32 > z(-10.0f, 110.0f);
+		std::uniform_real_distribution< F32 > r( 0.5f,  10.0f);
+
+		ArenaVector< BS > lights[g_nb_light_cluster_lists];
+		for (auto &list : lights) {
+			for (size_t i = 0u; i < 64u; ++i) {
+				list.emplace_back(Point3(x(generator), y(generator), z(generator)),
+					              r(generator));
+			}
+		}
+		// Lights containing the camera eye.
+		lights[0].emplace_back(Point3(0.0f, 0.0f, 0.0f), 1.0f);
+		lights[1].emplace_back(Point3(0.5f, 0.5f, 0.05f), 20.0f);
+
+		LightGrid grid;
+		grid.Update(view_to_projection, lights);
+
+		MAGE_CHECK(0u == CheckLightLists(grid, view_to_projection, lights));
+		MAGE_CHECK(0u == grid.GetNumberOfDroppedLights());
+	}
+
+	MAGE_TEST(LightGridCountsDroppedLights) {
+		const XMMATRIX view_to_projection = GetViewToProjectionMatrix();
+
+		// More lights than a light cluster list can contain.
+		ArenaVector< BS > lights[g_nb_light_cluster_lists];
+		for (size_t i = 0u; i < 300u; ++i) {
+			lights[2].emplace_back(Point3(0.0f, 0.0f, 20.0f + 0.01f * i), 2.0f);
+		}
+
+		LightGrid grid;
+		grid.Update(view_to_projection, lights);
+
+		const size_t nb_dropped
+			= CheckLightLists(grid, view_to_projection, lights);
+		// Light volumes touching a light cluster may be dropped as well.
+		MAGE_CHECK(0u < nb_dropped);
+		MAGE_CHECK(nb_dropped <= grid.GetNumberOfDroppedLights());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,286 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "rendering\pass\shadow_cascades.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 The vertical field of view of the shadow cascade tests.
+	 */
+	constexpr F32 g_shadow_cascades_test_fov_y = XM_PIDIV4;
+
+	/**
+	 The aspect ratio of the shadow cascade tests.
+	 */
+	constexpr F32 g_shadow_cascades_test_aspect_ratio = 16.0f / 9.0f;
+
+	/**
+	 The view-space depth of the near plane of the shadow cascade tests.
+	 */
+	constexpr F32 g_shadow_cascades_test_near_z = 0.1f;
+
+	/**
+	 The view-space depth of the far plane of the shadow cascade tests.
+	 */
+	constexpr F32 g_shadow_cascades_test_far_z = 100.0f;
+
+	/**
+	 The shadow map resolution of the shadow cascade tests.
+	 */
+	constexpr U32 g_shadow_cascades_test_resolution = 1024u;
+
+	/**
+	 Checks whether the given values are approximately equal.
+
+	 @param[in]		value
+					The value.
+	 @param[in]		expected
+					The expected value.
+	 @return		@c true if the given values are approximately equal.
+					@c false otherwise.
+	 */
+	inline bool NearEqual(F32 value, F32 expected) noexcept {
+		return std::abs(value - expected)
+			<= 0.0001f * std::max(1.0f, std::abs(expected));
+	}
+
+	/**
+	 Returns the view-to-projection transformation matrix of the shadow
+	 cascade tests.
+
+	 @param[in]		inverted
+					@c true if the depth buffer is inverted. @c false
+					otherwise.
+	 @return		The view-to-projection transformation matrix of the
+					shadow cascade tests.
+	 */
+	inline const XMMATRIX XM_CALLCONV
+		GetViewToProjectionMatrix(bool inverted = false) noexcept {
+
+		return inverted
+			? XMMatrixPerspectiveFovLH(g_shadow_cascades_test_fov_y,
+				                       g_shadow_cascades_test_aspect_ratio,
+				                       g_shadow_cascades_test_far_z,
+				                       g_shadow_cascades_test_near_z)
+			: XMMatrixPerspectiveFovLH(g_shadow_cascades_test_fov_y,
+				                       g_shadow_cascades_test_aspect_ratio,
+				                       g_shadow_cascades_test_near_z,
+				                       g_shadow_cascades_test_far_z);
+	}
+
+	/**
+	 Returns the world-to-light-view transformation matrix of the shadow
+	 cascade tests.
+
+	 @return		The world-to-light-view transformation matrix of the
+					shadow cascade tests.
+	 */
+	inline const XMMATRIX XM_CALLCONV GetWorldToLViewMatrix() noexcept {
+		return XMMatrixLookToLH(XMVectorZero(),
+			XMVectorSet(1.0f, -2.0f, 1.0f, 0.0f),
+			XMVectorSet(0.0f,  1.0f, 0.0f, 0.0f));
+	}
+
+	/**
+	 Returns the camera-view-to-light-view transformation matrix of the
+	 shadow cascade tests.
+
+	 @param[in]		eye
+					The world-space position of the camera.
+	 @return		The camera-view-to-light-view transformation matrix of
+					the shadow cascade tests.
+	 */
+	inline const XMMATRIX XM_CALLCONV
+		GetCViewToLViewMatrix(FXMVECTOR eye) noexcept {
+
+		const XMMATRIX world_to_view = XMMatrixLookToLH(eye,
+			XMVectorSet(0.3f, -0.2f, 1.0f, 0.0f),
+			XMVectorSet(0.0f,  1.0f, 0.0f, 0.0f));
+		return XMMatrixInverse(nullptr, world_to_view) * GetWorldToLViewMatrix();
+	}
+
+	MAGE_TEST(ShadowCascadeSplitsEndpoints) {
+		const F32 near_z = g_shadow_cascades_test_near_z;
+		const F32 far_z  = g_shadow_cascades_test_far_z;
+
+		for (const bool inverted : { false, true }) {
+			const XMMATRIX view_to_projection
+				= GetViewToProjectionMatrix(inverted);
+
+			F32 z;
+			F32 ends[g_nb_shadow_cascades];
+
+			// Uniform split scheme
+			ComputeShadowCascadeSplits(view_to_projection, far_z, 0.0f, z, ends);
+			MAGE_CHECK(NearEqual(z, near_z));
+			for (size_t i = 0; i < g_nb_shadow_cascades; ++i) {
+				const F32 f = (i + 1) / static_cast< F32 >(g_nb_shadow_cascades);
+				MAGE_CHECK(NearEqual(ends[i], near_z + (far_z - near_z) * f));
+			}
+
+			// Logarithmic split scheme
+			ComputeShadowCascadeSplits(view_to_projection, far_z, 1.0f, z, ends);
+			MAGE_CHECK(NearEqual(z, near_z));
+			for (size_t i = 0; i < g_nb_shadow_cascades; ++i) {
+				const F32 f = (i + 1) / static_cast< F32 >(g_nb_shadow_cascades);
+				MAGE_CHECK(NearEqual(ends[i], near_z * std::pow(far_z / near_z, f)));
+			}
+		}
+	}
+
+	MAGE_TEST(ShadowCascadeSplitsMonotonic) {
+		for (const bool inverted : { false, true }) {
+			const XMMATRIX view_to_projection
+				= GetViewToProjectionMatrix(inverted);
+
+			for (const F32 lambda : { 0.0f, 0.25f, 0.5f, 0.75f, 1.0f }) {
+				F32 near_z;
+				F32 ends[g_nb_shadow_cascades];
+				ComputeShadowCascadeSplits(view_to_projection,
+					MAGE_DEFAULT_SHADOW_DISTANCE, lambda, near_z, ends);
+
+				MAGE_CHECK(0.0f < near_z);
+				MAGE_CHECK(near_z < ends[0]);
+				for (size_t i = 1; i < g_nb_shadow_cascades; ++i) {
+					MAGE_CHECK(ends[i - 1] < ends[i]);
+				}
+			}
+		}
+	}
+
+	MAGE_TEST(ShadowCascadeSplitsFarPlane) {
+		for (const bool inverted : { false, true }) {
+			const XMMATRIX view_to_projection
+				= GetViewToProjectionMatrix(inverted);
+
+			F32 near_z;
+			F32 ends[g_nb_shadow_cascades];
+
+			// The last shadow cascade ends at the maximum distance.
+			ComputeShadowCascadeSplits(view_to_projection, 50.0f,
+				MAGE_DEFAULT_SHADOW_CASCADE_LAMBDA, near_z, ends);
+			MAGE_CHECK(50.0f == ends[g_nb_shadow_cascades - 1]);
+
+			// The last shadow cascade ends at the far plane.
+			ComputeShadowCascadeSplits(view_to_projection, 1000.0f,
+				MAGE_DEFAULT_SHADOW_CASCADE_LAMBDA, near_z, ends);
+			MAGE_CHECK(NearEqual(ends[g_nb_shadow_cascades - 1],
+				                 g_shadow_cascades_test_far_z));
+		}
+	}
+
+	MAGE_TEST(ShadowCascadeContainsSlice) {
+		const XMMATRIX view_to_projection = GetViewToProjectionMatrix();
+		const XMMATRIX cview_to_lview
+			= GetCViewToLViewMatrix(XMVectorSet(3.0f, 5.0f, -7.0f, 1.0f));
+
+		F32 near_z;
+		F32 ends[g_nb_shadow_cascades];
+		ComputeShadowCascadeSplits(view_to_projection,
+			MAGE_DEFAULT_SHADOW_DISTANCE, MAGE_DEFAULT_SHADOW_CASCADE_LAMBDA,
+			near_z, ends);
+
+		const F32 tan_y = std::tan(0.5f * g_shadow_cascades_test_fov_y);
+		const F32 tan_x = tan_y * g_shadow_cascades_test_aspect_ratio;
+		const F32 e     = 0.0001f;
+
+		for (size_t i = 0; i < g_nb_shadow_cascades; ++i) {
+			const F32 slice_near_z = (0 == i) ? near_z : ends[i - 1];
+			const F32 slice_far_z  = ends[i];
+
+			const AABB bounds = FitShadowCascade(view_to_projection,
+				cview_to_lview, slice_near_z, slice_far_z,
+				g_shadow_cascades_test_resolution);
+			const XMMATRIX cview_to_lprojection = cview_to_lview
+				* GetShadowCascadeViewToProjectionMatrix(bounds);
+
+			// The corners of the slice must be inside the orthographic
+			// volume of the shadow cascade.
+			for (U32 corner = 0u; corner < 8u; ++corner) {
+				const F32 z = (corner & 4u) ? slice_far_z : slice_near_z;
+				const F32 x = ((corner & 1u) ? tan_x : -tan_x) * z;
+				const F32 y = ((corner & 2u) ? tan_y : -tan_y) * z;
+
+				XMFLOAT3 p;
+				XMStoreFloat3(&p, XMVector3TransformCoord(
+					XMVectorSet(x, y, z, 1.0f), cview_to_lprojection));
+				MAGE_CHECK(-1.0f - e <= p.x && p.x <= 1.0f + e);
+				MAGE_CHECK(-1.0f - e <= p.y && p.y <= 1.0f + e);
+				MAGE_CHECK(       -e <= p.z && p.z <= 1.0f + e);
+			}
+		}
+	}
+
+	MAGE_TEST(ShadowCascadeSnappingIsStable) {
+		const XMMATRIX view_to_projection = GetViewToProjectionMatrix();
+		const XMVECTOR eye = XMVectorSet(3.0f, 5.0f, -7.0f, 1.0f);
+
+		F32 near_z;
+		F32 ends[g_nb_shadow_cascades];
+		ComputeShadowCascadeSplits(view_to_projection,
+			MAGE_DEFAULT_SHADOW_DISTANCE, MAGE_DEFAULT_SHADOW_CASCADE_LAMBDA,
+			near_z, ends);
+
+		const XMVECTOR translations[] = {
+			XMVectorSet( 0.01f,  0.0f,   0.0f,  0.0f),
+			XMVectorSet( 0.0f,  -0.003f, 0.0f,  0.0f),
+			XMVectorSet(-0.02f,  0.01f,  0.03f, 0.0f)
+		};
+
+		for (size_t i = 0; i < g_nb_shadow_cascades; ++i) {
+			const F32 slice_near_z = (0 == i) ? near_z : ends[i - 1];
+
+			const XMMATRIX cview_to_lview = GetCViewToLViewMatrix(eye);
+			const AABB bounds = FitShadowCascade(view_to_projection,
+				cview_to_lview, slice_near_z, ends[i],
+				g_shadow_cascades_test_resolution);
+			const F32 texel_size = (bounds.m_p_max.m_x - bounds.m_p_min.m_x)
+				                 / g_shadow_cascades_test_resolution;
+
+			for (const auto &translation : translations) {
+				const XMMATRIX moved_cview_to_lview
+					= GetCViewToLViewMatrix(eye + translation);
+				const AABB moved_bounds = FitShadowCascade(view_to_projection,
+					moved_cview_to_lview, slice_near_z, ends[i],
+					g_shadow_cascades_test_resolution);
+
+				// The extent of the shadow cascade must not change.
+				MAGE_CHECK(NearEqual(moved_bounds.m_p_max.m_x - moved_bounds.m_p_min.m_x,
+					                 bounds.m_p_max.m_x - bounds.m_p_min.m_x));
+				MAGE_CHECK(NearEqual(moved_bounds.m_p_max.m_y - moved_bounds.m_p_min.m_y,
+					                 bounds.m_p_max.m_y - bounds.m_p_min.m_y));
+
+				// The light view space is fixed, and thus world-space points
+				// must project onto the same texel grid, moved by at most
+				// one texel.
+				const F32 dx = (moved_bounds.m_p_min.m_x - bounds.m_p_min.m_x)
+					         / texel_size;
+				const F32 dy = (moved_bounds.m_p_min.m_y - bounds.m_p_min.m_y)
+					         / texel_size;
+				MAGE_CHECK(std::abs(dx - std::round(dx)) <= 0.001f);
+				MAGE_CHECK(std::abs(dy - std::round(dy)) <= 0.001f);
+				MAGE_CHECK(std::abs(dx) <= 1.001f);
+				MAGE_CHECK(std::abs(dy) <= 1.001f);
+			}
+		}
+	}
+}
\ No newline at end of file
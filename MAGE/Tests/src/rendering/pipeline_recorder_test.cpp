@@ -0,0 +1,269 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "rendering\pipeline.hpp"
+#include "rendering\pipeline_recorder.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstdio>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 The number of models per side of the grid of the headless rendering
+	 benchmark.
+	 */
+	constexpr size_t g_headless_benchmark_grid_size = 8u;
+
+	/**
+	 The contents of the OBJ file of the unit cube of the headless rendering
+	 benchmark.
+	 */
+	constexpr const char *g_headless_benchmark_cube =
+		"v -0.5 -0.5 -0.5\nv  0.5 -0.5 -0.5\nv  0.5  0.5 -0.5\nv -0.5  0.5 -0.5\n"
+		"v -0.5 -0.5  0.5\nv  0.5 -0.5  0.5\nv  0.5  0.5  0.5\nv -0.5  0.5  0.5\n"
+		"vt 0 0\n"
+		"vn 0 0 -1\nvn 0 0 1\nvn -1 0 0\nvn 1 0 0\nvn 0 -1 0\nvn 0 1 0\n"
+		"o cube\n"
+		"f 1/1/1 4/1/1 3/1/1 2/1/1\n"
+		"f 5/1/2 6/1/2 7/1/2 8/1/2\n"
+		"f 1/1/3 5/1/3 8/1/3 4/1/3\n"
+		"f 2/1/4 3/1/4 7/1/4 6/1/4\n"
+		"f 1/1/5 2/1/5 6/1/5 5/1/5\n"
+		"f 4/1/6 8/1/6 7/1/6 3/1/6\n";
+
+	/**
+	 A class of scenes for the headless rendering benchmark: a camera looking
+	 at a grid of cubes lit by a few omni lights.
+	 */
+	class HeadlessTestScene final : public Scene {
+
+	public:
+
+		/**
+		 Constructs a headless test scene.
+
+		 @param[in]		fname
+						The filename of the OBJ file of the unit cube.
+		 */
+		explicit HeadlessTestScene(wstring fname)
+			: Scene("headless_test"), m_fname(std::move(fname)) {}
+
+	private:
+
+		/**
+		 Loads this headless test scene.
+
+		 @throws		FormattedException
+						Failed to load this headless test scene.
+		 */
+		virtual void Load() override {
+			auto camera = Create< PerspectiveCameraNode >();
+			camera->GetTransform()->SetTranslation(0.0f, 4.0f, -10.0f);
+
+			const MeshDescriptor< VertexPositionNormalTexture > mesh_desc;
+			auto model_desc = ResourceManager::Get()
+				->GetOrCreateModelDescriptor(m_fname, mesh_desc);
+
+			const size_t grid_size = g_headless_benchmark_grid_size;
+			for (size_t i = 0u; i < grid_size * grid_size; ++i) {
+				auto model = CreateModel(*model_desc);
+				model->GetTransform()->SetTranslation(
+					2.0f * (i % grid_size) - grid_size + 1.0f, 0.0f,
+					2.0f * (i / grid_size));
+			}
+
+			for (size_t i = 0u; i < 4u; ++i) {
+				auto omni_light = Create< OmniLightNode >();
+				omni_light->GetTransform()->SetTranslation(
+					8.0f * (i % 2u) - 4.0f, 3.0f, 8.0f * (i / 2u));
+				omni_light->GetLight()->SetRange(10.0f);
+			}
+		}
+
+		/**
+		 The filename of the OBJ file of the unit cube.
+		 */
+		const wstring m_fname;
+	};
+
+	/**
+	 Returns the total number of recorded pipeline commands of the given
+	 contiguous range of pipeline command types.
+
+	 @param[in]		recorder
+					A reference to the null pipeline recorder.
+	 @param[in]		first
+					The first pipeline command type of the range.
+	 @param[in]		last
+					The last pipeline command type of the range.
+	 @return		The total number of recorded pipeline commands of the
+					given contiguous range of pipeline command types.
+	 */
+	size_t GetNumberOfCommands(const NullPipelineRecorder &recorder,
+		PipelineCommandType first, PipelineCommandType last) noexcept {
+
+		size_t nb_commands = 0u;
+		for (auto i = static_cast< size_t >(first);
+			i <= static_cast< size_t >(last); ++i) {
+
+			nb_commands += recorder.GetNumberOfCommands(
+				static_cast< PipelineCommandType >(i));
+		}
+		return nb_commands;
+	}
+
+	MAGE_TEST(NullPipelineRecorderValidatesCommands) {
+		NullPipelineRecorder recorder;
+
+		// The device contexts are only used to track the state per device
+		// context.
+		int contexts[2];
+		const auto context0 = reinterpret_cast< ID3D11DeviceContext4 * >(&contexts[0]);
+		const auto context1 = reinterpret_cast< ID3D11DeviceContext4 * >(&contexts[1]);
+		int objects[2];
+		const void * const shader   = &objects[0];
+		const void * const resource = &objects[1];
+
+		const auto record = [&recorder](ID3D11DeviceContext4 *context,
+			PipelineCommandType type, PipelineStage stage, U32 slot,
+			const void *object, U32 arg0 = 0u) {
+
+			const size_t nb_errors = recorder.GetNumberOfErrors();
+			recorder.Record(context,
+				{ type, stage, slot, 0u, nullptr, object, { arg0 } });
+			return nb_errors != recorder.GetNumberOfErrors();
+		};
+
+		// A draw without a bound vertex shader.
+		MAGE_CHECK(record(context0, PipelineCommandType::DrawIndexed,
+			PipelineStage::None, 0u, nullptr));
+		MAGE_CHECK(!record(context0, PipelineCommandType::BindShader,
+			PipelineStage::VS, 0u, shader));
+		MAGE_CHECK(!record(context0, PipelineCommandType::DrawIndexed,
+			PipelineStage::None, 0u, nullptr));
+		// The vertex shader is bound to another device context.
+		MAGE_CHECK(record(context1, PipelineCommandType::Draw,
+			PipelineStage::None, 0u, nullptr));
+		// A dispatch without a bound compute shader.
+		MAGE_CHECK(record(context0, PipelineCommandType::Dispatch,
+			PipelineStage::None, 0u, nullptr));
+
+		// Finishing a command list with restoring the state keeps the bound
+		// vertex shader; without restoring the state unbinds it.
+		MAGE_CHECK(!record(context0, PipelineCommandType::FinishCommandList,
+			PipelineStage::None, 0u, nullptr, 1u));
+		MAGE_CHECK(!record(context0, PipelineCommandType::Draw,
+			PipelineStage::None, 0u, nullptr));
+		MAGE_CHECK(!record(context0, PipelineCommandType::FinishCommandList,
+			PipelineStage::None, 0u, nullptr, 0u));
+		MAGE_CHECK(record(context0, PipelineCommandType::Draw,
+			PipelineStage::None, 0u, nullptr));
+
+		// A map on an already mapped subresource.
+		MAGE_CHECK(!record(context0, PipelineCommandType::Map,
+			PipelineStage::None, 0u, resource));
+		MAGE_CHECK(!record(context0, PipelineCommandType::Map,
+			PipelineStage::None, 1u, resource));
+		MAGE_CHECK(record(context0, PipelineCommandType::Map,
+			PipelineStage::None, 0u, resource));
+		MAGE_CHECK(!record(context0, PipelineCommandType::Unmap,
+			PipelineStage::None, 0u, resource));
+		// An unmap of a subresource which is not mapped.
+		MAGE_CHECK(record(context0, PipelineCommandType::Unmap,
+			PipelineStage::None, 0u, resource));
+		MAGE_CHECK(!record(context0, PipelineCommandType::Map,
+			PipelineStage::None, 0u, resource));
+		// A map without a resource.
+		MAGE_CHECK(record(context0, PipelineCommandType::Map,
+			PipelineStage::None, 0u, nullptr));
+
+		// Slots within and out of range.
+		const void *srvs[2] = {};
+		recorder.Record(context0, { PipelineCommandType::BindSRVs,
+			PipelineStage::PS, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT - 2u,
+			2u, srvs, nullptr, {} });
+		MAGE_CHECK(7u == recorder.GetNumberOfErrors());
+		recorder.Record(context0, { PipelineCommandType::BindSRVs,
+			PipelineStage::PS, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT - 1u,
+			2u, srvs, nullptr, {} });
+		MAGE_CHECK(8u == recorder.GetNumberOfErrors());
+		// A non-zero number of objects without objects.
+		recorder.Record(context0, { PipelineCommandType::BindSamplers,
+			PipelineStage::PS, 0u, 1u, nullptr, nullptr, {} });
+		MAGE_CHECK(9u == recorder.GetNumberOfErrors());
+
+		MAGE_CHECK(5u == recorder.GetNumberOfCommands(PipelineCommandType::Map));
+		MAGE_CHECK(19u == recorder.GetNumberOfCommands());
+
+		recorder.Reset();
+		MAGE_CHECK(0u == recorder.GetNumberOfCommands());
+		MAGE_CHECK(0u == recorder.GetNumberOfErrors());
+		// The tracked state is reset as well.
+		MAGE_CHECK(record(context0, PipelineCommandType::Draw,
+			PipelineStage::None, 0u, nullptr));
+		MAGE_CHECK(!record(context0, PipelineCommandType::Map,
+			PipelineStage::None, 0u, resource));
+	}
+
+	MAGE_BENCHMARK(HeadlessRenderingBenchmark) {
+		constexpr size_t nb_frames = 100u;
+		constexpr F64 delta_time   = 1.0 / 60.0;
+
+		Engine * const engine = GetEngine();
+		const wstring fname = WriteTemporaryFile(L"mage_headless_cube.obj",
+			                                     g_headless_benchmark_cube);
+
+		NullPipelineRecorder recorder;
+		Pipeline::SetRecorder(&recorder);
+
+		Timer timer;
+		timer.Restart();
+		try {
+			engine->RunHeadless(MakeUnique< HeadlessTestScene >(fname),
+				nb_frames, delta_time);
+		}
+		catch (...) {
+			Pipeline::SetRecorder(nullptr);
+			DeleteFile(fname.c_str());
+			throw;
+		}
+		timer.Stop();
+
+		Pipeline::SetRecorder(nullptr);
+		DeleteFile(fname.c_str());
+
+		const size_t nb_draws = GetNumberOfCommands(recorder,
+			PipelineCommandType::Draw,
+			PipelineCommandType::DrawIndexedInstancedIndirect);
+		const size_t nb_binds = GetNumberOfCommands(recorder,
+			PipelineCommandType::BindShader,
+			PipelineCommandType::BindRTVsAndDSVAndUAVs);
+		const size_t nb_maps
+			= recorder.GetNumberOfCommands(PipelineCommandType::Map);
+
+		Report("Render 64 models headless", timer.GetTotalDeltaTime(),
+			nb_frames);
+		std::printf("  %.1f draws, %.1f binds, %.1f maps per frame\n",
+			nb_draws / static_cast< F64 >(nb_frames),
+			nb_binds / static_cast< F64 >(nb_frames),
+			nb_maps  / static_cast< F64 >(nb_frames));
+
+		MAGE_CHECK(0u < nb_draws);
+		MAGE_CHECK(0u == recorder.GetNumberOfErrors());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,367 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "rendering\pipeline.hpp"
+#include "rendering\pipeline_recorder.hpp"
+#include "rendering\rendering_manager.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 A struct of textures of the pipeline tests with views for all usages.
+	 */
+	struct TestTexture final {
+
+	public:
+
+		/**
+		 A pointer to the shader resource view of this test texture.
+		 */
+		ComPtr< ID3D11ShaderResourceView > m_srv;
+
+		/**
+		 A pointer to the render target view of this test texture.
+		 */
+		ComPtr< ID3D11RenderTargetView > m_rtv;
+
+		/**
+		 A pointer to the depth stencil view of this test texture.
+		 */
+		ComPtr< ID3D11DepthStencilView > m_dsv;
+
+		/**
+		 A pointer to the unordered access view of this test texture.
+		 */
+		ComPtr< ID3D11UnorderedAccessView > m_uav;
+	};
+
+	/**
+	 Creates a color texture with a shader resource view, render target view
+	 and unordered access view.
+
+	 @param[in]		device
+					A pointer to the device.
+	 @return		The color texture.
+	 @throws		FormattedException
+					Failed to create the color texture.
+	 */
+	const TestTexture CreateColorTexture(ID3D11Device5 *device) {
+		const CD3D11_TEXTURE2D_DESC texture_desc(DXGI_FORMAT_R8G8B8A8_UNORM,
+			4u, 4u, 1u, 1u, D3D11_BIND_SHADER_RESOURCE
+			              | D3D11_BIND_RENDER_TARGET
+			              | D3D11_BIND_UNORDERED_ACCESS);
+		ComPtr< ID3D11Texture2D > texture;
+		MAGE_CHECK(SUCCEEDED(device->CreateTexture2D(&texture_desc, nullptr,
+			texture.ReleaseAndGetAddressOf())));
+
+		TestTexture result;
+		MAGE_CHECK(SUCCEEDED(device->CreateShaderResourceView(texture.Get(),
+			nullptr, result.m_srv.ReleaseAndGetAddressOf())));
+		MAGE_CHECK(SUCCEEDED(device->CreateRenderTargetView(texture.Get(),
+			nullptr, result.m_rtv.ReleaseAndGetAddressOf())));
+		MAGE_CHECK(SUCCEEDED(device->CreateUnorderedAccessView(texture.Get(),
+			nullptr, result.m_uav.ReleaseAndGetAddressOf())));
+		return result;
+	}
+
+	/**
+	 Creates a depth texture with a shader resource view and depth stencil
+	 view.
+
+	 @param[in]		device
+					A pointer to the device.
+	 @return		The depth texture.
+	 @throws		FormattedException
+					Failed to create the depth texture.
+	 */
+	const TestTexture CreateDepthTexture(ID3D11Device5 *device) {
+		const CD3D11_TEXTURE2D_DESC texture_desc(DXGI_FORMAT_R32_TYPELESS,
+			4u, 4u, 1u, 1u, D3D11_BIND_SHADER_RESOURCE
+			              | D3D11_BIND_DEPTH_STENCIL);
+		ComPtr< ID3D11Texture2D > texture;
+		MAGE_CHECK(SUCCEEDED(device->CreateTexture2D(&texture_desc, nullptr,
+			texture.ReleaseAndGetAddressOf())));
+
+		const CD3D11_SHADER_RESOURCE_VIEW_DESC srv_desc(
+			D3D11_SRV_DIMENSION_TEXTURE2D, DXGI_FORMAT_R32_FLOAT);
+		const CD3D11_DEPTH_STENCIL_VIEW_DESC dsv_desc(
+			D3D11_DSV_DIMENSION_TEXTURE2D, DXGI_FORMAT_D32_FLOAT);
+
+		TestTexture result;
+		MAGE_CHECK(SUCCEEDED(device->CreateShaderResourceView(texture.Get(),
+			&srv_desc, result.m_srv.ReleaseAndGetAddressOf())));
+		MAGE_CHECK(SUCCEEDED(device->CreateDepthStencilView(texture.Get(),
+			&dsv_desc, result.m_dsv.ReleaseAndGetAddressOf())));
+		return result;
+	}
+
+	/**
+	 Creates a rasterizer state.
+
+	 @param[in]		device
+					A pointer to the device.
+	 @return		A pointer to the rasterizer state.
+	 @throws		FormattedException
+					Failed to create the rasterizer state.
+	 */
+	ComPtr< ID3D11RasterizerState > CreateTestRasterizerState(
+		ID3D11Device5 *device) {
+
+		const CD3D11_RASTERIZER_DESC desc{ CD3D11_DEFAULT() };
+		ComPtr< ID3D11RasterizerState > state;
+		MAGE_CHECK(SUCCEEDED(device->CreateRasterizerState(&desc,
+			state.ReleaseAndGetAddressOf())));
+		return state;
+	}
+
+	/**
+	 Records the pipeline commands issued by the given function.
+
+	 @tparam		ActionT
+					The function type.
+	 @param[in]		action
+					The function issuing pipeline commands.
+	 @return		A vector containing the recorded pipeline commands.
+	 */
+	template< typename ActionT >
+	const vector< RecordedPipelineCommand > RecordCommands(ActionT action) {
+		StreamPipelineRecorder recorder;
+		// Setting the pipeline recorder invalidates the pipeline states.
+		Pipeline::SetRecorder(&recorder);
+
+		try {
+			action();
+		}
+		catch (...) {
+			Pipeline::SetRecorder(nullptr);
+			throw;
+		}
+
+		Pipeline::SetRecorder(nullptr);
+
+		return recorder.GetCommands();
+	}
+
+	/**
+	 Returns the recorded pipeline commands of the given type.
+
+	 @param[in]		commands
+					A reference to a vector containing the recorded pipeline
+					commands.
+	 @param[in]		type
+					The pipeline command type.
+	 @return		A vector containing the recorded pipeline commands of the
+					given type.
+	 */
+	const vector< RecordedPipelineCommand > GetCommands(
+		const vector< RecordedPipelineCommand > &commands,
+		PipelineCommandType type) {
+
+		vector< RecordedPipelineCommand > result;
+		for (const auto &command : commands) {
+			if (type == command.m_type) {
+				result.push_back(command);
+			}
+		}
+		return result;
+	}
+
+	MAGE_TEST(PipelineDropsRedundantBinds) {
+		GetEngine();
+		const RenderingManager * const rendering_manager
+			= RenderingManager::Get();
+		ID3D11DeviceContext4 * const device_context
+			= rendering_manager->GetDeviceContext();
+
+		const auto state   = CreateTestRasterizerState(rendering_manager->GetDevice());
+		const auto texture = CreateColorTexture(rendering_manager->GetDevice());
+
+		const auto bind = [device_context, &state, &texture]() {
+			Pipeline::RS::BindState(device_context, state.Get());
+			Pipeline::PS::BindSRV(device_context, 0u, texture.m_srv.Get());
+			Pipeline::Draw(device_context, 0u, 0u);
+		};
+
+		const auto commands = RecordCommands([device_context, &bind]() {
+			// Binding the same state twice issues one command.
+			bind();
+			bind();
+
+			// Invalidating the pipeline state forces a reissue.
+			Pipeline::InvalidateState(device_context);
+			bind();
+			bind();
+		});
+
+		MAGE_CHECK(2u == GetCommands(commands,
+			PipelineCommandType::BindRasterizerState).size());
+		MAGE_CHECK(2u == GetCommands(commands,
+			PipelineCommandType::BindSRVs).size());
+		MAGE_CHECK(4u == GetCommands(commands,
+			PipelineCommandType::Draw).size());
+	}
+
+	MAGE_TEST(PipelineUnbindsSRVsOfOutputs) {
+		GetEngine();
+		const RenderingManager * const rendering_manager
+			= RenderingManager::Get();
+		ID3D11Device5 * const device = rendering_manager->GetDevice();
+		ID3D11DeviceContext4 * const device_context
+			= rendering_manager->GetDeviceContext();
+
+		const auto color = CreateColorTexture(device);
+		const auto depth = CreateDepthTexture(device);
+		const auto other = CreateColorTexture(device);
+
+		// The RTV, DSV and UAV outputs aliasing the SRV of the first slot.
+		const auto bind_rtv = [device_context, &color]() {
+			Pipeline::OM::BindRTVAndDSV(device_context,
+				color.m_rtv.Get(), nullptr);
+		};
+		const auto bind_dsv = [device_context, &depth]() {
+			Pipeline::OM::BindRTVAndDSV(device_context,
+				nullptr, depth.m_dsv.Get());
+		};
+		const auto bind_uav = [device_context, &color]() {
+			ID3D11UnorderedAccessView * const uavs[1] = { color.m_uav.Get() };
+			const U32 initial_counts[1] = { 0u };
+			Pipeline::OM::BindRTVsAndDSVAndUAVs(device_context,
+				0u, nullptr, nullptr, 0u, 1u, uavs, initial_counts);
+		};
+
+		const pair< std::function< void() >, ID3D11ShaderResourceView * >
+			cases[] = {
+			{ bind_rtv, color.m_srv.Get() },
+			{ bind_dsv, depth.m_srv.Get() },
+			{ bind_uav, color.m_srv.Get() }
+		};
+
+		for (const auto &test_case : cases) {
+			const auto &bind_output = test_case.first;
+			ID3D11ShaderResourceView * const srvs[2] = {
+				test_case.second, other.m_srv.Get()
+			};
+
+			const auto bind_srvs = [device_context, &srvs]() {
+				Pipeline::PS::BindSRVs(device_context, 0u, 2u, srvs);
+				Pipeline::Draw(device_context, 0u, 0u);
+			};
+
+			const auto commands = GetCommands(RecordCommands(
+				[device_context, &bind_output, &bind_srvs]() {
+
+				bind_srvs();
+				// Binding the output unbinds the aliasing SRV, which is 
+				// reissued but not bound by the device context.
+				bind_output();
+				bind_srvs();
+				// Unbinding the output allows binding the SRV again.
+				Pipeline::OM::BindRTVAndDSV(device_context, nullptr, nullptr);
+				bind_srvs();
+			}), PipelineCommandType::BindSRVs);
+
+			// Only the SRV of the first slot is reissued.
+			MAGE_CHECK(3u == commands.size());
+			MAGE_CHECK(0u == commands[0].m_slot && 2u == commands[0].m_nb_objects);
+			MAGE_CHECK(0u == commands[1].m_slot && 1u == commands[1].m_nb_objects);
+			MAGE_CHECK(0u == commands[2].m_slot && 1u == commands[2].m_nb_objects);
+		}
+	}
+
+	MAGE_TEST(PipelineInvalidatesStateOfCommandListsWithoutRestore) {
+		GetEngine();
+		const RenderingManager * const rendering_manager
+			= RenderingManager::Get();
+		ID3D11Device5 * const device = rendering_manager->GetDevice();
+		ID3D11DeviceContext4 * const device_context
+			= rendering_manager->GetDeviceContext();
+
+		ComPtr< ID3D11DeviceContext3 > deferred_device_context3;
+		MAGE_CHECK(SUCCEEDED(device->CreateDeferredContext3(0u,
+			deferred_device_context3.ReleaseAndGetAddressOf())));
+		ComPtr< ID3D11DeviceContext4 > deferred_device_context;
+		MAGE_CHECK(SUCCEEDED(deferred_device_context3.As(&deferred_device_context)));
+
+		const auto state = CreateTestRasterizerState(device);
+		ComPtr< ID3D11CommandList > command_list;
+
+		Pipeline::RegisterDeviceContext(deferred_device_context.Get());
+
+		const auto commands = RecordCommands([device_context,
+			deferred = deferred_device_context.Get(), &state, &command_list]() {
+
+			Pipeline::RS::BindState(deferred, state.Get());
+			Pipeline::FinishCommandList(deferred, true,
+				command_list.ReleaseAndGetAddressOf());
+			// Restored: the rasterizer state is still bound.
+			Pipeline::RS::BindState(deferred, state.Get());
+			Pipeline::FinishCommandList(deferred, false,
+				command_list.ReleaseAndGetAddressOf());
+			// Reset: the rasterizer state is reissued.
+			Pipeline::RS::BindState(deferred, state.Get());
+			Pipeline::FinishCommandList(deferred, false,
+				command_list.ReleaseAndGetAddressOf());
+
+			Pipeline::RS::BindState(device_context, state.Get());
+			Pipeline::ExecuteCommandList(device_context,
+				command_list.Get(), true);
+			// Restored: the rasterizer state is still bound.
+			Pipeline::RS::BindState(device_context, state.Get());
+			Pipeline::ExecuteCommandList(device_context,
+				command_list.Get(), false);
+			// Reset: the rasterizer state is reissued.
+			Pipeline::RS::BindState(device_context, state.Get());
+		});
+
+		Pipeline::UnregisterDeviceContext(deferred_device_context.Get());
+
+		const PipelineCommandType expected[] = {
+			PipelineCommandType::BindRasterizerState,
+			PipelineCommandType::FinishCommandList,
+			PipelineCommandType::FinishCommandList,
+			PipelineCommandType::BindRasterizerState,
+			PipelineCommandType::FinishCommandList,
+			PipelineCommandType::BindRasterizerState,
+			PipelineCommandType::ExecuteCommandList,
+			PipelineCommandType::ExecuteCommandList,
+			PipelineCommandType::BindRasterizerState
+		};
+
+		size_t index = 0u;
+		for (const auto &command : commands) {
+			switch (command.m_type) {
+
+			case PipelineCommandType::BindRasterizerState:
+			case PipelineCommandType::FinishCommandList:
+			case PipelineCommandType::ExecuteCommandList: {
+				MAGE_CHECK(index < _countof(expected));
+				MAGE_CHECK(expected[index] == command.m_type);
+				++index;
+				break;
+			}
+
+			default:
+				break;
+			}
+		}
+
+		MAGE_CHECK(_countof(expected) == index);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,197 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "rendering\render_scheduler.hpp"
+#include "rendering\rendering_manager.hpp"
+#include "rendering\pipeline_recorder.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 Records the given number of items on the given render scheduler while
+	 capturing the pipeline commands. Each item is recorded as an empty draw
+	 whose start vertex is the index of the item.
+
+	 @param[in]		scheduler
+					A reference to the render scheduler.
+	 @param[in]		nb_items
+					The number of items.
+	 @param[in]		min_batch_size
+					The minimum number of items per render batch.
+	 @return		A vector containing the recorded draw, finish command
+					list and execute command list pipeline commands.
+	 @throws		FormattedException
+					Failed to record the items.
+	 */
+	const vector< RecordedPipelineCommand > RecordItems(
+		RenderScheduler &scheduler, size_t nb_items, size_t min_batch_size) {
+
+		StreamPipelineRecorder recorder;
+		Pipeline::SetRecorder(&recorder);
+
+		try {
+			scheduler.Record(nb_items, min_batch_size,
+				[](RenderWorker &worker, size_t begin, size_t end) {
+					for (size_t i = begin; i < end; ++i) {
+						Pipeline::Draw(worker.GetDeviceContext(),
+							0u, static_cast< U32 >(i));
+					}
+				});
+		}
+		catch (...) {
+			Pipeline::SetRecorder(nullptr);
+			throw;
+		}
+
+		Pipeline::SetRecorder(nullptr);
+
+		vector< RecordedPipelineCommand > commands;
+		for (const auto &command : recorder.GetCommands()) {
+			switch (command.m_type) {
+
+			case PipelineCommandType::Draw:
+			case PipelineCommandType::FinishCommandList:
+			case PipelineCommandType::ExecuteCommandList: {
+				commands.push_back(command);
+				break;
+			}
+
+			default:
+				break;
+			}
+		}
+
+		return commands;
+	}
+
+	/**
+	 Checks that the given recorded pipeline commands draw the given number
+	 of items in order, as the given render batches.
+
+	 @param[in]		commands
+					A reference to a vector containing the recorded draw,
+					finish command list and execute command list pipeline
+					commands.
+	 @param[in]		batches
+					A reference to a vector containing the render batches.
+	 @throws		FormattedException
+					The recorded pipeline commands differ.
+	 */
+	void CheckRecordedBatches(const vector< RecordedPipelineCommand > &commands,
+		const vector< RenderBatch > &batches) {
+
+		// A single render batch is recorded directly on the immediate device
+		// context without command lists.
+		const bool deferred = 1u < batches.size();
+
+		size_t index = 0u;
+		for (const auto &batch : batches) {
+			for (size_t i = batch.m_begin; i < batch.m_end; ++i) {
+				MAGE_CHECK(index < commands.size());
+				MAGE_CHECK(PipelineCommandType::Draw == commands[index].m_type);
+				MAGE_CHECK(i == commands[index].m_args[1]);
+				++index;
+			}
+
+			if (deferred) {
+				// Each render batch is finished into its own command list.
+				MAGE_CHECK(index < commands.size());
+				MAGE_CHECK(PipelineCommandType::FinishCommandList
+					== commands[index].m_type);
+				++index;
+			}
+		}
+
+		if (deferred) {
+			// The command lists are executed once all render batches are
+			// finished.
+			for (size_t i = 0u; i < batches.size(); ++i) {
+				MAGE_CHECK(index < commands.size());
+				MAGE_CHECK(PipelineCommandType::ExecuteCommandList
+					== commands[index].m_type);
+				++index;
+			}
+		}
+
+		MAGE_CHECK(commands.size() == index);
+	}
+
+	MAGE_TEST(RenderSchedulerPartition) {
+		vector< RenderBatch > batches;
+
+		RenderScheduler::Partition(10u, 3u, 2u, batches);
+		MAGE_CHECK(3u == batches.size());
+		MAGE_CHECK( 0u == batches[0].m_begin &&  3u == batches[0].m_end);
+		MAGE_CHECK( 3u == batches[1].m_begin &&  6u == batches[1].m_end);
+		MAGE_CHECK( 6u == batches[2].m_begin && 10u == batches[2].m_end);
+
+		// The minimum batch size limits the number of render batches.
+		RenderScheduler::Partition(10u, 8u, 4u, batches);
+		MAGE_CHECK(2u == batches.size());
+		MAGE_CHECK( 0u == batches[0].m_begin &&  5u == batches[0].m_end);
+		MAGE_CHECK( 5u == batches[1].m_begin && 10u == batches[1].m_end);
+
+		RenderScheduler::Partition(3u, 8u, 4u, batches);
+		MAGE_CHECK(1u == batches.size());
+		MAGE_CHECK( 0u == batches[0].m_begin &&  3u == batches[0].m_end);
+
+		RenderScheduler::Partition(5u, 8u, 0u, batches);
+		MAGE_CHECK(5u == batches.size());
+		for (size_t i = 0u; i < batches.size(); ++i) {
+			MAGE_CHECK(i == batches[i].m_begin && i + 1u == batches[i].m_end);
+		}
+
+		RenderScheduler::Partition(0u, 8u, 1u, batches);
+		MAGE_CHECK(batches.empty());
+	}
+
+	MAGE_TEST(RenderSchedulerRecordsBatchesInOrder) {
+		GetEngine();
+		const RenderingManager * const rendering_manager
+			= RenderingManager::Get();
+
+		RenderScheduler scheduler(rendering_manager->GetDevice(),
+			rendering_manager->GetDeviceContext(), 3u);
+		const size_t nb_workers = scheduler.GetNumberOfWorkers();
+		MAGE_CHECK(0u < nb_workers);
+
+		// The number of items and the minimum number of items per render
+		// batch.
+		const pair< size_t, size_t > cases[] = {
+			{ 10u, 2u }, { 10u, 6u }, { 1u, 1u }, { 0u, 1u }
+		};
+
+		vector< RenderBatch > batches;
+		for (const auto &[nb_items, min_batch_size] : cases) {
+			RenderScheduler::Partition(nb_items, nb_workers,
+				min_batch_size, batches);
+			CheckRecordedBatches(
+				RecordItems(scheduler, nb_items, min_batch_size), batches);
+		}
+
+		scheduler.EndFrame();
+	}
+
+	MAGE_TEST(RenderSchedulerRecordsWithoutWorkers) {
+		GetEngine();
+		const RenderingManager * const rendering_manager
+			= RenderingManager::Get();
+
+		RenderScheduler scheduler(rendering_manager->GetDevice(),
+			rendering_manager->GetDeviceContext(), 0u);
+		MAGE_CHECK(0u == scheduler.GetNumberOfWorkers());
+
+		// All items are recorded on the immediate device context.
+		CheckRecordedBatches(RecordItems(scheduler, 10u, 1u), { { 0u, 10u } });
+
+		scheduler.EndFrame();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "resource\resource_pool.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
+#include <thread>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 A class of test resources which count their creations and which can only
+	 be created once a gate is opened.
+	 */
+	class TestResource {
+
+	public:
+
+		/**
+		 Constructs a test resource.
+
+		 @param[in]		nb_creations
+						A pointer to the number of creations.
+		 @param[in]		gate
+						The future of the gate which must be opened before
+						the test resource can be created.
+		 @param[in]		fail
+						A flag indicating whether the creation fails.
+		 @throws		FormattedException
+						@a fail is @c true.
+		 */
+		explicit TestResource(std::atomic< size_t > *nb_creations,
+			std::shared_future< void > gate, bool fail) {
+
+			++(*nb_creations);
+			gate.wait();
+
+			if (fail) {
+				throw FormattedException("Failed to create the test resource.");
+			}
+		}
+
+		/**
+		 Destructs this test resource.
+		 */
+		virtual ~TestResource() = default;
+	};
+
+	/**
+	 The resource pool type of the resource pool tests.
+	 */
+	using TestResourcePool = ResourcePool< string, TestResource >;
+
+	MAGE_TEST(ResourcePoolCreatesConcurrentRequestsOnce) {
+		ThreadPool thread_pool(4u);
+		TestResourcePool resource_pool;
+		std::atomic< size_t > nb_creations(0u);
+
+		std::promise< void > gate;
+		const auto gate_future = gate.get_future().share();
+
+		// All requests are issued while the resource is still being created.
+		vector< TestResourcePool::ResourceFuture > futures;
+		for (size_t i = 0u; i < 8u; ++i) {
+			futures.push_back(resource_pool.GetOrCreateResourceAsync(
+				thread_pool, "resource", &nb_creations, gate_future, false));
+		}
+
+		SharedPtr< TestResource > resources[2];
+		std::thread threads[2];
+		for (size_t i = 0u; i < _countof(threads); ++i) {
+			threads[i] = std::thread([&resource_pool, &resources, &nb_creations,
+				                      &gate_future, i]() {
+				resources[i] = resource_pool.GetOrCreateResource(
+					"resource", &nb_creations, gate_future, false);
+			});
+		}
+
+		gate.set_value();
+		for (auto &thread : threads) {
+			thread.join();
+		}
+
+		const auto resource = futures[0].get();
+		MAGE_CHECK(resource);
+		for (auto &future : futures) {
+			MAGE_CHECK(resource == future.get());
+		}
+		for (const auto &thread_resource : resources) {
+			MAGE_CHECK(resource == thread_resource);
+		}
+
+		MAGE_CHECK(1u == nb_creations);
+		MAGE_CHECK(1u == resource_pool.GetNumberOfResources());
+		MAGE_CHECK(resource == resource_pool.GetResource("resource"));
+
+		// Requests for a created resource do not create it again.
+		MAGE_CHECK(resource == resource_pool.GetOrCreateResourceAsync(
+			thread_pool, "resource", &nb_creations, gate_future, false).get());
+		MAGE_CHECK(1u == nb_creations);
+	}
+
+	MAGE_TEST(ResourcePoolPropagatesCreationFailures) {
+		ThreadPool thread_pool(4u);
+		TestResourcePool resource_pool;
+		std::atomic< size_t > nb_creations(0u);
+
+		std::promise< void > gate;
+		const auto gate_future = gate.get_future().share();
+
+		vector< TestResourcePool::ResourceFuture > futures;
+		for (size_t i = 0u; i < 8u; ++i) {
+			futures.push_back(resource_pool.GetOrCreateResourceAsync(
+				thread_pool, "resource", &nb_creations, gate_future, true));
+		}
+
+		gate.set_value();
+
+		// The failure reaches every waiter.
+		for (auto &future : futures) {
+			bool failed = false;
+			try {
+				future.get();
+			}
+			catch (const FormattedException &) {
+				failed = true;
+			}
+			MAGE_CHECK(failed);
+		}
+
+		MAGE_CHECK(1u == nb_creations);
+		MAGE_CHECK(!resource_pool.HasResource("resource"));
+
+		// The pending resource is removed, so a later request retries.
+		const auto resource = resource_pool.GetOrCreateResourceAsync(
+			thread_pool, "resource", &nb_creations, gate_future, false).get();
+		MAGE_CHECK(resource);
+		MAGE_CHECK(2u == nb_creations);
+		MAGE_CHECK(resource_pool.HasResource("resource"));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstdio>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 The number of nodes of the scene benchmark.
+	 */
+	constexpr size_t g_scene_benchmark_nb_nodes = 50000u;
+
+	/**
+	 The number of nodes terminated per frame by the scene benchmark.
+	 */
+	constexpr size_t g_scene_benchmark_nb_terminated_nodes = 16u;
+
+	/**
+	 A class of scenes for the scene tests.
+	 */
+	class TestScene final : public Scene {
+
+	public:
+
+		/**
+		 Constructs a test scene.
+		 */
+		TestScene()
+			: Scene("test") {}
+	};
+
+	/**
+	 Creates a test scene with the given number of light nodes.
+
+	 @param[in]		nb_nodes
+					The number of light nodes.
+	 @return		A pointer to the test scene.
+	 */
+	inline UniquePtr< Scene > CreateTestScene(size_t nb_nodes) {
+		// The scene fog and sky require the resource manager.
+		GetEngine();
+
+		UniquePtr< Scene > scene = MakeUnique< TestScene >();
+		scene->Initialize();
+
+		for (size_t i = 0u; i < nb_nodes; ++i) {
+			if (0u == i % 2u) {
+				scene->Create< OmniLightNode >();
+			}
+			else {
+				scene->Create< SpotLightNode >();
+			}
+		}
+
+		return scene;
+	}
+
+	/**
+	 Runs a frame of the scene benchmark: the light nodes are traversed, some
+	 of them are terminated, and the scene is compacted.
+
+	 @param[in]		scene
+					A reference to the scene.
+	 @return		The number of traversed light nodes.
+	 */
+	inline size_t RunFrame(Scene &scene) {
+		size_t nb_nodes = 0u;
+		size_t nb_terminated = 0u;
+
+		scene.ForEachLight([&nb_nodes, &nb_terminated](Node *node) {
+			++nb_nodes;
+			if (nb_terminated < g_scene_benchmark_nb_terminated_nodes
+				&& 0u == nb_nodes % 1000u) {
+
+				node->Terminate();
+				++nb_terminated;
+			}
+		});
+
+		scene.Compact();
+
+		return nb_nodes;
+	}
+
+	MAGE_TEST(SceneCompactRemovesTerminatedNodes) {
+		UniquePtr< Scene > scene = CreateTestScene(4000u);
+
+		MAGE_CHECK(4000u == RunFrame(*scene));
+		MAGE_CHECK(3996u == RunFrame(*scene));
+
+		size_t nb_nodes = 0u;
+		scene->ForEachLight([&nb_nodes](Node *node) {
+			MAGE_CHECK(!node->IsTerminated());
+			++nb_nodes;
+		}, true);
+		MAGE_CHECK(3993u == nb_nodes);
+
+		scene->Uninitialize();
+	}
+
+	MAGE_BENCHMARK(SceneTraversalBenchmark) {
+		constexpr size_t nb_frames = 100u;
+
+		UniquePtr< Scene > scene = CreateTestScene(g_scene_benchmark_nb_nodes);
+
+		// Warm up.
+		RunFrame(*scene);
+
+		Timer timer;
+		size_t nb_nodes = 0u;
+
+		const size_t nb_allocations = GetNumberOfAllocations();
+		timer.Restart();
+		for (size_t i = 0u; i < nb_frames; ++i) {
+			nb_nodes += RunFrame(*scene);
+		}
+		timer.Stop();
+		const size_t nb_frame_allocations
+			= GetNumberOfAllocations() - nb_allocations;
+
+		Report("Traverse and compact 50k nodes", timer.GetTotalDeltaTime(),
+			nb_frames);
+		std::printf("  %zu nodes traversed, %zu heap allocations\n",
+			nb_nodes, nb_frame_allocations);
+
+		// Traversing and compacting must not allocate.
+		MAGE_CHECK(0u == nb_frame_allocations);
+
+		scene->Uninitialize();
+	}
+}
\ No newline at end of file
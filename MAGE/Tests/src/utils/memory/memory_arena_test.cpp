@@ -0,0 +1,82 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "utils\memory\memory_arena.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 The block size in bytes of the memory arenas of the memory arena tests.
+	 */
+	constexpr size_t g_memory_arena_test_block_size = 1u << 16u;
+
+	MAGE_TEST(ArenaVectorAllocatesOnMemoryArena) {
+		MemoryArena arena(g_memory_arena_test_block_size, 16u);
+
+		ArenaVector< U32 > v;
+		RebindArenaVector(v, &arena);
+		for (U32 i = 0u; i < 100u; ++i) {
+			v.push_back(i);
+		}
+
+		MAGE_CHECK(100u == v.size());
+		MAGE_CHECK(100u * sizeof(U32) <= arena.GetAllocatedSize());
+		for (U32 i = 0u; i < 100u; ++i) {
+			MAGE_CHECK(i == v[i]);
+		}
+
+		// Rebinding keeps the capacity but not the elements.
+		const size_t capacity = v.capacity();
+		RebindArenaVector(v, &arena);
+		MAGE_CHECK(v.empty());
+		MAGE_CHECK(capacity <= v.capacity());
+	}
+
+	MAGE_TEST(ArenaVectorWithoutMemoryArenaUsesHeap) {
+		ArenaVector< U32 > v;
+		RebindArenaVector(v, nullptr);
+
+		const size_t nb_allocations = GetNumberOfAllocations();
+		v.push_back(1u);
+		MAGE_CHECK(nb_allocations < GetNumberOfAllocations());
+		MAGE_CHECK(1u == v.front());
+	}
+
+	MAGE_TEST(DoubleBufferedArenaVectorsDoNotAllocate) {
+		constexpr size_t nb_frames = 16u;
+		constexpr size_t nb_warm_up_frames = 4u;
+
+		MemoryArena arenas[2] = {
+			MemoryArena(g_memory_arena_test_block_size, 16u),
+			MemoryArena(g_memory_arena_test_block_size, 16u)
+		};
+		ArenaVector< U32 > v;
+
+		size_t nb_allocations = 0u;
+		for (size_t frame = 0u; frame < nb_frames; ++frame) {
+			if (nb_warm_up_frames == frame) {
+				nb_allocations = GetNumberOfAllocations();
+			}
+
+			// Swap and reset the memory arenas as the rendering manager does.
+			MemoryArena &arena = arenas[frame % 2u];
+			arena.Reset();
+			RebindArenaVector(v, &arena);
+
+			for (U32 i = 0u; i < 1000u; ++i) {
+				v.push_back(i);
+			}
+			MAGE_CHECK(1000u == v.size());
+		}
+
+		MAGE_CHECK(nb_allocations == GetNumberOfAllocations());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,169 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "core\test.hpp"
+#include "utils\string\token.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 The number of values of the token benchmark.
+	 */
+	constexpr size_t g_token_benchmark_nb_values = 1000000u;
+
+	/**
+	 Generates a string of random space-separated @c F32 values in various
+	 notations.
+
+	 @param[in]		nb_values
+					The number of values.
+	 @return		The string of values.
+	 */
+	inline const string GenerateF32Values(size_t nb_values) {
+		std::mt19937 generator(11u);
+		std::uniform_real_distribution< F32 > value(-1000.0f, 1000.0f);
+		std::uniform_int_distribution< int > exponent(-30, 30);
+
+		static const char * const formats[] = { "%f", "%.9g", "%.3e", "%g" };
+
+		string str;
+		str.reserve(16u * nb_values);
+		char buffer[64];
+		for (size_t i = 0u; i < nb_values; ++i) {
+			const F32 f = (0u == i % 8u)
+				? value(generator) * std::pow(10.0f, static_cast< F32 >(exponent(generator)))
+				: value(generator);
+			std::snprintf(buffer, _countof(buffer), formats[i % _countof(formats)], f);
+			str += buffer;
+			str += ' ';
+		}
+
+		return str;
+	}
+
+	MAGE_TEST(ScanF32MatchesStrtof) {
+		const string str = GenerateF32Values(10000u);
+
+		const char *it         = str.c_str();
+		const char * const end = str.c_str() + str.size();
+		while (it != end) {
+			char *strtof_it = nullptr;
+			const F32 expected = std::strtof(it, &strtof_it);
+
+			F32 result;
+			MAGE_CHECK(TokenResult::Valid == ScanF32(it, end, result));
+			MAGE_CHECK(strtof_it == it);
+			// Allow a rounding difference of one unit in the last place.
+			MAGE_CHECK(expected == result
+				    || std::nextafter(expected,  INFINITY) == result
+				    || std::nextafter(expected, -INFINITY) == result);
+
+			MAGE_CHECK(' ' == *it);
+			++it;
+		}
+	}
+
+	MAGE_TEST(ScanF32ClampsExponents) {
+		const auto scan = [](const char *str, F32 &result) {
+			const char *it         = str;
+			const char * const end = str + std::strlen(str);
+			MAGE_CHECK(TokenResult::Valid == ScanF32(it, end, result));
+			MAGE_CHECK(end == it);
+		};
+
+		F32 result;
+		scan("1e2147483647", result);
+		MAGE_CHECK(std::isinf(result) && 0.0f < result);
+		scan("-1e2147483647", result);
+		MAGE_CHECK(std::isinf(result) && 0.0f > result);
+		scan("0.5e-2147483648", result);
+		MAGE_CHECK(0.0f == result);
+		scan("123456789012345678901234567890e-2147483648", result);
+		MAGE_CHECK(0.0f == result);
+		scan("1.5e3", result);
+		MAGE_CHECK(1500.0f == result);
+	}
+
+	MAGE_TEST(ScanF32RejectsOverlongTokens) {
+		// A token of 63 characters (too many digits for an exact mantissa)
+		// falling back to strtof.
+		const string fitting = "1." + string(61u, '0');
+		const char *it = fitting.c_str();
+		F32 result;
+		MAGE_CHECK(TokenResult::Valid
+			== ScanF32(it, fitting.c_str() + fitting.size(), result));
+		MAGE_CHECK(fitting.c_str() + fitting.size() == it);
+		MAGE_CHECK(1.0f == result);
+
+		// A token not fitting the fallback buffer is neither truncated nor
+		// partially consumed.
+		const string overlong = "1." + string(68u, '0') + " 1";
+		it = overlong.c_str();
+		MAGE_CHECK(TokenResult::Invalid
+			== ScanF32(it, overlong.c_str() + overlong.size(), result));
+		MAGE_CHECK(overlong.c_str() == it);
+	}
+
+	MAGE_BENCHMARK(ScanF32Benchmark) {
+		constexpr size_t nb_iterations = 10u;
+
+		const string str = GenerateF32Values(g_token_benchmark_nb_values);
+		const char * const begin = str.c_str();
+		const char * const end   = str.c_str() + str.size();
+		const F64 nb_megabytes   = nb_iterations * str.size() / 1000000.0;
+
+		Timer timer;
+		size_t nb_scan_values   = 0u;
+		size_t nb_strtof_values = 0u;
+
+		timer.Restart();
+		for (size_t j = 0u; j < nb_iterations; ++j) {
+			for (const char *it = begin; it != end; ++it) {
+				F32 result;
+				nb_scan_values
+					+= (TokenResult::Valid == ScanF32(it, end, result)) ? 1u : 0u;
+			}
+		}
+		timer.Stop();
+		const F64 time_scan = timer.GetTotalDeltaTime();
+		Report("ScanF32", time_scan, nb_iterations);
+
+		timer.Restart();
+		for (size_t j = 0u; j < nb_iterations; ++j) {
+			for (const char *it = begin; it != end; ++it) {
+				char *next = nullptr;
+				std::strtof(it, &next);
+				nb_strtof_values += (it != next) ? 1u : 0u;
+				it = next;
+			}
+		}
+		timer.Stop();
+		const F64 time_strtof = timer.GetTotalDeltaTime();
+		Report("strtof", time_strtof, nb_iterations);
+
+		std::printf("  ScanF32: %.1f MB/s, strtof: %.1f MB/s (%.1f MB)\n",
+			nb_megabytes / time_scan, nb_megabytes / time_strtof,
+			str.size() / 1000000.0);
+		MAGE_CHECK(nb_scan_values == nb_strtof_values);
+	}
+}
\ No newline at end of file